@@ -0,0 +1,148 @@
+/*
+    ARGPX_ATTR_ABBREVIATION with 10, 1k and 100k flags like "--flag-name-N-value", in hash mode.
+    1000 random arguments of the whole names, then of "--flag-name-N-v", then an unknown one. And a scan of every name
+    for the abbreviations, the way getopt_long() finds them.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <iso646.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "argpx/argpx.h"
+
+#define BM_ARG_COUNT 1000
+#define BM_LOOKUP_TOTAL (5 * 1000 * 1000)
+// the scan of 100k names is slow, it's timed on fewer
+#define BM_SCAN_TOTAL (20 * 1000)
+
+static double NowNs_(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double Parse_(struct ArgpxParser *parser, struct ArgpxParseOption *opt, char **arg_v)
+{
+    struct ArgpxResult res;
+    double start = NowNs_();
+    for (int i = 0; i < BM_LOOKUP_TOTAL / BM_ARG_COUNT; i++) {
+        if (ArgpxParseCompiled(&res, BM_ARG_COUNT, arg_v, parser, opt) != kArgpxStatusSuccess) {
+            printf("ArgParseX error: %s\n", ArgpxStatusString(res.status));
+            exit(EXIT_FAILURE);
+        }
+        ArgpxResultFree(&res);
+    }
+    return (NowNs_() - start) / BM_LOOKUP_TOTAL;
+}
+
+/*
+    The unique flag starting with name, like the loop of getopt_long().
+ */
+static int Scan_(struct ArgpxFlagSet *flag, const char *name)
+{
+    size_t name_len = strlen(name);
+    int found = -1;
+    for (int i = 0; i < flag->count; i++) {
+        if (strncmp(flag->ptr[i].name, name, name_len) != 0)
+            continue;
+        if (found >= 0)
+            return -1;
+        found = i;
+    }
+    return found;
+}
+
+// the results go here, so nothing is optimized out
+static volatile int bm_sink;
+
+static void Run_(int flag_c)
+{
+    struct ArgpxStyle style = ARGPX_STYLE_INIT;
+    ArgpxGroupAppend(&style, &(struct ArgpxGroup){
+        .prefix = "--",
+        .assigner = "=",
+        .delimiter = ",",
+        .attribute = ARGPX_ATTR_ABBREVIATION,
+    });
+
+    char **name_v = malloc(sizeof(char *) * flag_c);
+    char **abbrev_v = malloc(sizeof(char *) * flag_c);
+    struct ArgpxFlagSet flag = ARGPX_FLAGSET_INIT;
+    for (int i = 0; i < flag_c; i++) {
+        name_v[i] = malloc(32);
+        abbrev_v[i] = malloc(32);
+        snprintf(name_v[i], 32, "--flag-name-%d-value", i);
+        snprintf(abbrev_v[i], 32, "--flag-name-%d-v", i);
+        ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+            .group_idx = 0,
+            .name = name_v[i] + 2,
+            .action_type = kArgpxActionCallbackOnly,
+        });
+    }
+
+    char *whole_v[BM_ARG_COUNT];
+    char *short_v[BM_ARG_COUNT];
+    srand(1);
+    for (int i = 0; i < BM_ARG_COUNT; i++) {
+        int n = rand() % flag_c;
+        whole_v[i] = name_v[n];
+        short_v[i] = abbrev_v[n];
+    }
+    char *miss_v[] = {"--flag-name-missing"};
+
+    struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    opt.use_hash = true;
+
+    double start = NowNs_();
+    struct ArgpxParser *parser;
+    if (ArgpxCompile(&parser, &style, &flag, &opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX compile error\n");
+        exit(EXIT_FAILURE);
+    }
+    double compile_ns = NowNs_() - start;
+
+    double whole_ns = Parse_(parser, &opt, whole_v);
+    double short_ns = Parse_(parser, &opt, short_v);
+
+    struct ArgpxResult res;
+    start = NowNs_();
+    for (int i = 0; i < BM_LOOKUP_TOTAL / 10; i++) {
+        ArgpxParseCompiled(&res, 1, miss_v, parser, &opt);
+        ArgpxResultFree(&res);
+    }
+    double miss_ns = (NowNs_() - start) / (BM_LOOKUP_TOTAL / 10);
+
+    int scan_c = flag_c >= 100 * 1000 ? BM_SCAN_TOTAL / 100 : BM_SCAN_TOTAL;
+    start = NowNs_();
+    for (int i = 0; i < scan_c; i++)
+        bm_sink = Scan_(&flag, short_v[i % BM_ARG_COUNT] + 2);
+    double scan_ns = (NowNs_() - start) / scan_c;
+
+    printf("flags: %6d, compile: %10.0f ns, whole: %6.1f ns/arg, abbreviation: %6.1f ns/arg, miss: %6.1f ns/parse, "
+           "scan: %10.1f ns/arg\n",
+        flag_c, compile_ns, whole_ns, short_ns, miss_ns, scan_ns);
+
+    ArgpxParserFree(parser);
+    for (int i = 0; i < flag_c; i++) {
+        free(name_v[i]);
+        free(abbrev_v[i]);
+    }
+    free(name_v);
+    free(abbrev_v);
+    ArgpxStyleFree(&style);
+    ArgpxFlagFree(&flag);
+}
+
+int main(void)
+{
+    Run_(10);
+    Run_(1000);
+    Run_(100 * 1000);
+
+    return 0;
+}
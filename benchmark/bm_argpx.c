@@ -70,10 +70,16 @@ int main(void)
 
     // clang-format on
 
+    struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    struct ArgpxParser *parser;
+    if (ArgpxCompile(&parser, &style, &flag, &opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX compile error\n");
+        exit(EXIT_FAILURE);
+    }
+
     for (int i = 0; i < 10 * 1000 * 1000; i++) {
-        struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
         struct ArgpxResult res;
-        if (ArgpxParse(&res, bm_argc, bm_argv, &style, &flag, &opt) != kArgpxStatusSuccess) {
+        if (ArgpxParseCompiled(&res, bm_argc, bm_argv, parser, &opt) != kArgpxStatusSuccess) {
             printf("ArgParseX error: %s\n", ArgpxStatusString(res.status));
             printf("on '%s'\n", res.current_argv_ptr);
             exit(EXIT_FAILURE);
@@ -84,6 +90,7 @@ int main(void)
         free(ans.f_param_of_c);
     }
 
+    ArgpxParserFree(parser);
     ArgpxStyleFree(&style);
     ArgpxFlagFree(&flag);
 
@@ -0,0 +1,189 @@
+/*
+    ArgpxParseBatch() with 1, 2, 4... threads, up to the online CPU count, against a serial loop.
+    The outputs are bound(.bind_offset) to a record of each vector, so the shared flag set is never written.
+    A lazy one too, each record converts its own.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <iso646.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "argpx/argpx.h"
+
+#define BM_ITEM_COUNT (200 * 1000)
+#define BM_ROUND 5
+
+static double NowNs_(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+struct BmRecord_ {
+    int retry;
+    bool verbose;
+    struct ArgpxOutParamLazy timeout;
+};
+
+static void Check_(struct ArgpxBatchItem *item_v, struct BmRecord_ *record_v)
+{
+    for (int i = 0; i < BM_ITEM_COUNT; i++) {
+        // "param" and the i % 4 "extra" ones, the last "--timeout" is the i % 4 one and converted in its own record
+        struct ArgpxOutParamLazy *timeout = &record_v[i].timeout;
+        if (item_v[i].res.status != kArgpxStatusSuccess or item_v[i].res.param_c != 1 + i % 4
+            or record_v[i].retry != 7 or record_v[i].verbose != true or ArgpxOutParamLazyGet(timeout) != 0
+            or timeout->var_ptr != &timeout->value or timeout->value.as_int != i % 4)
+        {
+            printf("item %d: wrong result\n", i);
+            exit(EXIT_FAILURE);
+        }
+        ArgpxResultFree(&item_v[i].res);
+        record_v[i] = (struct BmRecord_){.retry = 0, .verbose = false, .timeout = {.raw = {.ptr = NULL}}};
+    }
+}
+
+/*
+    Without .bind_offset, a parameter action would write the shared flag set, so the batch refuses it.
+ */
+static void CheckUnbound_(struct ArgpxStyle *style)
+{
+    int retry = 0;
+    struct ArgpxFlagSet flag = ARGPX_FLAGSET_INIT;
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "retry",
+        .action_type = kArgpxActionParamSingle,
+        .action_load.param_single = {.type = kArgpxVarInt, .var_ptr = &retry},
+    });
+
+    struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    struct ArgpxParser *parser;
+    if (ArgpxCompile(&parser, style, &flag, &opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX compile error\n");
+        exit(EXIT_FAILURE);
+    }
+
+    char *arg_v[] = {"--retry=7"};
+    struct ArgpxBatchItem item = {.arg_c = 1, .arg_v = arg_v, .res = ARGPX_RESULT_INIT};
+    if (ArgpxParseBatch(NULL, &item, 1, parser, &opt) != kArgpxStatusConfigInvalid
+        or item.res.status != kArgpxStatusConfigInvalid or retry != 0)
+    {
+        printf("unbound flag: not refused\n");
+        exit(EXIT_FAILURE);
+    }
+
+    ArgpxResultFree(&item.res);
+    ArgpxParserFree(parser);
+    ArgpxFlagFree(&flag);
+}
+
+int main(void)
+{
+    struct ArgpxStyle style = ARGPX_STYLE_INIT;
+    ArgpxGroupAppend(&style, ARGPX_GROUP_GNU);
+    ArgpxGroupAppend(&style, ARGPX_GROUP_UNIX);
+    ArgpxSymbolAppend(&style, ARGPX_SYMBOL_STOP_PARSING("--"));
+    CheckUnbound_(&style);
+
+    char *name_v[] = {"config", "log-level", "quiet", "dry-run"};
+    struct ArgpxFlagSet flag = ARGPX_FLAGSET_INIT;
+    for (size_t i = 0; i < sizeof(name_v) / sizeof(char *); i++) {
+        ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+            .group_idx = 0,
+            .name = name_v[i],
+            .action_type = kArgpxActionCallbackOnly,
+        });
+    }
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "verbose",
+        .action_type = kArgpxActionSetBool,
+        .action_load.set_bool = {.source = true},
+        ARGPX_BIND_OFFSET(struct BmRecord_, verbose),
+    });
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "retry",
+        .action_type = kArgpxActionParamSingle,
+        .action_load.param_single = {.type = kArgpxVarInt},
+        ARGPX_BIND_OFFSET(struct BmRecord_, retry),
+    });
+    // the variable of the flag is never written in the batch
+    int shared_timeout = -1;
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "timeout",
+        .action_type = kArgpxActionParamLazy,
+        .action_load.param_lazy = {.type = kArgpxVarInt, .var_ptr = &shared_timeout},
+        ARGPX_BIND_OFFSET(struct BmRecord_, timeout),
+    });
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){.group_idx = 1, .name = "a", .action_type = kArgpxActionCallbackOnly});
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){.group_idx = 1, .name = "b", .action_type = kArgpxActionCallbackOnly});
+
+    struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    struct ArgpxParser *parser;
+    if (ArgpxCompile(&parser, &style, &flag, &opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX compile error\n");
+        exit(EXIT_FAILURE);
+    }
+
+    static char *sample_v[] = {
+        "--config", "-ab", "--timeout=0", "--verbose", "param", "--log-level", "--retry=7", "--quiet",
+        "extra", "--timeout=1", "extra", "--timeout=2", "extra", "--timeout=3",
+    };
+    struct ArgpxBatchItem *item_v = malloc(sizeof(struct ArgpxBatchItem) * BM_ITEM_COUNT);
+    struct BmRecord_ *record_v = calloc(BM_ITEM_COUNT, sizeof(struct BmRecord_));
+    for (int i = 0; i < BM_ITEM_COUNT; i++) {
+        item_v[i] = (struct ArgpxBatchItem){
+            .arg_c = 8 + i % 4 * 2,
+            .arg_v = sample_v,
+            .out_base = &record_v[i],
+            .res = ARGPX_RESULT_INIT,
+        };
+    }
+
+    double start = NowNs_();
+    for (int r = 0; r < BM_ROUND; r++) {
+        ArgpxParseBatch(NULL, item_v, BM_ITEM_COUNT, parser, &opt);
+        Check_(item_v, record_v);
+    }
+    double serial_ns = (NowNs_() - start) / BM_ROUND;
+    printf("serial:     %8.2f ms/batch\n", serial_ns / 1e6);
+
+    long cpu_c = sysconf(_SC_NPROCESSORS_ONLN);
+    for (int thread_c = 1; thread_c <= cpu_c; thread_c *= 2) {
+        struct ArgpxPool *pool;
+        if (ArgpxPoolCreate(&pool, thread_c, NULL) != kArgpxStatusSuccess) {
+            printf("ArgParseX pool error\n");
+            exit(EXIT_FAILURE);
+        }
+
+        start = NowNs_();
+        for (int r = 0; r < BM_ROUND; r++) {
+            ArgpxParseBatch(pool, item_v, BM_ITEM_COUNT, parser, &opt);
+            Check_(item_v, record_v);
+        }
+        double pool_ns = (NowNs_() - start) / BM_ROUND;
+        printf("threads %3d: %8.2f ms/batch, x%.2f\n", thread_c, pool_ns / 1e6, serial_ns / pool_ns);
+
+        ArgpxPoolFree(pool);
+    }
+
+    if (shared_timeout != -1) {
+        printf("the variable of --timeout is written\n");
+        exit(EXIT_FAILURE);
+    }
+
+    free(record_v);
+    free(item_v);
+    ArgpxParserFree(parser);
+    ArgpxStyleFree(&style);
+    ArgpxFlagFree(&flag);
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+    ArgpxParseEnv() with an empty argv against a getenv() and strtol() of every bound variable, the way a program
+    usually reads its environment. 30, 300 and 3k int flags bound to "APP_OPTION_N", and an environment of 100
+    unrelated variables like a shell has, with a tenth of the bound ones set.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <iso646.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "argpx/argpx.h"
+
+// the parse count is this over the flag count, the getenv() loop of 3k flags is slow
+#define BM_PARSE_TOTAL (60 * 1000)
+// the best of the rounds, the machine is noisy
+#define BM_ROUND 5
+#define BM_OTHER_COUNT 100
+#define BM_NAME_SIZE 32
+
+static double NowNs_(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*
+    The loop of getenv(), on env_v instead of the environ of the process.
+ */
+static char *GetEnv_(char **env_v, const char *name)
+{
+    size_t name_len = strlen(name);
+    for (int i = 0; env_v[i] != NULL; i++) {
+        if (strncmp(env_v[i], name, name_len) == 0 and env_v[i][name_len] == '=')
+            return env_v[i] + name_len + 1;
+    }
+    return NULL;
+}
+
+static void Run_(int flag_c)
+{
+    struct ArgpxStyle style = ARGPX_STYLE_INIT;
+    ArgpxGroupAppend(&style, ARGPX_GROUP_GNU);
+
+    char(*name_v)[BM_NAME_SIZE] = malloc(BM_NAME_SIZE * flag_c);
+    char(*env_name_v)[BM_NAME_SIZE] = malloc(BM_NAME_SIZE * flag_c);
+    int *value_v = calloc(flag_c, sizeof(int));
+    struct ArgpxFlagSet flag = ARGPX_FLAGSET_INIT;
+    for (int i = 0; i < flag_c; i++) {
+        snprintf(name_v[i], BM_NAME_SIZE, "option-%d", i);
+        snprintf(env_name_v[i], BM_NAME_SIZE, "APP_OPTION_%d", i);
+        ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+            .group_idx = 0,
+            .name = name_v[i],
+            .env_name = env_name_v[i],
+            .action_type = kArgpxActionParamSingle,
+            .action_load.param_single = {.type = kArgpxVarInt, .var_ptr = &value_v[i]},
+        });
+    }
+
+    // the unrelated ones, then every 10th bound one, shuffled
+    int set_c = flag_c / 10;
+    int env_c = BM_OTHER_COUNT + set_c;
+    char(*entry_v)[BM_NAME_SIZE] = malloc(BM_NAME_SIZE * env_c);
+    char **env_v = malloc(sizeof(char *) * (env_c + 1));
+    for (int i = 0; i < BM_OTHER_COUNT; i++)
+        snprintf(entry_v[i], BM_NAME_SIZE, "XDG_DIR_%d=/usr/share/%d", i, i);
+    for (int i = 0; i < set_c; i++)
+        snprintf(entry_v[BM_OTHER_COUNT + i], BM_NAME_SIZE, "APP_OPTION_%d=%d", i * 10, i);
+    srand(1);
+    for (int i = 0; i < env_c; i++)
+        env_v[i] = entry_v[i];
+    for (int i = env_c - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        char *tmp = env_v[i];
+        env_v[i] = env_v[j];
+        env_v[j] = tmp;
+    }
+    env_v[env_c] = NULL;
+
+    struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    struct ArgpxParser *parser;
+    if (ArgpxCompile(&parser, &style, &flag, &opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX compile error\n");
+        exit(EXIT_FAILURE);
+    }
+
+    char *arg_v[] = {NULL};
+    int parse_c = BM_PARSE_TOTAL / flag_c;
+    double getenv_ns = 0;
+    double argpx_ns = 0;
+    for (int r = 0; r < BM_ROUND; r++) {
+        double start = NowNs_();
+        for (int n = 0; n < parse_c; n++) {
+            for (int i = 0; i < flag_c; i++) {
+                char *value = GetEnv_(env_v, env_name_v[i]);
+                if (value != NULL)
+                    value_v[i] = (int)strtol(value, NULL, 0);
+            }
+        }
+        double ns = (NowNs_() - start) / parse_c;
+        if (r == 0 or ns < getenv_ns)
+            getenv_ns = ns;
+
+        struct ArgpxResult res;
+        start = NowNs_();
+        for (int n = 0; n < parse_c; n++) {
+            if (ArgpxParseEnv(&res, 0, arg_v, env_v, parser, &opt) != kArgpxStatusSuccess) {
+                printf("ArgParseX error: %s\n", ArgpxStatusString(res.status));
+                exit(EXIT_FAILURE);
+            }
+            ArgpxResultFree(&res);
+        }
+        ns = (NowNs_() - start) / parse_c;
+        if (r == 0 or ns < argpx_ns)
+            argpx_ns = ns;
+    }
+
+    // the same values, or it's not worth timing
+    if (set_c > 0 and value_v[(set_c - 1) * 10] != set_c - 1) {
+        printf("wrong value of APP_OPTION_%d\n", (set_c - 1) * 10);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("%5d flags, %4d variables: getenv %9.2f us/parse, argpx %6.2f us/parse, x%.1f\n", flag_c, env_c,
+        getenv_ns / 1000, argpx_ns / 1000, getenv_ns / argpx_ns);
+
+    ArgpxParserFree(parser);
+    ArgpxStyleFree(&style);
+    ArgpxFlagFree(&flag);
+    free(name_v);
+    free(env_name_v);
+    free(value_v);
+    free(entry_v);
+    free(env_v);
+}
+
+int main(void)
+{
+    Run_(30);
+    Run_(300);
+    Run_(3000);
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+    Flag lookup in hash mode, with 10, 1k and 100k flags.
+    Every argument of the sample is a flag, so the parse time is almost all spent on lookup.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "argpx/argpx.h"
+
+#define BM_ARG_COUNT 1000
+#define BM_LOOKUP_TOTAL (20 * 1000 * 1000)
+
+static double NowNs_(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void Run_(int flag_c)
+{
+    struct ArgpxStyle style = ARGPX_STYLE_INIT;
+    ArgpxGroupAppend(&style, ARGPX_GROUP_GNU);
+
+    // the names are also used as arguments, with the "--" prefix
+    char **name_v = malloc(sizeof(char *) * flag_c);
+    struct ArgpxFlagSet flag = ARGPX_FLAGSET_INIT;
+    for (int i = 0; i < flag_c; i++) {
+        name_v[i] = malloc(32);
+        snprintf(name_v[i], 32, "--flag-name-%d", i);
+        ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+            .group_idx = 0,
+            .name = name_v[i] + 2,
+            .action_type = kArgpxActionCallbackOnly,
+        });
+    }
+
+    char *arg_v[BM_ARG_COUNT];
+    srand(1);
+    for (int i = 0; i < BM_ARG_COUNT; i++)
+        arg_v[i] = name_v[rand() % flag_c];
+    char *miss_v[] = {"--flag-name-missing"};
+
+    struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    opt.use_hash = true;
+
+    double start = NowNs_();
+    struct ArgpxParser *parser;
+    if (ArgpxCompile(&parser, &style, &flag, &opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX compile error\n");
+        exit(EXIT_FAILURE);
+    }
+    double compile_ns = NowNs_() - start;
+
+    struct ArgpxResult res;
+    start = NowNs_();
+    for (int i = 0; i < BM_LOOKUP_TOTAL / BM_ARG_COUNT; i++) {
+        if (ArgpxParseCompiled(&res, BM_ARG_COUNT, arg_v, parser, &opt) != kArgpxStatusSuccess) {
+            printf("ArgParseX error: %s\n", ArgpxStatusString(res.status));
+            exit(EXIT_FAILURE);
+        }
+        ArgpxResultFree(&res);
+    }
+    double hit_ns = (NowNs_() - start) / BM_LOOKUP_TOTAL;
+
+    start = NowNs_();
+    for (int i = 0; i < BM_LOOKUP_TOTAL / 10; i++) {
+        ArgpxParseCompiled(&res, 1, miss_v, parser, &opt);
+        ArgpxResultFree(&res);
+    }
+    double miss_ns = (NowNs_() - start) / (BM_LOOKUP_TOTAL / 10);
+
+    printf("flags: %6d, compile: %10.0f ns, hit: %6.1f ns/arg, miss: %6.1f ns/parse\n", flag_c, compile_ns, hit_ns,
+        miss_ns);
+
+    ArgpxParserFree(parser);
+    for (int i = 0; i < flag_c; i++)
+        free(name_v[i]);
+    free(name_v);
+    ArgpxStyleFree(&style);
+    ArgpxFlagFree(&flag);
+}
+
+int main(void)
+{
+    Run_(10);
+    Run_(1000);
+    Run_(100 * 1000);
+
+    return 0;
+}
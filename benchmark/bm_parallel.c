@@ -0,0 +1,125 @@
+/*
+    ArgpxParseParallel() on one argv of 500k arguments, with 1, 2, 4... threads up to the online CPU count, against
+    ArgpxParseCompiled(). It's a file list with a numeric flag every 4 arguments, like "--weight=0.25 file".
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <iso646.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "argpx/argpx.h"
+
+#define BM_ARG_COUNT (500 * 1000)
+// the best of the rounds, the machine is noisy
+#define BM_ROUND 5
+
+static double NowNs_(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double bm_weight;
+static int bm_level;
+static int bm_file_c = 0;
+
+static void Check_(struct ArgpxResult *res)
+{
+    if (res->status != kArgpxStatusSuccess or res->param_c != bm_file_c or bm_level != 9) {
+        printf("wrong result: %s, %d params\n", ArgpxStatusString(res->status), res->param_c);
+        exit(EXIT_FAILURE);
+    }
+    ArgpxResultFree(res);
+    bm_level = 0;
+}
+
+int main(void)
+{
+    struct ArgpxStyle style = ARGPX_STYLE_INIT;
+    ArgpxGroupAppend(&style, ARGPX_GROUP_GNU);
+    ArgpxSymbolAppend(&style, ARGPX_SYMBOL_STOP_PARSING("--"));
+
+    struct ArgpxFlagSet flag = ARGPX_FLAGSET_INIT;
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "weight",
+        .action_type = kArgpxActionParamSingle,
+        .action_load.param_single = {.type = kArgpxVarDouble, .var_ptr = &bm_weight},
+    });
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "level",
+        .action_type = kArgpxActionParamSingle,
+        .action_load.param_single = {.type = kArgpxVarInt, .var_ptr = &bm_level},
+    });
+
+    struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    struct ArgpxParser *parser;
+    if (ArgpxCompile(&parser, &style, &flag, &opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX compile error\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // --weight=<n>.25 src/dir<n>/file<n>.c ... and --level 9 at the end
+    char **arg_v = malloc(sizeof(char *) * BM_ARG_COUNT);
+    for (int i = 0; i < BM_ARG_COUNT - 4; i++) {
+        arg_v[i] = malloc(32);
+        if (i % 4 == 0)
+            snprintf(arg_v[i], 32, "--weight=%d.25", i % 1000);
+        else
+            snprintf(arg_v[i], 32, "src/dir%d/file%d.c", i % 97, i);
+        bm_file_c += i % 4 != 0;
+    }
+    char *tail_v[] = {"--level", "9", "last.c", "--"};
+    bm_file_c += 1;
+    for (int i = 0; i < 4; i++)
+        arg_v[BM_ARG_COUNT - 4 + i] = tail_v[i];
+
+    struct ArgpxResult res;
+    double serial_ns = 0;
+    for (int r = 0; r < BM_ROUND; r++) {
+        double start = NowNs_();
+        ArgpxParseCompiled(&res, BM_ARG_COUNT, arg_v, parser, &opt);
+        double ns = NowNs_() - start;
+        if (r == 0 or ns < serial_ns)
+            serial_ns = ns;
+        Check_(&res);
+    }
+    printf("serial:      %8.2f ms/argv, %.1f ns/arg\n", serial_ns / 1e6, serial_ns / BM_ARG_COUNT);
+
+    long cpu_c = sysconf(_SC_NPROCESSORS_ONLN);
+    for (int thread_c = 1; thread_c <= cpu_c; thread_c *= 2) {
+        struct ArgpxPool *pool;
+        if (ArgpxPoolCreate(&pool, thread_c, NULL) != kArgpxStatusSuccess) {
+            printf("ArgParseX pool error\n");
+            exit(EXIT_FAILURE);
+        }
+
+        double pool_ns = 0;
+        for (int r = 0; r < BM_ROUND; r++) {
+            double start = NowNs_();
+            ArgpxParseParallel(pool, &res, BM_ARG_COUNT, arg_v, parser, &opt);
+            double ns = NowNs_() - start;
+            if (r == 0 or ns < pool_ns)
+                pool_ns = ns;
+            Check_(&res);
+        }
+        printf("threads %3d: %8.2f ms/argv, x%.2f\n", thread_c, pool_ns / 1e6, serial_ns / pool_ns);
+
+        ArgpxPoolFree(pool);
+    }
+
+    for (int i = 0; i < BM_ARG_COUNT - 4; i++)
+        free(arg_v[i]);
+    free(arg_v);
+    ArgpxParserFree(parser);
+    ArgpxStyleFree(&style);
+    ArgpxFlagFree(&flag);
+
+    return 0;
+}
@@ -0,0 +1,433 @@
+/*
+    Scenarios against ArgParseX(linear and hash mode), glibc getopt_long() and argp_parse().
+    The result is a JSON array on stdout, one object for each scenario and parser:
+    {"scenario": ..., "parser": ..., "args": ..., "ns_per_arg": ..., "args_per_sec": ..., "allocs_per_parse": ...}
+
+    usage: bm_scenario.out [scenario name]
+
+    The allocations are counted by replacing malloc() and friends, it needs glibc(__libc_malloc()).
+    getopt_long() and argp_parse() permute the argv, so they parse a copy of the pointer array, and the copy is counted.
+ */
+
+#define _GNU_SOURCE
+
+#include <argp.h>
+#include <getopt.h>
+#include <iso646.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "argpx/argpx.h"
+
+// every measurement runs at least this long
+#define BM_MIN_NS (100 * 1000 * 1000)
+
+/*
+    Allocation counter
+ */
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+static unsigned long bm_alloc_c = 0;
+
+void *malloc(size_t size)
+{
+    bm_alloc_c += 1;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    bm_alloc_c += 1;
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    bm_alloc_c += 1;
+    return __libc_realloc(ptr, size);
+}
+
+void free(void *ptr)
+{
+    __libc_free(ptr);
+}
+
+static double NowNs_(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*
+    Scenario
+
+    All the flags take no parameter, except the "list" one.
+ */
+
+struct Scenario_ {
+    const char *name;
+    // argv[0] is the program name, it's not counted
+    int arg_c;
+    char **arg_v;
+
+    int long_c;
+    char **long_name_v;
+    // like "abc", no parameter
+    const char *short_str;
+    bool has_list;
+
+    struct ArgpxStyle style;
+    struct ArgpxFlagSet flag;
+    struct option *getopt_long_v;
+    struct argp_option *argp_option_v;
+};
+
+// the sink of all the outputs, so nothing is optimized away
+static unsigned long bm_sink = 0;
+
+static char *Format_(const char *fmt, int n)
+{
+    char buf[64];
+    snprintf(buf, sizeof(buf), fmt, n);
+    return strdup(buf);
+}
+
+static void SplitListFree_(char **piece_v, int piece_c)
+{
+    for (int i = 0; i < piece_c; i++)
+        free(piece_v[i]);
+    free(piece_v);
+}
+
+/*
+    The same work as kArgpxActionParamList, for getopt and argp.
+ */
+static void SplitList_(const char *arg)
+{
+    int piece_c = 1;
+    for (const char *p = arg; *p != '\0'; p++)
+        piece_c += *p == ',';
+
+    char **piece_v = malloc(sizeof(char *) * piece_c);
+    const char *start = arg;
+    for (int i = 0; i < piece_c; i++) {
+        const char *end = strchr(start, ',');
+        size_t len = end != NULL ? (size_t)(end - start) : strlen(start);
+        piece_v[i] = malloc(len + 1);
+        memcpy(piece_v[i], start, len);
+        piece_v[i][len] = '\0';
+        start += len + 1;
+    }
+
+    bm_sink += piece_c;
+    SplitListFree_(piece_v, piece_c);
+}
+
+static void CbList_(void *action_load, void *param)
+{
+    struct ArgpxOutParamList *out = action_load;
+    bm_sink += out->out_count;
+    ArgpxOutParamListFree(out);
+}
+
+static void ScenarioSetup_(struct Scenario_ *sc)
+{
+    // ArgParseX
+    sc->style = ARGPX_STYLE_INIT;
+    ArgpxGroupAppend(&sc->style, ARGPX_GROUP_GNU);
+    ArgpxGroupAppend(&sc->style, ARGPX_GROUP_UNIX);
+    ArgpxSymbolAppend(&sc->style, ARGPX_SYMBOL_STOP_PARSING("--"));
+
+    sc->flag = ARGPX_FLAGSET_INIT;
+    for (int i = 0; i < sc->long_c; i++) {
+        ArgpxFlagAppend(&sc->flag, &(struct ArgpxFlag){
+            .group_idx = 0,
+            .name = sc->long_name_v[i],
+            .action_type = kArgpxActionCallbackOnly,
+        });
+    }
+    size_t short_c = strlen(sc->short_str);
+    static char letter_v[256][2];
+    for (size_t i = 0; i < short_c; i++) {
+        unsigned char c = sc->short_str[i];
+        letter_v[c][0] = c;
+        ArgpxFlagAppend(&sc->flag, &(struct ArgpxFlag){
+            .group_idx = 1,
+            .name = letter_v[c],
+            .action_type = kArgpxActionCallbackOnly,
+        });
+    }
+    if (sc->has_list) {
+        ArgpxFlagAppend(&sc->flag, &(struct ArgpxFlag){
+            .group_idx = 0,
+            .name = "list",
+            .action_type = kArgpxActionParamList,
+            .callback = CbList_,
+        });
+    }
+
+    // getopt_long(), the index of the long options is the same as long_name_v, "list" is the last one
+    sc->getopt_long_v = calloc(sc->long_c + 2, sizeof(struct option));
+    for (int i = 0; i < sc->long_c; i++)
+        sc->getopt_long_v[i] = (struct option){sc->long_name_v[i], no_argument, NULL, 0};
+    if (sc->has_list)
+        sc->getopt_long_v[sc->long_c] = (struct option){"list", required_argument, NULL, 0};
+
+    // argp_parse(), the long ones use the key 1000 + index, "list" is 999
+    sc->argp_option_v = calloc(sc->long_c + short_c + 2, sizeof(struct argp_option));
+    int opt_c = 0;
+    for (int i = 0; i < sc->long_c; i++)
+        sc->argp_option_v[opt_c++] = (struct argp_option){.name = sc->long_name_v[i], .key = 1000 + i};
+    for (size_t i = 0; i < short_c; i++)
+        sc->argp_option_v[opt_c++] = (struct argp_option){.key = (unsigned char)sc->short_str[i]};
+    if (sc->has_list)
+        sc->argp_option_v[opt_c++] = (struct argp_option){.name = "list", .key = 999, .arg = "LIST"};
+}
+
+/*
+    Parsers, each parses the scenario once.
+ */
+
+static void ParseGetopt_(struct Scenario_ *sc, char **work_v)
+{
+    memcpy(work_v, sc->arg_v, sizeof(char *) * (sc->arg_c + 1));
+
+    optind = 0;
+    opterr = 0;
+    int long_idx;
+    int opt;
+    while ((opt = getopt_long(sc->arg_c + 1, work_v, sc->short_str, sc->getopt_long_v, &long_idx)) != -1) {
+        if (opt == 0 and long_idx == sc->long_c)
+            SplitList_(optarg);
+        else
+            bm_sink += opt;
+    }
+    bm_sink += sc->arg_c + 1 - optind;
+}
+
+static error_t ArgpParser_(int key, char *arg, struct argp_state *state)
+{
+    switch (key) {
+    case 999:
+        SplitList_(arg);
+        return 0;
+    case ARGP_KEY_ARG:
+        bm_sink += 1;
+        return 0;
+    default:
+        if (key >= 1000 or (key > 0 and key < 256)) {
+            bm_sink += key;
+            return 0;
+        }
+        return ARGP_ERR_UNKNOWN;
+    }
+}
+
+static void ParseArgp_(struct Scenario_ *sc, char **work_v)
+{
+    memcpy(work_v, sc->arg_v, sizeof(char *) * (sc->arg_c + 1));
+
+    struct argp argp = {.options = sc->argp_option_v, .parser = ArgpParser_};
+    if (argp_parse(&argp, sc->arg_c + 1, work_v, ARGP_SILENT, NULL, NULL) != 0) {
+        printf("argp error on %s\n", sc->name);
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void ParseArgpx_(struct Scenario_ *sc, struct ArgpxParser *parser, struct ArgpxParseOption *opt)
+{
+    struct ArgpxResult res;
+    if (ArgpxParseCompiled(&res, sc->arg_c, sc->arg_v + 1, parser, opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX error on %s: %s, '%s'\n", sc->name, ArgpxStatusString(res.status), res.current_argv_ptr);
+        exit(EXIT_FAILURE);
+    }
+    bm_sink += res.param_c;
+    ArgpxResultFree(&res);
+}
+
+enum BmParser_ {
+    kBmArgpxLinear,
+    kBmArgpxHash,
+    kBmGetoptLong,
+    kBmArgp,
+};
+
+static const char *bm_parser_name_v[] = {"argpx_linear", "argpx_hash", "getopt_long", "argp"};
+
+static void Measure_(struct Scenario_ *sc, enum BmParser_ which, bool first)
+{
+    struct ArgpxParser *parser = NULL;
+    struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    if (which == kBmArgpxLinear or which == kBmArgpxHash) {
+        opt.use_hash = which == kBmArgpxHash;
+        if (ArgpxCompile(&parser, &sc->style, &sc->flag, &opt) != kArgpxStatusSuccess) {
+            printf("ArgParseX compile error on %s\n", sc->name);
+            exit(EXIT_FAILURE);
+        }
+    }
+    char **work_v = malloc(sizeof(char *) * (sc->arg_c + 1));
+
+    long iter = 1;
+    double elapsed = 0;
+    unsigned long alloc_c = 0;
+    while (true) {
+        unsigned long alloc_start = bm_alloc_c;
+        double start = NowNs_();
+        for (long i = 0; i < iter; i++) {
+            switch (which) {
+            case kBmArgpxLinear:
+            case kBmArgpxHash:
+                ParseArgpx_(sc, parser, &opt);
+                break;
+            case kBmGetoptLong:
+                ParseGetopt_(sc, work_v);
+                break;
+            case kBmArgp:
+                ParseArgp_(sc, work_v);
+                break;
+            }
+        }
+        elapsed = NowNs_() - start;
+        alloc_c = bm_alloc_c - alloc_start;
+        if (elapsed >= BM_MIN_NS)
+            break;
+        iter *= elapsed > 0 ? (BM_MIN_NS / elapsed > 8 ? 8 : 2) : 8;
+    }
+
+    double ns_per_arg = elapsed / ((double)iter * sc->arg_c);
+    printf("%s  {\"scenario\": \"%s\", \"parser\": \"%s\", \"args\": %d, \"ns_per_arg\": %.2f, \"args_per_sec\": %.0f, "
+           "\"allocs_per_parse\": %.2f}",
+        first ? "" : ",\n", sc->name, bm_parser_name_v[which], sc->arg_c, ns_per_arg, 1e9 / ns_per_arg,
+        (double)alloc_c / iter);
+    fflush(stdout);
+
+    free(work_v);
+    ArgpxParserFree(parser);
+}
+
+/*
+    Build the scenarios
+ */
+
+static char **LongNames_(int count)
+{
+    char **name_v = malloc(sizeof(char *) * count);
+    for (int i = 0; i < count; i++)
+        name_v[i] = Format_("flag-name-%d", i);
+    return name_v;
+}
+
+static char **ArgvMake_(int arg_c)
+{
+    char **arg_v = malloc(sizeof(char *) * (arg_c + 2));
+    arg_v[0] = "bm";
+    arg_v[arg_c + 1] = NULL;
+    return arg_v;
+}
+
+// 64 random ones of long_c flags
+static struct Scenario_ ScenarioLong_(const char *name, int long_c)
+{
+    struct Scenario_ sc = {.name = name, .arg_c = 64, .long_c = long_c, .short_str = ""};
+    sc.long_name_v = LongNames_(long_c);
+    sc.arg_v = ArgvMake_(sc.arg_c);
+    srand(1);
+    for (int i = 1; i <= sc.arg_c; i++)
+        sc.arg_v[i] = Format_("--flag-name-%d", rand() % long_c);
+    return sc;
+}
+
+// 64 arguments like -abcdef, 6 flags in each
+static struct Scenario_ ScenarioComposable_(void)
+{
+    static const char *letter = "abcdefghijklmnopqrstuvwxyz";
+    struct Scenario_ sc = {.name = "composable", .arg_c = 64, .short_str = letter};
+    sc.arg_v = ArgvMake_(sc.arg_c);
+    for (int i = 1; i <= sc.arg_c; i++) {
+        char buf[8] = {'-'};
+        for (int k = 0; k < 6; k++)
+            buf[k + 1] = letter[(i * 6 + k) % 26];
+        sc.arg_v[i] = strdup(buf);
+    }
+    return sc;
+}
+
+// 16 lists of 64 items
+static struct Scenario_ ScenarioParamList_(void)
+{
+    struct Scenario_ sc = {.name = "paramlist", .arg_c = 16, .short_str = "", .has_list = true};
+    sc.arg_v = ArgvMake_(sc.arg_c);
+    for (int i = 1; i <= sc.arg_c; i++) {
+        char buf[64 * 8 + 16] = "--list=";
+        for (int k = 0; k < 64; k++) {
+            char item[16];
+            snprintf(item, sizeof(item), "%sitem%d", k > 0 ? "," : "", k);
+            strcat(buf, item);
+        }
+        sc.arg_v[i] = strdup(buf);
+    }
+    return sc;
+}
+
+// one flag and 255 positional ones
+static struct Scenario_ ScenarioPositional_(void)
+{
+    struct Scenario_ sc = {.name = "positional", .arg_c = 256, .long_c = 1, .short_str = ""};
+    sc.long_name_v = LongNames_(1);
+    sc.arg_v = ArgvMake_(sc.arg_c);
+    sc.arg_v[1] = "--flag-name-0";
+    for (int i = 2; i <= sc.arg_c; i++)
+        sc.arg_v[i] = Format_("file-%d.txt", i);
+    return sc;
+}
+
+// one flag, "--" and then 254 arguments look like flags
+static struct Scenario_ ScenarioStop_(void)
+{
+    struct Scenario_ sc = {.name = "stop", .arg_c = 256, .long_c = 8, .short_str = ""};
+    sc.long_name_v = LongNames_(8);
+    sc.arg_v = ArgvMake_(sc.arg_c);
+    sc.arg_v[1] = "--flag-name-0";
+    sc.arg_v[2] = "--";
+    for (int i = 3; i <= sc.arg_c; i++)
+        sc.arg_v[i] = Format_("--flag-name-%d", i % 8);
+    return sc;
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter = argc > 1 ? argv[1] : NULL;
+
+    struct Scenario_ sc_v[] = {
+        ScenarioLong_("long_1k", 1000),
+        ScenarioLong_("long_10k", 10 * 1000),
+        ScenarioComposable_(),
+        ScenarioParamList_(),
+        ScenarioPositional_(),
+        ScenarioStop_(),
+    };
+
+    bool first = true;
+    printf("[\n");
+    for (size_t i = 0; i < sizeof(sc_v) / sizeof(struct Scenario_); i++) {
+        if (filter != NULL and strcmp(filter, sc_v[i].name) != 0)
+            continue;
+        ScenarioSetup_(&sc_v[i]);
+        for (int which = kBmArgpxLinear; which <= kBmArgp; which++) {
+            Measure_(&sc_v[i], which, first);
+            first = false;
+        }
+    }
+    printf("\n]\n");
+
+    // the scenarios live until the exit
+    return bm_sink == 0;
+}
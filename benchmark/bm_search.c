@@ -0,0 +1,214 @@
+/*
+    The assigner and delimiter search kernels of source/argpx_search.c, against the byte loop they replaced.
+    - miss: a haystack of 8 bytes or 1MB without the needle, the whole of it is scanned
+    - split: a 1MB list with the needle every 8 bytes, all of them are found like a ParamList
+    And a whole parse of --include=<64KB list>, split by ParamListView.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <iso646.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "argpx/argpx.h"
+#include "../source/argpx_search.h"
+
+#define BM_BYTES_TOTAL (64L * 1024 * 1024)
+// the best of the rounds, the machine is noisy
+#define BM_REPEAT 7
+
+static double NowNs_(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*
+    The old strnstr_() of argpx.c, searched again after each hit.
+ */
+static size_t ByteLoop_(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len,
+    const char **hit_v, size_t hit_cap)
+{
+    size_t hit_c = 0;
+    for (size_t i = 0; i < haystack_len and hit_c < hit_cap; i++) {
+        if (haystack[i] != needle[0])
+            continue;
+        for (size_t j = 0; i + j < haystack_len; j++) {
+            if (haystack[i + j] != needle[j])
+                break;
+            if (j + 1 == needle_len) {
+                hit_v[hit_c++] = &haystack[i];
+                i += needle_len - 1;
+                break;
+            }
+        }
+    }
+    return hit_c;
+}
+
+struct Kernel_ {
+    const char *name;
+    ArgpxSearchFn fn;
+};
+
+// the result goes here, so the search isn't optimized out
+static volatile size_t bm_sink;
+
+/*
+    return ns per byte
+ */
+static double Miss_(ArgpxSearchFn fn, const char *haystack, size_t len, const char *needle)
+{
+    long round = BM_BYTES_TOTAL / (long)len;
+    double best = 0;
+    for (int r = 0; r < BM_REPEAT; r++) {
+        double start = NowNs_();
+        for (long i = 0; i < round; i++)
+            bm_sink += ArgpxSearchFirst(fn, haystack, len, needle, strlen(needle)) == NULL;
+        double ns = (NowNs_() - start) / ((double)round * len);
+        if (r == 0 or ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+static double Split_(ArgpxSearchFn fn, const char *haystack, size_t len, const char *needle)
+{
+    size_t needle_len = strlen(needle);
+    long round = BM_BYTES_TOTAL / (long)len / 4;
+    double best = 0;
+    for (int r = 0; r < BM_REPEAT; r++) {
+        double start = NowNs_();
+        for (long i = 0; i < round; i++) {
+            const char *pos = haystack;
+            const char *end = haystack + len;
+            const char *hit_v[ARGPX_SEARCH_CHUNK];
+            size_t hit_c;
+            do {
+                hit_c = fn(pos, end - pos, needle, needle_len, hit_v, ARGPX_SEARCH_CHUNK);
+                bm_sink += hit_c;
+                if (hit_c > 0)
+                    pos = hit_v[hit_c - 1] + needle_len;
+            } while (hit_c == ARGPX_SEARCH_CHUNK);
+        }
+        double ns = (NowNs_() - start) / ((double)round * len);
+        if (r == 0 or ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+static void Kernels_(void)
+{
+    struct Kernel_ kernel_v[] = {
+        {"byte loop", ByteLoop_},
+        {"scalar", ArgpxSearchScalar},
+#ifdef ARGPX_SEARCH_X86
+        {"sse2", ArgpxSearchSse2},
+        {"avx2", NULL},
+#endif
+    };
+    int kernel_c = sizeof(kernel_v) / sizeof(kernel_v[0]);
+#ifdef ARGPX_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        kernel_v[kernel_c - 1].fn = ArgpxSearchAvx2;
+    else
+        kernel_c -= 1;
+#endif
+
+    size_t big_len = 1024 * 1024;
+    char *miss = malloc(big_len);
+    char *split = malloc(big_len);
+    for (size_t i = 0; i < big_len; i++) {
+        miss[i] = 'a' + i % 26;
+        // "item" + 3 letters + the needle
+        split[i] = "itemabc"[i % 8 < 7 ? i % 8 : 0];
+    }
+
+    const char *needle_v[] = {",", "::", "-,-"};
+    for (int n = 0; n < 3; n++) {
+        const char *needle = needle_v[n];
+        size_t needle_len = strlen(needle);
+        for (size_t i = 7; i + needle_len <= big_len; i += 8 + needle_len - 1)
+            memcpy(split + i, needle, needle_len);
+
+        printf("needle \"%s\":\n", needle);
+        printf("%-16s %14s %14s %14s\n", "kernel", "miss 8B", "miss 1MB", "split 1MB");
+        for (int k = 0; k < kernel_c; k++) {
+            printf("%-16s %8.3f ns/B %8.3f ns/B %8.3f ns/B\n", kernel_v[k].name, Miss_(kernel_v[k].fn, miss, 8, needle),
+                Miss_(kernel_v[k].fn, miss, big_len, needle), Split_(kernel_v[k].fn, split, big_len, needle));
+        }
+        // put the plain bytes back for the next needle
+        for (size_t i = 0; i < big_len; i++)
+            split[i] = "itemabc"[i % 8 < 7 ? i % 8 : 0];
+    }
+
+    free(miss);
+    free(split);
+}
+
+static void ParseLongList_(void)
+{
+    struct ArgpxStyle style = ARGPX_STYLE_INIT;
+    ArgpxGroupAppend(&style, ARGPX_GROUP_GNU);
+
+    struct ArgpxFlagSet flag = ARGPX_FLAGSET_INIT;
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "include",
+        .action_type = kArgpxActionParamListView,
+        .action_load.param_list_view = {.max = 0},
+    });
+
+    // --include=item0000,item0001,... of 64KB
+    size_t list_len = 64 * 1024;
+    char *arg = malloc(list_len + 32);
+    size_t len = (size_t)sprintf(arg, "--include=");
+    for (int i = 0; len + 10 < list_len; i++)
+        len += (size_t)sprintf(arg + len, "item%05d,", i);
+    arg[len - 1] = '\0';
+
+    struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    struct ArgpxParser *parser;
+    if (ArgpxCompile(&parser, &style, &flag, &opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX compile error\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int round = 500;
+    struct ArgpxResult res;
+    double parse_ns = 0;
+    for (int r = 0; r < BM_REPEAT; r++) {
+        double start = NowNs_();
+        for (int i = 0; i < round; i++) {
+            if (ArgpxParseCompiled(&res, 1, &arg, parser, &opt) != kArgpxStatusSuccess) {
+                printf("ArgParseX error: %s\n", ArgpxStatusString(res.status));
+                exit(EXIT_FAILURE);
+            }
+            ArgpxResultFree(&res);
+            ArgpxOutParamListViewFree(&flag.ptr[0].action_load.param_list_view);
+        }
+        double ns = (NowNs_() - start) / round;
+        if (r == 0 or ns < parse_ns)
+            parse_ns = ns;
+    }
+    printf("--include=<64KB list>: %.1f us/parse, %.3f ns/B\n", parse_ns / 1000, parse_ns / len);
+
+    free(arg);
+    ArgpxParserFree(parser);
+    ArgpxStyleFree(&style);
+    ArgpxFlagFree(&flag);
+}
+
+int main(void)
+{
+    Kernels_();
+    ParseLongList_();
+
+    return 0;
+}
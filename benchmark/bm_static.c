@@ -0,0 +1,93 @@
+/*
+    The static index made by argpx_gen against the runtime hash table, with 10k flags.
+    The compile time is the per-process setup, and the static index needs almost none.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "argpx/argpx.h"
+
+// keep it the same as the Makefile rule of bm_static.flags
+#define BM_FLAG_COUNT 10000
+#define BM_ARG_COUNT 1000
+#define BM_LOOKUP_TOTAL (20 * 1000 * 1000)
+
+extern const struct ArgpxStaticIndex bm_static_flags_index;
+
+static double NowNs_(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void Run_(const char *label, struct ArgpxStyle *style, struct ArgpxFlagSet *flag, char **arg_v,
+    struct ArgpxParseOption *opt)
+{
+    double start = NowNs_();
+    struct ArgpxParser *parser;
+    if (ArgpxCompile(&parser, style, flag, opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX compile error\n");
+        exit(EXIT_FAILURE);
+    }
+    double compile_ns = NowNs_() - start;
+
+    struct ArgpxResult res = ARGPX_RESULT_INIT;
+    start = NowNs_();
+    for (int i = 0; i < BM_LOOKUP_TOTAL / BM_ARG_COUNT; i++) {
+        if (ArgpxParseCompiled(&res, BM_ARG_COUNT, arg_v, parser, opt) != kArgpxStatusSuccess) {
+            printf("ArgParseX error: %s\n", ArgpxStatusString(res.status));
+            exit(EXIT_FAILURE);
+        }
+    }
+    double hit_ns = (NowNs_() - start) / BM_LOOKUP_TOTAL;
+    ArgpxResultFree(&res);
+
+    printf("%-8s compile: %10.0f ns, hit: %6.1f ns/arg\n", label, compile_ns, hit_ns);
+    ArgpxParserFree(parser);
+}
+
+int main(void)
+{
+    struct ArgpxStyle style = ARGPX_STYLE_INIT;
+    ArgpxGroupAppend(&style, ARGPX_GROUP_GNU);
+
+    // the names are also used as arguments, with the "--" prefix
+    char **name_v = malloc(sizeof(char *) * BM_FLAG_COUNT);
+    struct ArgpxFlagSet flag = ARGPX_FLAGSET_INIT;
+    for (int i = 0; i < BM_FLAG_COUNT; i++) {
+        name_v[i] = malloc(32);
+        snprintf(name_v[i], 32, "--flag-name-%d", i);
+        ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+            .group_idx = 0,
+            .name = name_v[i] + 2,
+            .action_type = kArgpxActionCallbackOnly,
+        });
+    }
+
+    char *arg_v[BM_ARG_COUNT];
+    srand(1);
+    for (int i = 0; i < BM_ARG_COUNT; i++)
+        arg_v[i] = name_v[rand() % BM_FLAG_COUNT];
+
+    struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    opt.use_hash = true;
+    opt.reuse_result = true;
+    Run_("hash", &style, &flag, arg_v, &opt);
+
+    opt.use_hash = false;
+    opt.static_index = &bm_static_flags_index;
+    Run_("static", &style, &flag, arg_v, &opt);
+
+    for (int i = 0; i < BM_FLAG_COUNT; i++)
+        free(name_v[i]);
+    free(name_v);
+    ArgpxStyleFree(&style);
+    ArgpxFlagFree(&flag);
+
+    return 0;
+}
@@ -0,0 +1,11064 @@
+// generated by argpx_gen from bm_static.flags, don't edit
+//
+// the flags, in the order of ArgpxFlagAppend():
+//   0: group 0, "flag-name-0"
+//   1: group 0, "flag-name-1"
+//   2: group 0, "flag-name-2"
+//   3: group 0, "flag-name-3"
+//   4: group 0, "flag-name-4"
+//   5: group 0, "flag-name-5"
+//   6: group 0, "flag-name-6"
+//   7: group 0, "flag-name-7"
+//   8: group 0, "flag-name-8"
+//   9: group 0, "flag-name-9"
+//   10: group 0, "flag-name-10"
+//   11: group 0, "flag-name-11"
+//   12: group 0, "flag-name-12"
+//   13: group 0, "flag-name-13"
+//   14: group 0, "flag-name-14"
+//   15: group 0, "flag-name-15"
+//   16: group 0, "flag-name-16"
+//   17: group 0, "flag-name-17"
+//   18: group 0, "flag-name-18"
+//   19: group 0, "flag-name-19"
+//   20: group 0, "flag-name-20"
+//   21: group 0, "flag-name-21"
+//   22: group 0, "flag-name-22"
+//   23: group 0, "flag-name-23"
+//   24: group 0, "flag-name-24"
+//   25: group 0, "flag-name-25"
+//   26: group 0, "flag-name-26"
+//   27: group 0, "flag-name-27"
+//   28: group 0, "flag-name-28"
+//   29: group 0, "flag-name-29"
+//   30: group 0, "flag-name-30"
+//   31: group 0, "flag-name-31"
+//   32: group 0, "flag-name-32"
+//   33: group 0, "flag-name-33"
+//   34: group 0, "flag-name-34"
+//   35: group 0, "flag-name-35"
+//   36: group 0, "flag-name-36"
+//   37: group 0, "flag-name-37"
+//   38: group 0, "flag-name-38"
+//   39: group 0, "flag-name-39"
+//   40: group 0, "flag-name-40"
+//   41: group 0, "flag-name-41"
+//   42: group 0, "flag-name-42"
+//   43: group 0, "flag-name-43"
+//   44: group 0, "flag-name-44"
+//   45: group 0, "flag-name-45"
+//   46: group 0, "flag-name-46"
+//   47: group 0, "flag-name-47"
+//   48: group 0, "flag-name-48"
+//   49: group 0, "flag-name-49"
+//   50: group 0, "flag-name-50"
+//   51: group 0, "flag-name-51"
+//   52: group 0, "flag-name-52"
+//   53: group 0, "flag-name-53"
+//   54: group 0, "flag-name-54"
+//   55: group 0, "flag-name-55"
+//   56: group 0, "flag-name-56"
+//   57: group 0, "flag-name-57"
+//   58: group 0, "flag-name-58"
+//   59: group 0, "flag-name-59"
+//   60: group 0, "flag-name-60"
+//   61: group 0, "flag-name-61"
+//   62: group 0, "flag-name-62"
+//   63: group 0, "flag-name-63"
+//   64: group 0, "flag-name-64"
+//   65: group 0, "flag-name-65"
+//   66: group 0, "flag-name-66"
+//   67: group 0, "flag-name-67"
+//   68: group 0, "flag-name-68"
+//   69: group 0, "flag-name-69"
+//   70: group 0, "flag-name-70"
+//   71: group 0, "flag-name-71"
+//   72: group 0, "flag-name-72"
+//   73: group 0, "flag-name-73"
+//   74: group 0, "flag-name-74"
+//   75: group 0, "flag-name-75"
+//   76: group 0, "flag-name-76"
+//   77: group 0, "flag-name-77"
+//   78: group 0, "flag-name-78"
+//   79: group 0, "flag-name-79"
+//   80: group 0, "flag-name-80"
+//   81: group 0, "flag-name-81"
+//   82: group 0, "flag-name-82"
+//   83: group 0, "flag-name-83"
+//   84: group 0, "flag-name-84"
+//   85: group 0, "flag-name-85"
+//   86: group 0, "flag-name-86"
+//   87: group 0, "flag-name-87"
+//   88: group 0, "flag-name-88"
+//   89: group 0, "flag-name-89"
+//   90: group 0, "flag-name-90"
+//   91: group 0, "flag-name-91"
+//   92: group 0, "flag-name-92"
+//   93: group 0, "flag-name-93"
+//   94: group 0, "flag-name-94"
+//   95: group 0, "flag-name-95"
+//   96: group 0, "flag-name-96"
+//   97: group 0, "flag-name-97"
+//   98: group 0, "flag-name-98"
+//   99: group 0, "flag-name-99"
+//   100: group 0, "flag-name-100"
+//   101: group 0, "flag-name-101"
+//   102: group 0, "flag-name-102"
+//   103: group 0, "flag-name-103"
+//   104: group 0, "flag-name-104"
+//   105: group 0, "flag-name-105"
+//   106: group 0, "flag-name-106"
+//   107: group 0, "flag-name-107"
+//   108: group 0, "flag-name-108"
+//   109: group 0, "flag-name-109"
+//   110: group 0, "flag-name-110"
+//   111: group 0, "flag-name-111"
+//   112: group 0, "flag-name-112"
+//   113: group 0, "flag-name-113"
+//   114: group 0, "flag-name-114"
+//   115: group 0, "flag-name-115"
+//   116: group 0, "flag-name-116"
+//   117: group 0, "flag-name-117"
+//   118: group 0, "flag-name-118"
+//   119: group 0, "flag-name-119"
+//   120: group 0, "flag-name-120"
+//   121: group 0, "flag-name-121"
+//   122: group 0, "flag-name-122"
+//   123: group 0, "flag-name-123"
+//   124: group 0, "flag-name-124"
+//   125: group 0, "flag-name-125"
+//   126: group 0, "flag-name-126"
+//   127: group 0, "flag-name-127"
+//   128: group 0, "flag-name-128"
+//   129: group 0, "flag-name-129"
+//   130: group 0, "flag-name-130"
+//   131: group 0, "flag-name-131"
+//   132: group 0, "flag-name-132"
+//   133: group 0, "flag-name-133"
+//   134: group 0, "flag-name-134"
+//   135: group 0, "flag-name-135"
+//   136: group 0, "flag-name-136"
+//   137: group 0, "flag-name-137"
+//   138: group 0, "flag-name-138"
+//   139: group 0, "flag-name-139"
+//   140: group 0, "flag-name-140"
+//   141: group 0, "flag-name-141"
+//   142: group 0, "flag-name-142"
+//   143: group 0, "flag-name-143"
+//   144: group 0, "flag-name-144"
+//   145: group 0, "flag-name-145"
+//   146: group 0, "flag-name-146"
+//   147: group 0, "flag-name-147"
+//   148: group 0, "flag-name-148"
+//   149: group 0, "flag-name-149"
+//   150: group 0, "flag-name-150"
+//   151: group 0, "flag-name-151"
+//   152: group 0, "flag-name-152"
+//   153: group 0, "flag-name-153"
+//   154: group 0, "flag-name-154"
+//   155: group 0, "flag-name-155"
+//   156: group 0, "flag-name-156"
+//   157: group 0, "flag-name-157"
+//   158: group 0, "flag-name-158"
+//   159: group 0, "flag-name-159"
+//   160: group 0, "flag-name-160"
+//   161: group 0, "flag-name-161"
+//   162: group 0, "flag-name-162"
+//   163: group 0, "flag-name-163"
+//   164: group 0, "flag-name-164"
+//   165: group 0, "flag-name-165"
+//   166: group 0, "flag-name-166"
+//   167: group 0, "flag-name-167"
+//   168: group 0, "flag-name-168"
+//   169: group 0, "flag-name-169"
+//   170: group 0, "flag-name-170"
+//   171: group 0, "flag-name-171"
+//   172: group 0, "flag-name-172"
+//   173: group 0, "flag-name-173"
+//   174: group 0, "flag-name-174"
+//   175: group 0, "flag-name-175"
+//   176: group 0, "flag-name-176"
+//   177: group 0, "flag-name-177"
+//   178: group 0, "flag-name-178"
+//   179: group 0, "flag-name-179"
+//   180: group 0, "flag-name-180"
+//   181: group 0, "flag-name-181"
+//   182: group 0, "flag-name-182"
+//   183: group 0, "flag-name-183"
+//   184: group 0, "flag-name-184"
+//   185: group 0, "flag-name-185"
+//   186: group 0, "flag-name-186"
+//   187: group 0, "flag-name-187"
+//   188: group 0, "flag-name-188"
+//   189: group 0, "flag-name-189"
+//   190: group 0, "flag-name-190"
+//   191: group 0, "flag-name-191"
+//   192: group 0, "flag-name-192"
+//   193: group 0, "flag-name-193"
+//   194: group 0, "flag-name-194"
+//   195: group 0, "flag-name-195"
+//   196: group 0, "flag-name-196"
+//   197: group 0, "flag-name-197"
+//   198: group 0, "flag-name-198"
+//   199: group 0, "flag-name-199"
+//   200: group 0, "flag-name-200"
+//   201: group 0, "flag-name-201"
+//   202: group 0, "flag-name-202"
+//   203: group 0, "flag-name-203"
+//   204: group 0, "flag-name-204"
+//   205: group 0, "flag-name-205"
+//   206: group 0, "flag-name-206"
+//   207: group 0, "flag-name-207"
+//   208: group 0, "flag-name-208"
+//   209: group 0, "flag-name-209"
+//   210: group 0, "flag-name-210"
+//   211: group 0, "flag-name-211"
+//   212: group 0, "flag-name-212"
+//   213: group 0, "flag-name-213"
+//   214: group 0, "flag-name-214"
+//   215: group 0, "flag-name-215"
+//   216: group 0, "flag-name-216"
+//   217: group 0, "flag-name-217"
+//   218: group 0, "flag-name-218"
+//   219: group 0, "flag-name-219"
+//   220: group 0, "flag-name-220"
+//   221: group 0, "flag-name-221"
+//   222: group 0, "flag-name-222"
+//   223: group 0, "flag-name-223"
+//   224: group 0, "flag-name-224"
+//   225: group 0, "flag-name-225"
+//   226: group 0, "flag-name-226"
+//   227: group 0, "flag-name-227"
+//   228: group 0, "flag-name-228"
+//   229: group 0, "flag-name-229"
+//   230: group 0, "flag-name-230"
+//   231: group 0, "flag-name-231"
+//   232: group 0, "flag-name-232"
+//   233: group 0, "flag-name-233"
+//   234: group 0, "flag-name-234"
+//   235: group 0, "flag-name-235"
+//   236: group 0, "flag-name-236"
+//   237: group 0, "flag-name-237"
+//   238: group 0, "flag-name-238"
+//   239: group 0, "flag-name-239"
+//   240: group 0, "flag-name-240"
+//   241: group 0, "flag-name-241"
+//   242: group 0, "flag-name-242"
+//   243: group 0, "flag-name-243"
+//   244: group 0, "flag-name-244"
+//   245: group 0, "flag-name-245"
+//   246: group 0, "flag-name-246"
+//   247: group 0, "flag-name-247"
+//   248: group 0, "flag-name-248"
+//   249: group 0, "flag-name-249"
+//   250: group 0, "flag-name-250"
+//   251: group 0, "flag-name-251"
+//   252: group 0, "flag-name-252"
+//   253: group 0, "flag-name-253"
+//   254: group 0, "flag-name-254"
+//   255: group 0, "flag-name-255"
+//   256: group 0, "flag-name-256"
+//   257: group 0, "flag-name-257"
+//   258: group 0, "flag-name-258"
+//   259: group 0, "flag-name-259"
+//   260: group 0, "flag-name-260"
+//   261: group 0, "flag-name-261"
+//   262: group 0, "flag-name-262"
+//   263: group 0, "flag-name-263"
+//   264: group 0, "flag-name-264"
+//   265: group 0, "flag-name-265"
+//   266: group 0, "flag-name-266"
+//   267: group 0, "flag-name-267"
+//   268: group 0, "flag-name-268"
+//   269: group 0, "flag-name-269"
+//   270: group 0, "flag-name-270"
+//   271: group 0, "flag-name-271"
+//   272: group 0, "flag-name-272"
+//   273: group 0, "flag-name-273"
+//   274: group 0, "flag-name-274"
+//   275: group 0, "flag-name-275"
+//   276: group 0, "flag-name-276"
+//   277: group 0, "flag-name-277"
+//   278: group 0, "flag-name-278"
+//   279: group 0, "flag-name-279"
+//   280: group 0, "flag-name-280"
+//   281: group 0, "flag-name-281"
+//   282: group 0, "flag-name-282"
+//   283: group 0, "flag-name-283"
+//   284: group 0, "flag-name-284"
+//   285: group 0, "flag-name-285"
+//   286: group 0, "flag-name-286"
+//   287: group 0, "flag-name-287"
+//   288: group 0, "flag-name-288"
+//   289: group 0, "flag-name-289"
+//   290: group 0, "flag-name-290"
+//   291: group 0, "flag-name-291"
+//   292: group 0, "flag-name-292"
+//   293: group 0, "flag-name-293"
+//   294: group 0, "flag-name-294"
+//   295: group 0, "flag-name-295"
+//   296: group 0, "flag-name-296"
+//   297: group 0, "flag-name-297"
+//   298: group 0, "flag-name-298"
+//   299: group 0, "flag-name-299"
+//   300: group 0, "flag-name-300"
+//   301: group 0, "flag-name-301"
+//   302: group 0, "flag-name-302"
+//   303: group 0, "flag-name-303"
+//   304: group 0, "flag-name-304"
+//   305: group 0, "flag-name-305"
+//   306: group 0, "flag-name-306"
+//   307: group 0, "flag-name-307"
+//   308: group 0, "flag-name-308"
+//   309: group 0, "flag-name-309"
+//   310: group 0, "flag-name-310"
+//   311: group 0, "flag-name-311"
+//   312: group 0, "flag-name-312"
+//   313: group 0, "flag-name-313"
+//   314: group 0, "flag-name-314"
+//   315: group 0, "flag-name-315"
+//   316: group 0, "flag-name-316"
+//   317: group 0, "flag-name-317"
+//   318: group 0, "flag-name-318"
+//   319: group 0, "flag-name-319"
+//   320: group 0, "flag-name-320"
+//   321: group 0, "flag-name-321"
+//   322: group 0, "flag-name-322"
+//   323: group 0, "flag-name-323"
+//   324: group 0, "flag-name-324"
+//   325: group 0, "flag-name-325"
+//   326: group 0, "flag-name-326"
+//   327: group 0, "flag-name-327"
+//   328: group 0, "flag-name-328"
+//   329: group 0, "flag-name-329"
+//   330: group 0, "flag-name-330"
+//   331: group 0, "flag-name-331"
+//   332: group 0, "flag-name-332"
+//   333: group 0, "flag-name-333"
+//   334: group 0, "flag-name-334"
+//   335: group 0, "flag-name-335"
+//   336: group 0, "flag-name-336"
+//   337: group 0, "flag-name-337"
+//   338: group 0, "flag-name-338"
+//   339: group 0, "flag-name-339"
+//   340: group 0, "flag-name-340"
+//   341: group 0, "flag-name-341"
+//   342: group 0, "flag-name-342"
+//   343: group 0, "flag-name-343"
+//   344: group 0, "flag-name-344"
+//   345: group 0, "flag-name-345"
+//   346: group 0, "flag-name-346"
+//   347: group 0, "flag-name-347"
+//   348: group 0, "flag-name-348"
+//   349: group 0, "flag-name-349"
+//   350: group 0, "flag-name-350"
+//   351: group 0, "flag-name-351"
+//   352: group 0, "flag-name-352"
+//   353: group 0, "flag-name-353"
+//   354: group 0, "flag-name-354"
+//   355: group 0, "flag-name-355"
+//   356: group 0, "flag-name-356"
+//   357: group 0, "flag-name-357"
+//   358: group 0, "flag-name-358"
+//   359: group 0, "flag-name-359"
+//   360: group 0, "flag-name-360"
+//   361: group 0, "flag-name-361"
+//   362: group 0, "flag-name-362"
+//   363: group 0, "flag-name-363"
+//   364: group 0, "flag-name-364"
+//   365: group 0, "flag-name-365"
+//   366: group 0, "flag-name-366"
+//   367: group 0, "flag-name-367"
+//   368: group 0, "flag-name-368"
+//   369: group 0, "flag-name-369"
+//   370: group 0, "flag-name-370"
+//   371: group 0, "flag-name-371"
+//   372: group 0, "flag-name-372"
+//   373: group 0, "flag-name-373"
+//   374: group 0, "flag-name-374"
+//   375: group 0, "flag-name-375"
+//   376: group 0, "flag-name-376"
+//   377: group 0, "flag-name-377"
+//   378: group 0, "flag-name-378"
+//   379: group 0, "flag-name-379"
+//   380: group 0, "flag-name-380"
+//   381: group 0, "flag-name-381"
+//   382: group 0, "flag-name-382"
+//   383: group 0, "flag-name-383"
+//   384: group 0, "flag-name-384"
+//   385: group 0, "flag-name-385"
+//   386: group 0, "flag-name-386"
+//   387: group 0, "flag-name-387"
+//   388: group 0, "flag-name-388"
+//   389: group 0, "flag-name-389"
+//   390: group 0, "flag-name-390"
+//   391: group 0, "flag-name-391"
+//   392: group 0, "flag-name-392"
+//   393: group 0, "flag-name-393"
+//   394: group 0, "flag-name-394"
+//   395: group 0, "flag-name-395"
+//   396: group 0, "flag-name-396"
+//   397: group 0, "flag-name-397"
+//   398: group 0, "flag-name-398"
+//   399: group 0, "flag-name-399"
+//   400: group 0, "flag-name-400"
+//   401: group 0, "flag-name-401"
+//   402: group 0, "flag-name-402"
+//   403: group 0, "flag-name-403"
+//   404: group 0, "flag-name-404"
+//   405: group 0, "flag-name-405"
+//   406: group 0, "flag-name-406"
+//   407: group 0, "flag-name-407"
+//   408: group 0, "flag-name-408"
+//   409: group 0, "flag-name-409"
+//   410: group 0, "flag-name-410"
+//   411: group 0, "flag-name-411"
+//   412: group 0, "flag-name-412"
+//   413: group 0, "flag-name-413"
+//   414: group 0, "flag-name-414"
+//   415: group 0, "flag-name-415"
+//   416: group 0, "flag-name-416"
+//   417: group 0, "flag-name-417"
+//   418: group 0, "flag-name-418"
+//   419: group 0, "flag-name-419"
+//   420: group 0, "flag-name-420"
+//   421: group 0, "flag-name-421"
+//   422: group 0, "flag-name-422"
+//   423: group 0, "flag-name-423"
+//   424: group 0, "flag-name-424"
+//   425: group 0, "flag-name-425"
+//   426: group 0, "flag-name-426"
+//   427: group 0, "flag-name-427"
+//   428: group 0, "flag-name-428"
+//   429: group 0, "flag-name-429"
+//   430: group 0, "flag-name-430"
+//   431: group 0, "flag-name-431"
+//   432: group 0, "flag-name-432"
+//   433: group 0, "flag-name-433"
+//   434: group 0, "flag-name-434"
+//   435: group 0, "flag-name-435"
+//   436: group 0, "flag-name-436"
+//   437: group 0, "flag-name-437"
+//   438: group 0, "flag-name-438"
+//   439: group 0, "flag-name-439"
+//   440: group 0, "flag-name-440"
+//   441: group 0, "flag-name-441"
+//   442: group 0, "flag-name-442"
+//   443: group 0, "flag-name-443"
+//   444: group 0, "flag-name-444"
+//   445: group 0, "flag-name-445"
+//   446: group 0, "flag-name-446"
+//   447: group 0, "flag-name-447"
+//   448: group 0, "flag-name-448"
+//   449: group 0, "flag-name-449"
+//   450: group 0, "flag-name-450"
+//   451: group 0, "flag-name-451"
+//   452: group 0, "flag-name-452"
+//   453: group 0, "flag-name-453"
+//   454: group 0, "flag-name-454"
+//   455: group 0, "flag-name-455"
+//   456: group 0, "flag-name-456"
+//   457: group 0, "flag-name-457"
+//   458: group 0, "flag-name-458"
+//   459: group 0, "flag-name-459"
+//   460: group 0, "flag-name-460"
+//   461: group 0, "flag-name-461"
+//   462: group 0, "flag-name-462"
+//   463: group 0, "flag-name-463"
+//   464: group 0, "flag-name-464"
+//   465: group 0, "flag-name-465"
+//   466: group 0, "flag-name-466"
+//   467: group 0, "flag-name-467"
+//   468: group 0, "flag-name-468"
+//   469: group 0, "flag-name-469"
+//   470: group 0, "flag-name-470"
+//   471: group 0, "flag-name-471"
+//   472: group 0, "flag-name-472"
+//   473: group 0, "flag-name-473"
+//   474: group 0, "flag-name-474"
+//   475: group 0, "flag-name-475"
+//   476: group 0, "flag-name-476"
+//   477: group 0, "flag-name-477"
+//   478: group 0, "flag-name-478"
+//   479: group 0, "flag-name-479"
+//   480: group 0, "flag-name-480"
+//   481: group 0, "flag-name-481"
+//   482: group 0, "flag-name-482"
+//   483: group 0, "flag-name-483"
+//   484: group 0, "flag-name-484"
+//   485: group 0, "flag-name-485"
+//   486: group 0, "flag-name-486"
+//   487: group 0, "flag-name-487"
+//   488: group 0, "flag-name-488"
+//   489: group 0, "flag-name-489"
+//   490: group 0, "flag-name-490"
+//   491: group 0, "flag-name-491"
+//   492: group 0, "flag-name-492"
+//   493: group 0, "flag-name-493"
+//   494: group 0, "flag-name-494"
+//   495: group 0, "flag-name-495"
+//   496: group 0, "flag-name-496"
+//   497: group 0, "flag-name-497"
+//   498: group 0, "flag-name-498"
+//   499: group 0, "flag-name-499"
+//   500: group 0, "flag-name-500"
+//   501: group 0, "flag-name-501"
+//   502: group 0, "flag-name-502"
+//   503: group 0, "flag-name-503"
+//   504: group 0, "flag-name-504"
+//   505: group 0, "flag-name-505"
+//   506: group 0, "flag-name-506"
+//   507: group 0, "flag-name-507"
+//   508: group 0, "flag-name-508"
+//   509: group 0, "flag-name-509"
+//   510: group 0, "flag-name-510"
+//   511: group 0, "flag-name-511"
+//   512: group 0, "flag-name-512"
+//   513: group 0, "flag-name-513"
+//   514: group 0, "flag-name-514"
+//   515: group 0, "flag-name-515"
+//   516: group 0, "flag-name-516"
+//   517: group 0, "flag-name-517"
+//   518: group 0, "flag-name-518"
+//   519: group 0, "flag-name-519"
+//   520: group 0, "flag-name-520"
+//   521: group 0, "flag-name-521"
+//   522: group 0, "flag-name-522"
+//   523: group 0, "flag-name-523"
+//   524: group 0, "flag-name-524"
+//   525: group 0, "flag-name-525"
+//   526: group 0, "flag-name-526"
+//   527: group 0, "flag-name-527"
+//   528: group 0, "flag-name-528"
+//   529: group 0, "flag-name-529"
+//   530: group 0, "flag-name-530"
+//   531: group 0, "flag-name-531"
+//   532: group 0, "flag-name-532"
+//   533: group 0, "flag-name-533"
+//   534: group 0, "flag-name-534"
+//   535: group 0, "flag-name-535"
+//   536: group 0, "flag-name-536"
+//   537: group 0, "flag-name-537"
+//   538: group 0, "flag-name-538"
+//   539: group 0, "flag-name-539"
+//   540: group 0, "flag-name-540"
+//   541: group 0, "flag-name-541"
+//   542: group 0, "flag-name-542"
+//   543: group 0, "flag-name-543"
+//   544: group 0, "flag-name-544"
+//   545: group 0, "flag-name-545"
+//   546: group 0, "flag-name-546"
+//   547: group 0, "flag-name-547"
+//   548: group 0, "flag-name-548"
+//   549: group 0, "flag-name-549"
+//   550: group 0, "flag-name-550"
+//   551: group 0, "flag-name-551"
+//   552: group 0, "flag-name-552"
+//   553: group 0, "flag-name-553"
+//   554: group 0, "flag-name-554"
+//   555: group 0, "flag-name-555"
+//   556: group 0, "flag-name-556"
+//   557: group 0, "flag-name-557"
+//   558: group 0, "flag-name-558"
+//   559: group 0, "flag-name-559"
+//   560: group 0, "flag-name-560"
+//   561: group 0, "flag-name-561"
+//   562: group 0, "flag-name-562"
+//   563: group 0, "flag-name-563"
+//   564: group 0, "flag-name-564"
+//   565: group 0, "flag-name-565"
+//   566: group 0, "flag-name-566"
+//   567: group 0, "flag-name-567"
+//   568: group 0, "flag-name-568"
+//   569: group 0, "flag-name-569"
+//   570: group 0, "flag-name-570"
+//   571: group 0, "flag-name-571"
+//   572: group 0, "flag-name-572"
+//   573: group 0, "flag-name-573"
+//   574: group 0, "flag-name-574"
+//   575: group 0, "flag-name-575"
+//   576: group 0, "flag-name-576"
+//   577: group 0, "flag-name-577"
+//   578: group 0, "flag-name-578"
+//   579: group 0, "flag-name-579"
+//   580: group 0, "flag-name-580"
+//   581: group 0, "flag-name-581"
+//   582: group 0, "flag-name-582"
+//   583: group 0, "flag-name-583"
+//   584: group 0, "flag-name-584"
+//   585: group 0, "flag-name-585"
+//   586: group 0, "flag-name-586"
+//   587: group 0, "flag-name-587"
+//   588: group 0, "flag-name-588"
+//   589: group 0, "flag-name-589"
+//   590: group 0, "flag-name-590"
+//   591: group 0, "flag-name-591"
+//   592: group 0, "flag-name-592"
+//   593: group 0, "flag-name-593"
+//   594: group 0, "flag-name-594"
+//   595: group 0, "flag-name-595"
+//   596: group 0, "flag-name-596"
+//   597: group 0, "flag-name-597"
+//   598: group 0, "flag-name-598"
+//   599: group 0, "flag-name-599"
+//   600: group 0, "flag-name-600"
+//   601: group 0, "flag-name-601"
+//   602: group 0, "flag-name-602"
+//   603: group 0, "flag-name-603"
+//   604: group 0, "flag-name-604"
+//   605: group 0, "flag-name-605"
+//   606: group 0, "flag-name-606"
+//   607: group 0, "flag-name-607"
+//   608: group 0, "flag-name-608"
+//   609: group 0, "flag-name-609"
+//   610: group 0, "flag-name-610"
+//   611: group 0, "flag-name-611"
+//   612: group 0, "flag-name-612"
+//   613: group 0, "flag-name-613"
+//   614: group 0, "flag-name-614"
+//   615: group 0, "flag-name-615"
+//   616: group 0, "flag-name-616"
+//   617: group 0, "flag-name-617"
+//   618: group 0, "flag-name-618"
+//   619: group 0, "flag-name-619"
+//   620: group 0, "flag-name-620"
+//   621: group 0, "flag-name-621"
+//   622: group 0, "flag-name-622"
+//   623: group 0, "flag-name-623"
+//   624: group 0, "flag-name-624"
+//   625: group 0, "flag-name-625"
+//   626: group 0, "flag-name-626"
+//   627: group 0, "flag-name-627"
+//   628: group 0, "flag-name-628"
+//   629: group 0, "flag-name-629"
+//   630: group 0, "flag-name-630"
+//   631: group 0, "flag-name-631"
+//   632: group 0, "flag-name-632"
+//   633: group 0, "flag-name-633"
+//   634: group 0, "flag-name-634"
+//   635: group 0, "flag-name-635"
+//   636: group 0, "flag-name-636"
+//   637: group 0, "flag-name-637"
+//   638: group 0, "flag-name-638"
+//   639: group 0, "flag-name-639"
+//   640: group 0, "flag-name-640"
+//   641: group 0, "flag-name-641"
+//   642: group 0, "flag-name-642"
+//   643: group 0, "flag-name-643"
+//   644: group 0, "flag-name-644"
+//   645: group 0, "flag-name-645"
+//   646: group 0, "flag-name-646"
+//   647: group 0, "flag-name-647"
+//   648: group 0, "flag-name-648"
+//   649: group 0, "flag-name-649"
+//   650: group 0, "flag-name-650"
+//   651: group 0, "flag-name-651"
+//   652: group 0, "flag-name-652"
+//   653: group 0, "flag-name-653"
+//   654: group 0, "flag-name-654"
+//   655: group 0, "flag-name-655"
+//   656: group 0, "flag-name-656"
+//   657: group 0, "flag-name-657"
+//   658: group 0, "flag-name-658"
+//   659: group 0, "flag-name-659"
+//   660: group 0, "flag-name-660"
+//   661: group 0, "flag-name-661"
+//   662: group 0, "flag-name-662"
+//   663: group 0, "flag-name-663"
+//   664: group 0, "flag-name-664"
+//   665: group 0, "flag-name-665"
+//   666: group 0, "flag-name-666"
+//   667: group 0, "flag-name-667"
+//   668: group 0, "flag-name-668"
+//   669: group 0, "flag-name-669"
+//   670: group 0, "flag-name-670"
+//   671: group 0, "flag-name-671"
+//   672: group 0, "flag-name-672"
+//   673: group 0, "flag-name-673"
+//   674: group 0, "flag-name-674"
+//   675: group 0, "flag-name-675"
+//   676: group 0, "flag-name-676"
+//   677: group 0, "flag-name-677"
+//   678: group 0, "flag-name-678"
+//   679: group 0, "flag-name-679"
+//   680: group 0, "flag-name-680"
+//   681: group 0, "flag-name-681"
+//   682: group 0, "flag-name-682"
+//   683: group 0, "flag-name-683"
+//   684: group 0, "flag-name-684"
+//   685: group 0, "flag-name-685"
+//   686: group 0, "flag-name-686"
+//   687: group 0, "flag-name-687"
+//   688: group 0, "flag-name-688"
+//   689: group 0, "flag-name-689"
+//   690: group 0, "flag-name-690"
+//   691: group 0, "flag-name-691"
+//   692: group 0, "flag-name-692"
+//   693: group 0, "flag-name-693"
+//   694: group 0, "flag-name-694"
+//   695: group 0, "flag-name-695"
+//   696: group 0, "flag-name-696"
+//   697: group 0, "flag-name-697"
+//   698: group 0, "flag-name-698"
+//   699: group 0, "flag-name-699"
+//   700: group 0, "flag-name-700"
+//   701: group 0, "flag-name-701"
+//   702: group 0, "flag-name-702"
+//   703: group 0, "flag-name-703"
+//   704: group 0, "flag-name-704"
+//   705: group 0, "flag-name-705"
+//   706: group 0, "flag-name-706"
+//   707: group 0, "flag-name-707"
+//   708: group 0, "flag-name-708"
+//   709: group 0, "flag-name-709"
+//   710: group 0, "flag-name-710"
+//   711: group 0, "flag-name-711"
+//   712: group 0, "flag-name-712"
+//   713: group 0, "flag-name-713"
+//   714: group 0, "flag-name-714"
+//   715: group 0, "flag-name-715"
+//   716: group 0, "flag-name-716"
+//   717: group 0, "flag-name-717"
+//   718: group 0, "flag-name-718"
+//   719: group 0, "flag-name-719"
+//   720: group 0, "flag-name-720"
+//   721: group 0, "flag-name-721"
+//   722: group 0, "flag-name-722"
+//   723: group 0, "flag-name-723"
+//   724: group 0, "flag-name-724"
+//   725: group 0, "flag-name-725"
+//   726: group 0, "flag-name-726"
+//   727: group 0, "flag-name-727"
+//   728: group 0, "flag-name-728"
+//   729: group 0, "flag-name-729"
+//   730: group 0, "flag-name-730"
+//   731: group 0, "flag-name-731"
+//   732: group 0, "flag-name-732"
+//   733: group 0, "flag-name-733"
+//   734: group 0, "flag-name-734"
+//   735: group 0, "flag-name-735"
+//   736: group 0, "flag-name-736"
+//   737: group 0, "flag-name-737"
+//   738: group 0, "flag-name-738"
+//   739: group 0, "flag-name-739"
+//   740: group 0, "flag-name-740"
+//   741: group 0, "flag-name-741"
+//   742: group 0, "flag-name-742"
+//   743: group 0, "flag-name-743"
+//   744: group 0, "flag-name-744"
+//   745: group 0, "flag-name-745"
+//   746: group 0, "flag-name-746"
+//   747: group 0, "flag-name-747"
+//   748: group 0, "flag-name-748"
+//   749: group 0, "flag-name-749"
+//   750: group 0, "flag-name-750"
+//   751: group 0, "flag-name-751"
+//   752: group 0, "flag-name-752"
+//   753: group 0, "flag-name-753"
+//   754: group 0, "flag-name-754"
+//   755: group 0, "flag-name-755"
+//   756: group 0, "flag-name-756"
+//   757: group 0, "flag-name-757"
+//   758: group 0, "flag-name-758"
+//   759: group 0, "flag-name-759"
+//   760: group 0, "flag-name-760"
+//   761: group 0, "flag-name-761"
+//   762: group 0, "flag-name-762"
+//   763: group 0, "flag-name-763"
+//   764: group 0, "flag-name-764"
+//   765: group 0, "flag-name-765"
+//   766: group 0, "flag-name-766"
+//   767: group 0, "flag-name-767"
+//   768: group 0, "flag-name-768"
+//   769: group 0, "flag-name-769"
+//   770: group 0, "flag-name-770"
+//   771: group 0, "flag-name-771"
+//   772: group 0, "flag-name-772"
+//   773: group 0, "flag-name-773"
+//   774: group 0, "flag-name-774"
+//   775: group 0, "flag-name-775"
+//   776: group 0, "flag-name-776"
+//   777: group 0, "flag-name-777"
+//   778: group 0, "flag-name-778"
+//   779: group 0, "flag-name-779"
+//   780: group 0, "flag-name-780"
+//   781: group 0, "flag-name-781"
+//   782: group 0, "flag-name-782"
+//   783: group 0, "flag-name-783"
+//   784: group 0, "flag-name-784"
+//   785: group 0, "flag-name-785"
+//   786: group 0, "flag-name-786"
+//   787: group 0, "flag-name-787"
+//   788: group 0, "flag-name-788"
+//   789: group 0, "flag-name-789"
+//   790: group 0, "flag-name-790"
+//   791: group 0, "flag-name-791"
+//   792: group 0, "flag-name-792"
+//   793: group 0, "flag-name-793"
+//   794: group 0, "flag-name-794"
+//   795: group 0, "flag-name-795"
+//   796: group 0, "flag-name-796"
+//   797: group 0, "flag-name-797"
+//   798: group 0, "flag-name-798"
+//   799: group 0, "flag-name-799"
+//   800: group 0, "flag-name-800"
+//   801: group 0, "flag-name-801"
+//   802: group 0, "flag-name-802"
+//   803: group 0, "flag-name-803"
+//   804: group 0, "flag-name-804"
+//   805: group 0, "flag-name-805"
+//   806: group 0, "flag-name-806"
+//   807: group 0, "flag-name-807"
+//   808: group 0, "flag-name-808"
+//   809: group 0, "flag-name-809"
+//   810: group 0, "flag-name-810"
+//   811: group 0, "flag-name-811"
+//   812: group 0, "flag-name-812"
+//   813: group 0, "flag-name-813"
+//   814: group 0, "flag-name-814"
+//   815: group 0, "flag-name-815"
+//   816: group 0, "flag-name-816"
+//   817: group 0, "flag-name-817"
+//   818: group 0, "flag-name-818"
+//   819: group 0, "flag-name-819"
+//   820: group 0, "flag-name-820"
+//   821: group 0, "flag-name-821"
+//   822: group 0, "flag-name-822"
+//   823: group 0, "flag-name-823"
+//   824: group 0, "flag-name-824"
+//   825: group 0, "flag-name-825"
+//   826: group 0, "flag-name-826"
+//   827: group 0, "flag-name-827"
+//   828: group 0, "flag-name-828"
+//   829: group 0, "flag-name-829"
+//   830: group 0, "flag-name-830"
+//   831: group 0, "flag-name-831"
+//   832: group 0, "flag-name-832"
+//   833: group 0, "flag-name-833"
+//   834: group 0, "flag-name-834"
+//   835: group 0, "flag-name-835"
+//   836: group 0, "flag-name-836"
+//   837: group 0, "flag-name-837"
+//   838: group 0, "flag-name-838"
+//   839: group 0, "flag-name-839"
+//   840: group 0, "flag-name-840"
+//   841: group 0, "flag-name-841"
+//   842: group 0, "flag-name-842"
+//   843: group 0, "flag-name-843"
+//   844: group 0, "flag-name-844"
+//   845: group 0, "flag-name-845"
+//   846: group 0, "flag-name-846"
+//   847: group 0, "flag-name-847"
+//   848: group 0, "flag-name-848"
+//   849: group 0, "flag-name-849"
+//   850: group 0, "flag-name-850"
+//   851: group 0, "flag-name-851"
+//   852: group 0, "flag-name-852"
+//   853: group 0, "flag-name-853"
+//   854: group 0, "flag-name-854"
+//   855: group 0, "flag-name-855"
+//   856: group 0, "flag-name-856"
+//   857: group 0, "flag-name-857"
+//   858: group 0, "flag-name-858"
+//   859: group 0, "flag-name-859"
+//   860: group 0, "flag-name-860"
+//   861: group 0, "flag-name-861"
+//   862: group 0, "flag-name-862"
+//   863: group 0, "flag-name-863"
+//   864: group 0, "flag-name-864"
+//   865: group 0, "flag-name-865"
+//   866: group 0, "flag-name-866"
+//   867: group 0, "flag-name-867"
+//   868: group 0, "flag-name-868"
+//   869: group 0, "flag-name-869"
+//   870: group 0, "flag-name-870"
+//   871: group 0, "flag-name-871"
+//   872: group 0, "flag-name-872"
+//   873: group 0, "flag-name-873"
+//   874: group 0, "flag-name-874"
+//   875: group 0, "flag-name-875"
+//   876: group 0, "flag-name-876"
+//   877: group 0, "flag-name-877"
+//   878: group 0, "flag-name-878"
+//   879: group 0, "flag-name-879"
+//   880: group 0, "flag-name-880"
+//   881: group 0, "flag-name-881"
+//   882: group 0, "flag-name-882"
+//   883: group 0, "flag-name-883"
+//   884: group 0, "flag-name-884"
+//   885: group 0, "flag-name-885"
+//   886: group 0, "flag-name-886"
+//   887: group 0, "flag-name-887"
+//   888: group 0, "flag-name-888"
+//   889: group 0, "flag-name-889"
+//   890: group 0, "flag-name-890"
+//   891: group 0, "flag-name-891"
+//   892: group 0, "flag-name-892"
+//   893: group 0, "flag-name-893"
+//   894: group 0, "flag-name-894"
+//   895: group 0, "flag-name-895"
+//   896: group 0, "flag-name-896"
+//   897: group 0, "flag-name-897"
+//   898: group 0, "flag-name-898"
+//   899: group 0, "flag-name-899"
+//   900: group 0, "flag-name-900"
+//   901: group 0, "flag-name-901"
+//   902: group 0, "flag-name-902"
+//   903: group 0, "flag-name-903"
+//   904: group 0, "flag-name-904"
+//   905: group 0, "flag-name-905"
+//   906: group 0, "flag-name-906"
+//   907: group 0, "flag-name-907"
+//   908: group 0, "flag-name-908"
+//   909: group 0, "flag-name-909"
+//   910: group 0, "flag-name-910"
+//   911: group 0, "flag-name-911"
+//   912: group 0, "flag-name-912"
+//   913: group 0, "flag-name-913"
+//   914: group 0, "flag-name-914"
+//   915: group 0, "flag-name-915"
+//   916: group 0, "flag-name-916"
+//   917: group 0, "flag-name-917"
+//   918: group 0, "flag-name-918"
+//   919: group 0, "flag-name-919"
+//   920: group 0, "flag-name-920"
+//   921: group 0, "flag-name-921"
+//   922: group 0, "flag-name-922"
+//   923: group 0, "flag-name-923"
+//   924: group 0, "flag-name-924"
+//   925: group 0, "flag-name-925"
+//   926: group 0, "flag-name-926"
+//   927: group 0, "flag-name-927"
+//   928: group 0, "flag-name-928"
+//   929: group 0, "flag-name-929"
+//   930: group 0, "flag-name-930"
+//   931: group 0, "flag-name-931"
+//   932: group 0, "flag-name-932"
+//   933: group 0, "flag-name-933"
+//   934: group 0, "flag-name-934"
+//   935: group 0, "flag-name-935"
+//   936: group 0, "flag-name-936"
+//   937: group 0, "flag-name-937"
+//   938: group 0, "flag-name-938"
+//   939: group 0, "flag-name-939"
+//   940: group 0, "flag-name-940"
+//   941: group 0, "flag-name-941"
+//   942: group 0, "flag-name-942"
+//   943: group 0, "flag-name-943"
+//   944: group 0, "flag-name-944"
+//   945: group 0, "flag-name-945"
+//   946: group 0, "flag-name-946"
+//   947: group 0, "flag-name-947"
+//   948: group 0, "flag-name-948"
+//   949: group 0, "flag-name-949"
+//   950: group 0, "flag-name-950"
+//   951: group 0, "flag-name-951"
+//   952: group 0, "flag-name-952"
+//   953: group 0, "flag-name-953"
+//   954: group 0, "flag-name-954"
+//   955: group 0, "flag-name-955"
+//   956: group 0, "flag-name-956"
+//   957: group 0, "flag-name-957"
+//   958: group 0, "flag-name-958"
+//   959: group 0, "flag-name-959"
+//   960: group 0, "flag-name-960"
+//   961: group 0, "flag-name-961"
+//   962: group 0, "flag-name-962"
+//   963: group 0, "flag-name-963"
+//   964: group 0, "flag-name-964"
+//   965: group 0, "flag-name-965"
+//   966: group 0, "flag-name-966"
+//   967: group 0, "flag-name-967"
+//   968: group 0, "flag-name-968"
+//   969: group 0, "flag-name-969"
+//   970: group 0, "flag-name-970"
+//   971: group 0, "flag-name-971"
+//   972: group 0, "flag-name-972"
+//   973: group 0, "flag-name-973"
+//   974: group 0, "flag-name-974"
+//   975: group 0, "flag-name-975"
+//   976: group 0, "flag-name-976"
+//   977: group 0, "flag-name-977"
+//   978: group 0, "flag-name-978"
+//   979: group 0, "flag-name-979"
+//   980: group 0, "flag-name-980"
+//   981: group 0, "flag-name-981"
+//   982: group 0, "flag-name-982"
+//   983: group 0, "flag-name-983"
+//   984: group 0, "flag-name-984"
+//   985: group 0, "flag-name-985"
+//   986: group 0, "flag-name-986"
+//   987: group 0, "flag-name-987"
+//   988: group 0, "flag-name-988"
+//   989: group 0, "flag-name-989"
+//   990: group 0, "flag-name-990"
+//   991: group 0, "flag-name-991"
+//   992: group 0, "flag-name-992"
+//   993: group 0, "flag-name-993"
+//   994: group 0, "flag-name-994"
+//   995: group 0, "flag-name-995"
+//   996: group 0, "flag-name-996"
+//   997: group 0, "flag-name-997"
+//   998: group 0, "flag-name-998"
+//   999: group 0, "flag-name-999"
+//   1000: group 0, "flag-name-1000"
+//   1001: group 0, "flag-name-1001"
+//   1002: group 0, "flag-name-1002"
+//   1003: group 0, "flag-name-1003"
+//   1004: group 0, "flag-name-1004"
+//   1005: group 0, "flag-name-1005"
+//   1006: group 0, "flag-name-1006"
+//   1007: group 0, "flag-name-1007"
+//   1008: group 0, "flag-name-1008"
+//   1009: group 0, "flag-name-1009"
+//   1010: group 0, "flag-name-1010"
+//   1011: group 0, "flag-name-1011"
+//   1012: group 0, "flag-name-1012"
+//   1013: group 0, "flag-name-1013"
+//   1014: group 0, "flag-name-1014"
+//   1015: group 0, "flag-name-1015"
+//   1016: group 0, "flag-name-1016"
+//   1017: group 0, "flag-name-1017"
+//   1018: group 0, "flag-name-1018"
+//   1019: group 0, "flag-name-1019"
+//   1020: group 0, "flag-name-1020"
+//   1021: group 0, "flag-name-1021"
+//   1022: group 0, "flag-name-1022"
+//   1023: group 0, "flag-name-1023"
+//   1024: group 0, "flag-name-1024"
+//   1025: group 0, "flag-name-1025"
+//   1026: group 0, "flag-name-1026"
+//   1027: group 0, "flag-name-1027"
+//   1028: group 0, "flag-name-1028"
+//   1029: group 0, "flag-name-1029"
+//   1030: group 0, "flag-name-1030"
+//   1031: group 0, "flag-name-1031"
+//   1032: group 0, "flag-name-1032"
+//   1033: group 0, "flag-name-1033"
+//   1034: group 0, "flag-name-1034"
+//   1035: group 0, "flag-name-1035"
+//   1036: group 0, "flag-name-1036"
+//   1037: group 0, "flag-name-1037"
+//   1038: group 0, "flag-name-1038"
+//   1039: group 0, "flag-name-1039"
+//   1040: group 0, "flag-name-1040"
+//   1041: group 0, "flag-name-1041"
+//   1042: group 0, "flag-name-1042"
+//   1043: group 0, "flag-name-1043"
+//   1044: group 0, "flag-name-1044"
+//   1045: group 0, "flag-name-1045"
+//   1046: group 0, "flag-name-1046"
+//   1047: group 0, "flag-name-1047"
+//   1048: group 0, "flag-name-1048"
+//   1049: group 0, "flag-name-1049"
+//   1050: group 0, "flag-name-1050"
+//   1051: group 0, "flag-name-1051"
+//   1052: group 0, "flag-name-1052"
+//   1053: group 0, "flag-name-1053"
+//   1054: group 0, "flag-name-1054"
+//   1055: group 0, "flag-name-1055"
+//   1056: group 0, "flag-name-1056"
+//   1057: group 0, "flag-name-1057"
+//   1058: group 0, "flag-name-1058"
+//   1059: group 0, "flag-name-1059"
+//   1060: group 0, "flag-name-1060"
+//   1061: group 0, "flag-name-1061"
+//   1062: group 0, "flag-name-1062"
+//   1063: group 0, "flag-name-1063"
+//   1064: group 0, "flag-name-1064"
+//   1065: group 0, "flag-name-1065"
+//   1066: group 0, "flag-name-1066"
+//   1067: group 0, "flag-name-1067"
+//   1068: group 0, "flag-name-1068"
+//   1069: group 0, "flag-name-1069"
+//   1070: group 0, "flag-name-1070"
+//   1071: group 0, "flag-name-1071"
+//   1072: group 0, "flag-name-1072"
+//   1073: group 0, "flag-name-1073"
+//   1074: group 0, "flag-name-1074"
+//   1075: group 0, "flag-name-1075"
+//   1076: group 0, "flag-name-1076"
+//   1077: group 0, "flag-name-1077"
+//   1078: group 0, "flag-name-1078"
+//   1079: group 0, "flag-name-1079"
+//   1080: group 0, "flag-name-1080"
+//   1081: group 0, "flag-name-1081"
+//   1082: group 0, "flag-name-1082"
+//   1083: group 0, "flag-name-1083"
+//   1084: group 0, "flag-name-1084"
+//   1085: group 0, "flag-name-1085"
+//   1086: group 0, "flag-name-1086"
+//   1087: group 0, "flag-name-1087"
+//   1088: group 0, "flag-name-1088"
+//   1089: group 0, "flag-name-1089"
+//   1090: group 0, "flag-name-1090"
+//   1091: group 0, "flag-name-1091"
+//   1092: group 0, "flag-name-1092"
+//   1093: group 0, "flag-name-1093"
+//   1094: group 0, "flag-name-1094"
+//   1095: group 0, "flag-name-1095"
+//   1096: group 0, "flag-name-1096"
+//   1097: group 0, "flag-name-1097"
+//   1098: group 0, "flag-name-1098"
+//   1099: group 0, "flag-name-1099"
+//   1100: group 0, "flag-name-1100"
+//   1101: group 0, "flag-name-1101"
+//   1102: group 0, "flag-name-1102"
+//   1103: group 0, "flag-name-1103"
+//   1104: group 0, "flag-name-1104"
+//   1105: group 0, "flag-name-1105"
+//   1106: group 0, "flag-name-1106"
+//   1107: group 0, "flag-name-1107"
+//   1108: group 0, "flag-name-1108"
+//   1109: group 0, "flag-name-1109"
+//   1110: group 0, "flag-name-1110"
+//   1111: group 0, "flag-name-1111"
+//   1112: group 0, "flag-name-1112"
+//   1113: group 0, "flag-name-1113"
+//   1114: group 0, "flag-name-1114"
+//   1115: group 0, "flag-name-1115"
+//   1116: group 0, "flag-name-1116"
+//   1117: group 0, "flag-name-1117"
+//   1118: group 0, "flag-name-1118"
+//   1119: group 0, "flag-name-1119"
+//   1120: group 0, "flag-name-1120"
+//   1121: group 0, "flag-name-1121"
+//   1122: group 0, "flag-name-1122"
+//   1123: group 0, "flag-name-1123"
+//   1124: group 0, "flag-name-1124"
+//   1125: group 0, "flag-name-1125"
+//   1126: group 0, "flag-name-1126"
+//   1127: group 0, "flag-name-1127"
+//   1128: group 0, "flag-name-1128"
+//   1129: group 0, "flag-name-1129"
+//   1130: group 0, "flag-name-1130"
+//   1131: group 0, "flag-name-1131"
+//   1132: group 0, "flag-name-1132"
+//   1133: group 0, "flag-name-1133"
+//   1134: group 0, "flag-name-1134"
+//   1135: group 0, "flag-name-1135"
+//   1136: group 0, "flag-name-1136"
+//   1137: group 0, "flag-name-1137"
+//   1138: group 0, "flag-name-1138"
+//   1139: group 0, "flag-name-1139"
+//   1140: group 0, "flag-name-1140"
+//   1141: group 0, "flag-name-1141"
+//   1142: group 0, "flag-name-1142"
+//   1143: group 0, "flag-name-1143"
+//   1144: group 0, "flag-name-1144"
+//   1145: group 0, "flag-name-1145"
+//   1146: group 0, "flag-name-1146"
+//   1147: group 0, "flag-name-1147"
+//   1148: group 0, "flag-name-1148"
+//   1149: group 0, "flag-name-1149"
+//   1150: group 0, "flag-name-1150"
+//   1151: group 0, "flag-name-1151"
+//   1152: group 0, "flag-name-1152"
+//   1153: group 0, "flag-name-1153"
+//   1154: group 0, "flag-name-1154"
+//   1155: group 0, "flag-name-1155"
+//   1156: group 0, "flag-name-1156"
+//   1157: group 0, "flag-name-1157"
+//   1158: group 0, "flag-name-1158"
+//   1159: group 0, "flag-name-1159"
+//   1160: group 0, "flag-name-1160"
+//   1161: group 0, "flag-name-1161"
+//   1162: group 0, "flag-name-1162"
+//   1163: group 0, "flag-name-1163"
+//   1164: group 0, "flag-name-1164"
+//   1165: group 0, "flag-name-1165"
+//   1166: group 0, "flag-name-1166"
+//   1167: group 0, "flag-name-1167"
+//   1168: group 0, "flag-name-1168"
+//   1169: group 0, "flag-name-1169"
+//   1170: group 0, "flag-name-1170"
+//   1171: group 0, "flag-name-1171"
+//   1172: group 0, "flag-name-1172"
+//   1173: group 0, "flag-name-1173"
+//   1174: group 0, "flag-name-1174"
+//   1175: group 0, "flag-name-1175"
+//   1176: group 0, "flag-name-1176"
+//   1177: group 0, "flag-name-1177"
+//   1178: group 0, "flag-name-1178"
+//   1179: group 0, "flag-name-1179"
+//   1180: group 0, "flag-name-1180"
+//   1181: group 0, "flag-name-1181"
+//   1182: group 0, "flag-name-1182"
+//   1183: group 0, "flag-name-1183"
+//   1184: group 0, "flag-name-1184"
+//   1185: group 0, "flag-name-1185"
+//   1186: group 0, "flag-name-1186"
+//   1187: group 0, "flag-name-1187"
+//   1188: group 0, "flag-name-1188"
+//   1189: group 0, "flag-name-1189"
+//   1190: group 0, "flag-name-1190"
+//   1191: group 0, "flag-name-1191"
+//   1192: group 0, "flag-name-1192"
+//   1193: group 0, "flag-name-1193"
+//   1194: group 0, "flag-name-1194"
+//   1195: group 0, "flag-name-1195"
+//   1196: group 0, "flag-name-1196"
+//   1197: group 0, "flag-name-1197"
+//   1198: group 0, "flag-name-1198"
+//   1199: group 0, "flag-name-1199"
+//   1200: group 0, "flag-name-1200"
+//   1201: group 0, "flag-name-1201"
+//   1202: group 0, "flag-name-1202"
+//   1203: group 0, "flag-name-1203"
+//   1204: group 0, "flag-name-1204"
+//   1205: group 0, "flag-name-1205"
+//   1206: group 0, "flag-name-1206"
+//   1207: group 0, "flag-name-1207"
+//   1208: group 0, "flag-name-1208"
+//   1209: group 0, "flag-name-1209"
+//   1210: group 0, "flag-name-1210"
+//   1211: group 0, "flag-name-1211"
+//   1212: group 0, "flag-name-1212"
+//   1213: group 0, "flag-name-1213"
+//   1214: group 0, "flag-name-1214"
+//   1215: group 0, "flag-name-1215"
+//   1216: group 0, "flag-name-1216"
+//   1217: group 0, "flag-name-1217"
+//   1218: group 0, "flag-name-1218"
+//   1219: group 0, "flag-name-1219"
+//   1220: group 0, "flag-name-1220"
+//   1221: group 0, "flag-name-1221"
+//   1222: group 0, "flag-name-1222"
+//   1223: group 0, "flag-name-1223"
+//   1224: group 0, "flag-name-1224"
+//   1225: group 0, "flag-name-1225"
+//   1226: group 0, "flag-name-1226"
+//   1227: group 0, "flag-name-1227"
+//   1228: group 0, "flag-name-1228"
+//   1229: group 0, "flag-name-1229"
+//   1230: group 0, "flag-name-1230"
+//   1231: group 0, "flag-name-1231"
+//   1232: group 0, "flag-name-1232"
+//   1233: group 0, "flag-name-1233"
+//   1234: group 0, "flag-name-1234"
+//   1235: group 0, "flag-name-1235"
+//   1236: group 0, "flag-name-1236"
+//   1237: group 0, "flag-name-1237"
+//   1238: group 0, "flag-name-1238"
+//   1239: group 0, "flag-name-1239"
+//   1240: group 0, "flag-name-1240"
+//   1241: group 0, "flag-name-1241"
+//   1242: group 0, "flag-name-1242"
+//   1243: group 0, "flag-name-1243"
+//   1244: group 0, "flag-name-1244"
+//   1245: group 0, "flag-name-1245"
+//   1246: group 0, "flag-name-1246"
+//   1247: group 0, "flag-name-1247"
+//   1248: group 0, "flag-name-1248"
+//   1249: group 0, "flag-name-1249"
+//   1250: group 0, "flag-name-1250"
+//   1251: group 0, "flag-name-1251"
+//   1252: group 0, "flag-name-1252"
+//   1253: group 0, "flag-name-1253"
+//   1254: group 0, "flag-name-1254"
+//   1255: group 0, "flag-name-1255"
+//   1256: group 0, "flag-name-1256"
+//   1257: group 0, "flag-name-1257"
+//   1258: group 0, "flag-name-1258"
+//   1259: group 0, "flag-name-1259"
+//   1260: group 0, "flag-name-1260"
+//   1261: group 0, "flag-name-1261"
+//   1262: group 0, "flag-name-1262"
+//   1263: group 0, "flag-name-1263"
+//   1264: group 0, "flag-name-1264"
+//   1265: group 0, "flag-name-1265"
+//   1266: group 0, "flag-name-1266"
+//   1267: group 0, "flag-name-1267"
+//   1268: group 0, "flag-name-1268"
+//   1269: group 0, "flag-name-1269"
+//   1270: group 0, "flag-name-1270"
+//   1271: group 0, "flag-name-1271"
+//   1272: group 0, "flag-name-1272"
+//   1273: group 0, "flag-name-1273"
+//   1274: group 0, "flag-name-1274"
+//   1275: group 0, "flag-name-1275"
+//   1276: group 0, "flag-name-1276"
+//   1277: group 0, "flag-name-1277"
+//   1278: group 0, "flag-name-1278"
+//   1279: group 0, "flag-name-1279"
+//   1280: group 0, "flag-name-1280"
+//   1281: group 0, "flag-name-1281"
+//   1282: group 0, "flag-name-1282"
+//   1283: group 0, "flag-name-1283"
+//   1284: group 0, "flag-name-1284"
+//   1285: group 0, "flag-name-1285"
+//   1286: group 0, "flag-name-1286"
+//   1287: group 0, "flag-name-1287"
+//   1288: group 0, "flag-name-1288"
+//   1289: group 0, "flag-name-1289"
+//   1290: group 0, "flag-name-1290"
+//   1291: group 0, "flag-name-1291"
+//   1292: group 0, "flag-name-1292"
+//   1293: group 0, "flag-name-1293"
+//   1294: group 0, "flag-name-1294"
+//   1295: group 0, "flag-name-1295"
+//   1296: group 0, "flag-name-1296"
+//   1297: group 0, "flag-name-1297"
+//   1298: group 0, "flag-name-1298"
+//   1299: group 0, "flag-name-1299"
+//   1300: group 0, "flag-name-1300"
+//   1301: group 0, "flag-name-1301"
+//   1302: group 0, "flag-name-1302"
+//   1303: group 0, "flag-name-1303"
+//   1304: group 0, "flag-name-1304"
+//   1305: group 0, "flag-name-1305"
+//   1306: group 0, "flag-name-1306"
+//   1307: group 0, "flag-name-1307"
+//   1308: group 0, "flag-name-1308"
+//   1309: group 0, "flag-name-1309"
+//   1310: group 0, "flag-name-1310"
+//   1311: group 0, "flag-name-1311"
+//   1312: group 0, "flag-name-1312"
+//   1313: group 0, "flag-name-1313"
+//   1314: group 0, "flag-name-1314"
+//   1315: group 0, "flag-name-1315"
+//   1316: group 0, "flag-name-1316"
+//   1317: group 0, "flag-name-1317"
+//   1318: group 0, "flag-name-1318"
+//   1319: group 0, "flag-name-1319"
+//   1320: group 0, "flag-name-1320"
+//   1321: group 0, "flag-name-1321"
+//   1322: group 0, "flag-name-1322"
+//   1323: group 0, "flag-name-1323"
+//   1324: group 0, "flag-name-1324"
+//   1325: group 0, "flag-name-1325"
+//   1326: group 0, "flag-name-1326"
+//   1327: group 0, "flag-name-1327"
+//   1328: group 0, "flag-name-1328"
+//   1329: group 0, "flag-name-1329"
+//   1330: group 0, "flag-name-1330"
+//   1331: group 0, "flag-name-1331"
+//   1332: group 0, "flag-name-1332"
+//   1333: group 0, "flag-name-1333"
+//   1334: group 0, "flag-name-1334"
+//   1335: group 0, "flag-name-1335"
+//   1336: group 0, "flag-name-1336"
+//   1337: group 0, "flag-name-1337"
+//   1338: group 0, "flag-name-1338"
+//   1339: group 0, "flag-name-1339"
+//   1340: group 0, "flag-name-1340"
+//   1341: group 0, "flag-name-1341"
+//   1342: group 0, "flag-name-1342"
+//   1343: group 0, "flag-name-1343"
+//   1344: group 0, "flag-name-1344"
+//   1345: group 0, "flag-name-1345"
+//   1346: group 0, "flag-name-1346"
+//   1347: group 0, "flag-name-1347"
+//   1348: group 0, "flag-name-1348"
+//   1349: group 0, "flag-name-1349"
+//   1350: group 0, "flag-name-1350"
+//   1351: group 0, "flag-name-1351"
+//   1352: group 0, "flag-name-1352"
+//   1353: group 0, "flag-name-1353"
+//   1354: group 0, "flag-name-1354"
+//   1355: group 0, "flag-name-1355"
+//   1356: group 0, "flag-name-1356"
+//   1357: group 0, "flag-name-1357"
+//   1358: group 0, "flag-name-1358"
+//   1359: group 0, "flag-name-1359"
+//   1360: group 0, "flag-name-1360"
+//   1361: group 0, "flag-name-1361"
+//   1362: group 0, "flag-name-1362"
+//   1363: group 0, "flag-name-1363"
+//   1364: group 0, "flag-name-1364"
+//   1365: group 0, "flag-name-1365"
+//   1366: group 0, "flag-name-1366"
+//   1367: group 0, "flag-name-1367"
+//   1368: group 0, "flag-name-1368"
+//   1369: group 0, "flag-name-1369"
+//   1370: group 0, "flag-name-1370"
+//   1371: group 0, "flag-name-1371"
+//   1372: group 0, "flag-name-1372"
+//   1373: group 0, "flag-name-1373"
+//   1374: group 0, "flag-name-1374"
+//   1375: group 0, "flag-name-1375"
+//   1376: group 0, "flag-name-1376"
+//   1377: group 0, "flag-name-1377"
+//   1378: group 0, "flag-name-1378"
+//   1379: group 0, "flag-name-1379"
+//   1380: group 0, "flag-name-1380"
+//   1381: group 0, "flag-name-1381"
+//   1382: group 0, "flag-name-1382"
+//   1383: group 0, "flag-name-1383"
+//   1384: group 0, "flag-name-1384"
+//   1385: group 0, "flag-name-1385"
+//   1386: group 0, "flag-name-1386"
+//   1387: group 0, "flag-name-1387"
+//   1388: group 0, "flag-name-1388"
+//   1389: group 0, "flag-name-1389"
+//   1390: group 0, "flag-name-1390"
+//   1391: group 0, "flag-name-1391"
+//   1392: group 0, "flag-name-1392"
+//   1393: group 0, "flag-name-1393"
+//   1394: group 0, "flag-name-1394"
+//   1395: group 0, "flag-name-1395"
+//   1396: group 0, "flag-name-1396"
+//   1397: group 0, "flag-name-1397"
+//   1398: group 0, "flag-name-1398"
+//   1399: group 0, "flag-name-1399"
+//   1400: group 0, "flag-name-1400"
+//   1401: group 0, "flag-name-1401"
+//   1402: group 0, "flag-name-1402"
+//   1403: group 0, "flag-name-1403"
+//   1404: group 0, "flag-name-1404"
+//   1405: group 0, "flag-name-1405"
+//   1406: group 0, "flag-name-1406"
+//   1407: group 0, "flag-name-1407"
+//   1408: group 0, "flag-name-1408"
+//   1409: group 0, "flag-name-1409"
+//   1410: group 0, "flag-name-1410"
+//   1411: group 0, "flag-name-1411"
+//   1412: group 0, "flag-name-1412"
+//   1413: group 0, "flag-name-1413"
+//   1414: group 0, "flag-name-1414"
+//   1415: group 0, "flag-name-1415"
+//   1416: group 0, "flag-name-1416"
+//   1417: group 0, "flag-name-1417"
+//   1418: group 0, "flag-name-1418"
+//   1419: group 0, "flag-name-1419"
+//   1420: group 0, "flag-name-1420"
+//   1421: group 0, "flag-name-1421"
+//   1422: group 0, "flag-name-1422"
+//   1423: group 0, "flag-name-1423"
+//   1424: group 0, "flag-name-1424"
+//   1425: group 0, "flag-name-1425"
+//   1426: group 0, "flag-name-1426"
+//   1427: group 0, "flag-name-1427"
+//   1428: group 0, "flag-name-1428"
+//   1429: group 0, "flag-name-1429"
+//   1430: group 0, "flag-name-1430"
+//   1431: group 0, "flag-name-1431"
+//   1432: group 0, "flag-name-1432"
+//   1433: group 0, "flag-name-1433"
+//   1434: group 0, "flag-name-1434"
+//   1435: group 0, "flag-name-1435"
+//   1436: group 0, "flag-name-1436"
+//   1437: group 0, "flag-name-1437"
+//   1438: group 0, "flag-name-1438"
+//   1439: group 0, "flag-name-1439"
+//   1440: group 0, "flag-name-1440"
+//   1441: group 0, "flag-name-1441"
+//   1442: group 0, "flag-name-1442"
+//   1443: group 0, "flag-name-1443"
+//   1444: group 0, "flag-name-1444"
+//   1445: group 0, "flag-name-1445"
+//   1446: group 0, "flag-name-1446"
+//   1447: group 0, "flag-name-1447"
+//   1448: group 0, "flag-name-1448"
+//   1449: group 0, "flag-name-1449"
+//   1450: group 0, "flag-name-1450"
+//   1451: group 0, "flag-name-1451"
+//   1452: group 0, "flag-name-1452"
+//   1453: group 0, "flag-name-1453"
+//   1454: group 0, "flag-name-1454"
+//   1455: group 0, "flag-name-1455"
+//   1456: group 0, "flag-name-1456"
+//   1457: group 0, "flag-name-1457"
+//   1458: group 0, "flag-name-1458"
+//   1459: group 0, "flag-name-1459"
+//   1460: group 0, "flag-name-1460"
+//   1461: group 0, "flag-name-1461"
+//   1462: group 0, "flag-name-1462"
+//   1463: group 0, "flag-name-1463"
+//   1464: group 0, "flag-name-1464"
+//   1465: group 0, "flag-name-1465"
+//   1466: group 0, "flag-name-1466"
+//   1467: group 0, "flag-name-1467"
+//   1468: group 0, "flag-name-1468"
+//   1469: group 0, "flag-name-1469"
+//   1470: group 0, "flag-name-1470"
+//   1471: group 0, "flag-name-1471"
+//   1472: group 0, "flag-name-1472"
+//   1473: group 0, "flag-name-1473"
+//   1474: group 0, "flag-name-1474"
+//   1475: group 0, "flag-name-1475"
+//   1476: group 0, "flag-name-1476"
+//   1477: group 0, "flag-name-1477"
+//   1478: group 0, "flag-name-1478"
+//   1479: group 0, "flag-name-1479"
+//   1480: group 0, "flag-name-1480"
+//   1481: group 0, "flag-name-1481"
+//   1482: group 0, "flag-name-1482"
+//   1483: group 0, "flag-name-1483"
+//   1484: group 0, "flag-name-1484"
+//   1485: group 0, "flag-name-1485"
+//   1486: group 0, "flag-name-1486"
+//   1487: group 0, "flag-name-1487"
+//   1488: group 0, "flag-name-1488"
+//   1489: group 0, "flag-name-1489"
+//   1490: group 0, "flag-name-1490"
+//   1491: group 0, "flag-name-1491"
+//   1492: group 0, "flag-name-1492"
+//   1493: group 0, "flag-name-1493"
+//   1494: group 0, "flag-name-1494"
+//   1495: group 0, "flag-name-1495"
+//   1496: group 0, "flag-name-1496"
+//   1497: group 0, "flag-name-1497"
+//   1498: group 0, "flag-name-1498"
+//   1499: group 0, "flag-name-1499"
+//   1500: group 0, "flag-name-1500"
+//   1501: group 0, "flag-name-1501"
+//   1502: group 0, "flag-name-1502"
+//   1503: group 0, "flag-name-1503"
+//   1504: group 0, "flag-name-1504"
+//   1505: group 0, "flag-name-1505"
+//   1506: group 0, "flag-name-1506"
+//   1507: group 0, "flag-name-1507"
+//   1508: group 0, "flag-name-1508"
+//   1509: group 0, "flag-name-1509"
+//   1510: group 0, "flag-name-1510"
+//   1511: group 0, "flag-name-1511"
+//   1512: group 0, "flag-name-1512"
+//   1513: group 0, "flag-name-1513"
+//   1514: group 0, "flag-name-1514"
+//   1515: group 0, "flag-name-1515"
+//   1516: group 0, "flag-name-1516"
+//   1517: group 0, "flag-name-1517"
+//   1518: group 0, "flag-name-1518"
+//   1519: group 0, "flag-name-1519"
+//   1520: group 0, "flag-name-1520"
+//   1521: group 0, "flag-name-1521"
+//   1522: group 0, "flag-name-1522"
+//   1523: group 0, "flag-name-1523"
+//   1524: group 0, "flag-name-1524"
+//   1525: group 0, "flag-name-1525"
+//   1526: group 0, "flag-name-1526"
+//   1527: group 0, "flag-name-1527"
+//   1528: group 0, "flag-name-1528"
+//   1529: group 0, "flag-name-1529"
+//   1530: group 0, "flag-name-1530"
+//   1531: group 0, "flag-name-1531"
+//   1532: group 0, "flag-name-1532"
+//   1533: group 0, "flag-name-1533"
+//   1534: group 0, "flag-name-1534"
+//   1535: group 0, "flag-name-1535"
+//   1536: group 0, "flag-name-1536"
+//   1537: group 0, "flag-name-1537"
+//   1538: group 0, "flag-name-1538"
+//   1539: group 0, "flag-name-1539"
+//   1540: group 0, "flag-name-1540"
+//   1541: group 0, "flag-name-1541"
+//   1542: group 0, "flag-name-1542"
+//   1543: group 0, "flag-name-1543"
+//   1544: group 0, "flag-name-1544"
+//   1545: group 0, "flag-name-1545"
+//   1546: group 0, "flag-name-1546"
+//   1547: group 0, "flag-name-1547"
+//   1548: group 0, "flag-name-1548"
+//   1549: group 0, "flag-name-1549"
+//   1550: group 0, "flag-name-1550"
+//   1551: group 0, "flag-name-1551"
+//   1552: group 0, "flag-name-1552"
+//   1553: group 0, "flag-name-1553"
+//   1554: group 0, "flag-name-1554"
+//   1555: group 0, "flag-name-1555"
+//   1556: group 0, "flag-name-1556"
+//   1557: group 0, "flag-name-1557"
+//   1558: group 0, "flag-name-1558"
+//   1559: group 0, "flag-name-1559"
+//   1560: group 0, "flag-name-1560"
+//   1561: group 0, "flag-name-1561"
+//   1562: group 0, "flag-name-1562"
+//   1563: group 0, "flag-name-1563"
+//   1564: group 0, "flag-name-1564"
+//   1565: group 0, "flag-name-1565"
+//   1566: group 0, "flag-name-1566"
+//   1567: group 0, "flag-name-1567"
+//   1568: group 0, "flag-name-1568"
+//   1569: group 0, "flag-name-1569"
+//   1570: group 0, "flag-name-1570"
+//   1571: group 0, "flag-name-1571"
+//   1572: group 0, "flag-name-1572"
+//   1573: group 0, "flag-name-1573"
+//   1574: group 0, "flag-name-1574"
+//   1575: group 0, "flag-name-1575"
+//   1576: group 0, "flag-name-1576"
+//   1577: group 0, "flag-name-1577"
+//   1578: group 0, "flag-name-1578"
+//   1579: group 0, "flag-name-1579"
+//   1580: group 0, "flag-name-1580"
+//   1581: group 0, "flag-name-1581"
+//   1582: group 0, "flag-name-1582"
+//   1583: group 0, "flag-name-1583"
+//   1584: group 0, "flag-name-1584"
+//   1585: group 0, "flag-name-1585"
+//   1586: group 0, "flag-name-1586"
+//   1587: group 0, "flag-name-1587"
+//   1588: group 0, "flag-name-1588"
+//   1589: group 0, "flag-name-1589"
+//   1590: group 0, "flag-name-1590"
+//   1591: group 0, "flag-name-1591"
+//   1592: group 0, "flag-name-1592"
+//   1593: group 0, "flag-name-1593"
+//   1594: group 0, "flag-name-1594"
+//   1595: group 0, "flag-name-1595"
+//   1596: group 0, "flag-name-1596"
+//   1597: group 0, "flag-name-1597"
+//   1598: group 0, "flag-name-1598"
+//   1599: group 0, "flag-name-1599"
+//   1600: group 0, "flag-name-1600"
+//   1601: group 0, "flag-name-1601"
+//   1602: group 0, "flag-name-1602"
+//   1603: group 0, "flag-name-1603"
+//   1604: group 0, "flag-name-1604"
+//   1605: group 0, "flag-name-1605"
+//   1606: group 0, "flag-name-1606"
+//   1607: group 0, "flag-name-1607"
+//   1608: group 0, "flag-name-1608"
+//   1609: group 0, "flag-name-1609"
+//   1610: group 0, "flag-name-1610"
+//   1611: group 0, "flag-name-1611"
+//   1612: group 0, "flag-name-1612"
+//   1613: group 0, "flag-name-1613"
+//   1614: group 0, "flag-name-1614"
+//   1615: group 0, "flag-name-1615"
+//   1616: group 0, "flag-name-1616"
+//   1617: group 0, "flag-name-1617"
+//   1618: group 0, "flag-name-1618"
+//   1619: group 0, "flag-name-1619"
+//   1620: group 0, "flag-name-1620"
+//   1621: group 0, "flag-name-1621"
+//   1622: group 0, "flag-name-1622"
+//   1623: group 0, "flag-name-1623"
+//   1624: group 0, "flag-name-1624"
+//   1625: group 0, "flag-name-1625"
+//   1626: group 0, "flag-name-1626"
+//   1627: group 0, "flag-name-1627"
+//   1628: group 0, "flag-name-1628"
+//   1629: group 0, "flag-name-1629"
+//   1630: group 0, "flag-name-1630"
+//   1631: group 0, "flag-name-1631"
+//   1632: group 0, "flag-name-1632"
+//   1633: group 0, "flag-name-1633"
+//   1634: group 0, "flag-name-1634"
+//   1635: group 0, "flag-name-1635"
+//   1636: group 0, "flag-name-1636"
+//   1637: group 0, "flag-name-1637"
+//   1638: group 0, "flag-name-1638"
+//   1639: group 0, "flag-name-1639"
+//   1640: group 0, "flag-name-1640"
+//   1641: group 0, "flag-name-1641"
+//   1642: group 0, "flag-name-1642"
+//   1643: group 0, "flag-name-1643"
+//   1644: group 0, "flag-name-1644"
+//   1645: group 0, "flag-name-1645"
+//   1646: group 0, "flag-name-1646"
+//   1647: group 0, "flag-name-1647"
+//   1648: group 0, "flag-name-1648"
+//   1649: group 0, "flag-name-1649"
+//   1650: group 0, "flag-name-1650"
+//   1651: group 0, "flag-name-1651"
+//   1652: group 0, "flag-name-1652"
+//   1653: group 0, "flag-name-1653"
+//   1654: group 0, "flag-name-1654"
+//   1655: group 0, "flag-name-1655"
+//   1656: group 0, "flag-name-1656"
+//   1657: group 0, "flag-name-1657"
+//   1658: group 0, "flag-name-1658"
+//   1659: group 0, "flag-name-1659"
+//   1660: group 0, "flag-name-1660"
+//   1661: group 0, "flag-name-1661"
+//   1662: group 0, "flag-name-1662"
+//   1663: group 0, "flag-name-1663"
+//   1664: group 0, "flag-name-1664"
+//   1665: group 0, "flag-name-1665"
+//   1666: group 0, "flag-name-1666"
+//   1667: group 0, "flag-name-1667"
+//   1668: group 0, "flag-name-1668"
+//   1669: group 0, "flag-name-1669"
+//   1670: group 0, "flag-name-1670"
+//   1671: group 0, "flag-name-1671"
+//   1672: group 0, "flag-name-1672"
+//   1673: group 0, "flag-name-1673"
+//   1674: group 0, "flag-name-1674"
+//   1675: group 0, "flag-name-1675"
+//   1676: group 0, "flag-name-1676"
+//   1677: group 0, "flag-name-1677"
+//   1678: group 0, "flag-name-1678"
+//   1679: group 0, "flag-name-1679"
+//   1680: group 0, "flag-name-1680"
+//   1681: group 0, "flag-name-1681"
+//   1682: group 0, "flag-name-1682"
+//   1683: group 0, "flag-name-1683"
+//   1684: group 0, "flag-name-1684"
+//   1685: group 0, "flag-name-1685"
+//   1686: group 0, "flag-name-1686"
+//   1687: group 0, "flag-name-1687"
+//   1688: group 0, "flag-name-1688"
+//   1689: group 0, "flag-name-1689"
+//   1690: group 0, "flag-name-1690"
+//   1691: group 0, "flag-name-1691"
+//   1692: group 0, "flag-name-1692"
+//   1693: group 0, "flag-name-1693"
+//   1694: group 0, "flag-name-1694"
+//   1695: group 0, "flag-name-1695"
+//   1696: group 0, "flag-name-1696"
+//   1697: group 0, "flag-name-1697"
+//   1698: group 0, "flag-name-1698"
+//   1699: group 0, "flag-name-1699"
+//   1700: group 0, "flag-name-1700"
+//   1701: group 0, "flag-name-1701"
+//   1702: group 0, "flag-name-1702"
+//   1703: group 0, "flag-name-1703"
+//   1704: group 0, "flag-name-1704"
+//   1705: group 0, "flag-name-1705"
+//   1706: group 0, "flag-name-1706"
+//   1707: group 0, "flag-name-1707"
+//   1708: group 0, "flag-name-1708"
+//   1709: group 0, "flag-name-1709"
+//   1710: group 0, "flag-name-1710"
+//   1711: group 0, "flag-name-1711"
+//   1712: group 0, "flag-name-1712"
+//   1713: group 0, "flag-name-1713"
+//   1714: group 0, "flag-name-1714"
+//   1715: group 0, "flag-name-1715"
+//   1716: group 0, "flag-name-1716"
+//   1717: group 0, "flag-name-1717"
+//   1718: group 0, "flag-name-1718"
+//   1719: group 0, "flag-name-1719"
+//   1720: group 0, "flag-name-1720"
+//   1721: group 0, "flag-name-1721"
+//   1722: group 0, "flag-name-1722"
+//   1723: group 0, "flag-name-1723"
+//   1724: group 0, "flag-name-1724"
+//   1725: group 0, "flag-name-1725"
+//   1726: group 0, "flag-name-1726"
+//   1727: group 0, "flag-name-1727"
+//   1728: group 0, "flag-name-1728"
+//   1729: group 0, "flag-name-1729"
+//   1730: group 0, "flag-name-1730"
+//   1731: group 0, "flag-name-1731"
+//   1732: group 0, "flag-name-1732"
+//   1733: group 0, "flag-name-1733"
+//   1734: group 0, "flag-name-1734"
+//   1735: group 0, "flag-name-1735"
+//   1736: group 0, "flag-name-1736"
+//   1737: group 0, "flag-name-1737"
+//   1738: group 0, "flag-name-1738"
+//   1739: group 0, "flag-name-1739"
+//   1740: group 0, "flag-name-1740"
+//   1741: group 0, "flag-name-1741"
+//   1742: group 0, "flag-name-1742"
+//   1743: group 0, "flag-name-1743"
+//   1744: group 0, "flag-name-1744"
+//   1745: group 0, "flag-name-1745"
+//   1746: group 0, "flag-name-1746"
+//   1747: group 0, "flag-name-1747"
+//   1748: group 0, "flag-name-1748"
+//   1749: group 0, "flag-name-1749"
+//   1750: group 0, "flag-name-1750"
+//   1751: group 0, "flag-name-1751"
+//   1752: group 0, "flag-name-1752"
+//   1753: group 0, "flag-name-1753"
+//   1754: group 0, "flag-name-1754"
+//   1755: group 0, "flag-name-1755"
+//   1756: group 0, "flag-name-1756"
+//   1757: group 0, "flag-name-1757"
+//   1758: group 0, "flag-name-1758"
+//   1759: group 0, "flag-name-1759"
+//   1760: group 0, "flag-name-1760"
+//   1761: group 0, "flag-name-1761"
+//   1762: group 0, "flag-name-1762"
+//   1763: group 0, "flag-name-1763"
+//   1764: group 0, "flag-name-1764"
+//   1765: group 0, "flag-name-1765"
+//   1766: group 0, "flag-name-1766"
+//   1767: group 0, "flag-name-1767"
+//   1768: group 0, "flag-name-1768"
+//   1769: group 0, "flag-name-1769"
+//   1770: group 0, "flag-name-1770"
+//   1771: group 0, "flag-name-1771"
+//   1772: group 0, "flag-name-1772"
+//   1773: group 0, "flag-name-1773"
+//   1774: group 0, "flag-name-1774"
+//   1775: group 0, "flag-name-1775"
+//   1776: group 0, "flag-name-1776"
+//   1777: group 0, "flag-name-1777"
+//   1778: group 0, "flag-name-1778"
+//   1779: group 0, "flag-name-1779"
+//   1780: group 0, "flag-name-1780"
+//   1781: group 0, "flag-name-1781"
+//   1782: group 0, "flag-name-1782"
+//   1783: group 0, "flag-name-1783"
+//   1784: group 0, "flag-name-1784"
+//   1785: group 0, "flag-name-1785"
+//   1786: group 0, "flag-name-1786"
+//   1787: group 0, "flag-name-1787"
+//   1788: group 0, "flag-name-1788"
+//   1789: group 0, "flag-name-1789"
+//   1790: group 0, "flag-name-1790"
+//   1791: group 0, "flag-name-1791"
+//   1792: group 0, "flag-name-1792"
+//   1793: group 0, "flag-name-1793"
+//   1794: group 0, "flag-name-1794"
+//   1795: group 0, "flag-name-1795"
+//   1796: group 0, "flag-name-1796"
+//   1797: group 0, "flag-name-1797"
+//   1798: group 0, "flag-name-1798"
+//   1799: group 0, "flag-name-1799"
+//   1800: group 0, "flag-name-1800"
+//   1801: group 0, "flag-name-1801"
+//   1802: group 0, "flag-name-1802"
+//   1803: group 0, "flag-name-1803"
+//   1804: group 0, "flag-name-1804"
+//   1805: group 0, "flag-name-1805"
+//   1806: group 0, "flag-name-1806"
+//   1807: group 0, "flag-name-1807"
+//   1808: group 0, "flag-name-1808"
+//   1809: group 0, "flag-name-1809"
+//   1810: group 0, "flag-name-1810"
+//   1811: group 0, "flag-name-1811"
+//   1812: group 0, "flag-name-1812"
+//   1813: group 0, "flag-name-1813"
+//   1814: group 0, "flag-name-1814"
+//   1815: group 0, "flag-name-1815"
+//   1816: group 0, "flag-name-1816"
+//   1817: group 0, "flag-name-1817"
+//   1818: group 0, "flag-name-1818"
+//   1819: group 0, "flag-name-1819"
+//   1820: group 0, "flag-name-1820"
+//   1821: group 0, "flag-name-1821"
+//   1822: group 0, "flag-name-1822"
+//   1823: group 0, "flag-name-1823"
+//   1824: group 0, "flag-name-1824"
+//   1825: group 0, "flag-name-1825"
+//   1826: group 0, "flag-name-1826"
+//   1827: group 0, "flag-name-1827"
+//   1828: group 0, "flag-name-1828"
+//   1829: group 0, "flag-name-1829"
+//   1830: group 0, "flag-name-1830"
+//   1831: group 0, "flag-name-1831"
+//   1832: group 0, "flag-name-1832"
+//   1833: group 0, "flag-name-1833"
+//   1834: group 0, "flag-name-1834"
+//   1835: group 0, "flag-name-1835"
+//   1836: group 0, "flag-name-1836"
+//   1837: group 0, "flag-name-1837"
+//   1838: group 0, "flag-name-1838"
+//   1839: group 0, "flag-name-1839"
+//   1840: group 0, "flag-name-1840"
+//   1841: group 0, "flag-name-1841"
+//   1842: group 0, "flag-name-1842"
+//   1843: group 0, "flag-name-1843"
+//   1844: group 0, "flag-name-1844"
+//   1845: group 0, "flag-name-1845"
+//   1846: group 0, "flag-name-1846"
+//   1847: group 0, "flag-name-1847"
+//   1848: group 0, "flag-name-1848"
+//   1849: group 0, "flag-name-1849"
+//   1850: group 0, "flag-name-1850"
+//   1851: group 0, "flag-name-1851"
+//   1852: group 0, "flag-name-1852"
+//   1853: group 0, "flag-name-1853"
+//   1854: group 0, "flag-name-1854"
+//   1855: group 0, "flag-name-1855"
+//   1856: group 0, "flag-name-1856"
+//   1857: group 0, "flag-name-1857"
+//   1858: group 0, "flag-name-1858"
+//   1859: group 0, "flag-name-1859"
+//   1860: group 0, "flag-name-1860"
+//   1861: group 0, "flag-name-1861"
+//   1862: group 0, "flag-name-1862"
+//   1863: group 0, "flag-name-1863"
+//   1864: group 0, "flag-name-1864"
+//   1865: group 0, "flag-name-1865"
+//   1866: group 0, "flag-name-1866"
+//   1867: group 0, "flag-name-1867"
+//   1868: group 0, "flag-name-1868"
+//   1869: group 0, "flag-name-1869"
+//   1870: group 0, "flag-name-1870"
+//   1871: group 0, "flag-name-1871"
+//   1872: group 0, "flag-name-1872"
+//   1873: group 0, "flag-name-1873"
+//   1874: group 0, "flag-name-1874"
+//   1875: group 0, "flag-name-1875"
+//   1876: group 0, "flag-name-1876"
+//   1877: group 0, "flag-name-1877"
+//   1878: group 0, "flag-name-1878"
+//   1879: group 0, "flag-name-1879"
+//   1880: group 0, "flag-name-1880"
+//   1881: group 0, "flag-name-1881"
+//   1882: group 0, "flag-name-1882"
+//   1883: group 0, "flag-name-1883"
+//   1884: group 0, "flag-name-1884"
+//   1885: group 0, "flag-name-1885"
+//   1886: group 0, "flag-name-1886"
+//   1887: group 0, "flag-name-1887"
+//   1888: group 0, "flag-name-1888"
+//   1889: group 0, "flag-name-1889"
+//   1890: group 0, "flag-name-1890"
+//   1891: group 0, "flag-name-1891"
+//   1892: group 0, "flag-name-1892"
+//   1893: group 0, "flag-name-1893"
+//   1894: group 0, "flag-name-1894"
+//   1895: group 0, "flag-name-1895"
+//   1896: group 0, "flag-name-1896"
+//   1897: group 0, "flag-name-1897"
+//   1898: group 0, "flag-name-1898"
+//   1899: group 0, "flag-name-1899"
+//   1900: group 0, "flag-name-1900"
+//   1901: group 0, "flag-name-1901"
+//   1902: group 0, "flag-name-1902"
+//   1903: group 0, "flag-name-1903"
+//   1904: group 0, "flag-name-1904"
+//   1905: group 0, "flag-name-1905"
+//   1906: group 0, "flag-name-1906"
+//   1907: group 0, "flag-name-1907"
+//   1908: group 0, "flag-name-1908"
+//   1909: group 0, "flag-name-1909"
+//   1910: group 0, "flag-name-1910"
+//   1911: group 0, "flag-name-1911"
+//   1912: group 0, "flag-name-1912"
+//   1913: group 0, "flag-name-1913"
+//   1914: group 0, "flag-name-1914"
+//   1915: group 0, "flag-name-1915"
+//   1916: group 0, "flag-name-1916"
+//   1917: group 0, "flag-name-1917"
+//   1918: group 0, "flag-name-1918"
+//   1919: group 0, "flag-name-1919"
+//   1920: group 0, "flag-name-1920"
+//   1921: group 0, "flag-name-1921"
+//   1922: group 0, "flag-name-1922"
+//   1923: group 0, "flag-name-1923"
+//   1924: group 0, "flag-name-1924"
+//   1925: group 0, "flag-name-1925"
+//   1926: group 0, "flag-name-1926"
+//   1927: group 0, "flag-name-1927"
+//   1928: group 0, "flag-name-1928"
+//   1929: group 0, "flag-name-1929"
+//   1930: group 0, "flag-name-1930"
+//   1931: group 0, "flag-name-1931"
+//   1932: group 0, "flag-name-1932"
+//   1933: group 0, "flag-name-1933"
+//   1934: group 0, "flag-name-1934"
+//   1935: group 0, "flag-name-1935"
+//   1936: group 0, "flag-name-1936"
+//   1937: group 0, "flag-name-1937"
+//   1938: group 0, "flag-name-1938"
+//   1939: group 0, "flag-name-1939"
+//   1940: group 0, "flag-name-1940"
+//   1941: group 0, "flag-name-1941"
+//   1942: group 0, "flag-name-1942"
+//   1943: group 0, "flag-name-1943"
+//   1944: group 0, "flag-name-1944"
+//   1945: group 0, "flag-name-1945"
+//   1946: group 0, "flag-name-1946"
+//   1947: group 0, "flag-name-1947"
+//   1948: group 0, "flag-name-1948"
+//   1949: group 0, "flag-name-1949"
+//   1950: group 0, "flag-name-1950"
+//   1951: group 0, "flag-name-1951"
+//   1952: group 0, "flag-name-1952"
+//   1953: group 0, "flag-name-1953"
+//   1954: group 0, "flag-name-1954"
+//   1955: group 0, "flag-name-1955"
+//   1956: group 0, "flag-name-1956"
+//   1957: group 0, "flag-name-1957"
+//   1958: group 0, "flag-name-1958"
+//   1959: group 0, "flag-name-1959"
+//   1960: group 0, "flag-name-1960"
+//   1961: group 0, "flag-name-1961"
+//   1962: group 0, "flag-name-1962"
+//   1963: group 0, "flag-name-1963"
+//   1964: group 0, "flag-name-1964"
+//   1965: group 0, "flag-name-1965"
+//   1966: group 0, "flag-name-1966"
+//   1967: group 0, "flag-name-1967"
+//   1968: group 0, "flag-name-1968"
+//   1969: group 0, "flag-name-1969"
+//   1970: group 0, "flag-name-1970"
+//   1971: group 0, "flag-name-1971"
+//   1972: group 0, "flag-name-1972"
+//   1973: group 0, "flag-name-1973"
+//   1974: group 0, "flag-name-1974"
+//   1975: group 0, "flag-name-1975"
+//   1976: group 0, "flag-name-1976"
+//   1977: group 0, "flag-name-1977"
+//   1978: group 0, "flag-name-1978"
+//   1979: group 0, "flag-name-1979"
+//   1980: group 0, "flag-name-1980"
+//   1981: group 0, "flag-name-1981"
+//   1982: group 0, "flag-name-1982"
+//   1983: group 0, "flag-name-1983"
+//   1984: group 0, "flag-name-1984"
+//   1985: group 0, "flag-name-1985"
+//   1986: group 0, "flag-name-1986"
+//   1987: group 0, "flag-name-1987"
+//   1988: group 0, "flag-name-1988"
+//   1989: group 0, "flag-name-1989"
+//   1990: group 0, "flag-name-1990"
+//   1991: group 0, "flag-name-1991"
+//   1992: group 0, "flag-name-1992"
+//   1993: group 0, "flag-name-1993"
+//   1994: group 0, "flag-name-1994"
+//   1995: group 0, "flag-name-1995"
+//   1996: group 0, "flag-name-1996"
+//   1997: group 0, "flag-name-1997"
+//   1998: group 0, "flag-name-1998"
+//   1999: group 0, "flag-name-1999"
+//   2000: group 0, "flag-name-2000"
+//   2001: group 0, "flag-name-2001"
+//   2002: group 0, "flag-name-2002"
+//   2003: group 0, "flag-name-2003"
+//   2004: group 0, "flag-name-2004"
+//   2005: group 0, "flag-name-2005"
+//   2006: group 0, "flag-name-2006"
+//   2007: group 0, "flag-name-2007"
+//   2008: group 0, "flag-name-2008"
+//   2009: group 0, "flag-name-2009"
+//   2010: group 0, "flag-name-2010"
+//   2011: group 0, "flag-name-2011"
+//   2012: group 0, "flag-name-2012"
+//   2013: group 0, "flag-name-2013"
+//   2014: group 0, "flag-name-2014"
+//   2015: group 0, "flag-name-2015"
+//   2016: group 0, "flag-name-2016"
+//   2017: group 0, "flag-name-2017"
+//   2018: group 0, "flag-name-2018"
+//   2019: group 0, "flag-name-2019"
+//   2020: group 0, "flag-name-2020"
+//   2021: group 0, "flag-name-2021"
+//   2022: group 0, "flag-name-2022"
+//   2023: group 0, "flag-name-2023"
+//   2024: group 0, "flag-name-2024"
+//   2025: group 0, "flag-name-2025"
+//   2026: group 0, "flag-name-2026"
+//   2027: group 0, "flag-name-2027"
+//   2028: group 0, "flag-name-2028"
+//   2029: group 0, "flag-name-2029"
+//   2030: group 0, "flag-name-2030"
+//   2031: group 0, "flag-name-2031"
+//   2032: group 0, "flag-name-2032"
+//   2033: group 0, "flag-name-2033"
+//   2034: group 0, "flag-name-2034"
+//   2035: group 0, "flag-name-2035"
+//   2036: group 0, "flag-name-2036"
+//   2037: group 0, "flag-name-2037"
+//   2038: group 0, "flag-name-2038"
+//   2039: group 0, "flag-name-2039"
+//   2040: group 0, "flag-name-2040"
+//   2041: group 0, "flag-name-2041"
+//   2042: group 0, "flag-name-2042"
+//   2043: group 0, "flag-name-2043"
+//   2044: group 0, "flag-name-2044"
+//   2045: group 0, "flag-name-2045"
+//   2046: group 0, "flag-name-2046"
+//   2047: group 0, "flag-name-2047"
+//   2048: group 0, "flag-name-2048"
+//   2049: group 0, "flag-name-2049"
+//   2050: group 0, "flag-name-2050"
+//   2051: group 0, "flag-name-2051"
+//   2052: group 0, "flag-name-2052"
+//   2053: group 0, "flag-name-2053"
+//   2054: group 0, "flag-name-2054"
+//   2055: group 0, "flag-name-2055"
+//   2056: group 0, "flag-name-2056"
+//   2057: group 0, "flag-name-2057"
+//   2058: group 0, "flag-name-2058"
+//   2059: group 0, "flag-name-2059"
+//   2060: group 0, "flag-name-2060"
+//   2061: group 0, "flag-name-2061"
+//   2062: group 0, "flag-name-2062"
+//   2063: group 0, "flag-name-2063"
+//   2064: group 0, "flag-name-2064"
+//   2065: group 0, "flag-name-2065"
+//   2066: group 0, "flag-name-2066"
+//   2067: group 0, "flag-name-2067"
+//   2068: group 0, "flag-name-2068"
+//   2069: group 0, "flag-name-2069"
+//   2070: group 0, "flag-name-2070"
+//   2071: group 0, "flag-name-2071"
+//   2072: group 0, "flag-name-2072"
+//   2073: group 0, "flag-name-2073"
+//   2074: group 0, "flag-name-2074"
+//   2075: group 0, "flag-name-2075"
+//   2076: group 0, "flag-name-2076"
+//   2077: group 0, "flag-name-2077"
+//   2078: group 0, "flag-name-2078"
+//   2079: group 0, "flag-name-2079"
+//   2080: group 0, "flag-name-2080"
+//   2081: group 0, "flag-name-2081"
+//   2082: group 0, "flag-name-2082"
+//   2083: group 0, "flag-name-2083"
+//   2084: group 0, "flag-name-2084"
+//   2085: group 0, "flag-name-2085"
+//   2086: group 0, "flag-name-2086"
+//   2087: group 0, "flag-name-2087"
+//   2088: group 0, "flag-name-2088"
+//   2089: group 0, "flag-name-2089"
+//   2090: group 0, "flag-name-2090"
+//   2091: group 0, "flag-name-2091"
+//   2092: group 0, "flag-name-2092"
+//   2093: group 0, "flag-name-2093"
+//   2094: group 0, "flag-name-2094"
+//   2095: group 0, "flag-name-2095"
+//   2096: group 0, "flag-name-2096"
+//   2097: group 0, "flag-name-2097"
+//   2098: group 0, "flag-name-2098"
+//   2099: group 0, "flag-name-2099"
+//   2100: group 0, "flag-name-2100"
+//   2101: group 0, "flag-name-2101"
+//   2102: group 0, "flag-name-2102"
+//   2103: group 0, "flag-name-2103"
+//   2104: group 0, "flag-name-2104"
+//   2105: group 0, "flag-name-2105"
+//   2106: group 0, "flag-name-2106"
+//   2107: group 0, "flag-name-2107"
+//   2108: group 0, "flag-name-2108"
+//   2109: group 0, "flag-name-2109"
+//   2110: group 0, "flag-name-2110"
+//   2111: group 0, "flag-name-2111"
+//   2112: group 0, "flag-name-2112"
+//   2113: group 0, "flag-name-2113"
+//   2114: group 0, "flag-name-2114"
+//   2115: group 0, "flag-name-2115"
+//   2116: group 0, "flag-name-2116"
+//   2117: group 0, "flag-name-2117"
+//   2118: group 0, "flag-name-2118"
+//   2119: group 0, "flag-name-2119"
+//   2120: group 0, "flag-name-2120"
+//   2121: group 0, "flag-name-2121"
+//   2122: group 0, "flag-name-2122"
+//   2123: group 0, "flag-name-2123"
+//   2124: group 0, "flag-name-2124"
+//   2125: group 0, "flag-name-2125"
+//   2126: group 0, "flag-name-2126"
+//   2127: group 0, "flag-name-2127"
+//   2128: group 0, "flag-name-2128"
+//   2129: group 0, "flag-name-2129"
+//   2130: group 0, "flag-name-2130"
+//   2131: group 0, "flag-name-2131"
+//   2132: group 0, "flag-name-2132"
+//   2133: group 0, "flag-name-2133"
+//   2134: group 0, "flag-name-2134"
+//   2135: group 0, "flag-name-2135"
+//   2136: group 0, "flag-name-2136"
+//   2137: group 0, "flag-name-2137"
+//   2138: group 0, "flag-name-2138"
+//   2139: group 0, "flag-name-2139"
+//   2140: group 0, "flag-name-2140"
+//   2141: group 0, "flag-name-2141"
+//   2142: group 0, "flag-name-2142"
+//   2143: group 0, "flag-name-2143"
+//   2144: group 0, "flag-name-2144"
+//   2145: group 0, "flag-name-2145"
+//   2146: group 0, "flag-name-2146"
+//   2147: group 0, "flag-name-2147"
+//   2148: group 0, "flag-name-2148"
+//   2149: group 0, "flag-name-2149"
+//   2150: group 0, "flag-name-2150"
+//   2151: group 0, "flag-name-2151"
+//   2152: group 0, "flag-name-2152"
+//   2153: group 0, "flag-name-2153"
+//   2154: group 0, "flag-name-2154"
+//   2155: group 0, "flag-name-2155"
+//   2156: group 0, "flag-name-2156"
+//   2157: group 0, "flag-name-2157"
+//   2158: group 0, "flag-name-2158"
+//   2159: group 0, "flag-name-2159"
+//   2160: group 0, "flag-name-2160"
+//   2161: group 0, "flag-name-2161"
+//   2162: group 0, "flag-name-2162"
+//   2163: group 0, "flag-name-2163"
+//   2164: group 0, "flag-name-2164"
+//   2165: group 0, "flag-name-2165"
+//   2166: group 0, "flag-name-2166"
+//   2167: group 0, "flag-name-2167"
+//   2168: group 0, "flag-name-2168"
+//   2169: group 0, "flag-name-2169"
+//   2170: group 0, "flag-name-2170"
+//   2171: group 0, "flag-name-2171"
+//   2172: group 0, "flag-name-2172"
+//   2173: group 0, "flag-name-2173"
+//   2174: group 0, "flag-name-2174"
+//   2175: group 0, "flag-name-2175"
+//   2176: group 0, "flag-name-2176"
+//   2177: group 0, "flag-name-2177"
+//   2178: group 0, "flag-name-2178"
+//   2179: group 0, "flag-name-2179"
+//   2180: group 0, "flag-name-2180"
+//   2181: group 0, "flag-name-2181"
+//   2182: group 0, "flag-name-2182"
+//   2183: group 0, "flag-name-2183"
+//   2184: group 0, "flag-name-2184"
+//   2185: group 0, "flag-name-2185"
+//   2186: group 0, "flag-name-2186"
+//   2187: group 0, "flag-name-2187"
+//   2188: group 0, "flag-name-2188"
+//   2189: group 0, "flag-name-2189"
+//   2190: group 0, "flag-name-2190"
+//   2191: group 0, "flag-name-2191"
+//   2192: group 0, "flag-name-2192"
+//   2193: group 0, "flag-name-2193"
+//   2194: group 0, "flag-name-2194"
+//   2195: group 0, "flag-name-2195"
+//   2196: group 0, "flag-name-2196"
+//   2197: group 0, "flag-name-2197"
+//   2198: group 0, "flag-name-2198"
+//   2199: group 0, "flag-name-2199"
+//   2200: group 0, "flag-name-2200"
+//   2201: group 0, "flag-name-2201"
+//   2202: group 0, "flag-name-2202"
+//   2203: group 0, "flag-name-2203"
+//   2204: group 0, "flag-name-2204"
+//   2205: group 0, "flag-name-2205"
+//   2206: group 0, "flag-name-2206"
+//   2207: group 0, "flag-name-2207"
+//   2208: group 0, "flag-name-2208"
+//   2209: group 0, "flag-name-2209"
+//   2210: group 0, "flag-name-2210"
+//   2211: group 0, "flag-name-2211"
+//   2212: group 0, "flag-name-2212"
+//   2213: group 0, "flag-name-2213"
+//   2214: group 0, "flag-name-2214"
+//   2215: group 0, "flag-name-2215"
+//   2216: group 0, "flag-name-2216"
+//   2217: group 0, "flag-name-2217"
+//   2218: group 0, "flag-name-2218"
+//   2219: group 0, "flag-name-2219"
+//   2220: group 0, "flag-name-2220"
+//   2221: group 0, "flag-name-2221"
+//   2222: group 0, "flag-name-2222"
+//   2223: group 0, "flag-name-2223"
+//   2224: group 0, "flag-name-2224"
+//   2225: group 0, "flag-name-2225"
+//   2226: group 0, "flag-name-2226"
+//   2227: group 0, "flag-name-2227"
+//   2228: group 0, "flag-name-2228"
+//   2229: group 0, "flag-name-2229"
+//   2230: group 0, "flag-name-2230"
+//   2231: group 0, "flag-name-2231"
+//   2232: group 0, "flag-name-2232"
+//   2233: group 0, "flag-name-2233"
+//   2234: group 0, "flag-name-2234"
+//   2235: group 0, "flag-name-2235"
+//   2236: group 0, "flag-name-2236"
+//   2237: group 0, "flag-name-2237"
+//   2238: group 0, "flag-name-2238"
+//   2239: group 0, "flag-name-2239"
+//   2240: group 0, "flag-name-2240"
+//   2241: group 0, "flag-name-2241"
+//   2242: group 0, "flag-name-2242"
+//   2243: group 0, "flag-name-2243"
+//   2244: group 0, "flag-name-2244"
+//   2245: group 0, "flag-name-2245"
+//   2246: group 0, "flag-name-2246"
+//   2247: group 0, "flag-name-2247"
+//   2248: group 0, "flag-name-2248"
+//   2249: group 0, "flag-name-2249"
+//   2250: group 0, "flag-name-2250"
+//   2251: group 0, "flag-name-2251"
+//   2252: group 0, "flag-name-2252"
+//   2253: group 0, "flag-name-2253"
+//   2254: group 0, "flag-name-2254"
+//   2255: group 0, "flag-name-2255"
+//   2256: group 0, "flag-name-2256"
+//   2257: group 0, "flag-name-2257"
+//   2258: group 0, "flag-name-2258"
+//   2259: group 0, "flag-name-2259"
+//   2260: group 0, "flag-name-2260"
+//   2261: group 0, "flag-name-2261"
+//   2262: group 0, "flag-name-2262"
+//   2263: group 0, "flag-name-2263"
+//   2264: group 0, "flag-name-2264"
+//   2265: group 0, "flag-name-2265"
+//   2266: group 0, "flag-name-2266"
+//   2267: group 0, "flag-name-2267"
+//   2268: group 0, "flag-name-2268"
+//   2269: group 0, "flag-name-2269"
+//   2270: group 0, "flag-name-2270"
+//   2271: group 0, "flag-name-2271"
+//   2272: group 0, "flag-name-2272"
+//   2273: group 0, "flag-name-2273"
+//   2274: group 0, "flag-name-2274"
+//   2275: group 0, "flag-name-2275"
+//   2276: group 0, "flag-name-2276"
+//   2277: group 0, "flag-name-2277"
+//   2278: group 0, "flag-name-2278"
+//   2279: group 0, "flag-name-2279"
+//   2280: group 0, "flag-name-2280"
+//   2281: group 0, "flag-name-2281"
+//   2282: group 0, "flag-name-2282"
+//   2283: group 0, "flag-name-2283"
+//   2284: group 0, "flag-name-2284"
+//   2285: group 0, "flag-name-2285"
+//   2286: group 0, "flag-name-2286"
+//   2287: group 0, "flag-name-2287"
+//   2288: group 0, "flag-name-2288"
+//   2289: group 0, "flag-name-2289"
+//   2290: group 0, "flag-name-2290"
+//   2291: group 0, "flag-name-2291"
+//   2292: group 0, "flag-name-2292"
+//   2293: group 0, "flag-name-2293"
+//   2294: group 0, "flag-name-2294"
+//   2295: group 0, "flag-name-2295"
+//   2296: group 0, "flag-name-2296"
+//   2297: group 0, "flag-name-2297"
+//   2298: group 0, "flag-name-2298"
+//   2299: group 0, "flag-name-2299"
+//   2300: group 0, "flag-name-2300"
+//   2301: group 0, "flag-name-2301"
+//   2302: group 0, "flag-name-2302"
+//   2303: group 0, "flag-name-2303"
+//   2304: group 0, "flag-name-2304"
+//   2305: group 0, "flag-name-2305"
+//   2306: group 0, "flag-name-2306"
+//   2307: group 0, "flag-name-2307"
+//   2308: group 0, "flag-name-2308"
+//   2309: group 0, "flag-name-2309"
+//   2310: group 0, "flag-name-2310"
+//   2311: group 0, "flag-name-2311"
+//   2312: group 0, "flag-name-2312"
+//   2313: group 0, "flag-name-2313"
+//   2314: group 0, "flag-name-2314"
+//   2315: group 0, "flag-name-2315"
+//   2316: group 0, "flag-name-2316"
+//   2317: group 0, "flag-name-2317"
+//   2318: group 0, "flag-name-2318"
+//   2319: group 0, "flag-name-2319"
+//   2320: group 0, "flag-name-2320"
+//   2321: group 0, "flag-name-2321"
+//   2322: group 0, "flag-name-2322"
+//   2323: group 0, "flag-name-2323"
+//   2324: group 0, "flag-name-2324"
+//   2325: group 0, "flag-name-2325"
+//   2326: group 0, "flag-name-2326"
+//   2327: group 0, "flag-name-2327"
+//   2328: group 0, "flag-name-2328"
+//   2329: group 0, "flag-name-2329"
+//   2330: group 0, "flag-name-2330"
+//   2331: group 0, "flag-name-2331"
+//   2332: group 0, "flag-name-2332"
+//   2333: group 0, "flag-name-2333"
+//   2334: group 0, "flag-name-2334"
+//   2335: group 0, "flag-name-2335"
+//   2336: group 0, "flag-name-2336"
+//   2337: group 0, "flag-name-2337"
+//   2338: group 0, "flag-name-2338"
+//   2339: group 0, "flag-name-2339"
+//   2340: group 0, "flag-name-2340"
+//   2341: group 0, "flag-name-2341"
+//   2342: group 0, "flag-name-2342"
+//   2343: group 0, "flag-name-2343"
+//   2344: group 0, "flag-name-2344"
+//   2345: group 0, "flag-name-2345"
+//   2346: group 0, "flag-name-2346"
+//   2347: group 0, "flag-name-2347"
+//   2348: group 0, "flag-name-2348"
+//   2349: group 0, "flag-name-2349"
+//   2350: group 0, "flag-name-2350"
+//   2351: group 0, "flag-name-2351"
+//   2352: group 0, "flag-name-2352"
+//   2353: group 0, "flag-name-2353"
+//   2354: group 0, "flag-name-2354"
+//   2355: group 0, "flag-name-2355"
+//   2356: group 0, "flag-name-2356"
+//   2357: group 0, "flag-name-2357"
+//   2358: group 0, "flag-name-2358"
+//   2359: group 0, "flag-name-2359"
+//   2360: group 0, "flag-name-2360"
+//   2361: group 0, "flag-name-2361"
+//   2362: group 0, "flag-name-2362"
+//   2363: group 0, "flag-name-2363"
+//   2364: group 0, "flag-name-2364"
+//   2365: group 0, "flag-name-2365"
+//   2366: group 0, "flag-name-2366"
+//   2367: group 0, "flag-name-2367"
+//   2368: group 0, "flag-name-2368"
+//   2369: group 0, "flag-name-2369"
+//   2370: group 0, "flag-name-2370"
+//   2371: group 0, "flag-name-2371"
+//   2372: group 0, "flag-name-2372"
+//   2373: group 0, "flag-name-2373"
+//   2374: group 0, "flag-name-2374"
+//   2375: group 0, "flag-name-2375"
+//   2376: group 0, "flag-name-2376"
+//   2377: group 0, "flag-name-2377"
+//   2378: group 0, "flag-name-2378"
+//   2379: group 0, "flag-name-2379"
+//   2380: group 0, "flag-name-2380"
+//   2381: group 0, "flag-name-2381"
+//   2382: group 0, "flag-name-2382"
+//   2383: group 0, "flag-name-2383"
+//   2384: group 0, "flag-name-2384"
+//   2385: group 0, "flag-name-2385"
+//   2386: group 0, "flag-name-2386"
+//   2387: group 0, "flag-name-2387"
+//   2388: group 0, "flag-name-2388"
+//   2389: group 0, "flag-name-2389"
+//   2390: group 0, "flag-name-2390"
+//   2391: group 0, "flag-name-2391"
+//   2392: group 0, "flag-name-2392"
+//   2393: group 0, "flag-name-2393"
+//   2394: group 0, "flag-name-2394"
+//   2395: group 0, "flag-name-2395"
+//   2396: group 0, "flag-name-2396"
+//   2397: group 0, "flag-name-2397"
+//   2398: group 0, "flag-name-2398"
+//   2399: group 0, "flag-name-2399"
+//   2400: group 0, "flag-name-2400"
+//   2401: group 0, "flag-name-2401"
+//   2402: group 0, "flag-name-2402"
+//   2403: group 0, "flag-name-2403"
+//   2404: group 0, "flag-name-2404"
+//   2405: group 0, "flag-name-2405"
+//   2406: group 0, "flag-name-2406"
+//   2407: group 0, "flag-name-2407"
+//   2408: group 0, "flag-name-2408"
+//   2409: group 0, "flag-name-2409"
+//   2410: group 0, "flag-name-2410"
+//   2411: group 0, "flag-name-2411"
+//   2412: group 0, "flag-name-2412"
+//   2413: group 0, "flag-name-2413"
+//   2414: group 0, "flag-name-2414"
+//   2415: group 0, "flag-name-2415"
+//   2416: group 0, "flag-name-2416"
+//   2417: group 0, "flag-name-2417"
+//   2418: group 0, "flag-name-2418"
+//   2419: group 0, "flag-name-2419"
+//   2420: group 0, "flag-name-2420"
+//   2421: group 0, "flag-name-2421"
+//   2422: group 0, "flag-name-2422"
+//   2423: group 0, "flag-name-2423"
+//   2424: group 0, "flag-name-2424"
+//   2425: group 0, "flag-name-2425"
+//   2426: group 0, "flag-name-2426"
+//   2427: group 0, "flag-name-2427"
+//   2428: group 0, "flag-name-2428"
+//   2429: group 0, "flag-name-2429"
+//   2430: group 0, "flag-name-2430"
+//   2431: group 0, "flag-name-2431"
+//   2432: group 0, "flag-name-2432"
+//   2433: group 0, "flag-name-2433"
+//   2434: group 0, "flag-name-2434"
+//   2435: group 0, "flag-name-2435"
+//   2436: group 0, "flag-name-2436"
+//   2437: group 0, "flag-name-2437"
+//   2438: group 0, "flag-name-2438"
+//   2439: group 0, "flag-name-2439"
+//   2440: group 0, "flag-name-2440"
+//   2441: group 0, "flag-name-2441"
+//   2442: group 0, "flag-name-2442"
+//   2443: group 0, "flag-name-2443"
+//   2444: group 0, "flag-name-2444"
+//   2445: group 0, "flag-name-2445"
+//   2446: group 0, "flag-name-2446"
+//   2447: group 0, "flag-name-2447"
+//   2448: group 0, "flag-name-2448"
+//   2449: group 0, "flag-name-2449"
+//   2450: group 0, "flag-name-2450"
+//   2451: group 0, "flag-name-2451"
+//   2452: group 0, "flag-name-2452"
+//   2453: group 0, "flag-name-2453"
+//   2454: group 0, "flag-name-2454"
+//   2455: group 0, "flag-name-2455"
+//   2456: group 0, "flag-name-2456"
+//   2457: group 0, "flag-name-2457"
+//   2458: group 0, "flag-name-2458"
+//   2459: group 0, "flag-name-2459"
+//   2460: group 0, "flag-name-2460"
+//   2461: group 0, "flag-name-2461"
+//   2462: group 0, "flag-name-2462"
+//   2463: group 0, "flag-name-2463"
+//   2464: group 0, "flag-name-2464"
+//   2465: group 0, "flag-name-2465"
+//   2466: group 0, "flag-name-2466"
+//   2467: group 0, "flag-name-2467"
+//   2468: group 0, "flag-name-2468"
+//   2469: group 0, "flag-name-2469"
+//   2470: group 0, "flag-name-2470"
+//   2471: group 0, "flag-name-2471"
+//   2472: group 0, "flag-name-2472"
+//   2473: group 0, "flag-name-2473"
+//   2474: group 0, "flag-name-2474"
+//   2475: group 0, "flag-name-2475"
+//   2476: group 0, "flag-name-2476"
+//   2477: group 0, "flag-name-2477"
+//   2478: group 0, "flag-name-2478"
+//   2479: group 0, "flag-name-2479"
+//   2480: group 0, "flag-name-2480"
+//   2481: group 0, "flag-name-2481"
+//   2482: group 0, "flag-name-2482"
+//   2483: group 0, "flag-name-2483"
+//   2484: group 0, "flag-name-2484"
+//   2485: group 0, "flag-name-2485"
+//   2486: group 0, "flag-name-2486"
+//   2487: group 0, "flag-name-2487"
+//   2488: group 0, "flag-name-2488"
+//   2489: group 0, "flag-name-2489"
+//   2490: group 0, "flag-name-2490"
+//   2491: group 0, "flag-name-2491"
+//   2492: group 0, "flag-name-2492"
+//   2493: group 0, "flag-name-2493"
+//   2494: group 0, "flag-name-2494"
+//   2495: group 0, "flag-name-2495"
+//   2496: group 0, "flag-name-2496"
+//   2497: group 0, "flag-name-2497"
+//   2498: group 0, "flag-name-2498"
+//   2499: group 0, "flag-name-2499"
+//   2500: group 0, "flag-name-2500"
+//   2501: group 0, "flag-name-2501"
+//   2502: group 0, "flag-name-2502"
+//   2503: group 0, "flag-name-2503"
+//   2504: group 0, "flag-name-2504"
+//   2505: group 0, "flag-name-2505"
+//   2506: group 0, "flag-name-2506"
+//   2507: group 0, "flag-name-2507"
+//   2508: group 0, "flag-name-2508"
+//   2509: group 0, "flag-name-2509"
+//   2510: group 0, "flag-name-2510"
+//   2511: group 0, "flag-name-2511"
+//   2512: group 0, "flag-name-2512"
+//   2513: group 0, "flag-name-2513"
+//   2514: group 0, "flag-name-2514"
+//   2515: group 0, "flag-name-2515"
+//   2516: group 0, "flag-name-2516"
+//   2517: group 0, "flag-name-2517"
+//   2518: group 0, "flag-name-2518"
+//   2519: group 0, "flag-name-2519"
+//   2520: group 0, "flag-name-2520"
+//   2521: group 0, "flag-name-2521"
+//   2522: group 0, "flag-name-2522"
+//   2523: group 0, "flag-name-2523"
+//   2524: group 0, "flag-name-2524"
+//   2525: group 0, "flag-name-2525"
+//   2526: group 0, "flag-name-2526"
+//   2527: group 0, "flag-name-2527"
+//   2528: group 0, "flag-name-2528"
+//   2529: group 0, "flag-name-2529"
+//   2530: group 0, "flag-name-2530"
+//   2531: group 0, "flag-name-2531"
+//   2532: group 0, "flag-name-2532"
+//   2533: group 0, "flag-name-2533"
+//   2534: group 0, "flag-name-2534"
+//   2535: group 0, "flag-name-2535"
+//   2536: group 0, "flag-name-2536"
+//   2537: group 0, "flag-name-2537"
+//   2538: group 0, "flag-name-2538"
+//   2539: group 0, "flag-name-2539"
+//   2540: group 0, "flag-name-2540"
+//   2541: group 0, "flag-name-2541"
+//   2542: group 0, "flag-name-2542"
+//   2543: group 0, "flag-name-2543"
+//   2544: group 0, "flag-name-2544"
+//   2545: group 0, "flag-name-2545"
+//   2546: group 0, "flag-name-2546"
+//   2547: group 0, "flag-name-2547"
+//   2548: group 0, "flag-name-2548"
+//   2549: group 0, "flag-name-2549"
+//   2550: group 0, "flag-name-2550"
+//   2551: group 0, "flag-name-2551"
+//   2552: group 0, "flag-name-2552"
+//   2553: group 0, "flag-name-2553"
+//   2554: group 0, "flag-name-2554"
+//   2555: group 0, "flag-name-2555"
+//   2556: group 0, "flag-name-2556"
+//   2557: group 0, "flag-name-2557"
+//   2558: group 0, "flag-name-2558"
+//   2559: group 0, "flag-name-2559"
+//   2560: group 0, "flag-name-2560"
+//   2561: group 0, "flag-name-2561"
+//   2562: group 0, "flag-name-2562"
+//   2563: group 0, "flag-name-2563"
+//   2564: group 0, "flag-name-2564"
+//   2565: group 0, "flag-name-2565"
+//   2566: group 0, "flag-name-2566"
+//   2567: group 0, "flag-name-2567"
+//   2568: group 0, "flag-name-2568"
+//   2569: group 0, "flag-name-2569"
+//   2570: group 0, "flag-name-2570"
+//   2571: group 0, "flag-name-2571"
+//   2572: group 0, "flag-name-2572"
+//   2573: group 0, "flag-name-2573"
+//   2574: group 0, "flag-name-2574"
+//   2575: group 0, "flag-name-2575"
+//   2576: group 0, "flag-name-2576"
+//   2577: group 0, "flag-name-2577"
+//   2578: group 0, "flag-name-2578"
+//   2579: group 0, "flag-name-2579"
+//   2580: group 0, "flag-name-2580"
+//   2581: group 0, "flag-name-2581"
+//   2582: group 0, "flag-name-2582"
+//   2583: group 0, "flag-name-2583"
+//   2584: group 0, "flag-name-2584"
+//   2585: group 0, "flag-name-2585"
+//   2586: group 0, "flag-name-2586"
+//   2587: group 0, "flag-name-2587"
+//   2588: group 0, "flag-name-2588"
+//   2589: group 0, "flag-name-2589"
+//   2590: group 0, "flag-name-2590"
+//   2591: group 0, "flag-name-2591"
+//   2592: group 0, "flag-name-2592"
+//   2593: group 0, "flag-name-2593"
+//   2594: group 0, "flag-name-2594"
+//   2595: group 0, "flag-name-2595"
+//   2596: group 0, "flag-name-2596"
+//   2597: group 0, "flag-name-2597"
+//   2598: group 0, "flag-name-2598"
+//   2599: group 0, "flag-name-2599"
+//   2600: group 0, "flag-name-2600"
+//   2601: group 0, "flag-name-2601"
+//   2602: group 0, "flag-name-2602"
+//   2603: group 0, "flag-name-2603"
+//   2604: group 0, "flag-name-2604"
+//   2605: group 0, "flag-name-2605"
+//   2606: group 0, "flag-name-2606"
+//   2607: group 0, "flag-name-2607"
+//   2608: group 0, "flag-name-2608"
+//   2609: group 0, "flag-name-2609"
+//   2610: group 0, "flag-name-2610"
+//   2611: group 0, "flag-name-2611"
+//   2612: group 0, "flag-name-2612"
+//   2613: group 0, "flag-name-2613"
+//   2614: group 0, "flag-name-2614"
+//   2615: group 0, "flag-name-2615"
+//   2616: group 0, "flag-name-2616"
+//   2617: group 0, "flag-name-2617"
+//   2618: group 0, "flag-name-2618"
+//   2619: group 0, "flag-name-2619"
+//   2620: group 0, "flag-name-2620"
+//   2621: group 0, "flag-name-2621"
+//   2622: group 0, "flag-name-2622"
+//   2623: group 0, "flag-name-2623"
+//   2624: group 0, "flag-name-2624"
+//   2625: group 0, "flag-name-2625"
+//   2626: group 0, "flag-name-2626"
+//   2627: group 0, "flag-name-2627"
+//   2628: group 0, "flag-name-2628"
+//   2629: group 0, "flag-name-2629"
+//   2630: group 0, "flag-name-2630"
+//   2631: group 0, "flag-name-2631"
+//   2632: group 0, "flag-name-2632"
+//   2633: group 0, "flag-name-2633"
+//   2634: group 0, "flag-name-2634"
+//   2635: group 0, "flag-name-2635"
+//   2636: group 0, "flag-name-2636"
+//   2637: group 0, "flag-name-2637"
+//   2638: group 0, "flag-name-2638"
+//   2639: group 0, "flag-name-2639"
+//   2640: group 0, "flag-name-2640"
+//   2641: group 0, "flag-name-2641"
+//   2642: group 0, "flag-name-2642"
+//   2643: group 0, "flag-name-2643"
+//   2644: group 0, "flag-name-2644"
+//   2645: group 0, "flag-name-2645"
+//   2646: group 0, "flag-name-2646"
+//   2647: group 0, "flag-name-2647"
+//   2648: group 0, "flag-name-2648"
+//   2649: group 0, "flag-name-2649"
+//   2650: group 0, "flag-name-2650"
+//   2651: group 0, "flag-name-2651"
+//   2652: group 0, "flag-name-2652"
+//   2653: group 0, "flag-name-2653"
+//   2654: group 0, "flag-name-2654"
+//   2655: group 0, "flag-name-2655"
+//   2656: group 0, "flag-name-2656"
+//   2657: group 0, "flag-name-2657"
+//   2658: group 0, "flag-name-2658"
+//   2659: group 0, "flag-name-2659"
+//   2660: group 0, "flag-name-2660"
+//   2661: group 0, "flag-name-2661"
+//   2662: group 0, "flag-name-2662"
+//   2663: group 0, "flag-name-2663"
+//   2664: group 0, "flag-name-2664"
+//   2665: group 0, "flag-name-2665"
+//   2666: group 0, "flag-name-2666"
+//   2667: group 0, "flag-name-2667"
+//   2668: group 0, "flag-name-2668"
+//   2669: group 0, "flag-name-2669"
+//   2670: group 0, "flag-name-2670"
+//   2671: group 0, "flag-name-2671"
+//   2672: group 0, "flag-name-2672"
+//   2673: group 0, "flag-name-2673"
+//   2674: group 0, "flag-name-2674"
+//   2675: group 0, "flag-name-2675"
+//   2676: group 0, "flag-name-2676"
+//   2677: group 0, "flag-name-2677"
+//   2678: group 0, "flag-name-2678"
+//   2679: group 0, "flag-name-2679"
+//   2680: group 0, "flag-name-2680"
+//   2681: group 0, "flag-name-2681"
+//   2682: group 0, "flag-name-2682"
+//   2683: group 0, "flag-name-2683"
+//   2684: group 0, "flag-name-2684"
+//   2685: group 0, "flag-name-2685"
+//   2686: group 0, "flag-name-2686"
+//   2687: group 0, "flag-name-2687"
+//   2688: group 0, "flag-name-2688"
+//   2689: group 0, "flag-name-2689"
+//   2690: group 0, "flag-name-2690"
+//   2691: group 0, "flag-name-2691"
+//   2692: group 0, "flag-name-2692"
+//   2693: group 0, "flag-name-2693"
+//   2694: group 0, "flag-name-2694"
+//   2695: group 0, "flag-name-2695"
+//   2696: group 0, "flag-name-2696"
+//   2697: group 0, "flag-name-2697"
+//   2698: group 0, "flag-name-2698"
+//   2699: group 0, "flag-name-2699"
+//   2700: group 0, "flag-name-2700"
+//   2701: group 0, "flag-name-2701"
+//   2702: group 0, "flag-name-2702"
+//   2703: group 0, "flag-name-2703"
+//   2704: group 0, "flag-name-2704"
+//   2705: group 0, "flag-name-2705"
+//   2706: group 0, "flag-name-2706"
+//   2707: group 0, "flag-name-2707"
+//   2708: group 0, "flag-name-2708"
+//   2709: group 0, "flag-name-2709"
+//   2710: group 0, "flag-name-2710"
+//   2711: group 0, "flag-name-2711"
+//   2712: group 0, "flag-name-2712"
+//   2713: group 0, "flag-name-2713"
+//   2714: group 0, "flag-name-2714"
+//   2715: group 0, "flag-name-2715"
+//   2716: group 0, "flag-name-2716"
+//   2717: group 0, "flag-name-2717"
+//   2718: group 0, "flag-name-2718"
+//   2719: group 0, "flag-name-2719"
+//   2720: group 0, "flag-name-2720"
+//   2721: group 0, "flag-name-2721"
+//   2722: group 0, "flag-name-2722"
+//   2723: group 0, "flag-name-2723"
+//   2724: group 0, "flag-name-2724"
+//   2725: group 0, "flag-name-2725"
+//   2726: group 0, "flag-name-2726"
+//   2727: group 0, "flag-name-2727"
+//   2728: group 0, "flag-name-2728"
+//   2729: group 0, "flag-name-2729"
+//   2730: group 0, "flag-name-2730"
+//   2731: group 0, "flag-name-2731"
+//   2732: group 0, "flag-name-2732"
+//   2733: group 0, "flag-name-2733"
+//   2734: group 0, "flag-name-2734"
+//   2735: group 0, "flag-name-2735"
+//   2736: group 0, "flag-name-2736"
+//   2737: group 0, "flag-name-2737"
+//   2738: group 0, "flag-name-2738"
+//   2739: group 0, "flag-name-2739"
+//   2740: group 0, "flag-name-2740"
+//   2741: group 0, "flag-name-2741"
+//   2742: group 0, "flag-name-2742"
+//   2743: group 0, "flag-name-2743"
+//   2744: group 0, "flag-name-2744"
+//   2745: group 0, "flag-name-2745"
+//   2746: group 0, "flag-name-2746"
+//   2747: group 0, "flag-name-2747"
+//   2748: group 0, "flag-name-2748"
+//   2749: group 0, "flag-name-2749"
+//   2750: group 0, "flag-name-2750"
+//   2751: group 0, "flag-name-2751"
+//   2752: group 0, "flag-name-2752"
+//   2753: group 0, "flag-name-2753"
+//   2754: group 0, "flag-name-2754"
+//   2755: group 0, "flag-name-2755"
+//   2756: group 0, "flag-name-2756"
+//   2757: group 0, "flag-name-2757"
+//   2758: group 0, "flag-name-2758"
+//   2759: group 0, "flag-name-2759"
+//   2760: group 0, "flag-name-2760"
+//   2761: group 0, "flag-name-2761"
+//   2762: group 0, "flag-name-2762"
+//   2763: group 0, "flag-name-2763"
+//   2764: group 0, "flag-name-2764"
+//   2765: group 0, "flag-name-2765"
+//   2766: group 0, "flag-name-2766"
+//   2767: group 0, "flag-name-2767"
+//   2768: group 0, "flag-name-2768"
+//   2769: group 0, "flag-name-2769"
+//   2770: group 0, "flag-name-2770"
+//   2771: group 0, "flag-name-2771"
+//   2772: group 0, "flag-name-2772"
+//   2773: group 0, "flag-name-2773"
+//   2774: group 0, "flag-name-2774"
+//   2775: group 0, "flag-name-2775"
+//   2776: group 0, "flag-name-2776"
+//   2777: group 0, "flag-name-2777"
+//   2778: group 0, "flag-name-2778"
+//   2779: group 0, "flag-name-2779"
+//   2780: group 0, "flag-name-2780"
+//   2781: group 0, "flag-name-2781"
+//   2782: group 0, "flag-name-2782"
+//   2783: group 0, "flag-name-2783"
+//   2784: group 0, "flag-name-2784"
+//   2785: group 0, "flag-name-2785"
+//   2786: group 0, "flag-name-2786"
+//   2787: group 0, "flag-name-2787"
+//   2788: group 0, "flag-name-2788"
+//   2789: group 0, "flag-name-2789"
+//   2790: group 0, "flag-name-2790"
+//   2791: group 0, "flag-name-2791"
+//   2792: group 0, "flag-name-2792"
+//   2793: group 0, "flag-name-2793"
+//   2794: group 0, "flag-name-2794"
+//   2795: group 0, "flag-name-2795"
+//   2796: group 0, "flag-name-2796"
+//   2797: group 0, "flag-name-2797"
+//   2798: group 0, "flag-name-2798"
+//   2799: group 0, "flag-name-2799"
+//   2800: group 0, "flag-name-2800"
+//   2801: group 0, "flag-name-2801"
+//   2802: group 0, "flag-name-2802"
+//   2803: group 0, "flag-name-2803"
+//   2804: group 0, "flag-name-2804"
+//   2805: group 0, "flag-name-2805"
+//   2806: group 0, "flag-name-2806"
+//   2807: group 0, "flag-name-2807"
+//   2808: group 0, "flag-name-2808"
+//   2809: group 0, "flag-name-2809"
+//   2810: group 0, "flag-name-2810"
+//   2811: group 0, "flag-name-2811"
+//   2812: group 0, "flag-name-2812"
+//   2813: group 0, "flag-name-2813"
+//   2814: group 0, "flag-name-2814"
+//   2815: group 0, "flag-name-2815"
+//   2816: group 0, "flag-name-2816"
+//   2817: group 0, "flag-name-2817"
+//   2818: group 0, "flag-name-2818"
+//   2819: group 0, "flag-name-2819"
+//   2820: group 0, "flag-name-2820"
+//   2821: group 0, "flag-name-2821"
+//   2822: group 0, "flag-name-2822"
+//   2823: group 0, "flag-name-2823"
+//   2824: group 0, "flag-name-2824"
+//   2825: group 0, "flag-name-2825"
+//   2826: group 0, "flag-name-2826"
+//   2827: group 0, "flag-name-2827"
+//   2828: group 0, "flag-name-2828"
+//   2829: group 0, "flag-name-2829"
+//   2830: group 0, "flag-name-2830"
+//   2831: group 0, "flag-name-2831"
+//   2832: group 0, "flag-name-2832"
+//   2833: group 0, "flag-name-2833"
+//   2834: group 0, "flag-name-2834"
+//   2835: group 0, "flag-name-2835"
+//   2836: group 0, "flag-name-2836"
+//   2837: group 0, "flag-name-2837"
+//   2838: group 0, "flag-name-2838"
+//   2839: group 0, "flag-name-2839"
+//   2840: group 0, "flag-name-2840"
+//   2841: group 0, "flag-name-2841"
+//   2842: group 0, "flag-name-2842"
+//   2843: group 0, "flag-name-2843"
+//   2844: group 0, "flag-name-2844"
+//   2845: group 0, "flag-name-2845"
+//   2846: group 0, "flag-name-2846"
+//   2847: group 0, "flag-name-2847"
+//   2848: group 0, "flag-name-2848"
+//   2849: group 0, "flag-name-2849"
+//   2850: group 0, "flag-name-2850"
+//   2851: group 0, "flag-name-2851"
+//   2852: group 0, "flag-name-2852"
+//   2853: group 0, "flag-name-2853"
+//   2854: group 0, "flag-name-2854"
+//   2855: group 0, "flag-name-2855"
+//   2856: group 0, "flag-name-2856"
+//   2857: group 0, "flag-name-2857"
+//   2858: group 0, "flag-name-2858"
+//   2859: group 0, "flag-name-2859"
+//   2860: group 0, "flag-name-2860"
+//   2861: group 0, "flag-name-2861"
+//   2862: group 0, "flag-name-2862"
+//   2863: group 0, "flag-name-2863"
+//   2864: group 0, "flag-name-2864"
+//   2865: group 0, "flag-name-2865"
+//   2866: group 0, "flag-name-2866"
+//   2867: group 0, "flag-name-2867"
+//   2868: group 0, "flag-name-2868"
+//   2869: group 0, "flag-name-2869"
+//   2870: group 0, "flag-name-2870"
+//   2871: group 0, "flag-name-2871"
+//   2872: group 0, "flag-name-2872"
+//   2873: group 0, "flag-name-2873"
+//   2874: group 0, "flag-name-2874"
+//   2875: group 0, "flag-name-2875"
+//   2876: group 0, "flag-name-2876"
+//   2877: group 0, "flag-name-2877"
+//   2878: group 0, "flag-name-2878"
+//   2879: group 0, "flag-name-2879"
+//   2880: group 0, "flag-name-2880"
+//   2881: group 0, "flag-name-2881"
+//   2882: group 0, "flag-name-2882"
+//   2883: group 0, "flag-name-2883"
+//   2884: group 0, "flag-name-2884"
+//   2885: group 0, "flag-name-2885"
+//   2886: group 0, "flag-name-2886"
+//   2887: group 0, "flag-name-2887"
+//   2888: group 0, "flag-name-2888"
+//   2889: group 0, "flag-name-2889"
+//   2890: group 0, "flag-name-2890"
+//   2891: group 0, "flag-name-2891"
+//   2892: group 0, "flag-name-2892"
+//   2893: group 0, "flag-name-2893"
+//   2894: group 0, "flag-name-2894"
+//   2895: group 0, "flag-name-2895"
+//   2896: group 0, "flag-name-2896"
+//   2897: group 0, "flag-name-2897"
+//   2898: group 0, "flag-name-2898"
+//   2899: group 0, "flag-name-2899"
+//   2900: group 0, "flag-name-2900"
+//   2901: group 0, "flag-name-2901"
+//   2902: group 0, "flag-name-2902"
+//   2903: group 0, "flag-name-2903"
+//   2904: group 0, "flag-name-2904"
+//   2905: group 0, "flag-name-2905"
+//   2906: group 0, "flag-name-2906"
+//   2907: group 0, "flag-name-2907"
+//   2908: group 0, "flag-name-2908"
+//   2909: group 0, "flag-name-2909"
+//   2910: group 0, "flag-name-2910"
+//   2911: group 0, "flag-name-2911"
+//   2912: group 0, "flag-name-2912"
+//   2913: group 0, "flag-name-2913"
+//   2914: group 0, "flag-name-2914"
+//   2915: group 0, "flag-name-2915"
+//   2916: group 0, "flag-name-2916"
+//   2917: group 0, "flag-name-2917"
+//   2918: group 0, "flag-name-2918"
+//   2919: group 0, "flag-name-2919"
+//   2920: group 0, "flag-name-2920"
+//   2921: group 0, "flag-name-2921"
+//   2922: group 0, "flag-name-2922"
+//   2923: group 0, "flag-name-2923"
+//   2924: group 0, "flag-name-2924"
+//   2925: group 0, "flag-name-2925"
+//   2926: group 0, "flag-name-2926"
+//   2927: group 0, "flag-name-2927"
+//   2928: group 0, "flag-name-2928"
+//   2929: group 0, "flag-name-2929"
+//   2930: group 0, "flag-name-2930"
+//   2931: group 0, "flag-name-2931"
+//   2932: group 0, "flag-name-2932"
+//   2933: group 0, "flag-name-2933"
+//   2934: group 0, "flag-name-2934"
+//   2935: group 0, "flag-name-2935"
+//   2936: group 0, "flag-name-2936"
+//   2937: group 0, "flag-name-2937"
+//   2938: group 0, "flag-name-2938"
+//   2939: group 0, "flag-name-2939"
+//   2940: group 0, "flag-name-2940"
+//   2941: group 0, "flag-name-2941"
+//   2942: group 0, "flag-name-2942"
+//   2943: group 0, "flag-name-2943"
+//   2944: group 0, "flag-name-2944"
+//   2945: group 0, "flag-name-2945"
+//   2946: group 0, "flag-name-2946"
+//   2947: group 0, "flag-name-2947"
+//   2948: group 0, "flag-name-2948"
+//   2949: group 0, "flag-name-2949"
+//   2950: group 0, "flag-name-2950"
+//   2951: group 0, "flag-name-2951"
+//   2952: group 0, "flag-name-2952"
+//   2953: group 0, "flag-name-2953"
+//   2954: group 0, "flag-name-2954"
+//   2955: group 0, "flag-name-2955"
+//   2956: group 0, "flag-name-2956"
+//   2957: group 0, "flag-name-2957"
+//   2958: group 0, "flag-name-2958"
+//   2959: group 0, "flag-name-2959"
+//   2960: group 0, "flag-name-2960"
+//   2961: group 0, "flag-name-2961"
+//   2962: group 0, "flag-name-2962"
+//   2963: group 0, "flag-name-2963"
+//   2964: group 0, "flag-name-2964"
+//   2965: group 0, "flag-name-2965"
+//   2966: group 0, "flag-name-2966"
+//   2967: group 0, "flag-name-2967"
+//   2968: group 0, "flag-name-2968"
+//   2969: group 0, "flag-name-2969"
+//   2970: group 0, "flag-name-2970"
+//   2971: group 0, "flag-name-2971"
+//   2972: group 0, "flag-name-2972"
+//   2973: group 0, "flag-name-2973"
+//   2974: group 0, "flag-name-2974"
+//   2975: group 0, "flag-name-2975"
+//   2976: group 0, "flag-name-2976"
+//   2977: group 0, "flag-name-2977"
+//   2978: group 0, "flag-name-2978"
+//   2979: group 0, "flag-name-2979"
+//   2980: group 0, "flag-name-2980"
+//   2981: group 0, "flag-name-2981"
+//   2982: group 0, "flag-name-2982"
+//   2983: group 0, "flag-name-2983"
+//   2984: group 0, "flag-name-2984"
+//   2985: group 0, "flag-name-2985"
+//   2986: group 0, "flag-name-2986"
+//   2987: group 0, "flag-name-2987"
+//   2988: group 0, "flag-name-2988"
+//   2989: group 0, "flag-name-2989"
+//   2990: group 0, "flag-name-2990"
+//   2991: group 0, "flag-name-2991"
+//   2992: group 0, "flag-name-2992"
+//   2993: group 0, "flag-name-2993"
+//   2994: group 0, "flag-name-2994"
+//   2995: group 0, "flag-name-2995"
+//   2996: group 0, "flag-name-2996"
+//   2997: group 0, "flag-name-2997"
+//   2998: group 0, "flag-name-2998"
+//   2999: group 0, "flag-name-2999"
+//   3000: group 0, "flag-name-3000"
+//   3001: group 0, "flag-name-3001"
+//   3002: group 0, "flag-name-3002"
+//   3003: group 0, "flag-name-3003"
+//   3004: group 0, "flag-name-3004"
+//   3005: group 0, "flag-name-3005"
+//   3006: group 0, "flag-name-3006"
+//   3007: group 0, "flag-name-3007"
+//   3008: group 0, "flag-name-3008"
+//   3009: group 0, "flag-name-3009"
+//   3010: group 0, "flag-name-3010"
+//   3011: group 0, "flag-name-3011"
+//   3012: group 0, "flag-name-3012"
+//   3013: group 0, "flag-name-3013"
+//   3014: group 0, "flag-name-3014"
+//   3015: group 0, "flag-name-3015"
+//   3016: group 0, "flag-name-3016"
+//   3017: group 0, "flag-name-3017"
+//   3018: group 0, "flag-name-3018"
+//   3019: group 0, "flag-name-3019"
+//   3020: group 0, "flag-name-3020"
+//   3021: group 0, "flag-name-3021"
+//   3022: group 0, "flag-name-3022"
+//   3023: group 0, "flag-name-3023"
+//   3024: group 0, "flag-name-3024"
+//   3025: group 0, "flag-name-3025"
+//   3026: group 0, "flag-name-3026"
+//   3027: group 0, "flag-name-3027"
+//   3028: group 0, "flag-name-3028"
+//   3029: group 0, "flag-name-3029"
+//   3030: group 0, "flag-name-3030"
+//   3031: group 0, "flag-name-3031"
+//   3032: group 0, "flag-name-3032"
+//   3033: group 0, "flag-name-3033"
+//   3034: group 0, "flag-name-3034"
+//   3035: group 0, "flag-name-3035"
+//   3036: group 0, "flag-name-3036"
+//   3037: group 0, "flag-name-3037"
+//   3038: group 0, "flag-name-3038"
+//   3039: group 0, "flag-name-3039"
+//   3040: group 0, "flag-name-3040"
+//   3041: group 0, "flag-name-3041"
+//   3042: group 0, "flag-name-3042"
+//   3043: group 0, "flag-name-3043"
+//   3044: group 0, "flag-name-3044"
+//   3045: group 0, "flag-name-3045"
+//   3046: group 0, "flag-name-3046"
+//   3047: group 0, "flag-name-3047"
+//   3048: group 0, "flag-name-3048"
+//   3049: group 0, "flag-name-3049"
+//   3050: group 0, "flag-name-3050"
+//   3051: group 0, "flag-name-3051"
+//   3052: group 0, "flag-name-3052"
+//   3053: group 0, "flag-name-3053"
+//   3054: group 0, "flag-name-3054"
+//   3055: group 0, "flag-name-3055"
+//   3056: group 0, "flag-name-3056"
+//   3057: group 0, "flag-name-3057"
+//   3058: group 0, "flag-name-3058"
+//   3059: group 0, "flag-name-3059"
+//   3060: group 0, "flag-name-3060"
+//   3061: group 0, "flag-name-3061"
+//   3062: group 0, "flag-name-3062"
+//   3063: group 0, "flag-name-3063"
+//   3064: group 0, "flag-name-3064"
+//   3065: group 0, "flag-name-3065"
+//   3066: group 0, "flag-name-3066"
+//   3067: group 0, "flag-name-3067"
+//   3068: group 0, "flag-name-3068"
+//   3069: group 0, "flag-name-3069"
+//   3070: group 0, "flag-name-3070"
+//   3071: group 0, "flag-name-3071"
+//   3072: group 0, "flag-name-3072"
+//   3073: group 0, "flag-name-3073"
+//   3074: group 0, "flag-name-3074"
+//   3075: group 0, "flag-name-3075"
+//   3076: group 0, "flag-name-3076"
+//   3077: group 0, "flag-name-3077"
+//   3078: group 0, "flag-name-3078"
+//   3079: group 0, "flag-name-3079"
+//   3080: group 0, "flag-name-3080"
+//   3081: group 0, "flag-name-3081"
+//   3082: group 0, "flag-name-3082"
+//   3083: group 0, "flag-name-3083"
+//   3084: group 0, "flag-name-3084"
+//   3085: group 0, "flag-name-3085"
+//   3086: group 0, "flag-name-3086"
+//   3087: group 0, "flag-name-3087"
+//   3088: group 0, "flag-name-3088"
+//   3089: group 0, "flag-name-3089"
+//   3090: group 0, "flag-name-3090"
+//   3091: group 0, "flag-name-3091"
+//   3092: group 0, "flag-name-3092"
+//   3093: group 0, "flag-name-3093"
+//   3094: group 0, "flag-name-3094"
+//   3095: group 0, "flag-name-3095"
+//   3096: group 0, "flag-name-3096"
+//   3097: group 0, "flag-name-3097"
+//   3098: group 0, "flag-name-3098"
+//   3099: group 0, "flag-name-3099"
+//   3100: group 0, "flag-name-3100"
+//   3101: group 0, "flag-name-3101"
+//   3102: group 0, "flag-name-3102"
+//   3103: group 0, "flag-name-3103"
+//   3104: group 0, "flag-name-3104"
+//   3105: group 0, "flag-name-3105"
+//   3106: group 0, "flag-name-3106"
+//   3107: group 0, "flag-name-3107"
+//   3108: group 0, "flag-name-3108"
+//   3109: group 0, "flag-name-3109"
+//   3110: group 0, "flag-name-3110"
+//   3111: group 0, "flag-name-3111"
+//   3112: group 0, "flag-name-3112"
+//   3113: group 0, "flag-name-3113"
+//   3114: group 0, "flag-name-3114"
+//   3115: group 0, "flag-name-3115"
+//   3116: group 0, "flag-name-3116"
+//   3117: group 0, "flag-name-3117"
+//   3118: group 0, "flag-name-3118"
+//   3119: group 0, "flag-name-3119"
+//   3120: group 0, "flag-name-3120"
+//   3121: group 0, "flag-name-3121"
+//   3122: group 0, "flag-name-3122"
+//   3123: group 0, "flag-name-3123"
+//   3124: group 0, "flag-name-3124"
+//   3125: group 0, "flag-name-3125"
+//   3126: group 0, "flag-name-3126"
+//   3127: group 0, "flag-name-3127"
+//   3128: group 0, "flag-name-3128"
+//   3129: group 0, "flag-name-3129"
+//   3130: group 0, "flag-name-3130"
+//   3131: group 0, "flag-name-3131"
+//   3132: group 0, "flag-name-3132"
+//   3133: group 0, "flag-name-3133"
+//   3134: group 0, "flag-name-3134"
+//   3135: group 0, "flag-name-3135"
+//   3136: group 0, "flag-name-3136"
+//   3137: group 0, "flag-name-3137"
+//   3138: group 0, "flag-name-3138"
+//   3139: group 0, "flag-name-3139"
+//   3140: group 0, "flag-name-3140"
+//   3141: group 0, "flag-name-3141"
+//   3142: group 0, "flag-name-3142"
+//   3143: group 0, "flag-name-3143"
+//   3144: group 0, "flag-name-3144"
+//   3145: group 0, "flag-name-3145"
+//   3146: group 0, "flag-name-3146"
+//   3147: group 0, "flag-name-3147"
+//   3148: group 0, "flag-name-3148"
+//   3149: group 0, "flag-name-3149"
+//   3150: group 0, "flag-name-3150"
+//   3151: group 0, "flag-name-3151"
+//   3152: group 0, "flag-name-3152"
+//   3153: group 0, "flag-name-3153"
+//   3154: group 0, "flag-name-3154"
+//   3155: group 0, "flag-name-3155"
+//   3156: group 0, "flag-name-3156"
+//   3157: group 0, "flag-name-3157"
+//   3158: group 0, "flag-name-3158"
+//   3159: group 0, "flag-name-3159"
+//   3160: group 0, "flag-name-3160"
+//   3161: group 0, "flag-name-3161"
+//   3162: group 0, "flag-name-3162"
+//   3163: group 0, "flag-name-3163"
+//   3164: group 0, "flag-name-3164"
+//   3165: group 0, "flag-name-3165"
+//   3166: group 0, "flag-name-3166"
+//   3167: group 0, "flag-name-3167"
+//   3168: group 0, "flag-name-3168"
+//   3169: group 0, "flag-name-3169"
+//   3170: group 0, "flag-name-3170"
+//   3171: group 0, "flag-name-3171"
+//   3172: group 0, "flag-name-3172"
+//   3173: group 0, "flag-name-3173"
+//   3174: group 0, "flag-name-3174"
+//   3175: group 0, "flag-name-3175"
+//   3176: group 0, "flag-name-3176"
+//   3177: group 0, "flag-name-3177"
+//   3178: group 0, "flag-name-3178"
+//   3179: group 0, "flag-name-3179"
+//   3180: group 0, "flag-name-3180"
+//   3181: group 0, "flag-name-3181"
+//   3182: group 0, "flag-name-3182"
+//   3183: group 0, "flag-name-3183"
+//   3184: group 0, "flag-name-3184"
+//   3185: group 0, "flag-name-3185"
+//   3186: group 0, "flag-name-3186"
+//   3187: group 0, "flag-name-3187"
+//   3188: group 0, "flag-name-3188"
+//   3189: group 0, "flag-name-3189"
+//   3190: group 0, "flag-name-3190"
+//   3191: group 0, "flag-name-3191"
+//   3192: group 0, "flag-name-3192"
+//   3193: group 0, "flag-name-3193"
+//   3194: group 0, "flag-name-3194"
+//   3195: group 0, "flag-name-3195"
+//   3196: group 0, "flag-name-3196"
+//   3197: group 0, "flag-name-3197"
+//   3198: group 0, "flag-name-3198"
+//   3199: group 0, "flag-name-3199"
+//   3200: group 0, "flag-name-3200"
+//   3201: group 0, "flag-name-3201"
+//   3202: group 0, "flag-name-3202"
+//   3203: group 0, "flag-name-3203"
+//   3204: group 0, "flag-name-3204"
+//   3205: group 0, "flag-name-3205"
+//   3206: group 0, "flag-name-3206"
+//   3207: group 0, "flag-name-3207"
+//   3208: group 0, "flag-name-3208"
+//   3209: group 0, "flag-name-3209"
+//   3210: group 0, "flag-name-3210"
+//   3211: group 0, "flag-name-3211"
+//   3212: group 0, "flag-name-3212"
+//   3213: group 0, "flag-name-3213"
+//   3214: group 0, "flag-name-3214"
+//   3215: group 0, "flag-name-3215"
+//   3216: group 0, "flag-name-3216"
+//   3217: group 0, "flag-name-3217"
+//   3218: group 0, "flag-name-3218"
+//   3219: group 0, "flag-name-3219"
+//   3220: group 0, "flag-name-3220"
+//   3221: group 0, "flag-name-3221"
+//   3222: group 0, "flag-name-3222"
+//   3223: group 0, "flag-name-3223"
+//   3224: group 0, "flag-name-3224"
+//   3225: group 0, "flag-name-3225"
+//   3226: group 0, "flag-name-3226"
+//   3227: group 0, "flag-name-3227"
+//   3228: group 0, "flag-name-3228"
+//   3229: group 0, "flag-name-3229"
+//   3230: group 0, "flag-name-3230"
+//   3231: group 0, "flag-name-3231"
+//   3232: group 0, "flag-name-3232"
+//   3233: group 0, "flag-name-3233"
+//   3234: group 0, "flag-name-3234"
+//   3235: group 0, "flag-name-3235"
+//   3236: group 0, "flag-name-3236"
+//   3237: group 0, "flag-name-3237"
+//   3238: group 0, "flag-name-3238"
+//   3239: group 0, "flag-name-3239"
+//   3240: group 0, "flag-name-3240"
+//   3241: group 0, "flag-name-3241"
+//   3242: group 0, "flag-name-3242"
+//   3243: group 0, "flag-name-3243"
+//   3244: group 0, "flag-name-3244"
+//   3245: group 0, "flag-name-3245"
+//   3246: group 0, "flag-name-3246"
+//   3247: group 0, "flag-name-3247"
+//   3248: group 0, "flag-name-3248"
+//   3249: group 0, "flag-name-3249"
+//   3250: group 0, "flag-name-3250"
+//   3251: group 0, "flag-name-3251"
+//   3252: group 0, "flag-name-3252"
+//   3253: group 0, "flag-name-3253"
+//   3254: group 0, "flag-name-3254"
+//   3255: group 0, "flag-name-3255"
+//   3256: group 0, "flag-name-3256"
+//   3257: group 0, "flag-name-3257"
+//   3258: group 0, "flag-name-3258"
+//   3259: group 0, "flag-name-3259"
+//   3260: group 0, "flag-name-3260"
+//   3261: group 0, "flag-name-3261"
+//   3262: group 0, "flag-name-3262"
+//   3263: group 0, "flag-name-3263"
+//   3264: group 0, "flag-name-3264"
+//   3265: group 0, "flag-name-3265"
+//   3266: group 0, "flag-name-3266"
+//   3267: group 0, "flag-name-3267"
+//   3268: group 0, "flag-name-3268"
+//   3269: group 0, "flag-name-3269"
+//   3270: group 0, "flag-name-3270"
+//   3271: group 0, "flag-name-3271"
+//   3272: group 0, "flag-name-3272"
+//   3273: group 0, "flag-name-3273"
+//   3274: group 0, "flag-name-3274"
+//   3275: group 0, "flag-name-3275"
+//   3276: group 0, "flag-name-3276"
+//   3277: group 0, "flag-name-3277"
+//   3278: group 0, "flag-name-3278"
+//   3279: group 0, "flag-name-3279"
+//   3280: group 0, "flag-name-3280"
+//   3281: group 0, "flag-name-3281"
+//   3282: group 0, "flag-name-3282"
+//   3283: group 0, "flag-name-3283"
+//   3284: group 0, "flag-name-3284"
+//   3285: group 0, "flag-name-3285"
+//   3286: group 0, "flag-name-3286"
+//   3287: group 0, "flag-name-3287"
+//   3288: group 0, "flag-name-3288"
+//   3289: group 0, "flag-name-3289"
+//   3290: group 0, "flag-name-3290"
+//   3291: group 0, "flag-name-3291"
+//   3292: group 0, "flag-name-3292"
+//   3293: group 0, "flag-name-3293"
+//   3294: group 0, "flag-name-3294"
+//   3295: group 0, "flag-name-3295"
+//   3296: group 0, "flag-name-3296"
+//   3297: group 0, "flag-name-3297"
+//   3298: group 0, "flag-name-3298"
+//   3299: group 0, "flag-name-3299"
+//   3300: group 0, "flag-name-3300"
+//   3301: group 0, "flag-name-3301"
+//   3302: group 0, "flag-name-3302"
+//   3303: group 0, "flag-name-3303"
+//   3304: group 0, "flag-name-3304"
+//   3305: group 0, "flag-name-3305"
+//   3306: group 0, "flag-name-3306"
+//   3307: group 0, "flag-name-3307"
+//   3308: group 0, "flag-name-3308"
+//   3309: group 0, "flag-name-3309"
+//   3310: group 0, "flag-name-3310"
+//   3311: group 0, "flag-name-3311"
+//   3312: group 0, "flag-name-3312"
+//   3313: group 0, "flag-name-3313"
+//   3314: group 0, "flag-name-3314"
+//   3315: group 0, "flag-name-3315"
+//   3316: group 0, "flag-name-3316"
+//   3317: group 0, "flag-name-3317"
+//   3318: group 0, "flag-name-3318"
+//   3319: group 0, "flag-name-3319"
+//   3320: group 0, "flag-name-3320"
+//   3321: group 0, "flag-name-3321"
+//   3322: group 0, "flag-name-3322"
+//   3323: group 0, "flag-name-3323"
+//   3324: group 0, "flag-name-3324"
+//   3325: group 0, "flag-name-3325"
+//   3326: group 0, "flag-name-3326"
+//   3327: group 0, "flag-name-3327"
+//   3328: group 0, "flag-name-3328"
+//   3329: group 0, "flag-name-3329"
+//   3330: group 0, "flag-name-3330"
+//   3331: group 0, "flag-name-3331"
+//   3332: group 0, "flag-name-3332"
+//   3333: group 0, "flag-name-3333"
+//   3334: group 0, "flag-name-3334"
+//   3335: group 0, "flag-name-3335"
+//   3336: group 0, "flag-name-3336"
+//   3337: group 0, "flag-name-3337"
+//   3338: group 0, "flag-name-3338"
+//   3339: group 0, "flag-name-3339"
+//   3340: group 0, "flag-name-3340"
+//   3341: group 0, "flag-name-3341"
+//   3342: group 0, "flag-name-3342"
+//   3343: group 0, "flag-name-3343"
+//   3344: group 0, "flag-name-3344"
+//   3345: group 0, "flag-name-3345"
+//   3346: group 0, "flag-name-3346"
+//   3347: group 0, "flag-name-3347"
+//   3348: group 0, "flag-name-3348"
+//   3349: group 0, "flag-name-3349"
+//   3350: group 0, "flag-name-3350"
+//   3351: group 0, "flag-name-3351"
+//   3352: group 0, "flag-name-3352"
+//   3353: group 0, "flag-name-3353"
+//   3354: group 0, "flag-name-3354"
+//   3355: group 0, "flag-name-3355"
+//   3356: group 0, "flag-name-3356"
+//   3357: group 0, "flag-name-3357"
+//   3358: group 0, "flag-name-3358"
+//   3359: group 0, "flag-name-3359"
+//   3360: group 0, "flag-name-3360"
+//   3361: group 0, "flag-name-3361"
+//   3362: group 0, "flag-name-3362"
+//   3363: group 0, "flag-name-3363"
+//   3364: group 0, "flag-name-3364"
+//   3365: group 0, "flag-name-3365"
+//   3366: group 0, "flag-name-3366"
+//   3367: group 0, "flag-name-3367"
+//   3368: group 0, "flag-name-3368"
+//   3369: group 0, "flag-name-3369"
+//   3370: group 0, "flag-name-3370"
+//   3371: group 0, "flag-name-3371"
+//   3372: group 0, "flag-name-3372"
+//   3373: group 0, "flag-name-3373"
+//   3374: group 0, "flag-name-3374"
+//   3375: group 0, "flag-name-3375"
+//   3376: group 0, "flag-name-3376"
+//   3377: group 0, "flag-name-3377"
+//   3378: group 0, "flag-name-3378"
+//   3379: group 0, "flag-name-3379"
+//   3380: group 0, "flag-name-3380"
+//   3381: group 0, "flag-name-3381"
+//   3382: group 0, "flag-name-3382"
+//   3383: group 0, "flag-name-3383"
+//   3384: group 0, "flag-name-3384"
+//   3385: group 0, "flag-name-3385"
+//   3386: group 0, "flag-name-3386"
+//   3387: group 0, "flag-name-3387"
+//   3388: group 0, "flag-name-3388"
+//   3389: group 0, "flag-name-3389"
+//   3390: group 0, "flag-name-3390"
+//   3391: group 0, "flag-name-3391"
+//   3392: group 0, "flag-name-3392"
+//   3393: group 0, "flag-name-3393"
+//   3394: group 0, "flag-name-3394"
+//   3395: group 0, "flag-name-3395"
+//   3396: group 0, "flag-name-3396"
+//   3397: group 0, "flag-name-3397"
+//   3398: group 0, "flag-name-3398"
+//   3399: group 0, "flag-name-3399"
+//   3400: group 0, "flag-name-3400"
+//   3401: group 0, "flag-name-3401"
+//   3402: group 0, "flag-name-3402"
+//   3403: group 0, "flag-name-3403"
+//   3404: group 0, "flag-name-3404"
+//   3405: group 0, "flag-name-3405"
+//   3406: group 0, "flag-name-3406"
+//   3407: group 0, "flag-name-3407"
+//   3408: group 0, "flag-name-3408"
+//   3409: group 0, "flag-name-3409"
+//   3410: group 0, "flag-name-3410"
+//   3411: group 0, "flag-name-3411"
+//   3412: group 0, "flag-name-3412"
+//   3413: group 0, "flag-name-3413"
+//   3414: group 0, "flag-name-3414"
+//   3415: group 0, "flag-name-3415"
+//   3416: group 0, "flag-name-3416"
+//   3417: group 0, "flag-name-3417"
+//   3418: group 0, "flag-name-3418"
+//   3419: group 0, "flag-name-3419"
+//   3420: group 0, "flag-name-3420"
+//   3421: group 0, "flag-name-3421"
+//   3422: group 0, "flag-name-3422"
+//   3423: group 0, "flag-name-3423"
+//   3424: group 0, "flag-name-3424"
+//   3425: group 0, "flag-name-3425"
+//   3426: group 0, "flag-name-3426"
+//   3427: group 0, "flag-name-3427"
+//   3428: group 0, "flag-name-3428"
+//   3429: group 0, "flag-name-3429"
+//   3430: group 0, "flag-name-3430"
+//   3431: group 0, "flag-name-3431"
+//   3432: group 0, "flag-name-3432"
+//   3433: group 0, "flag-name-3433"
+//   3434: group 0, "flag-name-3434"
+//   3435: group 0, "flag-name-3435"
+//   3436: group 0, "flag-name-3436"
+//   3437: group 0, "flag-name-3437"
+//   3438: group 0, "flag-name-3438"
+//   3439: group 0, "flag-name-3439"
+//   3440: group 0, "flag-name-3440"
+//   3441: group 0, "flag-name-3441"
+//   3442: group 0, "flag-name-3442"
+//   3443: group 0, "flag-name-3443"
+//   3444: group 0, "flag-name-3444"
+//   3445: group 0, "flag-name-3445"
+//   3446: group 0, "flag-name-3446"
+//   3447: group 0, "flag-name-3447"
+//   3448: group 0, "flag-name-3448"
+//   3449: group 0, "flag-name-3449"
+//   3450: group 0, "flag-name-3450"
+//   3451: group 0, "flag-name-3451"
+//   3452: group 0, "flag-name-3452"
+//   3453: group 0, "flag-name-3453"
+//   3454: group 0, "flag-name-3454"
+//   3455: group 0, "flag-name-3455"
+//   3456: group 0, "flag-name-3456"
+//   3457: group 0, "flag-name-3457"
+//   3458: group 0, "flag-name-3458"
+//   3459: group 0, "flag-name-3459"
+//   3460: group 0, "flag-name-3460"
+//   3461: group 0, "flag-name-3461"
+//   3462: group 0, "flag-name-3462"
+//   3463: group 0, "flag-name-3463"
+//   3464: group 0, "flag-name-3464"
+//   3465: group 0, "flag-name-3465"
+//   3466: group 0, "flag-name-3466"
+//   3467: group 0, "flag-name-3467"
+//   3468: group 0, "flag-name-3468"
+//   3469: group 0, "flag-name-3469"
+//   3470: group 0, "flag-name-3470"
+//   3471: group 0, "flag-name-3471"
+//   3472: group 0, "flag-name-3472"
+//   3473: group 0, "flag-name-3473"
+//   3474: group 0, "flag-name-3474"
+//   3475: group 0, "flag-name-3475"
+//   3476: group 0, "flag-name-3476"
+//   3477: group 0, "flag-name-3477"
+//   3478: group 0, "flag-name-3478"
+//   3479: group 0, "flag-name-3479"
+//   3480: group 0, "flag-name-3480"
+//   3481: group 0, "flag-name-3481"
+//   3482: group 0, "flag-name-3482"
+//   3483: group 0, "flag-name-3483"
+//   3484: group 0, "flag-name-3484"
+//   3485: group 0, "flag-name-3485"
+//   3486: group 0, "flag-name-3486"
+//   3487: group 0, "flag-name-3487"
+//   3488: group 0, "flag-name-3488"
+//   3489: group 0, "flag-name-3489"
+//   3490: group 0, "flag-name-3490"
+//   3491: group 0, "flag-name-3491"
+//   3492: group 0, "flag-name-3492"
+//   3493: group 0, "flag-name-3493"
+//   3494: group 0, "flag-name-3494"
+//   3495: group 0, "flag-name-3495"
+//   3496: group 0, "flag-name-3496"
+//   3497: group 0, "flag-name-3497"
+//   3498: group 0, "flag-name-3498"
+//   3499: group 0, "flag-name-3499"
+//   3500: group 0, "flag-name-3500"
+//   3501: group 0, "flag-name-3501"
+//   3502: group 0, "flag-name-3502"
+//   3503: group 0, "flag-name-3503"
+//   3504: group 0, "flag-name-3504"
+//   3505: group 0, "flag-name-3505"
+//   3506: group 0, "flag-name-3506"
+//   3507: group 0, "flag-name-3507"
+//   3508: group 0, "flag-name-3508"
+//   3509: group 0, "flag-name-3509"
+//   3510: group 0, "flag-name-3510"
+//   3511: group 0, "flag-name-3511"
+//   3512: group 0, "flag-name-3512"
+//   3513: group 0, "flag-name-3513"
+//   3514: group 0, "flag-name-3514"
+//   3515: group 0, "flag-name-3515"
+//   3516: group 0, "flag-name-3516"
+//   3517: group 0, "flag-name-3517"
+//   3518: group 0, "flag-name-3518"
+//   3519: group 0, "flag-name-3519"
+//   3520: group 0, "flag-name-3520"
+//   3521: group 0, "flag-name-3521"
+//   3522: group 0, "flag-name-3522"
+//   3523: group 0, "flag-name-3523"
+//   3524: group 0, "flag-name-3524"
+//   3525: group 0, "flag-name-3525"
+//   3526: group 0, "flag-name-3526"
+//   3527: group 0, "flag-name-3527"
+//   3528: group 0, "flag-name-3528"
+//   3529: group 0, "flag-name-3529"
+//   3530: group 0, "flag-name-3530"
+//   3531: group 0, "flag-name-3531"
+//   3532: group 0, "flag-name-3532"
+//   3533: group 0, "flag-name-3533"
+//   3534: group 0, "flag-name-3534"
+//   3535: group 0, "flag-name-3535"
+//   3536: group 0, "flag-name-3536"
+//   3537: group 0, "flag-name-3537"
+//   3538: group 0, "flag-name-3538"
+//   3539: group 0, "flag-name-3539"
+//   3540: group 0, "flag-name-3540"
+//   3541: group 0, "flag-name-3541"
+//   3542: group 0, "flag-name-3542"
+//   3543: group 0, "flag-name-3543"
+//   3544: group 0, "flag-name-3544"
+//   3545: group 0, "flag-name-3545"
+//   3546: group 0, "flag-name-3546"
+//   3547: group 0, "flag-name-3547"
+//   3548: group 0, "flag-name-3548"
+//   3549: group 0, "flag-name-3549"
+//   3550: group 0, "flag-name-3550"
+//   3551: group 0, "flag-name-3551"
+//   3552: group 0, "flag-name-3552"
+//   3553: group 0, "flag-name-3553"
+//   3554: group 0, "flag-name-3554"
+//   3555: group 0, "flag-name-3555"
+//   3556: group 0, "flag-name-3556"
+//   3557: group 0, "flag-name-3557"
+//   3558: group 0, "flag-name-3558"
+//   3559: group 0, "flag-name-3559"
+//   3560: group 0, "flag-name-3560"
+//   3561: group 0, "flag-name-3561"
+//   3562: group 0, "flag-name-3562"
+//   3563: group 0, "flag-name-3563"
+//   3564: group 0, "flag-name-3564"
+//   3565: group 0, "flag-name-3565"
+//   3566: group 0, "flag-name-3566"
+//   3567: group 0, "flag-name-3567"
+//   3568: group 0, "flag-name-3568"
+//   3569: group 0, "flag-name-3569"
+//   3570: group 0, "flag-name-3570"
+//   3571: group 0, "flag-name-3571"
+//   3572: group 0, "flag-name-3572"
+//   3573: group 0, "flag-name-3573"
+//   3574: group 0, "flag-name-3574"
+//   3575: group 0, "flag-name-3575"
+//   3576: group 0, "flag-name-3576"
+//   3577: group 0, "flag-name-3577"
+//   3578: group 0, "flag-name-3578"
+//   3579: group 0, "flag-name-3579"
+//   3580: group 0, "flag-name-3580"
+//   3581: group 0, "flag-name-3581"
+//   3582: group 0, "flag-name-3582"
+//   3583: group 0, "flag-name-3583"
+//   3584: group 0, "flag-name-3584"
+//   3585: group 0, "flag-name-3585"
+//   3586: group 0, "flag-name-3586"
+//   3587: group 0, "flag-name-3587"
+//   3588: group 0, "flag-name-3588"
+//   3589: group 0, "flag-name-3589"
+//   3590: group 0, "flag-name-3590"
+//   3591: group 0, "flag-name-3591"
+//   3592: group 0, "flag-name-3592"
+//   3593: group 0, "flag-name-3593"
+//   3594: group 0, "flag-name-3594"
+//   3595: group 0, "flag-name-3595"
+//   3596: group 0, "flag-name-3596"
+//   3597: group 0, "flag-name-3597"
+//   3598: group 0, "flag-name-3598"
+//   3599: group 0, "flag-name-3599"
+//   3600: group 0, "flag-name-3600"
+//   3601: group 0, "flag-name-3601"
+//   3602: group 0, "flag-name-3602"
+//   3603: group 0, "flag-name-3603"
+//   3604: group 0, "flag-name-3604"
+//   3605: group 0, "flag-name-3605"
+//   3606: group 0, "flag-name-3606"
+//   3607: group 0, "flag-name-3607"
+//   3608: group 0, "flag-name-3608"
+//   3609: group 0, "flag-name-3609"
+//   3610: group 0, "flag-name-3610"
+//   3611: group 0, "flag-name-3611"
+//   3612: group 0, "flag-name-3612"
+//   3613: group 0, "flag-name-3613"
+//   3614: group 0, "flag-name-3614"
+//   3615: group 0, "flag-name-3615"
+//   3616: group 0, "flag-name-3616"
+//   3617: group 0, "flag-name-3617"
+//   3618: group 0, "flag-name-3618"
+//   3619: group 0, "flag-name-3619"
+//   3620: group 0, "flag-name-3620"
+//   3621: group 0, "flag-name-3621"
+//   3622: group 0, "flag-name-3622"
+//   3623: group 0, "flag-name-3623"
+//   3624: group 0, "flag-name-3624"
+//   3625: group 0, "flag-name-3625"
+//   3626: group 0, "flag-name-3626"
+//   3627: group 0, "flag-name-3627"
+//   3628: group 0, "flag-name-3628"
+//   3629: group 0, "flag-name-3629"
+//   3630: group 0, "flag-name-3630"
+//   3631: group 0, "flag-name-3631"
+//   3632: group 0, "flag-name-3632"
+//   3633: group 0, "flag-name-3633"
+//   3634: group 0, "flag-name-3634"
+//   3635: group 0, "flag-name-3635"
+//   3636: group 0, "flag-name-3636"
+//   3637: group 0, "flag-name-3637"
+//   3638: group 0, "flag-name-3638"
+//   3639: group 0, "flag-name-3639"
+//   3640: group 0, "flag-name-3640"
+//   3641: group 0, "flag-name-3641"
+//   3642: group 0, "flag-name-3642"
+//   3643: group 0, "flag-name-3643"
+//   3644: group 0, "flag-name-3644"
+//   3645: group 0, "flag-name-3645"
+//   3646: group 0, "flag-name-3646"
+//   3647: group 0, "flag-name-3647"
+//   3648: group 0, "flag-name-3648"
+//   3649: group 0, "flag-name-3649"
+//   3650: group 0, "flag-name-3650"
+//   3651: group 0, "flag-name-3651"
+//   3652: group 0, "flag-name-3652"
+//   3653: group 0, "flag-name-3653"
+//   3654: group 0, "flag-name-3654"
+//   3655: group 0, "flag-name-3655"
+//   3656: group 0, "flag-name-3656"
+//   3657: group 0, "flag-name-3657"
+//   3658: group 0, "flag-name-3658"
+//   3659: group 0, "flag-name-3659"
+//   3660: group 0, "flag-name-3660"
+//   3661: group 0, "flag-name-3661"
+//   3662: group 0, "flag-name-3662"
+//   3663: group 0, "flag-name-3663"
+//   3664: group 0, "flag-name-3664"
+//   3665: group 0, "flag-name-3665"
+//   3666: group 0, "flag-name-3666"
+//   3667: group 0, "flag-name-3667"
+//   3668: group 0, "flag-name-3668"
+//   3669: group 0, "flag-name-3669"
+//   3670: group 0, "flag-name-3670"
+//   3671: group 0, "flag-name-3671"
+//   3672: group 0, "flag-name-3672"
+//   3673: group 0, "flag-name-3673"
+//   3674: group 0, "flag-name-3674"
+//   3675: group 0, "flag-name-3675"
+//   3676: group 0, "flag-name-3676"
+//   3677: group 0, "flag-name-3677"
+//   3678: group 0, "flag-name-3678"
+//   3679: group 0, "flag-name-3679"
+//   3680: group 0, "flag-name-3680"
+//   3681: group 0, "flag-name-3681"
+//   3682: group 0, "flag-name-3682"
+//   3683: group 0, "flag-name-3683"
+//   3684: group 0, "flag-name-3684"
+//   3685: group 0, "flag-name-3685"
+//   3686: group 0, "flag-name-3686"
+//   3687: group 0, "flag-name-3687"
+//   3688: group 0, "flag-name-3688"
+//   3689: group 0, "flag-name-3689"
+//   3690: group 0, "flag-name-3690"
+//   3691: group 0, "flag-name-3691"
+//   3692: group 0, "flag-name-3692"
+//   3693: group 0, "flag-name-3693"
+//   3694: group 0, "flag-name-3694"
+//   3695: group 0, "flag-name-3695"
+//   3696: group 0, "flag-name-3696"
+//   3697: group 0, "flag-name-3697"
+//   3698: group 0, "flag-name-3698"
+//   3699: group 0, "flag-name-3699"
+//   3700: group 0, "flag-name-3700"
+//   3701: group 0, "flag-name-3701"
+//   3702: group 0, "flag-name-3702"
+//   3703: group 0, "flag-name-3703"
+//   3704: group 0, "flag-name-3704"
+//   3705: group 0, "flag-name-3705"
+//   3706: group 0, "flag-name-3706"
+//   3707: group 0, "flag-name-3707"
+//   3708: group 0, "flag-name-3708"
+//   3709: group 0, "flag-name-3709"
+//   3710: group 0, "flag-name-3710"
+//   3711: group 0, "flag-name-3711"
+//   3712: group 0, "flag-name-3712"
+//   3713: group 0, "flag-name-3713"
+//   3714: group 0, "flag-name-3714"
+//   3715: group 0, "flag-name-3715"
+//   3716: group 0, "flag-name-3716"
+//   3717: group 0, "flag-name-3717"
+//   3718: group 0, "flag-name-3718"
+//   3719: group 0, "flag-name-3719"
+//   3720: group 0, "flag-name-3720"
+//   3721: group 0, "flag-name-3721"
+//   3722: group 0, "flag-name-3722"
+//   3723: group 0, "flag-name-3723"
+//   3724: group 0, "flag-name-3724"
+//   3725: group 0, "flag-name-3725"
+//   3726: group 0, "flag-name-3726"
+//   3727: group 0, "flag-name-3727"
+//   3728: group 0, "flag-name-3728"
+//   3729: group 0, "flag-name-3729"
+//   3730: group 0, "flag-name-3730"
+//   3731: group 0, "flag-name-3731"
+//   3732: group 0, "flag-name-3732"
+//   3733: group 0, "flag-name-3733"
+//   3734: group 0, "flag-name-3734"
+//   3735: group 0, "flag-name-3735"
+//   3736: group 0, "flag-name-3736"
+//   3737: group 0, "flag-name-3737"
+//   3738: group 0, "flag-name-3738"
+//   3739: group 0, "flag-name-3739"
+//   3740: group 0, "flag-name-3740"
+//   3741: group 0, "flag-name-3741"
+//   3742: group 0, "flag-name-3742"
+//   3743: group 0, "flag-name-3743"
+//   3744: group 0, "flag-name-3744"
+//   3745: group 0, "flag-name-3745"
+//   3746: group 0, "flag-name-3746"
+//   3747: group 0, "flag-name-3747"
+//   3748: group 0, "flag-name-3748"
+//   3749: group 0, "flag-name-3749"
+//   3750: group 0, "flag-name-3750"
+//   3751: group 0, "flag-name-3751"
+//   3752: group 0, "flag-name-3752"
+//   3753: group 0, "flag-name-3753"
+//   3754: group 0, "flag-name-3754"
+//   3755: group 0, "flag-name-3755"
+//   3756: group 0, "flag-name-3756"
+//   3757: group 0, "flag-name-3757"
+//   3758: group 0, "flag-name-3758"
+//   3759: group 0, "flag-name-3759"
+//   3760: group 0, "flag-name-3760"
+//   3761: group 0, "flag-name-3761"
+//   3762: group 0, "flag-name-3762"
+//   3763: group 0, "flag-name-3763"
+//   3764: group 0, "flag-name-3764"
+//   3765: group 0, "flag-name-3765"
+//   3766: group 0, "flag-name-3766"
+//   3767: group 0, "flag-name-3767"
+//   3768: group 0, "flag-name-3768"
+//   3769: group 0, "flag-name-3769"
+//   3770: group 0, "flag-name-3770"
+//   3771: group 0, "flag-name-3771"
+//   3772: group 0, "flag-name-3772"
+//   3773: group 0, "flag-name-3773"
+//   3774: group 0, "flag-name-3774"
+//   3775: group 0, "flag-name-3775"
+//   3776: group 0, "flag-name-3776"
+//   3777: group 0, "flag-name-3777"
+//   3778: group 0, "flag-name-3778"
+//   3779: group 0, "flag-name-3779"
+//   3780: group 0, "flag-name-3780"
+//   3781: group 0, "flag-name-3781"
+//   3782: group 0, "flag-name-3782"
+//   3783: group 0, "flag-name-3783"
+//   3784: group 0, "flag-name-3784"
+//   3785: group 0, "flag-name-3785"
+//   3786: group 0, "flag-name-3786"
+//   3787: group 0, "flag-name-3787"
+//   3788: group 0, "flag-name-3788"
+//   3789: group 0, "flag-name-3789"
+//   3790: group 0, "flag-name-3790"
+//   3791: group 0, "flag-name-3791"
+//   3792: group 0, "flag-name-3792"
+//   3793: group 0, "flag-name-3793"
+//   3794: group 0, "flag-name-3794"
+//   3795: group 0, "flag-name-3795"
+//   3796: group 0, "flag-name-3796"
+//   3797: group 0, "flag-name-3797"
+//   3798: group 0, "flag-name-3798"
+//   3799: group 0, "flag-name-3799"
+//   3800: group 0, "flag-name-3800"
+//   3801: group 0, "flag-name-3801"
+//   3802: group 0, "flag-name-3802"
+//   3803: group 0, "flag-name-3803"
+//   3804: group 0, "flag-name-3804"
+//   3805: group 0, "flag-name-3805"
+//   3806: group 0, "flag-name-3806"
+//   3807: group 0, "flag-name-3807"
+//   3808: group 0, "flag-name-3808"
+//   3809: group 0, "flag-name-3809"
+//   3810: group 0, "flag-name-3810"
+//   3811: group 0, "flag-name-3811"
+//   3812: group 0, "flag-name-3812"
+//   3813: group 0, "flag-name-3813"
+//   3814: group 0, "flag-name-3814"
+//   3815: group 0, "flag-name-3815"
+//   3816: group 0, "flag-name-3816"
+//   3817: group 0, "flag-name-3817"
+//   3818: group 0, "flag-name-3818"
+//   3819: group 0, "flag-name-3819"
+//   3820: group 0, "flag-name-3820"
+//   3821: group 0, "flag-name-3821"
+//   3822: group 0, "flag-name-3822"
+//   3823: group 0, "flag-name-3823"
+//   3824: group 0, "flag-name-3824"
+//   3825: group 0, "flag-name-3825"
+//   3826: group 0, "flag-name-3826"
+//   3827: group 0, "flag-name-3827"
+//   3828: group 0, "flag-name-3828"
+//   3829: group 0, "flag-name-3829"
+//   3830: group 0, "flag-name-3830"
+//   3831: group 0, "flag-name-3831"
+//   3832: group 0, "flag-name-3832"
+//   3833: group 0, "flag-name-3833"
+//   3834: group 0, "flag-name-3834"
+//   3835: group 0, "flag-name-3835"
+//   3836: group 0, "flag-name-3836"
+//   3837: group 0, "flag-name-3837"
+//   3838: group 0, "flag-name-3838"
+//   3839: group 0, "flag-name-3839"
+//   3840: group 0, "flag-name-3840"
+//   3841: group 0, "flag-name-3841"
+//   3842: group 0, "flag-name-3842"
+//   3843: group 0, "flag-name-3843"
+//   3844: group 0, "flag-name-3844"
+//   3845: group 0, "flag-name-3845"
+//   3846: group 0, "flag-name-3846"
+//   3847: group 0, "flag-name-3847"
+//   3848: group 0, "flag-name-3848"
+//   3849: group 0, "flag-name-3849"
+//   3850: group 0, "flag-name-3850"
+//   3851: group 0, "flag-name-3851"
+//   3852: group 0, "flag-name-3852"
+//   3853: group 0, "flag-name-3853"
+//   3854: group 0, "flag-name-3854"
+//   3855: group 0, "flag-name-3855"
+//   3856: group 0, "flag-name-3856"
+//   3857: group 0, "flag-name-3857"
+//   3858: group 0, "flag-name-3858"
+//   3859: group 0, "flag-name-3859"
+//   3860: group 0, "flag-name-3860"
+//   3861: group 0, "flag-name-3861"
+//   3862: group 0, "flag-name-3862"
+//   3863: group 0, "flag-name-3863"
+//   3864: group 0, "flag-name-3864"
+//   3865: group 0, "flag-name-3865"
+//   3866: group 0, "flag-name-3866"
+//   3867: group 0, "flag-name-3867"
+//   3868: group 0, "flag-name-3868"
+//   3869: group 0, "flag-name-3869"
+//   3870: group 0, "flag-name-3870"
+//   3871: group 0, "flag-name-3871"
+//   3872: group 0, "flag-name-3872"
+//   3873: group 0, "flag-name-3873"
+//   3874: group 0, "flag-name-3874"
+//   3875: group 0, "flag-name-3875"
+//   3876: group 0, "flag-name-3876"
+//   3877: group 0, "flag-name-3877"
+//   3878: group 0, "flag-name-3878"
+//   3879: group 0, "flag-name-3879"
+//   3880: group 0, "flag-name-3880"
+//   3881: group 0, "flag-name-3881"
+//   3882: group 0, "flag-name-3882"
+//   3883: group 0, "flag-name-3883"
+//   3884: group 0, "flag-name-3884"
+//   3885: group 0, "flag-name-3885"
+//   3886: group 0, "flag-name-3886"
+//   3887: group 0, "flag-name-3887"
+//   3888: group 0, "flag-name-3888"
+//   3889: group 0, "flag-name-3889"
+//   3890: group 0, "flag-name-3890"
+//   3891: group 0, "flag-name-3891"
+//   3892: group 0, "flag-name-3892"
+//   3893: group 0, "flag-name-3893"
+//   3894: group 0, "flag-name-3894"
+//   3895: group 0, "flag-name-3895"
+//   3896: group 0, "flag-name-3896"
+//   3897: group 0, "flag-name-3897"
+//   3898: group 0, "flag-name-3898"
+//   3899: group 0, "flag-name-3899"
+//   3900: group 0, "flag-name-3900"
+//   3901: group 0, "flag-name-3901"
+//   3902: group 0, "flag-name-3902"
+//   3903: group 0, "flag-name-3903"
+//   3904: group 0, "flag-name-3904"
+//   3905: group 0, "flag-name-3905"
+//   3906: group 0, "flag-name-3906"
+//   3907: group 0, "flag-name-3907"
+//   3908: group 0, "flag-name-3908"
+//   3909: group 0, "flag-name-3909"
+//   3910: group 0, "flag-name-3910"
+//   3911: group 0, "flag-name-3911"
+//   3912: group 0, "flag-name-3912"
+//   3913: group 0, "flag-name-3913"
+//   3914: group 0, "flag-name-3914"
+//   3915: group 0, "flag-name-3915"
+//   3916: group 0, "flag-name-3916"
+//   3917: group 0, "flag-name-3917"
+//   3918: group 0, "flag-name-3918"
+//   3919: group 0, "flag-name-3919"
+//   3920: group 0, "flag-name-3920"
+//   3921: group 0, "flag-name-3921"
+//   3922: group 0, "flag-name-3922"
+//   3923: group 0, "flag-name-3923"
+//   3924: group 0, "flag-name-3924"
+//   3925: group 0, "flag-name-3925"
+//   3926: group 0, "flag-name-3926"
+//   3927: group 0, "flag-name-3927"
+//   3928: group 0, "flag-name-3928"
+//   3929: group 0, "flag-name-3929"
+//   3930: group 0, "flag-name-3930"
+//   3931: group 0, "flag-name-3931"
+//   3932: group 0, "flag-name-3932"
+//   3933: group 0, "flag-name-3933"
+//   3934: group 0, "flag-name-3934"
+//   3935: group 0, "flag-name-3935"
+//   3936: group 0, "flag-name-3936"
+//   3937: group 0, "flag-name-3937"
+//   3938: group 0, "flag-name-3938"
+//   3939: group 0, "flag-name-3939"
+//   3940: group 0, "flag-name-3940"
+//   3941: group 0, "flag-name-3941"
+//   3942: group 0, "flag-name-3942"
+//   3943: group 0, "flag-name-3943"
+//   3944: group 0, "flag-name-3944"
+//   3945: group 0, "flag-name-3945"
+//   3946: group 0, "flag-name-3946"
+//   3947: group 0, "flag-name-3947"
+//   3948: group 0, "flag-name-3948"
+//   3949: group 0, "flag-name-3949"
+//   3950: group 0, "flag-name-3950"
+//   3951: group 0, "flag-name-3951"
+//   3952: group 0, "flag-name-3952"
+//   3953: group 0, "flag-name-3953"
+//   3954: group 0, "flag-name-3954"
+//   3955: group 0, "flag-name-3955"
+//   3956: group 0, "flag-name-3956"
+//   3957: group 0, "flag-name-3957"
+//   3958: group 0, "flag-name-3958"
+//   3959: group 0, "flag-name-3959"
+//   3960: group 0, "flag-name-3960"
+//   3961: group 0, "flag-name-3961"
+//   3962: group 0, "flag-name-3962"
+//   3963: group 0, "flag-name-3963"
+//   3964: group 0, "flag-name-3964"
+//   3965: group 0, "flag-name-3965"
+//   3966: group 0, "flag-name-3966"
+//   3967: group 0, "flag-name-3967"
+//   3968: group 0, "flag-name-3968"
+//   3969: group 0, "flag-name-3969"
+//   3970: group 0, "flag-name-3970"
+//   3971: group 0, "flag-name-3971"
+//   3972: group 0, "flag-name-3972"
+//   3973: group 0, "flag-name-3973"
+//   3974: group 0, "flag-name-3974"
+//   3975: group 0, "flag-name-3975"
+//   3976: group 0, "flag-name-3976"
+//   3977: group 0, "flag-name-3977"
+//   3978: group 0, "flag-name-3978"
+//   3979: group 0, "flag-name-3979"
+//   3980: group 0, "flag-name-3980"
+//   3981: group 0, "flag-name-3981"
+//   3982: group 0, "flag-name-3982"
+//   3983: group 0, "flag-name-3983"
+//   3984: group 0, "flag-name-3984"
+//   3985: group 0, "flag-name-3985"
+//   3986: group 0, "flag-name-3986"
+//   3987: group 0, "flag-name-3987"
+//   3988: group 0, "flag-name-3988"
+//   3989: group 0, "flag-name-3989"
+//   3990: group 0, "flag-name-3990"
+//   3991: group 0, "flag-name-3991"
+//   3992: group 0, "flag-name-3992"
+//   3993: group 0, "flag-name-3993"
+//   3994: group 0, "flag-name-3994"
+//   3995: group 0, "flag-name-3995"
+//   3996: group 0, "flag-name-3996"
+//   3997: group 0, "flag-name-3997"
+//   3998: group 0, "flag-name-3998"
+//   3999: group 0, "flag-name-3999"
+//   4000: group 0, "flag-name-4000"
+//   4001: group 0, "flag-name-4001"
+//   4002: group 0, "flag-name-4002"
+//   4003: group 0, "flag-name-4003"
+//   4004: group 0, "flag-name-4004"
+//   4005: group 0, "flag-name-4005"
+//   4006: group 0, "flag-name-4006"
+//   4007: group 0, "flag-name-4007"
+//   4008: group 0, "flag-name-4008"
+//   4009: group 0, "flag-name-4009"
+//   4010: group 0, "flag-name-4010"
+//   4011: group 0, "flag-name-4011"
+//   4012: group 0, "flag-name-4012"
+//   4013: group 0, "flag-name-4013"
+//   4014: group 0, "flag-name-4014"
+//   4015: group 0, "flag-name-4015"
+//   4016: group 0, "flag-name-4016"
+//   4017: group 0, "flag-name-4017"
+//   4018: group 0, "flag-name-4018"
+//   4019: group 0, "flag-name-4019"
+//   4020: group 0, "flag-name-4020"
+//   4021: group 0, "flag-name-4021"
+//   4022: group 0, "flag-name-4022"
+//   4023: group 0, "flag-name-4023"
+//   4024: group 0, "flag-name-4024"
+//   4025: group 0, "flag-name-4025"
+//   4026: group 0, "flag-name-4026"
+//   4027: group 0, "flag-name-4027"
+//   4028: group 0, "flag-name-4028"
+//   4029: group 0, "flag-name-4029"
+//   4030: group 0, "flag-name-4030"
+//   4031: group 0, "flag-name-4031"
+//   4032: group 0, "flag-name-4032"
+//   4033: group 0, "flag-name-4033"
+//   4034: group 0, "flag-name-4034"
+//   4035: group 0, "flag-name-4035"
+//   4036: group 0, "flag-name-4036"
+//   4037: group 0, "flag-name-4037"
+//   4038: group 0, "flag-name-4038"
+//   4039: group 0, "flag-name-4039"
+//   4040: group 0, "flag-name-4040"
+//   4041: group 0, "flag-name-4041"
+//   4042: group 0, "flag-name-4042"
+//   4043: group 0, "flag-name-4043"
+//   4044: group 0, "flag-name-4044"
+//   4045: group 0, "flag-name-4045"
+//   4046: group 0, "flag-name-4046"
+//   4047: group 0, "flag-name-4047"
+//   4048: group 0, "flag-name-4048"
+//   4049: group 0, "flag-name-4049"
+//   4050: group 0, "flag-name-4050"
+//   4051: group 0, "flag-name-4051"
+//   4052: group 0, "flag-name-4052"
+//   4053: group 0, "flag-name-4053"
+//   4054: group 0, "flag-name-4054"
+//   4055: group 0, "flag-name-4055"
+//   4056: group 0, "flag-name-4056"
+//   4057: group 0, "flag-name-4057"
+//   4058: group 0, "flag-name-4058"
+//   4059: group 0, "flag-name-4059"
+//   4060: group 0, "flag-name-4060"
+//   4061: group 0, "flag-name-4061"
+//   4062: group 0, "flag-name-4062"
+//   4063: group 0, "flag-name-4063"
+//   4064: group 0, "flag-name-4064"
+//   4065: group 0, "flag-name-4065"
+//   4066: group 0, "flag-name-4066"
+//   4067: group 0, "flag-name-4067"
+//   4068: group 0, "flag-name-4068"
+//   4069: group 0, "flag-name-4069"
+//   4070: group 0, "flag-name-4070"
+//   4071: group 0, "flag-name-4071"
+//   4072: group 0, "flag-name-4072"
+//   4073: group 0, "flag-name-4073"
+//   4074: group 0, "flag-name-4074"
+//   4075: group 0, "flag-name-4075"
+//   4076: group 0, "flag-name-4076"
+//   4077: group 0, "flag-name-4077"
+//   4078: group 0, "flag-name-4078"
+//   4079: group 0, "flag-name-4079"
+//   4080: group 0, "flag-name-4080"
+//   4081: group 0, "flag-name-4081"
+//   4082: group 0, "flag-name-4082"
+//   4083: group 0, "flag-name-4083"
+//   4084: group 0, "flag-name-4084"
+//   4085: group 0, "flag-name-4085"
+//   4086: group 0, "flag-name-4086"
+//   4087: group 0, "flag-name-4087"
+//   4088: group 0, "flag-name-4088"
+//   4089: group 0, "flag-name-4089"
+//   4090: group 0, "flag-name-4090"
+//   4091: group 0, "flag-name-4091"
+//   4092: group 0, "flag-name-4092"
+//   4093: group 0, "flag-name-4093"
+//   4094: group 0, "flag-name-4094"
+//   4095: group 0, "flag-name-4095"
+//   4096: group 0, "flag-name-4096"
+//   4097: group 0, "flag-name-4097"
+//   4098: group 0, "flag-name-4098"
+//   4099: group 0, "flag-name-4099"
+//   4100: group 0, "flag-name-4100"
+//   4101: group 0, "flag-name-4101"
+//   4102: group 0, "flag-name-4102"
+//   4103: group 0, "flag-name-4103"
+//   4104: group 0, "flag-name-4104"
+//   4105: group 0, "flag-name-4105"
+//   4106: group 0, "flag-name-4106"
+//   4107: group 0, "flag-name-4107"
+//   4108: group 0, "flag-name-4108"
+//   4109: group 0, "flag-name-4109"
+//   4110: group 0, "flag-name-4110"
+//   4111: group 0, "flag-name-4111"
+//   4112: group 0, "flag-name-4112"
+//   4113: group 0, "flag-name-4113"
+//   4114: group 0, "flag-name-4114"
+//   4115: group 0, "flag-name-4115"
+//   4116: group 0, "flag-name-4116"
+//   4117: group 0, "flag-name-4117"
+//   4118: group 0, "flag-name-4118"
+//   4119: group 0, "flag-name-4119"
+//   4120: group 0, "flag-name-4120"
+//   4121: group 0, "flag-name-4121"
+//   4122: group 0, "flag-name-4122"
+//   4123: group 0, "flag-name-4123"
+//   4124: group 0, "flag-name-4124"
+//   4125: group 0, "flag-name-4125"
+//   4126: group 0, "flag-name-4126"
+//   4127: group 0, "flag-name-4127"
+//   4128: group 0, "flag-name-4128"
+//   4129: group 0, "flag-name-4129"
+//   4130: group 0, "flag-name-4130"
+//   4131: group 0, "flag-name-4131"
+//   4132: group 0, "flag-name-4132"
+//   4133: group 0, "flag-name-4133"
+//   4134: group 0, "flag-name-4134"
+//   4135: group 0, "flag-name-4135"
+//   4136: group 0, "flag-name-4136"
+//   4137: group 0, "flag-name-4137"
+//   4138: group 0, "flag-name-4138"
+//   4139: group 0, "flag-name-4139"
+//   4140: group 0, "flag-name-4140"
+//   4141: group 0, "flag-name-4141"
+//   4142: group 0, "flag-name-4142"
+//   4143: group 0, "flag-name-4143"
+//   4144: group 0, "flag-name-4144"
+//   4145: group 0, "flag-name-4145"
+//   4146: group 0, "flag-name-4146"
+//   4147: group 0, "flag-name-4147"
+//   4148: group 0, "flag-name-4148"
+//   4149: group 0, "flag-name-4149"
+//   4150: group 0, "flag-name-4150"
+//   4151: group 0, "flag-name-4151"
+//   4152: group 0, "flag-name-4152"
+//   4153: group 0, "flag-name-4153"
+//   4154: group 0, "flag-name-4154"
+//   4155: group 0, "flag-name-4155"
+//   4156: group 0, "flag-name-4156"
+//   4157: group 0, "flag-name-4157"
+//   4158: group 0, "flag-name-4158"
+//   4159: group 0, "flag-name-4159"
+//   4160: group 0, "flag-name-4160"
+//   4161: group 0, "flag-name-4161"
+//   4162: group 0, "flag-name-4162"
+//   4163: group 0, "flag-name-4163"
+//   4164: group 0, "flag-name-4164"
+//   4165: group 0, "flag-name-4165"
+//   4166: group 0, "flag-name-4166"
+//   4167: group 0, "flag-name-4167"
+//   4168: group 0, "flag-name-4168"
+//   4169: group 0, "flag-name-4169"
+//   4170: group 0, "flag-name-4170"
+//   4171: group 0, "flag-name-4171"
+//   4172: group 0, "flag-name-4172"
+//   4173: group 0, "flag-name-4173"
+//   4174: group 0, "flag-name-4174"
+//   4175: group 0, "flag-name-4175"
+//   4176: group 0, "flag-name-4176"
+//   4177: group 0, "flag-name-4177"
+//   4178: group 0, "flag-name-4178"
+//   4179: group 0, "flag-name-4179"
+//   4180: group 0, "flag-name-4180"
+//   4181: group 0, "flag-name-4181"
+//   4182: group 0, "flag-name-4182"
+//   4183: group 0, "flag-name-4183"
+//   4184: group 0, "flag-name-4184"
+//   4185: group 0, "flag-name-4185"
+//   4186: group 0, "flag-name-4186"
+//   4187: group 0, "flag-name-4187"
+//   4188: group 0, "flag-name-4188"
+//   4189: group 0, "flag-name-4189"
+//   4190: group 0, "flag-name-4190"
+//   4191: group 0, "flag-name-4191"
+//   4192: group 0, "flag-name-4192"
+//   4193: group 0, "flag-name-4193"
+//   4194: group 0, "flag-name-4194"
+//   4195: group 0, "flag-name-4195"
+//   4196: group 0, "flag-name-4196"
+//   4197: group 0, "flag-name-4197"
+//   4198: group 0, "flag-name-4198"
+//   4199: group 0, "flag-name-4199"
+//   4200: group 0, "flag-name-4200"
+//   4201: group 0, "flag-name-4201"
+//   4202: group 0, "flag-name-4202"
+//   4203: group 0, "flag-name-4203"
+//   4204: group 0, "flag-name-4204"
+//   4205: group 0, "flag-name-4205"
+//   4206: group 0, "flag-name-4206"
+//   4207: group 0, "flag-name-4207"
+//   4208: group 0, "flag-name-4208"
+//   4209: group 0, "flag-name-4209"
+//   4210: group 0, "flag-name-4210"
+//   4211: group 0, "flag-name-4211"
+//   4212: group 0, "flag-name-4212"
+//   4213: group 0, "flag-name-4213"
+//   4214: group 0, "flag-name-4214"
+//   4215: group 0, "flag-name-4215"
+//   4216: group 0, "flag-name-4216"
+//   4217: group 0, "flag-name-4217"
+//   4218: group 0, "flag-name-4218"
+//   4219: group 0, "flag-name-4219"
+//   4220: group 0, "flag-name-4220"
+//   4221: group 0, "flag-name-4221"
+//   4222: group 0, "flag-name-4222"
+//   4223: group 0, "flag-name-4223"
+//   4224: group 0, "flag-name-4224"
+//   4225: group 0, "flag-name-4225"
+//   4226: group 0, "flag-name-4226"
+//   4227: group 0, "flag-name-4227"
+//   4228: group 0, "flag-name-4228"
+//   4229: group 0, "flag-name-4229"
+//   4230: group 0, "flag-name-4230"
+//   4231: group 0, "flag-name-4231"
+//   4232: group 0, "flag-name-4232"
+//   4233: group 0, "flag-name-4233"
+//   4234: group 0, "flag-name-4234"
+//   4235: group 0, "flag-name-4235"
+//   4236: group 0, "flag-name-4236"
+//   4237: group 0, "flag-name-4237"
+//   4238: group 0, "flag-name-4238"
+//   4239: group 0, "flag-name-4239"
+//   4240: group 0, "flag-name-4240"
+//   4241: group 0, "flag-name-4241"
+//   4242: group 0, "flag-name-4242"
+//   4243: group 0, "flag-name-4243"
+//   4244: group 0, "flag-name-4244"
+//   4245: group 0, "flag-name-4245"
+//   4246: group 0, "flag-name-4246"
+//   4247: group 0, "flag-name-4247"
+//   4248: group 0, "flag-name-4248"
+//   4249: group 0, "flag-name-4249"
+//   4250: group 0, "flag-name-4250"
+//   4251: group 0, "flag-name-4251"
+//   4252: group 0, "flag-name-4252"
+//   4253: group 0, "flag-name-4253"
+//   4254: group 0, "flag-name-4254"
+//   4255: group 0, "flag-name-4255"
+//   4256: group 0, "flag-name-4256"
+//   4257: group 0, "flag-name-4257"
+//   4258: group 0, "flag-name-4258"
+//   4259: group 0, "flag-name-4259"
+//   4260: group 0, "flag-name-4260"
+//   4261: group 0, "flag-name-4261"
+//   4262: group 0, "flag-name-4262"
+//   4263: group 0, "flag-name-4263"
+//   4264: group 0, "flag-name-4264"
+//   4265: group 0, "flag-name-4265"
+//   4266: group 0, "flag-name-4266"
+//   4267: group 0, "flag-name-4267"
+//   4268: group 0, "flag-name-4268"
+//   4269: group 0, "flag-name-4269"
+//   4270: group 0, "flag-name-4270"
+//   4271: group 0, "flag-name-4271"
+//   4272: group 0, "flag-name-4272"
+//   4273: group 0, "flag-name-4273"
+//   4274: group 0, "flag-name-4274"
+//   4275: group 0, "flag-name-4275"
+//   4276: group 0, "flag-name-4276"
+//   4277: group 0, "flag-name-4277"
+//   4278: group 0, "flag-name-4278"
+//   4279: group 0, "flag-name-4279"
+//   4280: group 0, "flag-name-4280"
+//   4281: group 0, "flag-name-4281"
+//   4282: group 0, "flag-name-4282"
+//   4283: group 0, "flag-name-4283"
+//   4284: group 0, "flag-name-4284"
+//   4285: group 0, "flag-name-4285"
+//   4286: group 0, "flag-name-4286"
+//   4287: group 0, "flag-name-4287"
+//   4288: group 0, "flag-name-4288"
+//   4289: group 0, "flag-name-4289"
+//   4290: group 0, "flag-name-4290"
+//   4291: group 0, "flag-name-4291"
+//   4292: group 0, "flag-name-4292"
+//   4293: group 0, "flag-name-4293"
+//   4294: group 0, "flag-name-4294"
+//   4295: group 0, "flag-name-4295"
+//   4296: group 0, "flag-name-4296"
+//   4297: group 0, "flag-name-4297"
+//   4298: group 0, "flag-name-4298"
+//   4299: group 0, "flag-name-4299"
+//   4300: group 0, "flag-name-4300"
+//   4301: group 0, "flag-name-4301"
+//   4302: group 0, "flag-name-4302"
+//   4303: group 0, "flag-name-4303"
+//   4304: group 0, "flag-name-4304"
+//   4305: group 0, "flag-name-4305"
+//   4306: group 0, "flag-name-4306"
+//   4307: group 0, "flag-name-4307"
+//   4308: group 0, "flag-name-4308"
+//   4309: group 0, "flag-name-4309"
+//   4310: group 0, "flag-name-4310"
+//   4311: group 0, "flag-name-4311"
+//   4312: group 0, "flag-name-4312"
+//   4313: group 0, "flag-name-4313"
+//   4314: group 0, "flag-name-4314"
+//   4315: group 0, "flag-name-4315"
+//   4316: group 0, "flag-name-4316"
+//   4317: group 0, "flag-name-4317"
+//   4318: group 0, "flag-name-4318"
+//   4319: group 0, "flag-name-4319"
+//   4320: group 0, "flag-name-4320"
+//   4321: group 0, "flag-name-4321"
+//   4322: group 0, "flag-name-4322"
+//   4323: group 0, "flag-name-4323"
+//   4324: group 0, "flag-name-4324"
+//   4325: group 0, "flag-name-4325"
+//   4326: group 0, "flag-name-4326"
+//   4327: group 0, "flag-name-4327"
+//   4328: group 0, "flag-name-4328"
+//   4329: group 0, "flag-name-4329"
+//   4330: group 0, "flag-name-4330"
+//   4331: group 0, "flag-name-4331"
+//   4332: group 0, "flag-name-4332"
+//   4333: group 0, "flag-name-4333"
+//   4334: group 0, "flag-name-4334"
+//   4335: group 0, "flag-name-4335"
+//   4336: group 0, "flag-name-4336"
+//   4337: group 0, "flag-name-4337"
+//   4338: group 0, "flag-name-4338"
+//   4339: group 0, "flag-name-4339"
+//   4340: group 0, "flag-name-4340"
+//   4341: group 0, "flag-name-4341"
+//   4342: group 0, "flag-name-4342"
+//   4343: group 0, "flag-name-4343"
+//   4344: group 0, "flag-name-4344"
+//   4345: group 0, "flag-name-4345"
+//   4346: group 0, "flag-name-4346"
+//   4347: group 0, "flag-name-4347"
+//   4348: group 0, "flag-name-4348"
+//   4349: group 0, "flag-name-4349"
+//   4350: group 0, "flag-name-4350"
+//   4351: group 0, "flag-name-4351"
+//   4352: group 0, "flag-name-4352"
+//   4353: group 0, "flag-name-4353"
+//   4354: group 0, "flag-name-4354"
+//   4355: group 0, "flag-name-4355"
+//   4356: group 0, "flag-name-4356"
+//   4357: group 0, "flag-name-4357"
+//   4358: group 0, "flag-name-4358"
+//   4359: group 0, "flag-name-4359"
+//   4360: group 0, "flag-name-4360"
+//   4361: group 0, "flag-name-4361"
+//   4362: group 0, "flag-name-4362"
+//   4363: group 0, "flag-name-4363"
+//   4364: group 0, "flag-name-4364"
+//   4365: group 0, "flag-name-4365"
+//   4366: group 0, "flag-name-4366"
+//   4367: group 0, "flag-name-4367"
+//   4368: group 0, "flag-name-4368"
+//   4369: group 0, "flag-name-4369"
+//   4370: group 0, "flag-name-4370"
+//   4371: group 0, "flag-name-4371"
+//   4372: group 0, "flag-name-4372"
+//   4373: group 0, "flag-name-4373"
+//   4374: group 0, "flag-name-4374"
+//   4375: group 0, "flag-name-4375"
+//   4376: group 0, "flag-name-4376"
+//   4377: group 0, "flag-name-4377"
+//   4378: group 0, "flag-name-4378"
+//   4379: group 0, "flag-name-4379"
+//   4380: group 0, "flag-name-4380"
+//   4381: group 0, "flag-name-4381"
+//   4382: group 0, "flag-name-4382"
+//   4383: group 0, "flag-name-4383"
+//   4384: group 0, "flag-name-4384"
+//   4385: group 0, "flag-name-4385"
+//   4386: group 0, "flag-name-4386"
+//   4387: group 0, "flag-name-4387"
+//   4388: group 0, "flag-name-4388"
+//   4389: group 0, "flag-name-4389"
+//   4390: group 0, "flag-name-4390"
+//   4391: group 0, "flag-name-4391"
+//   4392: group 0, "flag-name-4392"
+//   4393: group 0, "flag-name-4393"
+//   4394: group 0, "flag-name-4394"
+//   4395: group 0, "flag-name-4395"
+//   4396: group 0, "flag-name-4396"
+//   4397: group 0, "flag-name-4397"
+//   4398: group 0, "flag-name-4398"
+//   4399: group 0, "flag-name-4399"
+//   4400: group 0, "flag-name-4400"
+//   4401: group 0, "flag-name-4401"
+//   4402: group 0, "flag-name-4402"
+//   4403: group 0, "flag-name-4403"
+//   4404: group 0, "flag-name-4404"
+//   4405: group 0, "flag-name-4405"
+//   4406: group 0, "flag-name-4406"
+//   4407: group 0, "flag-name-4407"
+//   4408: group 0, "flag-name-4408"
+//   4409: group 0, "flag-name-4409"
+//   4410: group 0, "flag-name-4410"
+//   4411: group 0, "flag-name-4411"
+//   4412: group 0, "flag-name-4412"
+//   4413: group 0, "flag-name-4413"
+//   4414: group 0, "flag-name-4414"
+//   4415: group 0, "flag-name-4415"
+//   4416: group 0, "flag-name-4416"
+//   4417: group 0, "flag-name-4417"
+//   4418: group 0, "flag-name-4418"
+//   4419: group 0, "flag-name-4419"
+//   4420: group 0, "flag-name-4420"
+//   4421: group 0, "flag-name-4421"
+//   4422: group 0, "flag-name-4422"
+//   4423: group 0, "flag-name-4423"
+//   4424: group 0, "flag-name-4424"
+//   4425: group 0, "flag-name-4425"
+//   4426: group 0, "flag-name-4426"
+//   4427: group 0, "flag-name-4427"
+//   4428: group 0, "flag-name-4428"
+//   4429: group 0, "flag-name-4429"
+//   4430: group 0, "flag-name-4430"
+//   4431: group 0, "flag-name-4431"
+//   4432: group 0, "flag-name-4432"
+//   4433: group 0, "flag-name-4433"
+//   4434: group 0, "flag-name-4434"
+//   4435: group 0, "flag-name-4435"
+//   4436: group 0, "flag-name-4436"
+//   4437: group 0, "flag-name-4437"
+//   4438: group 0, "flag-name-4438"
+//   4439: group 0, "flag-name-4439"
+//   4440: group 0, "flag-name-4440"
+//   4441: group 0, "flag-name-4441"
+//   4442: group 0, "flag-name-4442"
+//   4443: group 0, "flag-name-4443"
+//   4444: group 0, "flag-name-4444"
+//   4445: group 0, "flag-name-4445"
+//   4446: group 0, "flag-name-4446"
+//   4447: group 0, "flag-name-4447"
+//   4448: group 0, "flag-name-4448"
+//   4449: group 0, "flag-name-4449"
+//   4450: group 0, "flag-name-4450"
+//   4451: group 0, "flag-name-4451"
+//   4452: group 0, "flag-name-4452"
+//   4453: group 0, "flag-name-4453"
+//   4454: group 0, "flag-name-4454"
+//   4455: group 0, "flag-name-4455"
+//   4456: group 0, "flag-name-4456"
+//   4457: group 0, "flag-name-4457"
+//   4458: group 0, "flag-name-4458"
+//   4459: group 0, "flag-name-4459"
+//   4460: group 0, "flag-name-4460"
+//   4461: group 0, "flag-name-4461"
+//   4462: group 0, "flag-name-4462"
+//   4463: group 0, "flag-name-4463"
+//   4464: group 0, "flag-name-4464"
+//   4465: group 0, "flag-name-4465"
+//   4466: group 0, "flag-name-4466"
+//   4467: group 0, "flag-name-4467"
+//   4468: group 0, "flag-name-4468"
+//   4469: group 0, "flag-name-4469"
+//   4470: group 0, "flag-name-4470"
+//   4471: group 0, "flag-name-4471"
+//   4472: group 0, "flag-name-4472"
+//   4473: group 0, "flag-name-4473"
+//   4474: group 0, "flag-name-4474"
+//   4475: group 0, "flag-name-4475"
+//   4476: group 0, "flag-name-4476"
+//   4477: group 0, "flag-name-4477"
+//   4478: group 0, "flag-name-4478"
+//   4479: group 0, "flag-name-4479"
+//   4480: group 0, "flag-name-4480"
+//   4481: group 0, "flag-name-4481"
+//   4482: group 0, "flag-name-4482"
+//   4483: group 0, "flag-name-4483"
+//   4484: group 0, "flag-name-4484"
+//   4485: group 0, "flag-name-4485"
+//   4486: group 0, "flag-name-4486"
+//   4487: group 0, "flag-name-4487"
+//   4488: group 0, "flag-name-4488"
+//   4489: group 0, "flag-name-4489"
+//   4490: group 0, "flag-name-4490"
+//   4491: group 0, "flag-name-4491"
+//   4492: group 0, "flag-name-4492"
+//   4493: group 0, "flag-name-4493"
+//   4494: group 0, "flag-name-4494"
+//   4495: group 0, "flag-name-4495"
+//   4496: group 0, "flag-name-4496"
+//   4497: group 0, "flag-name-4497"
+//   4498: group 0, "flag-name-4498"
+//   4499: group 0, "flag-name-4499"
+//   4500: group 0, "flag-name-4500"
+//   4501: group 0, "flag-name-4501"
+//   4502: group 0, "flag-name-4502"
+//   4503: group 0, "flag-name-4503"
+//   4504: group 0, "flag-name-4504"
+//   4505: group 0, "flag-name-4505"
+//   4506: group 0, "flag-name-4506"
+//   4507: group 0, "flag-name-4507"
+//   4508: group 0, "flag-name-4508"
+//   4509: group 0, "flag-name-4509"
+//   4510: group 0, "flag-name-4510"
+//   4511: group 0, "flag-name-4511"
+//   4512: group 0, "flag-name-4512"
+//   4513: group 0, "flag-name-4513"
+//   4514: group 0, "flag-name-4514"
+//   4515: group 0, "flag-name-4515"
+//   4516: group 0, "flag-name-4516"
+//   4517: group 0, "flag-name-4517"
+//   4518: group 0, "flag-name-4518"
+//   4519: group 0, "flag-name-4519"
+//   4520: group 0, "flag-name-4520"
+//   4521: group 0, "flag-name-4521"
+//   4522: group 0, "flag-name-4522"
+//   4523: group 0, "flag-name-4523"
+//   4524: group 0, "flag-name-4524"
+//   4525: group 0, "flag-name-4525"
+//   4526: group 0, "flag-name-4526"
+//   4527: group 0, "flag-name-4527"
+//   4528: group 0, "flag-name-4528"
+//   4529: group 0, "flag-name-4529"
+//   4530: group 0, "flag-name-4530"
+//   4531: group 0, "flag-name-4531"
+//   4532: group 0, "flag-name-4532"
+//   4533: group 0, "flag-name-4533"
+//   4534: group 0, "flag-name-4534"
+//   4535: group 0, "flag-name-4535"
+//   4536: group 0, "flag-name-4536"
+//   4537: group 0, "flag-name-4537"
+//   4538: group 0, "flag-name-4538"
+//   4539: group 0, "flag-name-4539"
+//   4540: group 0, "flag-name-4540"
+//   4541: group 0, "flag-name-4541"
+//   4542: group 0, "flag-name-4542"
+//   4543: group 0, "flag-name-4543"
+//   4544: group 0, "flag-name-4544"
+//   4545: group 0, "flag-name-4545"
+//   4546: group 0, "flag-name-4546"
+//   4547: group 0, "flag-name-4547"
+//   4548: group 0, "flag-name-4548"
+//   4549: group 0, "flag-name-4549"
+//   4550: group 0, "flag-name-4550"
+//   4551: group 0, "flag-name-4551"
+//   4552: group 0, "flag-name-4552"
+//   4553: group 0, "flag-name-4553"
+//   4554: group 0, "flag-name-4554"
+//   4555: group 0, "flag-name-4555"
+//   4556: group 0, "flag-name-4556"
+//   4557: group 0, "flag-name-4557"
+//   4558: group 0, "flag-name-4558"
+//   4559: group 0, "flag-name-4559"
+//   4560: group 0, "flag-name-4560"
+//   4561: group 0, "flag-name-4561"
+//   4562: group 0, "flag-name-4562"
+//   4563: group 0, "flag-name-4563"
+//   4564: group 0, "flag-name-4564"
+//   4565: group 0, "flag-name-4565"
+//   4566: group 0, "flag-name-4566"
+//   4567: group 0, "flag-name-4567"
+//   4568: group 0, "flag-name-4568"
+//   4569: group 0, "flag-name-4569"
+//   4570: group 0, "flag-name-4570"
+//   4571: group 0, "flag-name-4571"
+//   4572: group 0, "flag-name-4572"
+//   4573: group 0, "flag-name-4573"
+//   4574: group 0, "flag-name-4574"
+//   4575: group 0, "flag-name-4575"
+//   4576: group 0, "flag-name-4576"
+//   4577: group 0, "flag-name-4577"
+//   4578: group 0, "flag-name-4578"
+//   4579: group 0, "flag-name-4579"
+//   4580: group 0, "flag-name-4580"
+//   4581: group 0, "flag-name-4581"
+//   4582: group 0, "flag-name-4582"
+//   4583: group 0, "flag-name-4583"
+//   4584: group 0, "flag-name-4584"
+//   4585: group 0, "flag-name-4585"
+//   4586: group 0, "flag-name-4586"
+//   4587: group 0, "flag-name-4587"
+//   4588: group 0, "flag-name-4588"
+//   4589: group 0, "flag-name-4589"
+//   4590: group 0, "flag-name-4590"
+//   4591: group 0, "flag-name-4591"
+//   4592: group 0, "flag-name-4592"
+//   4593: group 0, "flag-name-4593"
+//   4594: group 0, "flag-name-4594"
+//   4595: group 0, "flag-name-4595"
+//   4596: group 0, "flag-name-4596"
+//   4597: group 0, "flag-name-4597"
+//   4598: group 0, "flag-name-4598"
+//   4599: group 0, "flag-name-4599"
+//   4600: group 0, "flag-name-4600"
+//   4601: group 0, "flag-name-4601"
+//   4602: group 0, "flag-name-4602"
+//   4603: group 0, "flag-name-4603"
+//   4604: group 0, "flag-name-4604"
+//   4605: group 0, "flag-name-4605"
+//   4606: group 0, "flag-name-4606"
+//   4607: group 0, "flag-name-4607"
+//   4608: group 0, "flag-name-4608"
+//   4609: group 0, "flag-name-4609"
+//   4610: group 0, "flag-name-4610"
+//   4611: group 0, "flag-name-4611"
+//   4612: group 0, "flag-name-4612"
+//   4613: group 0, "flag-name-4613"
+//   4614: group 0, "flag-name-4614"
+//   4615: group 0, "flag-name-4615"
+//   4616: group 0, "flag-name-4616"
+//   4617: group 0, "flag-name-4617"
+//   4618: group 0, "flag-name-4618"
+//   4619: group 0, "flag-name-4619"
+//   4620: group 0, "flag-name-4620"
+//   4621: group 0, "flag-name-4621"
+//   4622: group 0, "flag-name-4622"
+//   4623: group 0, "flag-name-4623"
+//   4624: group 0, "flag-name-4624"
+//   4625: group 0, "flag-name-4625"
+//   4626: group 0, "flag-name-4626"
+//   4627: group 0, "flag-name-4627"
+//   4628: group 0, "flag-name-4628"
+//   4629: group 0, "flag-name-4629"
+//   4630: group 0, "flag-name-4630"
+//   4631: group 0, "flag-name-4631"
+//   4632: group 0, "flag-name-4632"
+//   4633: group 0, "flag-name-4633"
+//   4634: group 0, "flag-name-4634"
+//   4635: group 0, "flag-name-4635"
+//   4636: group 0, "flag-name-4636"
+//   4637: group 0, "flag-name-4637"
+//   4638: group 0, "flag-name-4638"
+//   4639: group 0, "flag-name-4639"
+//   4640: group 0, "flag-name-4640"
+//   4641: group 0, "flag-name-4641"
+//   4642: group 0, "flag-name-4642"
+//   4643: group 0, "flag-name-4643"
+//   4644: group 0, "flag-name-4644"
+//   4645: group 0, "flag-name-4645"
+//   4646: group 0, "flag-name-4646"
+//   4647: group 0, "flag-name-4647"
+//   4648: group 0, "flag-name-4648"
+//   4649: group 0, "flag-name-4649"
+//   4650: group 0, "flag-name-4650"
+//   4651: group 0, "flag-name-4651"
+//   4652: group 0, "flag-name-4652"
+//   4653: group 0, "flag-name-4653"
+//   4654: group 0, "flag-name-4654"
+//   4655: group 0, "flag-name-4655"
+//   4656: group 0, "flag-name-4656"
+//   4657: group 0, "flag-name-4657"
+//   4658: group 0, "flag-name-4658"
+//   4659: group 0, "flag-name-4659"
+//   4660: group 0, "flag-name-4660"
+//   4661: group 0, "flag-name-4661"
+//   4662: group 0, "flag-name-4662"
+//   4663: group 0, "flag-name-4663"
+//   4664: group 0, "flag-name-4664"
+//   4665: group 0, "flag-name-4665"
+//   4666: group 0, "flag-name-4666"
+//   4667: group 0, "flag-name-4667"
+//   4668: group 0, "flag-name-4668"
+//   4669: group 0, "flag-name-4669"
+//   4670: group 0, "flag-name-4670"
+//   4671: group 0, "flag-name-4671"
+//   4672: group 0, "flag-name-4672"
+//   4673: group 0, "flag-name-4673"
+//   4674: group 0, "flag-name-4674"
+//   4675: group 0, "flag-name-4675"
+//   4676: group 0, "flag-name-4676"
+//   4677: group 0, "flag-name-4677"
+//   4678: group 0, "flag-name-4678"
+//   4679: group 0, "flag-name-4679"
+//   4680: group 0, "flag-name-4680"
+//   4681: group 0, "flag-name-4681"
+//   4682: group 0, "flag-name-4682"
+//   4683: group 0, "flag-name-4683"
+//   4684: group 0, "flag-name-4684"
+//   4685: group 0, "flag-name-4685"
+//   4686: group 0, "flag-name-4686"
+//   4687: group 0, "flag-name-4687"
+//   4688: group 0, "flag-name-4688"
+//   4689: group 0, "flag-name-4689"
+//   4690: group 0, "flag-name-4690"
+//   4691: group 0, "flag-name-4691"
+//   4692: group 0, "flag-name-4692"
+//   4693: group 0, "flag-name-4693"
+//   4694: group 0, "flag-name-4694"
+//   4695: group 0, "flag-name-4695"
+//   4696: group 0, "flag-name-4696"
+//   4697: group 0, "flag-name-4697"
+//   4698: group 0, "flag-name-4698"
+//   4699: group 0, "flag-name-4699"
+//   4700: group 0, "flag-name-4700"
+//   4701: group 0, "flag-name-4701"
+//   4702: group 0, "flag-name-4702"
+//   4703: group 0, "flag-name-4703"
+//   4704: group 0, "flag-name-4704"
+//   4705: group 0, "flag-name-4705"
+//   4706: group 0, "flag-name-4706"
+//   4707: group 0, "flag-name-4707"
+//   4708: group 0, "flag-name-4708"
+//   4709: group 0, "flag-name-4709"
+//   4710: group 0, "flag-name-4710"
+//   4711: group 0, "flag-name-4711"
+//   4712: group 0, "flag-name-4712"
+//   4713: group 0, "flag-name-4713"
+//   4714: group 0, "flag-name-4714"
+//   4715: group 0, "flag-name-4715"
+//   4716: group 0, "flag-name-4716"
+//   4717: group 0, "flag-name-4717"
+//   4718: group 0, "flag-name-4718"
+//   4719: group 0, "flag-name-4719"
+//   4720: group 0, "flag-name-4720"
+//   4721: group 0, "flag-name-4721"
+//   4722: group 0, "flag-name-4722"
+//   4723: group 0, "flag-name-4723"
+//   4724: group 0, "flag-name-4724"
+//   4725: group 0, "flag-name-4725"
+//   4726: group 0, "flag-name-4726"
+//   4727: group 0, "flag-name-4727"
+//   4728: group 0, "flag-name-4728"
+//   4729: group 0, "flag-name-4729"
+//   4730: group 0, "flag-name-4730"
+//   4731: group 0, "flag-name-4731"
+//   4732: group 0, "flag-name-4732"
+//   4733: group 0, "flag-name-4733"
+//   4734: group 0, "flag-name-4734"
+//   4735: group 0, "flag-name-4735"
+//   4736: group 0, "flag-name-4736"
+//   4737: group 0, "flag-name-4737"
+//   4738: group 0, "flag-name-4738"
+//   4739: group 0, "flag-name-4739"
+//   4740: group 0, "flag-name-4740"
+//   4741: group 0, "flag-name-4741"
+//   4742: group 0, "flag-name-4742"
+//   4743: group 0, "flag-name-4743"
+//   4744: group 0, "flag-name-4744"
+//   4745: group 0, "flag-name-4745"
+//   4746: group 0, "flag-name-4746"
+//   4747: group 0, "flag-name-4747"
+//   4748: group 0, "flag-name-4748"
+//   4749: group 0, "flag-name-4749"
+//   4750: group 0, "flag-name-4750"
+//   4751: group 0, "flag-name-4751"
+//   4752: group 0, "flag-name-4752"
+//   4753: group 0, "flag-name-4753"
+//   4754: group 0, "flag-name-4754"
+//   4755: group 0, "flag-name-4755"
+//   4756: group 0, "flag-name-4756"
+//   4757: group 0, "flag-name-4757"
+//   4758: group 0, "flag-name-4758"
+//   4759: group 0, "flag-name-4759"
+//   4760: group 0, "flag-name-4760"
+//   4761: group 0, "flag-name-4761"
+//   4762: group 0, "flag-name-4762"
+//   4763: group 0, "flag-name-4763"
+//   4764: group 0, "flag-name-4764"
+//   4765: group 0, "flag-name-4765"
+//   4766: group 0, "flag-name-4766"
+//   4767: group 0, "flag-name-4767"
+//   4768: group 0, "flag-name-4768"
+//   4769: group 0, "flag-name-4769"
+//   4770: group 0, "flag-name-4770"
+//   4771: group 0, "flag-name-4771"
+//   4772: group 0, "flag-name-4772"
+//   4773: group 0, "flag-name-4773"
+//   4774: group 0, "flag-name-4774"
+//   4775: group 0, "flag-name-4775"
+//   4776: group 0, "flag-name-4776"
+//   4777: group 0, "flag-name-4777"
+//   4778: group 0, "flag-name-4778"
+//   4779: group 0, "flag-name-4779"
+//   4780: group 0, "flag-name-4780"
+//   4781: group 0, "flag-name-4781"
+//   4782: group 0, "flag-name-4782"
+//   4783: group 0, "flag-name-4783"
+//   4784: group 0, "flag-name-4784"
+//   4785: group 0, "flag-name-4785"
+//   4786: group 0, "flag-name-4786"
+//   4787: group 0, "flag-name-4787"
+//   4788: group 0, "flag-name-4788"
+//   4789: group 0, "flag-name-4789"
+//   4790: group 0, "flag-name-4790"
+//   4791: group 0, "flag-name-4791"
+//   4792: group 0, "flag-name-4792"
+//   4793: group 0, "flag-name-4793"
+//   4794: group 0, "flag-name-4794"
+//   4795: group 0, "flag-name-4795"
+//   4796: group 0, "flag-name-4796"
+//   4797: group 0, "flag-name-4797"
+//   4798: group 0, "flag-name-4798"
+//   4799: group 0, "flag-name-4799"
+//   4800: group 0, "flag-name-4800"
+//   4801: group 0, "flag-name-4801"
+//   4802: group 0, "flag-name-4802"
+//   4803: group 0, "flag-name-4803"
+//   4804: group 0, "flag-name-4804"
+//   4805: group 0, "flag-name-4805"
+//   4806: group 0, "flag-name-4806"
+//   4807: group 0, "flag-name-4807"
+//   4808: group 0, "flag-name-4808"
+//   4809: group 0, "flag-name-4809"
+//   4810: group 0, "flag-name-4810"
+//   4811: group 0, "flag-name-4811"
+//   4812: group 0, "flag-name-4812"
+//   4813: group 0, "flag-name-4813"
+//   4814: group 0, "flag-name-4814"
+//   4815: group 0, "flag-name-4815"
+//   4816: group 0, "flag-name-4816"
+//   4817: group 0, "flag-name-4817"
+//   4818: group 0, "flag-name-4818"
+//   4819: group 0, "flag-name-4819"
+//   4820: group 0, "flag-name-4820"
+//   4821: group 0, "flag-name-4821"
+//   4822: group 0, "flag-name-4822"
+//   4823: group 0, "flag-name-4823"
+//   4824: group 0, "flag-name-4824"
+//   4825: group 0, "flag-name-4825"
+//   4826: group 0, "flag-name-4826"
+//   4827: group 0, "flag-name-4827"
+//   4828: group 0, "flag-name-4828"
+//   4829: group 0, "flag-name-4829"
+//   4830: group 0, "flag-name-4830"
+//   4831: group 0, "flag-name-4831"
+//   4832: group 0, "flag-name-4832"
+//   4833: group 0, "flag-name-4833"
+//   4834: group 0, "flag-name-4834"
+//   4835: group 0, "flag-name-4835"
+//   4836: group 0, "flag-name-4836"
+//   4837: group 0, "flag-name-4837"
+//   4838: group 0, "flag-name-4838"
+//   4839: group 0, "flag-name-4839"
+//   4840: group 0, "flag-name-4840"
+//   4841: group 0, "flag-name-4841"
+//   4842: group 0, "flag-name-4842"
+//   4843: group 0, "flag-name-4843"
+//   4844: group 0, "flag-name-4844"
+//   4845: group 0, "flag-name-4845"
+//   4846: group 0, "flag-name-4846"
+//   4847: group 0, "flag-name-4847"
+//   4848: group 0, "flag-name-4848"
+//   4849: group 0, "flag-name-4849"
+//   4850: group 0, "flag-name-4850"
+//   4851: group 0, "flag-name-4851"
+//   4852: group 0, "flag-name-4852"
+//   4853: group 0, "flag-name-4853"
+//   4854: group 0, "flag-name-4854"
+//   4855: group 0, "flag-name-4855"
+//   4856: group 0, "flag-name-4856"
+//   4857: group 0, "flag-name-4857"
+//   4858: group 0, "flag-name-4858"
+//   4859: group 0, "flag-name-4859"
+//   4860: group 0, "flag-name-4860"
+//   4861: group 0, "flag-name-4861"
+//   4862: group 0, "flag-name-4862"
+//   4863: group 0, "flag-name-4863"
+//   4864: group 0, "flag-name-4864"
+//   4865: group 0, "flag-name-4865"
+//   4866: group 0, "flag-name-4866"
+//   4867: group 0, "flag-name-4867"
+//   4868: group 0, "flag-name-4868"
+//   4869: group 0, "flag-name-4869"
+//   4870: group 0, "flag-name-4870"
+//   4871: group 0, "flag-name-4871"
+//   4872: group 0, "flag-name-4872"
+//   4873: group 0, "flag-name-4873"
+//   4874: group 0, "flag-name-4874"
+//   4875: group 0, "flag-name-4875"
+//   4876: group 0, "flag-name-4876"
+//   4877: group 0, "flag-name-4877"
+//   4878: group 0, "flag-name-4878"
+//   4879: group 0, "flag-name-4879"
+//   4880: group 0, "flag-name-4880"
+//   4881: group 0, "flag-name-4881"
+//   4882: group 0, "flag-name-4882"
+//   4883: group 0, "flag-name-4883"
+//   4884: group 0, "flag-name-4884"
+//   4885: group 0, "flag-name-4885"
+//   4886: group 0, "flag-name-4886"
+//   4887: group 0, "flag-name-4887"
+//   4888: group 0, "flag-name-4888"
+//   4889: group 0, "flag-name-4889"
+//   4890: group 0, "flag-name-4890"
+//   4891: group 0, "flag-name-4891"
+//   4892: group 0, "flag-name-4892"
+//   4893: group 0, "flag-name-4893"
+//   4894: group 0, "flag-name-4894"
+//   4895: group 0, "flag-name-4895"
+//   4896: group 0, "flag-name-4896"
+//   4897: group 0, "flag-name-4897"
+//   4898: group 0, "flag-name-4898"
+//   4899: group 0, "flag-name-4899"
+//   4900: group 0, "flag-name-4900"
+//   4901: group 0, "flag-name-4901"
+//   4902: group 0, "flag-name-4902"
+//   4903: group 0, "flag-name-4903"
+//   4904: group 0, "flag-name-4904"
+//   4905: group 0, "flag-name-4905"
+//   4906: group 0, "flag-name-4906"
+//   4907: group 0, "flag-name-4907"
+//   4908: group 0, "flag-name-4908"
+//   4909: group 0, "flag-name-4909"
+//   4910: group 0, "flag-name-4910"
+//   4911: group 0, "flag-name-4911"
+//   4912: group 0, "flag-name-4912"
+//   4913: group 0, "flag-name-4913"
+//   4914: group 0, "flag-name-4914"
+//   4915: group 0, "flag-name-4915"
+//   4916: group 0, "flag-name-4916"
+//   4917: group 0, "flag-name-4917"
+//   4918: group 0, "flag-name-4918"
+//   4919: group 0, "flag-name-4919"
+//   4920: group 0, "flag-name-4920"
+//   4921: group 0, "flag-name-4921"
+//   4922: group 0, "flag-name-4922"
+//   4923: group 0, "flag-name-4923"
+//   4924: group 0, "flag-name-4924"
+//   4925: group 0, "flag-name-4925"
+//   4926: group 0, "flag-name-4926"
+//   4927: group 0, "flag-name-4927"
+//   4928: group 0, "flag-name-4928"
+//   4929: group 0, "flag-name-4929"
+//   4930: group 0, "flag-name-4930"
+//   4931: group 0, "flag-name-4931"
+//   4932: group 0, "flag-name-4932"
+//   4933: group 0, "flag-name-4933"
+//   4934: group 0, "flag-name-4934"
+//   4935: group 0, "flag-name-4935"
+//   4936: group 0, "flag-name-4936"
+//   4937: group 0, "flag-name-4937"
+//   4938: group 0, "flag-name-4938"
+//   4939: group 0, "flag-name-4939"
+//   4940: group 0, "flag-name-4940"
+//   4941: group 0, "flag-name-4941"
+//   4942: group 0, "flag-name-4942"
+//   4943: group 0, "flag-name-4943"
+//   4944: group 0, "flag-name-4944"
+//   4945: group 0, "flag-name-4945"
+//   4946: group 0, "flag-name-4946"
+//   4947: group 0, "flag-name-4947"
+//   4948: group 0, "flag-name-4948"
+//   4949: group 0, "flag-name-4949"
+//   4950: group 0, "flag-name-4950"
+//   4951: group 0, "flag-name-4951"
+//   4952: group 0, "flag-name-4952"
+//   4953: group 0, "flag-name-4953"
+//   4954: group 0, "flag-name-4954"
+//   4955: group 0, "flag-name-4955"
+//   4956: group 0, "flag-name-4956"
+//   4957: group 0, "flag-name-4957"
+//   4958: group 0, "flag-name-4958"
+//   4959: group 0, "flag-name-4959"
+//   4960: group 0, "flag-name-4960"
+//   4961: group 0, "flag-name-4961"
+//   4962: group 0, "flag-name-4962"
+//   4963: group 0, "flag-name-4963"
+//   4964: group 0, "flag-name-4964"
+//   4965: group 0, "flag-name-4965"
+//   4966: group 0, "flag-name-4966"
+//   4967: group 0, "flag-name-4967"
+//   4968: group 0, "flag-name-4968"
+//   4969: group 0, "flag-name-4969"
+//   4970: group 0, "flag-name-4970"
+//   4971: group 0, "flag-name-4971"
+//   4972: group 0, "flag-name-4972"
+//   4973: group 0, "flag-name-4973"
+//   4974: group 0, "flag-name-4974"
+//   4975: group 0, "flag-name-4975"
+//   4976: group 0, "flag-name-4976"
+//   4977: group 0, "flag-name-4977"
+//   4978: group 0, "flag-name-4978"
+//   4979: group 0, "flag-name-4979"
+//   4980: group 0, "flag-name-4980"
+//   4981: group 0, "flag-name-4981"
+//   4982: group 0, "flag-name-4982"
+//   4983: group 0, "flag-name-4983"
+//   4984: group 0, "flag-name-4984"
+//   4985: group 0, "flag-name-4985"
+//   4986: group 0, "flag-name-4986"
+//   4987: group 0, "flag-name-4987"
+//   4988: group 0, "flag-name-4988"
+//   4989: group 0, "flag-name-4989"
+//   4990: group 0, "flag-name-4990"
+//   4991: group 0, "flag-name-4991"
+//   4992: group 0, "flag-name-4992"
+//   4993: group 0, "flag-name-4993"
+//   4994: group 0, "flag-name-4994"
+//   4995: group 0, "flag-name-4995"
+//   4996: group 0, "flag-name-4996"
+//   4997: group 0, "flag-name-4997"
+//   4998: group 0, "flag-name-4998"
+//   4999: group 0, "flag-name-4999"
+//   5000: group 0, "flag-name-5000"
+//   5001: group 0, "flag-name-5001"
+//   5002: group 0, "flag-name-5002"
+//   5003: group 0, "flag-name-5003"
+//   5004: group 0, "flag-name-5004"
+//   5005: group 0, "flag-name-5005"
+//   5006: group 0, "flag-name-5006"
+//   5007: group 0, "flag-name-5007"
+//   5008: group 0, "flag-name-5008"
+//   5009: group 0, "flag-name-5009"
+//   5010: group 0, "flag-name-5010"
+//   5011: group 0, "flag-name-5011"
+//   5012: group 0, "flag-name-5012"
+//   5013: group 0, "flag-name-5013"
+//   5014: group 0, "flag-name-5014"
+//   5015: group 0, "flag-name-5015"
+//   5016: group 0, "flag-name-5016"
+//   5017: group 0, "flag-name-5017"
+//   5018: group 0, "flag-name-5018"
+//   5019: group 0, "flag-name-5019"
+//   5020: group 0, "flag-name-5020"
+//   5021: group 0, "flag-name-5021"
+//   5022: group 0, "flag-name-5022"
+//   5023: group 0, "flag-name-5023"
+//   5024: group 0, "flag-name-5024"
+//   5025: group 0, "flag-name-5025"
+//   5026: group 0, "flag-name-5026"
+//   5027: group 0, "flag-name-5027"
+//   5028: group 0, "flag-name-5028"
+//   5029: group 0, "flag-name-5029"
+//   5030: group 0, "flag-name-5030"
+//   5031: group 0, "flag-name-5031"
+//   5032: group 0, "flag-name-5032"
+//   5033: group 0, "flag-name-5033"
+//   5034: group 0, "flag-name-5034"
+//   5035: group 0, "flag-name-5035"
+//   5036: group 0, "flag-name-5036"
+//   5037: group 0, "flag-name-5037"
+//   5038: group 0, "flag-name-5038"
+//   5039: group 0, "flag-name-5039"
+//   5040: group 0, "flag-name-5040"
+//   5041: group 0, "flag-name-5041"
+//   5042: group 0, "flag-name-5042"
+//   5043: group 0, "flag-name-5043"
+//   5044: group 0, "flag-name-5044"
+//   5045: group 0, "flag-name-5045"
+//   5046: group 0, "flag-name-5046"
+//   5047: group 0, "flag-name-5047"
+//   5048: group 0, "flag-name-5048"
+//   5049: group 0, "flag-name-5049"
+//   5050: group 0, "flag-name-5050"
+//   5051: group 0, "flag-name-5051"
+//   5052: group 0, "flag-name-5052"
+//   5053: group 0, "flag-name-5053"
+//   5054: group 0, "flag-name-5054"
+//   5055: group 0, "flag-name-5055"
+//   5056: group 0, "flag-name-5056"
+//   5057: group 0, "flag-name-5057"
+//   5058: group 0, "flag-name-5058"
+//   5059: group 0, "flag-name-5059"
+//   5060: group 0, "flag-name-5060"
+//   5061: group 0, "flag-name-5061"
+//   5062: group 0, "flag-name-5062"
+//   5063: group 0, "flag-name-5063"
+//   5064: group 0, "flag-name-5064"
+//   5065: group 0, "flag-name-5065"
+//   5066: group 0, "flag-name-5066"
+//   5067: group 0, "flag-name-5067"
+//   5068: group 0, "flag-name-5068"
+//   5069: group 0, "flag-name-5069"
+//   5070: group 0, "flag-name-5070"
+//   5071: group 0, "flag-name-5071"
+//   5072: group 0, "flag-name-5072"
+//   5073: group 0, "flag-name-5073"
+//   5074: group 0, "flag-name-5074"
+//   5075: group 0, "flag-name-5075"
+//   5076: group 0, "flag-name-5076"
+//   5077: group 0, "flag-name-5077"
+//   5078: group 0, "flag-name-5078"
+//   5079: group 0, "flag-name-5079"
+//   5080: group 0, "flag-name-5080"
+//   5081: group 0, "flag-name-5081"
+//   5082: group 0, "flag-name-5082"
+//   5083: group 0, "flag-name-5083"
+//   5084: group 0, "flag-name-5084"
+//   5085: group 0, "flag-name-5085"
+//   5086: group 0, "flag-name-5086"
+//   5087: group 0, "flag-name-5087"
+//   5088: group 0, "flag-name-5088"
+//   5089: group 0, "flag-name-5089"
+//   5090: group 0, "flag-name-5090"
+//   5091: group 0, "flag-name-5091"
+//   5092: group 0, "flag-name-5092"
+//   5093: group 0, "flag-name-5093"
+//   5094: group 0, "flag-name-5094"
+//   5095: group 0, "flag-name-5095"
+//   5096: group 0, "flag-name-5096"
+//   5097: group 0, "flag-name-5097"
+//   5098: group 0, "flag-name-5098"
+//   5099: group 0, "flag-name-5099"
+//   5100: group 0, "flag-name-5100"
+//   5101: group 0, "flag-name-5101"
+//   5102: group 0, "flag-name-5102"
+//   5103: group 0, "flag-name-5103"
+//   5104: group 0, "flag-name-5104"
+//   5105: group 0, "flag-name-5105"
+//   5106: group 0, "flag-name-5106"
+//   5107: group 0, "flag-name-5107"
+//   5108: group 0, "flag-name-5108"
+//   5109: group 0, "flag-name-5109"
+//   5110: group 0, "flag-name-5110"
+//   5111: group 0, "flag-name-5111"
+//   5112: group 0, "flag-name-5112"
+//   5113: group 0, "flag-name-5113"
+//   5114: group 0, "flag-name-5114"
+//   5115: group 0, "flag-name-5115"
+//   5116: group 0, "flag-name-5116"
+//   5117: group 0, "flag-name-5117"
+//   5118: group 0, "flag-name-5118"
+//   5119: group 0, "flag-name-5119"
+//   5120: group 0, "flag-name-5120"
+//   5121: group 0, "flag-name-5121"
+//   5122: group 0, "flag-name-5122"
+//   5123: group 0, "flag-name-5123"
+//   5124: group 0, "flag-name-5124"
+//   5125: group 0, "flag-name-5125"
+//   5126: group 0, "flag-name-5126"
+//   5127: group 0, "flag-name-5127"
+//   5128: group 0, "flag-name-5128"
+//   5129: group 0, "flag-name-5129"
+//   5130: group 0, "flag-name-5130"
+//   5131: group 0, "flag-name-5131"
+//   5132: group 0, "flag-name-5132"
+//   5133: group 0, "flag-name-5133"
+//   5134: group 0, "flag-name-5134"
+//   5135: group 0, "flag-name-5135"
+//   5136: group 0, "flag-name-5136"
+//   5137: group 0, "flag-name-5137"
+//   5138: group 0, "flag-name-5138"
+//   5139: group 0, "flag-name-5139"
+//   5140: group 0, "flag-name-5140"
+//   5141: group 0, "flag-name-5141"
+//   5142: group 0, "flag-name-5142"
+//   5143: group 0, "flag-name-5143"
+//   5144: group 0, "flag-name-5144"
+//   5145: group 0, "flag-name-5145"
+//   5146: group 0, "flag-name-5146"
+//   5147: group 0, "flag-name-5147"
+//   5148: group 0, "flag-name-5148"
+//   5149: group 0, "flag-name-5149"
+//   5150: group 0, "flag-name-5150"
+//   5151: group 0, "flag-name-5151"
+//   5152: group 0, "flag-name-5152"
+//   5153: group 0, "flag-name-5153"
+//   5154: group 0, "flag-name-5154"
+//   5155: group 0, "flag-name-5155"
+//   5156: group 0, "flag-name-5156"
+//   5157: group 0, "flag-name-5157"
+//   5158: group 0, "flag-name-5158"
+//   5159: group 0, "flag-name-5159"
+//   5160: group 0, "flag-name-5160"
+//   5161: group 0, "flag-name-5161"
+//   5162: group 0, "flag-name-5162"
+//   5163: group 0, "flag-name-5163"
+//   5164: group 0, "flag-name-5164"
+//   5165: group 0, "flag-name-5165"
+//   5166: group 0, "flag-name-5166"
+//   5167: group 0, "flag-name-5167"
+//   5168: group 0, "flag-name-5168"
+//   5169: group 0, "flag-name-5169"
+//   5170: group 0, "flag-name-5170"
+//   5171: group 0, "flag-name-5171"
+//   5172: group 0, "flag-name-5172"
+//   5173: group 0, "flag-name-5173"
+//   5174: group 0, "flag-name-5174"
+//   5175: group 0, "flag-name-5175"
+//   5176: group 0, "flag-name-5176"
+//   5177: group 0, "flag-name-5177"
+//   5178: group 0, "flag-name-5178"
+//   5179: group 0, "flag-name-5179"
+//   5180: group 0, "flag-name-5180"
+//   5181: group 0, "flag-name-5181"
+//   5182: group 0, "flag-name-5182"
+//   5183: group 0, "flag-name-5183"
+//   5184: group 0, "flag-name-5184"
+//   5185: group 0, "flag-name-5185"
+//   5186: group 0, "flag-name-5186"
+//   5187: group 0, "flag-name-5187"
+//   5188: group 0, "flag-name-5188"
+//   5189: group 0, "flag-name-5189"
+//   5190: group 0, "flag-name-5190"
+//   5191: group 0, "flag-name-5191"
+//   5192: group 0, "flag-name-5192"
+//   5193: group 0, "flag-name-5193"
+//   5194: group 0, "flag-name-5194"
+//   5195: group 0, "flag-name-5195"
+//   5196: group 0, "flag-name-5196"
+//   5197: group 0, "flag-name-5197"
+//   5198: group 0, "flag-name-5198"
+//   5199: group 0, "flag-name-5199"
+//   5200: group 0, "flag-name-5200"
+//   5201: group 0, "flag-name-5201"
+//   5202: group 0, "flag-name-5202"
+//   5203: group 0, "flag-name-5203"
+//   5204: group 0, "flag-name-5204"
+//   5205: group 0, "flag-name-5205"
+//   5206: group 0, "flag-name-5206"
+//   5207: group 0, "flag-name-5207"
+//   5208: group 0, "flag-name-5208"
+//   5209: group 0, "flag-name-5209"
+//   5210: group 0, "flag-name-5210"
+//   5211: group 0, "flag-name-5211"
+//   5212: group 0, "flag-name-5212"
+//   5213: group 0, "flag-name-5213"
+//   5214: group 0, "flag-name-5214"
+//   5215: group 0, "flag-name-5215"
+//   5216: group 0, "flag-name-5216"
+//   5217: group 0, "flag-name-5217"
+//   5218: group 0, "flag-name-5218"
+//   5219: group 0, "flag-name-5219"
+//   5220: group 0, "flag-name-5220"
+//   5221: group 0, "flag-name-5221"
+//   5222: group 0, "flag-name-5222"
+//   5223: group 0, "flag-name-5223"
+//   5224: group 0, "flag-name-5224"
+//   5225: group 0, "flag-name-5225"
+//   5226: group 0, "flag-name-5226"
+//   5227: group 0, "flag-name-5227"
+//   5228: group 0, "flag-name-5228"
+//   5229: group 0, "flag-name-5229"
+//   5230: group 0, "flag-name-5230"
+//   5231: group 0, "flag-name-5231"
+//   5232: group 0, "flag-name-5232"
+//   5233: group 0, "flag-name-5233"
+//   5234: group 0, "flag-name-5234"
+//   5235: group 0, "flag-name-5235"
+//   5236: group 0, "flag-name-5236"
+//   5237: group 0, "flag-name-5237"
+//   5238: group 0, "flag-name-5238"
+//   5239: group 0, "flag-name-5239"
+//   5240: group 0, "flag-name-5240"
+//   5241: group 0, "flag-name-5241"
+//   5242: group 0, "flag-name-5242"
+//   5243: group 0, "flag-name-5243"
+//   5244: group 0, "flag-name-5244"
+//   5245: group 0, "flag-name-5245"
+//   5246: group 0, "flag-name-5246"
+//   5247: group 0, "flag-name-5247"
+//   5248: group 0, "flag-name-5248"
+//   5249: group 0, "flag-name-5249"
+//   5250: group 0, "flag-name-5250"
+//   5251: group 0, "flag-name-5251"
+//   5252: group 0, "flag-name-5252"
+//   5253: group 0, "flag-name-5253"
+//   5254: group 0, "flag-name-5254"
+//   5255: group 0, "flag-name-5255"
+//   5256: group 0, "flag-name-5256"
+//   5257: group 0, "flag-name-5257"
+//   5258: group 0, "flag-name-5258"
+//   5259: group 0, "flag-name-5259"
+//   5260: group 0, "flag-name-5260"
+//   5261: group 0, "flag-name-5261"
+//   5262: group 0, "flag-name-5262"
+//   5263: group 0, "flag-name-5263"
+//   5264: group 0, "flag-name-5264"
+//   5265: group 0, "flag-name-5265"
+//   5266: group 0, "flag-name-5266"
+//   5267: group 0, "flag-name-5267"
+//   5268: group 0, "flag-name-5268"
+//   5269: group 0, "flag-name-5269"
+//   5270: group 0, "flag-name-5270"
+//   5271: group 0, "flag-name-5271"
+//   5272: group 0, "flag-name-5272"
+//   5273: group 0, "flag-name-5273"
+//   5274: group 0, "flag-name-5274"
+//   5275: group 0, "flag-name-5275"
+//   5276: group 0, "flag-name-5276"
+//   5277: group 0, "flag-name-5277"
+//   5278: group 0, "flag-name-5278"
+//   5279: group 0, "flag-name-5279"
+//   5280: group 0, "flag-name-5280"
+//   5281: group 0, "flag-name-5281"
+//   5282: group 0, "flag-name-5282"
+//   5283: group 0, "flag-name-5283"
+//   5284: group 0, "flag-name-5284"
+//   5285: group 0, "flag-name-5285"
+//   5286: group 0, "flag-name-5286"
+//   5287: group 0, "flag-name-5287"
+//   5288: group 0, "flag-name-5288"
+//   5289: group 0, "flag-name-5289"
+//   5290: group 0, "flag-name-5290"
+//   5291: group 0, "flag-name-5291"
+//   5292: group 0, "flag-name-5292"
+//   5293: group 0, "flag-name-5293"
+//   5294: group 0, "flag-name-5294"
+//   5295: group 0, "flag-name-5295"
+//   5296: group 0, "flag-name-5296"
+//   5297: group 0, "flag-name-5297"
+//   5298: group 0, "flag-name-5298"
+//   5299: group 0, "flag-name-5299"
+//   5300: group 0, "flag-name-5300"
+//   5301: group 0, "flag-name-5301"
+//   5302: group 0, "flag-name-5302"
+//   5303: group 0, "flag-name-5303"
+//   5304: group 0, "flag-name-5304"
+//   5305: group 0, "flag-name-5305"
+//   5306: group 0, "flag-name-5306"
+//   5307: group 0, "flag-name-5307"
+//   5308: group 0, "flag-name-5308"
+//   5309: group 0, "flag-name-5309"
+//   5310: group 0, "flag-name-5310"
+//   5311: group 0, "flag-name-5311"
+//   5312: group 0, "flag-name-5312"
+//   5313: group 0, "flag-name-5313"
+//   5314: group 0, "flag-name-5314"
+//   5315: group 0, "flag-name-5315"
+//   5316: group 0, "flag-name-5316"
+//   5317: group 0, "flag-name-5317"
+//   5318: group 0, "flag-name-5318"
+//   5319: group 0, "flag-name-5319"
+//   5320: group 0, "flag-name-5320"
+//   5321: group 0, "flag-name-5321"
+//   5322: group 0, "flag-name-5322"
+//   5323: group 0, "flag-name-5323"
+//   5324: group 0, "flag-name-5324"
+//   5325: group 0, "flag-name-5325"
+//   5326: group 0, "flag-name-5326"
+//   5327: group 0, "flag-name-5327"
+//   5328: group 0, "flag-name-5328"
+//   5329: group 0, "flag-name-5329"
+//   5330: group 0, "flag-name-5330"
+//   5331: group 0, "flag-name-5331"
+//   5332: group 0, "flag-name-5332"
+//   5333: group 0, "flag-name-5333"
+//   5334: group 0, "flag-name-5334"
+//   5335: group 0, "flag-name-5335"
+//   5336: group 0, "flag-name-5336"
+//   5337: group 0, "flag-name-5337"
+//   5338: group 0, "flag-name-5338"
+//   5339: group 0, "flag-name-5339"
+//   5340: group 0, "flag-name-5340"
+//   5341: group 0, "flag-name-5341"
+//   5342: group 0, "flag-name-5342"
+//   5343: group 0, "flag-name-5343"
+//   5344: group 0, "flag-name-5344"
+//   5345: group 0, "flag-name-5345"
+//   5346: group 0, "flag-name-5346"
+//   5347: group 0, "flag-name-5347"
+//   5348: group 0, "flag-name-5348"
+//   5349: group 0, "flag-name-5349"
+//   5350: group 0, "flag-name-5350"
+//   5351: group 0, "flag-name-5351"
+//   5352: group 0, "flag-name-5352"
+//   5353: group 0, "flag-name-5353"
+//   5354: group 0, "flag-name-5354"
+//   5355: group 0, "flag-name-5355"
+//   5356: group 0, "flag-name-5356"
+//   5357: group 0, "flag-name-5357"
+//   5358: group 0, "flag-name-5358"
+//   5359: group 0, "flag-name-5359"
+//   5360: group 0, "flag-name-5360"
+//   5361: group 0, "flag-name-5361"
+//   5362: group 0, "flag-name-5362"
+//   5363: group 0, "flag-name-5363"
+//   5364: group 0, "flag-name-5364"
+//   5365: group 0, "flag-name-5365"
+//   5366: group 0, "flag-name-5366"
+//   5367: group 0, "flag-name-5367"
+//   5368: group 0, "flag-name-5368"
+//   5369: group 0, "flag-name-5369"
+//   5370: group 0, "flag-name-5370"
+//   5371: group 0, "flag-name-5371"
+//   5372: group 0, "flag-name-5372"
+//   5373: group 0, "flag-name-5373"
+//   5374: group 0, "flag-name-5374"
+//   5375: group 0, "flag-name-5375"
+//   5376: group 0, "flag-name-5376"
+//   5377: group 0, "flag-name-5377"
+//   5378: group 0, "flag-name-5378"
+//   5379: group 0, "flag-name-5379"
+//   5380: group 0, "flag-name-5380"
+//   5381: group 0, "flag-name-5381"
+//   5382: group 0, "flag-name-5382"
+//   5383: group 0, "flag-name-5383"
+//   5384: group 0, "flag-name-5384"
+//   5385: group 0, "flag-name-5385"
+//   5386: group 0, "flag-name-5386"
+//   5387: group 0, "flag-name-5387"
+//   5388: group 0, "flag-name-5388"
+//   5389: group 0, "flag-name-5389"
+//   5390: group 0, "flag-name-5390"
+//   5391: group 0, "flag-name-5391"
+//   5392: group 0, "flag-name-5392"
+//   5393: group 0, "flag-name-5393"
+//   5394: group 0, "flag-name-5394"
+//   5395: group 0, "flag-name-5395"
+//   5396: group 0, "flag-name-5396"
+//   5397: group 0, "flag-name-5397"
+//   5398: group 0, "flag-name-5398"
+//   5399: group 0, "flag-name-5399"
+//   5400: group 0, "flag-name-5400"
+//   5401: group 0, "flag-name-5401"
+//   5402: group 0, "flag-name-5402"
+//   5403: group 0, "flag-name-5403"
+//   5404: group 0, "flag-name-5404"
+//   5405: group 0, "flag-name-5405"
+//   5406: group 0, "flag-name-5406"
+//   5407: group 0, "flag-name-5407"
+//   5408: group 0, "flag-name-5408"
+//   5409: group 0, "flag-name-5409"
+//   5410: group 0, "flag-name-5410"
+//   5411: group 0, "flag-name-5411"
+//   5412: group 0, "flag-name-5412"
+//   5413: group 0, "flag-name-5413"
+//   5414: group 0, "flag-name-5414"
+//   5415: group 0, "flag-name-5415"
+//   5416: group 0, "flag-name-5416"
+//   5417: group 0, "flag-name-5417"
+//   5418: group 0, "flag-name-5418"
+//   5419: group 0, "flag-name-5419"
+//   5420: group 0, "flag-name-5420"
+//   5421: group 0, "flag-name-5421"
+//   5422: group 0, "flag-name-5422"
+//   5423: group 0, "flag-name-5423"
+//   5424: group 0, "flag-name-5424"
+//   5425: group 0, "flag-name-5425"
+//   5426: group 0, "flag-name-5426"
+//   5427: group 0, "flag-name-5427"
+//   5428: group 0, "flag-name-5428"
+//   5429: group 0, "flag-name-5429"
+//   5430: group 0, "flag-name-5430"
+//   5431: group 0, "flag-name-5431"
+//   5432: group 0, "flag-name-5432"
+//   5433: group 0, "flag-name-5433"
+//   5434: group 0, "flag-name-5434"
+//   5435: group 0, "flag-name-5435"
+//   5436: group 0, "flag-name-5436"
+//   5437: group 0, "flag-name-5437"
+//   5438: group 0, "flag-name-5438"
+//   5439: group 0, "flag-name-5439"
+//   5440: group 0, "flag-name-5440"
+//   5441: group 0, "flag-name-5441"
+//   5442: group 0, "flag-name-5442"
+//   5443: group 0, "flag-name-5443"
+//   5444: group 0, "flag-name-5444"
+//   5445: group 0, "flag-name-5445"
+//   5446: group 0, "flag-name-5446"
+//   5447: group 0, "flag-name-5447"
+//   5448: group 0, "flag-name-5448"
+//   5449: group 0, "flag-name-5449"
+//   5450: group 0, "flag-name-5450"
+//   5451: group 0, "flag-name-5451"
+//   5452: group 0, "flag-name-5452"
+//   5453: group 0, "flag-name-5453"
+//   5454: group 0, "flag-name-5454"
+//   5455: group 0, "flag-name-5455"
+//   5456: group 0, "flag-name-5456"
+//   5457: group 0, "flag-name-5457"
+//   5458: group 0, "flag-name-5458"
+//   5459: group 0, "flag-name-5459"
+//   5460: group 0, "flag-name-5460"
+//   5461: group 0, "flag-name-5461"
+//   5462: group 0, "flag-name-5462"
+//   5463: group 0, "flag-name-5463"
+//   5464: group 0, "flag-name-5464"
+//   5465: group 0, "flag-name-5465"
+//   5466: group 0, "flag-name-5466"
+//   5467: group 0, "flag-name-5467"
+//   5468: group 0, "flag-name-5468"
+//   5469: group 0, "flag-name-5469"
+//   5470: group 0, "flag-name-5470"
+//   5471: group 0, "flag-name-5471"
+//   5472: group 0, "flag-name-5472"
+//   5473: group 0, "flag-name-5473"
+//   5474: group 0, "flag-name-5474"
+//   5475: group 0, "flag-name-5475"
+//   5476: group 0, "flag-name-5476"
+//   5477: group 0, "flag-name-5477"
+//   5478: group 0, "flag-name-5478"
+//   5479: group 0, "flag-name-5479"
+//   5480: group 0, "flag-name-5480"
+//   5481: group 0, "flag-name-5481"
+//   5482: group 0, "flag-name-5482"
+//   5483: group 0, "flag-name-5483"
+//   5484: group 0, "flag-name-5484"
+//   5485: group 0, "flag-name-5485"
+//   5486: group 0, "flag-name-5486"
+//   5487: group 0, "flag-name-5487"
+//   5488: group 0, "flag-name-5488"
+//   5489: group 0, "flag-name-5489"
+//   5490: group 0, "flag-name-5490"
+//   5491: group 0, "flag-name-5491"
+//   5492: group 0, "flag-name-5492"
+//   5493: group 0, "flag-name-5493"
+//   5494: group 0, "flag-name-5494"
+//   5495: group 0, "flag-name-5495"
+//   5496: group 0, "flag-name-5496"
+//   5497: group 0, "flag-name-5497"
+//   5498: group 0, "flag-name-5498"
+//   5499: group 0, "flag-name-5499"
+//   5500: group 0, "flag-name-5500"
+//   5501: group 0, "flag-name-5501"
+//   5502: group 0, "flag-name-5502"
+//   5503: group 0, "flag-name-5503"
+//   5504: group 0, "flag-name-5504"
+//   5505: group 0, "flag-name-5505"
+//   5506: group 0, "flag-name-5506"
+//   5507: group 0, "flag-name-5507"
+//   5508: group 0, "flag-name-5508"
+//   5509: group 0, "flag-name-5509"
+//   5510: group 0, "flag-name-5510"
+//   5511: group 0, "flag-name-5511"
+//   5512: group 0, "flag-name-5512"
+//   5513: group 0, "flag-name-5513"
+//   5514: group 0, "flag-name-5514"
+//   5515: group 0, "flag-name-5515"
+//   5516: group 0, "flag-name-5516"
+//   5517: group 0, "flag-name-5517"
+//   5518: group 0, "flag-name-5518"
+//   5519: group 0, "flag-name-5519"
+//   5520: group 0, "flag-name-5520"
+//   5521: group 0, "flag-name-5521"
+//   5522: group 0, "flag-name-5522"
+//   5523: group 0, "flag-name-5523"
+//   5524: group 0, "flag-name-5524"
+//   5525: group 0, "flag-name-5525"
+//   5526: group 0, "flag-name-5526"
+//   5527: group 0, "flag-name-5527"
+//   5528: group 0, "flag-name-5528"
+//   5529: group 0, "flag-name-5529"
+//   5530: group 0, "flag-name-5530"
+//   5531: group 0, "flag-name-5531"
+//   5532: group 0, "flag-name-5532"
+//   5533: group 0, "flag-name-5533"
+//   5534: group 0, "flag-name-5534"
+//   5535: group 0, "flag-name-5535"
+//   5536: group 0, "flag-name-5536"
+//   5537: group 0, "flag-name-5537"
+//   5538: group 0, "flag-name-5538"
+//   5539: group 0, "flag-name-5539"
+//   5540: group 0, "flag-name-5540"
+//   5541: group 0, "flag-name-5541"
+//   5542: group 0, "flag-name-5542"
+//   5543: group 0, "flag-name-5543"
+//   5544: group 0, "flag-name-5544"
+//   5545: group 0, "flag-name-5545"
+//   5546: group 0, "flag-name-5546"
+//   5547: group 0, "flag-name-5547"
+//   5548: group 0, "flag-name-5548"
+//   5549: group 0, "flag-name-5549"
+//   5550: group 0, "flag-name-5550"
+//   5551: group 0, "flag-name-5551"
+//   5552: group 0, "flag-name-5552"
+//   5553: group 0, "flag-name-5553"
+//   5554: group 0, "flag-name-5554"
+//   5555: group 0, "flag-name-5555"
+//   5556: group 0, "flag-name-5556"
+//   5557: group 0, "flag-name-5557"
+//   5558: group 0, "flag-name-5558"
+//   5559: group 0, "flag-name-5559"
+//   5560: group 0, "flag-name-5560"
+//   5561: group 0, "flag-name-5561"
+//   5562: group 0, "flag-name-5562"
+//   5563: group 0, "flag-name-5563"
+//   5564: group 0, "flag-name-5564"
+//   5565: group 0, "flag-name-5565"
+//   5566: group 0, "flag-name-5566"
+//   5567: group 0, "flag-name-5567"
+//   5568: group 0, "flag-name-5568"
+//   5569: group 0, "flag-name-5569"
+//   5570: group 0, "flag-name-5570"
+//   5571: group 0, "flag-name-5571"
+//   5572: group 0, "flag-name-5572"
+//   5573: group 0, "flag-name-5573"
+//   5574: group 0, "flag-name-5574"
+//   5575: group 0, "flag-name-5575"
+//   5576: group 0, "flag-name-5576"
+//   5577: group 0, "flag-name-5577"
+//   5578: group 0, "flag-name-5578"
+//   5579: group 0, "flag-name-5579"
+//   5580: group 0, "flag-name-5580"
+//   5581: group 0, "flag-name-5581"
+//   5582: group 0, "flag-name-5582"
+//   5583: group 0, "flag-name-5583"
+//   5584: group 0, "flag-name-5584"
+//   5585: group 0, "flag-name-5585"
+//   5586: group 0, "flag-name-5586"
+//   5587: group 0, "flag-name-5587"
+//   5588: group 0, "flag-name-5588"
+//   5589: group 0, "flag-name-5589"
+//   5590: group 0, "flag-name-5590"
+//   5591: group 0, "flag-name-5591"
+//   5592: group 0, "flag-name-5592"
+//   5593: group 0, "flag-name-5593"
+//   5594: group 0, "flag-name-5594"
+//   5595: group 0, "flag-name-5595"
+//   5596: group 0, "flag-name-5596"
+//   5597: group 0, "flag-name-5597"
+//   5598: group 0, "flag-name-5598"
+//   5599: group 0, "flag-name-5599"
+//   5600: group 0, "flag-name-5600"
+//   5601: group 0, "flag-name-5601"
+//   5602: group 0, "flag-name-5602"
+//   5603: group 0, "flag-name-5603"
+//   5604: group 0, "flag-name-5604"
+//   5605: group 0, "flag-name-5605"
+//   5606: group 0, "flag-name-5606"
+//   5607: group 0, "flag-name-5607"
+//   5608: group 0, "flag-name-5608"
+//   5609: group 0, "flag-name-5609"
+//   5610: group 0, "flag-name-5610"
+//   5611: group 0, "flag-name-5611"
+//   5612: group 0, "flag-name-5612"
+//   5613: group 0, "flag-name-5613"
+//   5614: group 0, "flag-name-5614"
+//   5615: group 0, "flag-name-5615"
+//   5616: group 0, "flag-name-5616"
+//   5617: group 0, "flag-name-5617"
+//   5618: group 0, "flag-name-5618"
+//   5619: group 0, "flag-name-5619"
+//   5620: group 0, "flag-name-5620"
+//   5621: group 0, "flag-name-5621"
+//   5622: group 0, "flag-name-5622"
+//   5623: group 0, "flag-name-5623"
+//   5624: group 0, "flag-name-5624"
+//   5625: group 0, "flag-name-5625"
+//   5626: group 0, "flag-name-5626"
+//   5627: group 0, "flag-name-5627"
+//   5628: group 0, "flag-name-5628"
+//   5629: group 0, "flag-name-5629"
+//   5630: group 0, "flag-name-5630"
+//   5631: group 0, "flag-name-5631"
+//   5632: group 0, "flag-name-5632"
+//   5633: group 0, "flag-name-5633"
+//   5634: group 0, "flag-name-5634"
+//   5635: group 0, "flag-name-5635"
+//   5636: group 0, "flag-name-5636"
+//   5637: group 0, "flag-name-5637"
+//   5638: group 0, "flag-name-5638"
+//   5639: group 0, "flag-name-5639"
+//   5640: group 0, "flag-name-5640"
+//   5641: group 0, "flag-name-5641"
+//   5642: group 0, "flag-name-5642"
+//   5643: group 0, "flag-name-5643"
+//   5644: group 0, "flag-name-5644"
+//   5645: group 0, "flag-name-5645"
+//   5646: group 0, "flag-name-5646"
+//   5647: group 0, "flag-name-5647"
+//   5648: group 0, "flag-name-5648"
+//   5649: group 0, "flag-name-5649"
+//   5650: group 0, "flag-name-5650"
+//   5651: group 0, "flag-name-5651"
+//   5652: group 0, "flag-name-5652"
+//   5653: group 0, "flag-name-5653"
+//   5654: group 0, "flag-name-5654"
+//   5655: group 0, "flag-name-5655"
+//   5656: group 0, "flag-name-5656"
+//   5657: group 0, "flag-name-5657"
+//   5658: group 0, "flag-name-5658"
+//   5659: group 0, "flag-name-5659"
+//   5660: group 0, "flag-name-5660"
+//   5661: group 0, "flag-name-5661"
+//   5662: group 0, "flag-name-5662"
+//   5663: group 0, "flag-name-5663"
+//   5664: group 0, "flag-name-5664"
+//   5665: group 0, "flag-name-5665"
+//   5666: group 0, "flag-name-5666"
+//   5667: group 0, "flag-name-5667"
+//   5668: group 0, "flag-name-5668"
+//   5669: group 0, "flag-name-5669"
+//   5670: group 0, "flag-name-5670"
+//   5671: group 0, "flag-name-5671"
+//   5672: group 0, "flag-name-5672"
+//   5673: group 0, "flag-name-5673"
+//   5674: group 0, "flag-name-5674"
+//   5675: group 0, "flag-name-5675"
+//   5676: group 0, "flag-name-5676"
+//   5677: group 0, "flag-name-5677"
+//   5678: group 0, "flag-name-5678"
+//   5679: group 0, "flag-name-5679"
+//   5680: group 0, "flag-name-5680"
+//   5681: group 0, "flag-name-5681"
+//   5682: group 0, "flag-name-5682"
+//   5683: group 0, "flag-name-5683"
+//   5684: group 0, "flag-name-5684"
+//   5685: group 0, "flag-name-5685"
+//   5686: group 0, "flag-name-5686"
+//   5687: group 0, "flag-name-5687"
+//   5688: group 0, "flag-name-5688"
+//   5689: group 0, "flag-name-5689"
+//   5690: group 0, "flag-name-5690"
+//   5691: group 0, "flag-name-5691"
+//   5692: group 0, "flag-name-5692"
+//   5693: group 0, "flag-name-5693"
+//   5694: group 0, "flag-name-5694"
+//   5695: group 0, "flag-name-5695"
+//   5696: group 0, "flag-name-5696"
+//   5697: group 0, "flag-name-5697"
+//   5698: group 0, "flag-name-5698"
+//   5699: group 0, "flag-name-5699"
+//   5700: group 0, "flag-name-5700"
+//   5701: group 0, "flag-name-5701"
+//   5702: group 0, "flag-name-5702"
+//   5703: group 0, "flag-name-5703"
+//   5704: group 0, "flag-name-5704"
+//   5705: group 0, "flag-name-5705"
+//   5706: group 0, "flag-name-5706"
+//   5707: group 0, "flag-name-5707"
+//   5708: group 0, "flag-name-5708"
+//   5709: group 0, "flag-name-5709"
+//   5710: group 0, "flag-name-5710"
+//   5711: group 0, "flag-name-5711"
+//   5712: group 0, "flag-name-5712"
+//   5713: group 0, "flag-name-5713"
+//   5714: group 0, "flag-name-5714"
+//   5715: group 0, "flag-name-5715"
+//   5716: group 0, "flag-name-5716"
+//   5717: group 0, "flag-name-5717"
+//   5718: group 0, "flag-name-5718"
+//   5719: group 0, "flag-name-5719"
+//   5720: group 0, "flag-name-5720"
+//   5721: group 0, "flag-name-5721"
+//   5722: group 0, "flag-name-5722"
+//   5723: group 0, "flag-name-5723"
+//   5724: group 0, "flag-name-5724"
+//   5725: group 0, "flag-name-5725"
+//   5726: group 0, "flag-name-5726"
+//   5727: group 0, "flag-name-5727"
+//   5728: group 0, "flag-name-5728"
+//   5729: group 0, "flag-name-5729"
+//   5730: group 0, "flag-name-5730"
+//   5731: group 0, "flag-name-5731"
+//   5732: group 0, "flag-name-5732"
+//   5733: group 0, "flag-name-5733"
+//   5734: group 0, "flag-name-5734"
+//   5735: group 0, "flag-name-5735"
+//   5736: group 0, "flag-name-5736"
+//   5737: group 0, "flag-name-5737"
+//   5738: group 0, "flag-name-5738"
+//   5739: group 0, "flag-name-5739"
+//   5740: group 0, "flag-name-5740"
+//   5741: group 0, "flag-name-5741"
+//   5742: group 0, "flag-name-5742"
+//   5743: group 0, "flag-name-5743"
+//   5744: group 0, "flag-name-5744"
+//   5745: group 0, "flag-name-5745"
+//   5746: group 0, "flag-name-5746"
+//   5747: group 0, "flag-name-5747"
+//   5748: group 0, "flag-name-5748"
+//   5749: group 0, "flag-name-5749"
+//   5750: group 0, "flag-name-5750"
+//   5751: group 0, "flag-name-5751"
+//   5752: group 0, "flag-name-5752"
+//   5753: group 0, "flag-name-5753"
+//   5754: group 0, "flag-name-5754"
+//   5755: group 0, "flag-name-5755"
+//   5756: group 0, "flag-name-5756"
+//   5757: group 0, "flag-name-5757"
+//   5758: group 0, "flag-name-5758"
+//   5759: group 0, "flag-name-5759"
+//   5760: group 0, "flag-name-5760"
+//   5761: group 0, "flag-name-5761"
+//   5762: group 0, "flag-name-5762"
+//   5763: group 0, "flag-name-5763"
+//   5764: group 0, "flag-name-5764"
+//   5765: group 0, "flag-name-5765"
+//   5766: group 0, "flag-name-5766"
+//   5767: group 0, "flag-name-5767"
+//   5768: group 0, "flag-name-5768"
+//   5769: group 0, "flag-name-5769"
+//   5770: group 0, "flag-name-5770"
+//   5771: group 0, "flag-name-5771"
+//   5772: group 0, "flag-name-5772"
+//   5773: group 0, "flag-name-5773"
+//   5774: group 0, "flag-name-5774"
+//   5775: group 0, "flag-name-5775"
+//   5776: group 0, "flag-name-5776"
+//   5777: group 0, "flag-name-5777"
+//   5778: group 0, "flag-name-5778"
+//   5779: group 0, "flag-name-5779"
+//   5780: group 0, "flag-name-5780"
+//   5781: group 0, "flag-name-5781"
+//   5782: group 0, "flag-name-5782"
+//   5783: group 0, "flag-name-5783"
+//   5784: group 0, "flag-name-5784"
+//   5785: group 0, "flag-name-5785"
+//   5786: group 0, "flag-name-5786"
+//   5787: group 0, "flag-name-5787"
+//   5788: group 0, "flag-name-5788"
+//   5789: group 0, "flag-name-5789"
+//   5790: group 0, "flag-name-5790"
+//   5791: group 0, "flag-name-5791"
+//   5792: group 0, "flag-name-5792"
+//   5793: group 0, "flag-name-5793"
+//   5794: group 0, "flag-name-5794"
+//   5795: group 0, "flag-name-5795"
+//   5796: group 0, "flag-name-5796"
+//   5797: group 0, "flag-name-5797"
+//   5798: group 0, "flag-name-5798"
+//   5799: group 0, "flag-name-5799"
+//   5800: group 0, "flag-name-5800"
+//   5801: group 0, "flag-name-5801"
+//   5802: group 0, "flag-name-5802"
+//   5803: group 0, "flag-name-5803"
+//   5804: group 0, "flag-name-5804"
+//   5805: group 0, "flag-name-5805"
+//   5806: group 0, "flag-name-5806"
+//   5807: group 0, "flag-name-5807"
+//   5808: group 0, "flag-name-5808"
+//   5809: group 0, "flag-name-5809"
+//   5810: group 0, "flag-name-5810"
+//   5811: group 0, "flag-name-5811"
+//   5812: group 0, "flag-name-5812"
+//   5813: group 0, "flag-name-5813"
+//   5814: group 0, "flag-name-5814"
+//   5815: group 0, "flag-name-5815"
+//   5816: group 0, "flag-name-5816"
+//   5817: group 0, "flag-name-5817"
+//   5818: group 0, "flag-name-5818"
+//   5819: group 0, "flag-name-5819"
+//   5820: group 0, "flag-name-5820"
+//   5821: group 0, "flag-name-5821"
+//   5822: group 0, "flag-name-5822"
+//   5823: group 0, "flag-name-5823"
+//   5824: group 0, "flag-name-5824"
+//   5825: group 0, "flag-name-5825"
+//   5826: group 0, "flag-name-5826"
+//   5827: group 0, "flag-name-5827"
+//   5828: group 0, "flag-name-5828"
+//   5829: group 0, "flag-name-5829"
+//   5830: group 0, "flag-name-5830"
+//   5831: group 0, "flag-name-5831"
+//   5832: group 0, "flag-name-5832"
+//   5833: group 0, "flag-name-5833"
+//   5834: group 0, "flag-name-5834"
+//   5835: group 0, "flag-name-5835"
+//   5836: group 0, "flag-name-5836"
+//   5837: group 0, "flag-name-5837"
+//   5838: group 0, "flag-name-5838"
+//   5839: group 0, "flag-name-5839"
+//   5840: group 0, "flag-name-5840"
+//   5841: group 0, "flag-name-5841"
+//   5842: group 0, "flag-name-5842"
+//   5843: group 0, "flag-name-5843"
+//   5844: group 0, "flag-name-5844"
+//   5845: group 0, "flag-name-5845"
+//   5846: group 0, "flag-name-5846"
+//   5847: group 0, "flag-name-5847"
+//   5848: group 0, "flag-name-5848"
+//   5849: group 0, "flag-name-5849"
+//   5850: group 0, "flag-name-5850"
+//   5851: group 0, "flag-name-5851"
+//   5852: group 0, "flag-name-5852"
+//   5853: group 0, "flag-name-5853"
+//   5854: group 0, "flag-name-5854"
+//   5855: group 0, "flag-name-5855"
+//   5856: group 0, "flag-name-5856"
+//   5857: group 0, "flag-name-5857"
+//   5858: group 0, "flag-name-5858"
+//   5859: group 0, "flag-name-5859"
+//   5860: group 0, "flag-name-5860"
+//   5861: group 0, "flag-name-5861"
+//   5862: group 0, "flag-name-5862"
+//   5863: group 0, "flag-name-5863"
+//   5864: group 0, "flag-name-5864"
+//   5865: group 0, "flag-name-5865"
+//   5866: group 0, "flag-name-5866"
+//   5867: group 0, "flag-name-5867"
+//   5868: group 0, "flag-name-5868"
+//   5869: group 0, "flag-name-5869"
+//   5870: group 0, "flag-name-5870"
+//   5871: group 0, "flag-name-5871"
+//   5872: group 0, "flag-name-5872"
+//   5873: group 0, "flag-name-5873"
+//   5874: group 0, "flag-name-5874"
+//   5875: group 0, "flag-name-5875"
+//   5876: group 0, "flag-name-5876"
+//   5877: group 0, "flag-name-5877"
+//   5878: group 0, "flag-name-5878"
+//   5879: group 0, "flag-name-5879"
+//   5880: group 0, "flag-name-5880"
+//   5881: group 0, "flag-name-5881"
+//   5882: group 0, "flag-name-5882"
+//   5883: group 0, "flag-name-5883"
+//   5884: group 0, "flag-name-5884"
+//   5885: group 0, "flag-name-5885"
+//   5886: group 0, "flag-name-5886"
+//   5887: group 0, "flag-name-5887"
+//   5888: group 0, "flag-name-5888"
+//   5889: group 0, "flag-name-5889"
+//   5890: group 0, "flag-name-5890"
+//   5891: group 0, "flag-name-5891"
+//   5892: group 0, "flag-name-5892"
+//   5893: group 0, "flag-name-5893"
+//   5894: group 0, "flag-name-5894"
+//   5895: group 0, "flag-name-5895"
+//   5896: group 0, "flag-name-5896"
+//   5897: group 0, "flag-name-5897"
+//   5898: group 0, "flag-name-5898"
+//   5899: group 0, "flag-name-5899"
+//   5900: group 0, "flag-name-5900"
+//   5901: group 0, "flag-name-5901"
+//   5902: group 0, "flag-name-5902"
+//   5903: group 0, "flag-name-5903"
+//   5904: group 0, "flag-name-5904"
+//   5905: group 0, "flag-name-5905"
+//   5906: group 0, "flag-name-5906"
+//   5907: group 0, "flag-name-5907"
+//   5908: group 0, "flag-name-5908"
+//   5909: group 0, "flag-name-5909"
+//   5910: group 0, "flag-name-5910"
+//   5911: group 0, "flag-name-5911"
+//   5912: group 0, "flag-name-5912"
+//   5913: group 0, "flag-name-5913"
+//   5914: group 0, "flag-name-5914"
+//   5915: group 0, "flag-name-5915"
+//   5916: group 0, "flag-name-5916"
+//   5917: group 0, "flag-name-5917"
+//   5918: group 0, "flag-name-5918"
+//   5919: group 0, "flag-name-5919"
+//   5920: group 0, "flag-name-5920"
+//   5921: group 0, "flag-name-5921"
+//   5922: group 0, "flag-name-5922"
+//   5923: group 0, "flag-name-5923"
+//   5924: group 0, "flag-name-5924"
+//   5925: group 0, "flag-name-5925"
+//   5926: group 0, "flag-name-5926"
+//   5927: group 0, "flag-name-5927"
+//   5928: group 0, "flag-name-5928"
+//   5929: group 0, "flag-name-5929"
+//   5930: group 0, "flag-name-5930"
+//   5931: group 0, "flag-name-5931"
+//   5932: group 0, "flag-name-5932"
+//   5933: group 0, "flag-name-5933"
+//   5934: group 0, "flag-name-5934"
+//   5935: group 0, "flag-name-5935"
+//   5936: group 0, "flag-name-5936"
+//   5937: group 0, "flag-name-5937"
+//   5938: group 0, "flag-name-5938"
+//   5939: group 0, "flag-name-5939"
+//   5940: group 0, "flag-name-5940"
+//   5941: group 0, "flag-name-5941"
+//   5942: group 0, "flag-name-5942"
+//   5943: group 0, "flag-name-5943"
+//   5944: group 0, "flag-name-5944"
+//   5945: group 0, "flag-name-5945"
+//   5946: group 0, "flag-name-5946"
+//   5947: group 0, "flag-name-5947"
+//   5948: group 0, "flag-name-5948"
+//   5949: group 0, "flag-name-5949"
+//   5950: group 0, "flag-name-5950"
+//   5951: group 0, "flag-name-5951"
+//   5952: group 0, "flag-name-5952"
+//   5953: group 0, "flag-name-5953"
+//   5954: group 0, "flag-name-5954"
+//   5955: group 0, "flag-name-5955"
+//   5956: group 0, "flag-name-5956"
+//   5957: group 0, "flag-name-5957"
+//   5958: group 0, "flag-name-5958"
+//   5959: group 0, "flag-name-5959"
+//   5960: group 0, "flag-name-5960"
+//   5961: group 0, "flag-name-5961"
+//   5962: group 0, "flag-name-5962"
+//   5963: group 0, "flag-name-5963"
+//   5964: group 0, "flag-name-5964"
+//   5965: group 0, "flag-name-5965"
+//   5966: group 0, "flag-name-5966"
+//   5967: group 0, "flag-name-5967"
+//   5968: group 0, "flag-name-5968"
+//   5969: group 0, "flag-name-5969"
+//   5970: group 0, "flag-name-5970"
+//   5971: group 0, "flag-name-5971"
+//   5972: group 0, "flag-name-5972"
+//   5973: group 0, "flag-name-5973"
+//   5974: group 0, "flag-name-5974"
+//   5975: group 0, "flag-name-5975"
+//   5976: group 0, "flag-name-5976"
+//   5977: group 0, "flag-name-5977"
+//   5978: group 0, "flag-name-5978"
+//   5979: group 0, "flag-name-5979"
+//   5980: group 0, "flag-name-5980"
+//   5981: group 0, "flag-name-5981"
+//   5982: group 0, "flag-name-5982"
+//   5983: group 0, "flag-name-5983"
+//   5984: group 0, "flag-name-5984"
+//   5985: group 0, "flag-name-5985"
+//   5986: group 0, "flag-name-5986"
+//   5987: group 0, "flag-name-5987"
+//   5988: group 0, "flag-name-5988"
+//   5989: group 0, "flag-name-5989"
+//   5990: group 0, "flag-name-5990"
+//   5991: group 0, "flag-name-5991"
+//   5992: group 0, "flag-name-5992"
+//   5993: group 0, "flag-name-5993"
+//   5994: group 0, "flag-name-5994"
+//   5995: group 0, "flag-name-5995"
+//   5996: group 0, "flag-name-5996"
+//   5997: group 0, "flag-name-5997"
+//   5998: group 0, "flag-name-5998"
+//   5999: group 0, "flag-name-5999"
+//   6000: group 0, "flag-name-6000"
+//   6001: group 0, "flag-name-6001"
+//   6002: group 0, "flag-name-6002"
+//   6003: group 0, "flag-name-6003"
+//   6004: group 0, "flag-name-6004"
+//   6005: group 0, "flag-name-6005"
+//   6006: group 0, "flag-name-6006"
+//   6007: group 0, "flag-name-6007"
+//   6008: group 0, "flag-name-6008"
+//   6009: group 0, "flag-name-6009"
+//   6010: group 0, "flag-name-6010"
+//   6011: group 0, "flag-name-6011"
+//   6012: group 0, "flag-name-6012"
+//   6013: group 0, "flag-name-6013"
+//   6014: group 0, "flag-name-6014"
+//   6015: group 0, "flag-name-6015"
+//   6016: group 0, "flag-name-6016"
+//   6017: group 0, "flag-name-6017"
+//   6018: group 0, "flag-name-6018"
+//   6019: group 0, "flag-name-6019"
+//   6020: group 0, "flag-name-6020"
+//   6021: group 0, "flag-name-6021"
+//   6022: group 0, "flag-name-6022"
+//   6023: group 0, "flag-name-6023"
+//   6024: group 0, "flag-name-6024"
+//   6025: group 0, "flag-name-6025"
+//   6026: group 0, "flag-name-6026"
+//   6027: group 0, "flag-name-6027"
+//   6028: group 0, "flag-name-6028"
+//   6029: group 0, "flag-name-6029"
+//   6030: group 0, "flag-name-6030"
+//   6031: group 0, "flag-name-6031"
+//   6032: group 0, "flag-name-6032"
+//   6033: group 0, "flag-name-6033"
+//   6034: group 0, "flag-name-6034"
+//   6035: group 0, "flag-name-6035"
+//   6036: group 0, "flag-name-6036"
+//   6037: group 0, "flag-name-6037"
+//   6038: group 0, "flag-name-6038"
+//   6039: group 0, "flag-name-6039"
+//   6040: group 0, "flag-name-6040"
+//   6041: group 0, "flag-name-6041"
+//   6042: group 0, "flag-name-6042"
+//   6043: group 0, "flag-name-6043"
+//   6044: group 0, "flag-name-6044"
+//   6045: group 0, "flag-name-6045"
+//   6046: group 0, "flag-name-6046"
+//   6047: group 0, "flag-name-6047"
+//   6048: group 0, "flag-name-6048"
+//   6049: group 0, "flag-name-6049"
+//   6050: group 0, "flag-name-6050"
+//   6051: group 0, "flag-name-6051"
+//   6052: group 0, "flag-name-6052"
+//   6053: group 0, "flag-name-6053"
+//   6054: group 0, "flag-name-6054"
+//   6055: group 0, "flag-name-6055"
+//   6056: group 0, "flag-name-6056"
+//   6057: group 0, "flag-name-6057"
+//   6058: group 0, "flag-name-6058"
+//   6059: group 0, "flag-name-6059"
+//   6060: group 0, "flag-name-6060"
+//   6061: group 0, "flag-name-6061"
+//   6062: group 0, "flag-name-6062"
+//   6063: group 0, "flag-name-6063"
+//   6064: group 0, "flag-name-6064"
+//   6065: group 0, "flag-name-6065"
+//   6066: group 0, "flag-name-6066"
+//   6067: group 0, "flag-name-6067"
+//   6068: group 0, "flag-name-6068"
+//   6069: group 0, "flag-name-6069"
+//   6070: group 0, "flag-name-6070"
+//   6071: group 0, "flag-name-6071"
+//   6072: group 0, "flag-name-6072"
+//   6073: group 0, "flag-name-6073"
+//   6074: group 0, "flag-name-6074"
+//   6075: group 0, "flag-name-6075"
+//   6076: group 0, "flag-name-6076"
+//   6077: group 0, "flag-name-6077"
+//   6078: group 0, "flag-name-6078"
+//   6079: group 0, "flag-name-6079"
+//   6080: group 0, "flag-name-6080"
+//   6081: group 0, "flag-name-6081"
+//   6082: group 0, "flag-name-6082"
+//   6083: group 0, "flag-name-6083"
+//   6084: group 0, "flag-name-6084"
+//   6085: group 0, "flag-name-6085"
+//   6086: group 0, "flag-name-6086"
+//   6087: group 0, "flag-name-6087"
+//   6088: group 0, "flag-name-6088"
+//   6089: group 0, "flag-name-6089"
+//   6090: group 0, "flag-name-6090"
+//   6091: group 0, "flag-name-6091"
+//   6092: group 0, "flag-name-6092"
+//   6093: group 0, "flag-name-6093"
+//   6094: group 0, "flag-name-6094"
+//   6095: group 0, "flag-name-6095"
+//   6096: group 0, "flag-name-6096"
+//   6097: group 0, "flag-name-6097"
+//   6098: group 0, "flag-name-6098"
+//   6099: group 0, "flag-name-6099"
+//   6100: group 0, "flag-name-6100"
+//   6101: group 0, "flag-name-6101"
+//   6102: group 0, "flag-name-6102"
+//   6103: group 0, "flag-name-6103"
+//   6104: group 0, "flag-name-6104"
+//   6105: group 0, "flag-name-6105"
+//   6106: group 0, "flag-name-6106"
+//   6107: group 0, "flag-name-6107"
+//   6108: group 0, "flag-name-6108"
+//   6109: group 0, "flag-name-6109"
+//   6110: group 0, "flag-name-6110"
+//   6111: group 0, "flag-name-6111"
+//   6112: group 0, "flag-name-6112"
+//   6113: group 0, "flag-name-6113"
+//   6114: group 0, "flag-name-6114"
+//   6115: group 0, "flag-name-6115"
+//   6116: group 0, "flag-name-6116"
+//   6117: group 0, "flag-name-6117"
+//   6118: group 0, "flag-name-6118"
+//   6119: group 0, "flag-name-6119"
+//   6120: group 0, "flag-name-6120"
+//   6121: group 0, "flag-name-6121"
+//   6122: group 0, "flag-name-6122"
+//   6123: group 0, "flag-name-6123"
+//   6124: group 0, "flag-name-6124"
+//   6125: group 0, "flag-name-6125"
+//   6126: group 0, "flag-name-6126"
+//   6127: group 0, "flag-name-6127"
+//   6128: group 0, "flag-name-6128"
+//   6129: group 0, "flag-name-6129"
+//   6130: group 0, "flag-name-6130"
+//   6131: group 0, "flag-name-6131"
+//   6132: group 0, "flag-name-6132"
+//   6133: group 0, "flag-name-6133"
+//   6134: group 0, "flag-name-6134"
+//   6135: group 0, "flag-name-6135"
+//   6136: group 0, "flag-name-6136"
+//   6137: group 0, "flag-name-6137"
+//   6138: group 0, "flag-name-6138"
+//   6139: group 0, "flag-name-6139"
+//   6140: group 0, "flag-name-6140"
+//   6141: group 0, "flag-name-6141"
+//   6142: group 0, "flag-name-6142"
+//   6143: group 0, "flag-name-6143"
+//   6144: group 0, "flag-name-6144"
+//   6145: group 0, "flag-name-6145"
+//   6146: group 0, "flag-name-6146"
+//   6147: group 0, "flag-name-6147"
+//   6148: group 0, "flag-name-6148"
+//   6149: group 0, "flag-name-6149"
+//   6150: group 0, "flag-name-6150"
+//   6151: group 0, "flag-name-6151"
+//   6152: group 0, "flag-name-6152"
+//   6153: group 0, "flag-name-6153"
+//   6154: group 0, "flag-name-6154"
+//   6155: group 0, "flag-name-6155"
+//   6156: group 0, "flag-name-6156"
+//   6157: group 0, "flag-name-6157"
+//   6158: group 0, "flag-name-6158"
+//   6159: group 0, "flag-name-6159"
+//   6160: group 0, "flag-name-6160"
+//   6161: group 0, "flag-name-6161"
+//   6162: group 0, "flag-name-6162"
+//   6163: group 0, "flag-name-6163"
+//   6164: group 0, "flag-name-6164"
+//   6165: group 0, "flag-name-6165"
+//   6166: group 0, "flag-name-6166"
+//   6167: group 0, "flag-name-6167"
+//   6168: group 0, "flag-name-6168"
+//   6169: group 0, "flag-name-6169"
+//   6170: group 0, "flag-name-6170"
+//   6171: group 0, "flag-name-6171"
+//   6172: group 0, "flag-name-6172"
+//   6173: group 0, "flag-name-6173"
+//   6174: group 0, "flag-name-6174"
+//   6175: group 0, "flag-name-6175"
+//   6176: group 0, "flag-name-6176"
+//   6177: group 0, "flag-name-6177"
+//   6178: group 0, "flag-name-6178"
+//   6179: group 0, "flag-name-6179"
+//   6180: group 0, "flag-name-6180"
+//   6181: group 0, "flag-name-6181"
+//   6182: group 0, "flag-name-6182"
+//   6183: group 0, "flag-name-6183"
+//   6184: group 0, "flag-name-6184"
+//   6185: group 0, "flag-name-6185"
+//   6186: group 0, "flag-name-6186"
+//   6187: group 0, "flag-name-6187"
+//   6188: group 0, "flag-name-6188"
+//   6189: group 0, "flag-name-6189"
+//   6190: group 0, "flag-name-6190"
+//   6191: group 0, "flag-name-6191"
+//   6192: group 0, "flag-name-6192"
+//   6193: group 0, "flag-name-6193"
+//   6194: group 0, "flag-name-6194"
+//   6195: group 0, "flag-name-6195"
+//   6196: group 0, "flag-name-6196"
+//   6197: group 0, "flag-name-6197"
+//   6198: group 0, "flag-name-6198"
+//   6199: group 0, "flag-name-6199"
+//   6200: group 0, "flag-name-6200"
+//   6201: group 0, "flag-name-6201"
+//   6202: group 0, "flag-name-6202"
+//   6203: group 0, "flag-name-6203"
+//   6204: group 0, "flag-name-6204"
+//   6205: group 0, "flag-name-6205"
+//   6206: group 0, "flag-name-6206"
+//   6207: group 0, "flag-name-6207"
+//   6208: group 0, "flag-name-6208"
+//   6209: group 0, "flag-name-6209"
+//   6210: group 0, "flag-name-6210"
+//   6211: group 0, "flag-name-6211"
+//   6212: group 0, "flag-name-6212"
+//   6213: group 0, "flag-name-6213"
+//   6214: group 0, "flag-name-6214"
+//   6215: group 0, "flag-name-6215"
+//   6216: group 0, "flag-name-6216"
+//   6217: group 0, "flag-name-6217"
+//   6218: group 0, "flag-name-6218"
+//   6219: group 0, "flag-name-6219"
+//   6220: group 0, "flag-name-6220"
+//   6221: group 0, "flag-name-6221"
+//   6222: group 0, "flag-name-6222"
+//   6223: group 0, "flag-name-6223"
+//   6224: group 0, "flag-name-6224"
+//   6225: group 0, "flag-name-6225"
+//   6226: group 0, "flag-name-6226"
+//   6227: group 0, "flag-name-6227"
+//   6228: group 0, "flag-name-6228"
+//   6229: group 0, "flag-name-6229"
+//   6230: group 0, "flag-name-6230"
+//   6231: group 0, "flag-name-6231"
+//   6232: group 0, "flag-name-6232"
+//   6233: group 0, "flag-name-6233"
+//   6234: group 0, "flag-name-6234"
+//   6235: group 0, "flag-name-6235"
+//   6236: group 0, "flag-name-6236"
+//   6237: group 0, "flag-name-6237"
+//   6238: group 0, "flag-name-6238"
+//   6239: group 0, "flag-name-6239"
+//   6240: group 0, "flag-name-6240"
+//   6241: group 0, "flag-name-6241"
+//   6242: group 0, "flag-name-6242"
+//   6243: group 0, "flag-name-6243"
+//   6244: group 0, "flag-name-6244"
+//   6245: group 0, "flag-name-6245"
+//   6246: group 0, "flag-name-6246"
+//   6247: group 0, "flag-name-6247"
+//   6248: group 0, "flag-name-6248"
+//   6249: group 0, "flag-name-6249"
+//   6250: group 0, "flag-name-6250"
+//   6251: group 0, "flag-name-6251"
+//   6252: group 0, "flag-name-6252"
+//   6253: group 0, "flag-name-6253"
+//   6254: group 0, "flag-name-6254"
+//   6255: group 0, "flag-name-6255"
+//   6256: group 0, "flag-name-6256"
+//   6257: group 0, "flag-name-6257"
+//   6258: group 0, "flag-name-6258"
+//   6259: group 0, "flag-name-6259"
+//   6260: group 0, "flag-name-6260"
+//   6261: group 0, "flag-name-6261"
+//   6262: group 0, "flag-name-6262"
+//   6263: group 0, "flag-name-6263"
+//   6264: group 0, "flag-name-6264"
+//   6265: group 0, "flag-name-6265"
+//   6266: group 0, "flag-name-6266"
+//   6267: group 0, "flag-name-6267"
+//   6268: group 0, "flag-name-6268"
+//   6269: group 0, "flag-name-6269"
+//   6270: group 0, "flag-name-6270"
+//   6271: group 0, "flag-name-6271"
+//   6272: group 0, "flag-name-6272"
+//   6273: group 0, "flag-name-6273"
+//   6274: group 0, "flag-name-6274"
+//   6275: group 0, "flag-name-6275"
+//   6276: group 0, "flag-name-6276"
+//   6277: group 0, "flag-name-6277"
+//   6278: group 0, "flag-name-6278"
+//   6279: group 0, "flag-name-6279"
+//   6280: group 0, "flag-name-6280"
+//   6281: group 0, "flag-name-6281"
+//   6282: group 0, "flag-name-6282"
+//   6283: group 0, "flag-name-6283"
+//   6284: group 0, "flag-name-6284"
+//   6285: group 0, "flag-name-6285"
+//   6286: group 0, "flag-name-6286"
+//   6287: group 0, "flag-name-6287"
+//   6288: group 0, "flag-name-6288"
+//   6289: group 0, "flag-name-6289"
+//   6290: group 0, "flag-name-6290"
+//   6291: group 0, "flag-name-6291"
+//   6292: group 0, "flag-name-6292"
+//   6293: group 0, "flag-name-6293"
+//   6294: group 0, "flag-name-6294"
+//   6295: group 0, "flag-name-6295"
+//   6296: group 0, "flag-name-6296"
+//   6297: group 0, "flag-name-6297"
+//   6298: group 0, "flag-name-6298"
+//   6299: group 0, "flag-name-6299"
+//   6300: group 0, "flag-name-6300"
+//   6301: group 0, "flag-name-6301"
+//   6302: group 0, "flag-name-6302"
+//   6303: group 0, "flag-name-6303"
+//   6304: group 0, "flag-name-6304"
+//   6305: group 0, "flag-name-6305"
+//   6306: group 0, "flag-name-6306"
+//   6307: group 0, "flag-name-6307"
+//   6308: group 0, "flag-name-6308"
+//   6309: group 0, "flag-name-6309"
+//   6310: group 0, "flag-name-6310"
+//   6311: group 0, "flag-name-6311"
+//   6312: group 0, "flag-name-6312"
+//   6313: group 0, "flag-name-6313"
+//   6314: group 0, "flag-name-6314"
+//   6315: group 0, "flag-name-6315"
+//   6316: group 0, "flag-name-6316"
+//   6317: group 0, "flag-name-6317"
+//   6318: group 0, "flag-name-6318"
+//   6319: group 0, "flag-name-6319"
+//   6320: group 0, "flag-name-6320"
+//   6321: group 0, "flag-name-6321"
+//   6322: group 0, "flag-name-6322"
+//   6323: group 0, "flag-name-6323"
+//   6324: group 0, "flag-name-6324"
+//   6325: group 0, "flag-name-6325"
+//   6326: group 0, "flag-name-6326"
+//   6327: group 0, "flag-name-6327"
+//   6328: group 0, "flag-name-6328"
+//   6329: group 0, "flag-name-6329"
+//   6330: group 0, "flag-name-6330"
+//   6331: group 0, "flag-name-6331"
+//   6332: group 0, "flag-name-6332"
+//   6333: group 0, "flag-name-6333"
+//   6334: group 0, "flag-name-6334"
+//   6335: group 0, "flag-name-6335"
+//   6336: group 0, "flag-name-6336"
+//   6337: group 0, "flag-name-6337"
+//   6338: group 0, "flag-name-6338"
+//   6339: group 0, "flag-name-6339"
+//   6340: group 0, "flag-name-6340"
+//   6341: group 0, "flag-name-6341"
+//   6342: group 0, "flag-name-6342"
+//   6343: group 0, "flag-name-6343"
+//   6344: group 0, "flag-name-6344"
+//   6345: group 0, "flag-name-6345"
+//   6346: group 0, "flag-name-6346"
+//   6347: group 0, "flag-name-6347"
+//   6348: group 0, "flag-name-6348"
+//   6349: group 0, "flag-name-6349"
+//   6350: group 0, "flag-name-6350"
+//   6351: group 0, "flag-name-6351"
+//   6352: group 0, "flag-name-6352"
+//   6353: group 0, "flag-name-6353"
+//   6354: group 0, "flag-name-6354"
+//   6355: group 0, "flag-name-6355"
+//   6356: group 0, "flag-name-6356"
+//   6357: group 0, "flag-name-6357"
+//   6358: group 0, "flag-name-6358"
+//   6359: group 0, "flag-name-6359"
+//   6360: group 0, "flag-name-6360"
+//   6361: group 0, "flag-name-6361"
+//   6362: group 0, "flag-name-6362"
+//   6363: group 0, "flag-name-6363"
+//   6364: group 0, "flag-name-6364"
+//   6365: group 0, "flag-name-6365"
+//   6366: group 0, "flag-name-6366"
+//   6367: group 0, "flag-name-6367"
+//   6368: group 0, "flag-name-6368"
+//   6369: group 0, "flag-name-6369"
+//   6370: group 0, "flag-name-6370"
+//   6371: group 0, "flag-name-6371"
+//   6372: group 0, "flag-name-6372"
+//   6373: group 0, "flag-name-6373"
+//   6374: group 0, "flag-name-6374"
+//   6375: group 0, "flag-name-6375"
+//   6376: group 0, "flag-name-6376"
+//   6377: group 0, "flag-name-6377"
+//   6378: group 0, "flag-name-6378"
+//   6379: group 0, "flag-name-6379"
+//   6380: group 0, "flag-name-6380"
+//   6381: group 0, "flag-name-6381"
+//   6382: group 0, "flag-name-6382"
+//   6383: group 0, "flag-name-6383"
+//   6384: group 0, "flag-name-6384"
+//   6385: group 0, "flag-name-6385"
+//   6386: group 0, "flag-name-6386"
+//   6387: group 0, "flag-name-6387"
+//   6388: group 0, "flag-name-6388"
+//   6389: group 0, "flag-name-6389"
+//   6390: group 0, "flag-name-6390"
+//   6391: group 0, "flag-name-6391"
+//   6392: group 0, "flag-name-6392"
+//   6393: group 0, "flag-name-6393"
+//   6394: group 0, "flag-name-6394"
+//   6395: group 0, "flag-name-6395"
+//   6396: group 0, "flag-name-6396"
+//   6397: group 0, "flag-name-6397"
+//   6398: group 0, "flag-name-6398"
+//   6399: group 0, "flag-name-6399"
+//   6400: group 0, "flag-name-6400"
+//   6401: group 0, "flag-name-6401"
+//   6402: group 0, "flag-name-6402"
+//   6403: group 0, "flag-name-6403"
+//   6404: group 0, "flag-name-6404"
+//   6405: group 0, "flag-name-6405"
+//   6406: group 0, "flag-name-6406"
+//   6407: group 0, "flag-name-6407"
+//   6408: group 0, "flag-name-6408"
+//   6409: group 0, "flag-name-6409"
+//   6410: group 0, "flag-name-6410"
+//   6411: group 0, "flag-name-6411"
+//   6412: group 0, "flag-name-6412"
+//   6413: group 0, "flag-name-6413"
+//   6414: group 0, "flag-name-6414"
+//   6415: group 0, "flag-name-6415"
+//   6416: group 0, "flag-name-6416"
+//   6417: group 0, "flag-name-6417"
+//   6418: group 0, "flag-name-6418"
+//   6419: group 0, "flag-name-6419"
+//   6420: group 0, "flag-name-6420"
+//   6421: group 0, "flag-name-6421"
+//   6422: group 0, "flag-name-6422"
+//   6423: group 0, "flag-name-6423"
+//   6424: group 0, "flag-name-6424"
+//   6425: group 0, "flag-name-6425"
+//   6426: group 0, "flag-name-6426"
+//   6427: group 0, "flag-name-6427"
+//   6428: group 0, "flag-name-6428"
+//   6429: group 0, "flag-name-6429"
+//   6430: group 0, "flag-name-6430"
+//   6431: group 0, "flag-name-6431"
+//   6432: group 0, "flag-name-6432"
+//   6433: group 0, "flag-name-6433"
+//   6434: group 0, "flag-name-6434"
+//   6435: group 0, "flag-name-6435"
+//   6436: group 0, "flag-name-6436"
+//   6437: group 0, "flag-name-6437"
+//   6438: group 0, "flag-name-6438"
+//   6439: group 0, "flag-name-6439"
+//   6440: group 0, "flag-name-6440"
+//   6441: group 0, "flag-name-6441"
+//   6442: group 0, "flag-name-6442"
+//   6443: group 0, "flag-name-6443"
+//   6444: group 0, "flag-name-6444"
+//   6445: group 0, "flag-name-6445"
+//   6446: group 0, "flag-name-6446"
+//   6447: group 0, "flag-name-6447"
+//   6448: group 0, "flag-name-6448"
+//   6449: group 0, "flag-name-6449"
+//   6450: group 0, "flag-name-6450"
+//   6451: group 0, "flag-name-6451"
+//   6452: group 0, "flag-name-6452"
+//   6453: group 0, "flag-name-6453"
+//   6454: group 0, "flag-name-6454"
+//   6455: group 0, "flag-name-6455"
+//   6456: group 0, "flag-name-6456"
+//   6457: group 0, "flag-name-6457"
+//   6458: group 0, "flag-name-6458"
+//   6459: group 0, "flag-name-6459"
+//   6460: group 0, "flag-name-6460"
+//   6461: group 0, "flag-name-6461"
+//   6462: group 0, "flag-name-6462"
+//   6463: group 0, "flag-name-6463"
+//   6464: group 0, "flag-name-6464"
+//   6465: group 0, "flag-name-6465"
+//   6466: group 0, "flag-name-6466"
+//   6467: group 0, "flag-name-6467"
+//   6468: group 0, "flag-name-6468"
+//   6469: group 0, "flag-name-6469"
+//   6470: group 0, "flag-name-6470"
+//   6471: group 0, "flag-name-6471"
+//   6472: group 0, "flag-name-6472"
+//   6473: group 0, "flag-name-6473"
+//   6474: group 0, "flag-name-6474"
+//   6475: group 0, "flag-name-6475"
+//   6476: group 0, "flag-name-6476"
+//   6477: group 0, "flag-name-6477"
+//   6478: group 0, "flag-name-6478"
+//   6479: group 0, "flag-name-6479"
+//   6480: group 0, "flag-name-6480"
+//   6481: group 0, "flag-name-6481"
+//   6482: group 0, "flag-name-6482"
+//   6483: group 0, "flag-name-6483"
+//   6484: group 0, "flag-name-6484"
+//   6485: group 0, "flag-name-6485"
+//   6486: group 0, "flag-name-6486"
+//   6487: group 0, "flag-name-6487"
+//   6488: group 0, "flag-name-6488"
+//   6489: group 0, "flag-name-6489"
+//   6490: group 0, "flag-name-6490"
+//   6491: group 0, "flag-name-6491"
+//   6492: group 0, "flag-name-6492"
+//   6493: group 0, "flag-name-6493"
+//   6494: group 0, "flag-name-6494"
+//   6495: group 0, "flag-name-6495"
+//   6496: group 0, "flag-name-6496"
+//   6497: group 0, "flag-name-6497"
+//   6498: group 0, "flag-name-6498"
+//   6499: group 0, "flag-name-6499"
+//   6500: group 0, "flag-name-6500"
+//   6501: group 0, "flag-name-6501"
+//   6502: group 0, "flag-name-6502"
+//   6503: group 0, "flag-name-6503"
+//   6504: group 0, "flag-name-6504"
+//   6505: group 0, "flag-name-6505"
+//   6506: group 0, "flag-name-6506"
+//   6507: group 0, "flag-name-6507"
+//   6508: group 0, "flag-name-6508"
+//   6509: group 0, "flag-name-6509"
+//   6510: group 0, "flag-name-6510"
+//   6511: group 0, "flag-name-6511"
+//   6512: group 0, "flag-name-6512"
+//   6513: group 0, "flag-name-6513"
+//   6514: group 0, "flag-name-6514"
+//   6515: group 0, "flag-name-6515"
+//   6516: group 0, "flag-name-6516"
+//   6517: group 0, "flag-name-6517"
+//   6518: group 0, "flag-name-6518"
+//   6519: group 0, "flag-name-6519"
+//   6520: group 0, "flag-name-6520"
+//   6521: group 0, "flag-name-6521"
+//   6522: group 0, "flag-name-6522"
+//   6523: group 0, "flag-name-6523"
+//   6524: group 0, "flag-name-6524"
+//   6525: group 0, "flag-name-6525"
+//   6526: group 0, "flag-name-6526"
+//   6527: group 0, "flag-name-6527"
+//   6528: group 0, "flag-name-6528"
+//   6529: group 0, "flag-name-6529"
+//   6530: group 0, "flag-name-6530"
+//   6531: group 0, "flag-name-6531"
+//   6532: group 0, "flag-name-6532"
+//   6533: group 0, "flag-name-6533"
+//   6534: group 0, "flag-name-6534"
+//   6535: group 0, "flag-name-6535"
+//   6536: group 0, "flag-name-6536"
+//   6537: group 0, "flag-name-6537"
+//   6538: group 0, "flag-name-6538"
+//   6539: group 0, "flag-name-6539"
+//   6540: group 0, "flag-name-6540"
+//   6541: group 0, "flag-name-6541"
+//   6542: group 0, "flag-name-6542"
+//   6543: group 0, "flag-name-6543"
+//   6544: group 0, "flag-name-6544"
+//   6545: group 0, "flag-name-6545"
+//   6546: group 0, "flag-name-6546"
+//   6547: group 0, "flag-name-6547"
+//   6548: group 0, "flag-name-6548"
+//   6549: group 0, "flag-name-6549"
+//   6550: group 0, "flag-name-6550"
+//   6551: group 0, "flag-name-6551"
+//   6552: group 0, "flag-name-6552"
+//   6553: group 0, "flag-name-6553"
+//   6554: group 0, "flag-name-6554"
+//   6555: group 0, "flag-name-6555"
+//   6556: group 0, "flag-name-6556"
+//   6557: group 0, "flag-name-6557"
+//   6558: group 0, "flag-name-6558"
+//   6559: group 0, "flag-name-6559"
+//   6560: group 0, "flag-name-6560"
+//   6561: group 0, "flag-name-6561"
+//   6562: group 0, "flag-name-6562"
+//   6563: group 0, "flag-name-6563"
+//   6564: group 0, "flag-name-6564"
+//   6565: group 0, "flag-name-6565"
+//   6566: group 0, "flag-name-6566"
+//   6567: group 0, "flag-name-6567"
+//   6568: group 0, "flag-name-6568"
+//   6569: group 0, "flag-name-6569"
+//   6570: group 0, "flag-name-6570"
+//   6571: group 0, "flag-name-6571"
+//   6572: group 0, "flag-name-6572"
+//   6573: group 0, "flag-name-6573"
+//   6574: group 0, "flag-name-6574"
+//   6575: group 0, "flag-name-6575"
+//   6576: group 0, "flag-name-6576"
+//   6577: group 0, "flag-name-6577"
+//   6578: group 0, "flag-name-6578"
+//   6579: group 0, "flag-name-6579"
+//   6580: group 0, "flag-name-6580"
+//   6581: group 0, "flag-name-6581"
+//   6582: group 0, "flag-name-6582"
+//   6583: group 0, "flag-name-6583"
+//   6584: group 0, "flag-name-6584"
+//   6585: group 0, "flag-name-6585"
+//   6586: group 0, "flag-name-6586"
+//   6587: group 0, "flag-name-6587"
+//   6588: group 0, "flag-name-6588"
+//   6589: group 0, "flag-name-6589"
+//   6590: group 0, "flag-name-6590"
+//   6591: group 0, "flag-name-6591"
+//   6592: group 0, "flag-name-6592"
+//   6593: group 0, "flag-name-6593"
+//   6594: group 0, "flag-name-6594"
+//   6595: group 0, "flag-name-6595"
+//   6596: group 0, "flag-name-6596"
+//   6597: group 0, "flag-name-6597"
+//   6598: group 0, "flag-name-6598"
+//   6599: group 0, "flag-name-6599"
+//   6600: group 0, "flag-name-6600"
+//   6601: group 0, "flag-name-6601"
+//   6602: group 0, "flag-name-6602"
+//   6603: group 0, "flag-name-6603"
+//   6604: group 0, "flag-name-6604"
+//   6605: group 0, "flag-name-6605"
+//   6606: group 0, "flag-name-6606"
+//   6607: group 0, "flag-name-6607"
+//   6608: group 0, "flag-name-6608"
+//   6609: group 0, "flag-name-6609"
+//   6610: group 0, "flag-name-6610"
+//   6611: group 0, "flag-name-6611"
+//   6612: group 0, "flag-name-6612"
+//   6613: group 0, "flag-name-6613"
+//   6614: group 0, "flag-name-6614"
+//   6615: group 0, "flag-name-6615"
+//   6616: group 0, "flag-name-6616"
+//   6617: group 0, "flag-name-6617"
+//   6618: group 0, "flag-name-6618"
+//   6619: group 0, "flag-name-6619"
+//   6620: group 0, "flag-name-6620"
+//   6621: group 0, "flag-name-6621"
+//   6622: group 0, "flag-name-6622"
+//   6623: group 0, "flag-name-6623"
+//   6624: group 0, "flag-name-6624"
+//   6625: group 0, "flag-name-6625"
+//   6626: group 0, "flag-name-6626"
+//   6627: group 0, "flag-name-6627"
+//   6628: group 0, "flag-name-6628"
+//   6629: group 0, "flag-name-6629"
+//   6630: group 0, "flag-name-6630"
+//   6631: group 0, "flag-name-6631"
+//   6632: group 0, "flag-name-6632"
+//   6633: group 0, "flag-name-6633"
+//   6634: group 0, "flag-name-6634"
+//   6635: group 0, "flag-name-6635"
+//   6636: group 0, "flag-name-6636"
+//   6637: group 0, "flag-name-6637"
+//   6638: group 0, "flag-name-6638"
+//   6639: group 0, "flag-name-6639"
+//   6640: group 0, "flag-name-6640"
+//   6641: group 0, "flag-name-6641"
+//   6642: group 0, "flag-name-6642"
+//   6643: group 0, "flag-name-6643"
+//   6644: group 0, "flag-name-6644"
+//   6645: group 0, "flag-name-6645"
+//   6646: group 0, "flag-name-6646"
+//   6647: group 0, "flag-name-6647"
+//   6648: group 0, "flag-name-6648"
+//   6649: group 0, "flag-name-6649"
+//   6650: group 0, "flag-name-6650"
+//   6651: group 0, "flag-name-6651"
+//   6652: group 0, "flag-name-6652"
+//   6653: group 0, "flag-name-6653"
+//   6654: group 0, "flag-name-6654"
+//   6655: group 0, "flag-name-6655"
+//   6656: group 0, "flag-name-6656"
+//   6657: group 0, "flag-name-6657"
+//   6658: group 0, "flag-name-6658"
+//   6659: group 0, "flag-name-6659"
+//   6660: group 0, "flag-name-6660"
+//   6661: group 0, "flag-name-6661"
+//   6662: group 0, "flag-name-6662"
+//   6663: group 0, "flag-name-6663"
+//   6664: group 0, "flag-name-6664"
+//   6665: group 0, "flag-name-6665"
+//   6666: group 0, "flag-name-6666"
+//   6667: group 0, "flag-name-6667"
+//   6668: group 0, "flag-name-6668"
+//   6669: group 0, "flag-name-6669"
+//   6670: group 0, "flag-name-6670"
+//   6671: group 0, "flag-name-6671"
+//   6672: group 0, "flag-name-6672"
+//   6673: group 0, "flag-name-6673"
+//   6674: group 0, "flag-name-6674"
+//   6675: group 0, "flag-name-6675"
+//   6676: group 0, "flag-name-6676"
+//   6677: group 0, "flag-name-6677"
+//   6678: group 0, "flag-name-6678"
+//   6679: group 0, "flag-name-6679"
+//   6680: group 0, "flag-name-6680"
+//   6681: group 0, "flag-name-6681"
+//   6682: group 0, "flag-name-6682"
+//   6683: group 0, "flag-name-6683"
+//   6684: group 0, "flag-name-6684"
+//   6685: group 0, "flag-name-6685"
+//   6686: group 0, "flag-name-6686"
+//   6687: group 0, "flag-name-6687"
+//   6688: group 0, "flag-name-6688"
+//   6689: group 0, "flag-name-6689"
+//   6690: group 0, "flag-name-6690"
+//   6691: group 0, "flag-name-6691"
+//   6692: group 0, "flag-name-6692"
+//   6693: group 0, "flag-name-6693"
+//   6694: group 0, "flag-name-6694"
+//   6695: group 0, "flag-name-6695"
+//   6696: group 0, "flag-name-6696"
+//   6697: group 0, "flag-name-6697"
+//   6698: group 0, "flag-name-6698"
+//   6699: group 0, "flag-name-6699"
+//   6700: group 0, "flag-name-6700"
+//   6701: group 0, "flag-name-6701"
+//   6702: group 0, "flag-name-6702"
+//   6703: group 0, "flag-name-6703"
+//   6704: group 0, "flag-name-6704"
+//   6705: group 0, "flag-name-6705"
+//   6706: group 0, "flag-name-6706"
+//   6707: group 0, "flag-name-6707"
+//   6708: group 0, "flag-name-6708"
+//   6709: group 0, "flag-name-6709"
+//   6710: group 0, "flag-name-6710"
+//   6711: group 0, "flag-name-6711"
+//   6712: group 0, "flag-name-6712"
+//   6713: group 0, "flag-name-6713"
+//   6714: group 0, "flag-name-6714"
+//   6715: group 0, "flag-name-6715"
+//   6716: group 0, "flag-name-6716"
+//   6717: group 0, "flag-name-6717"
+//   6718: group 0, "flag-name-6718"
+//   6719: group 0, "flag-name-6719"
+//   6720: group 0, "flag-name-6720"
+//   6721: group 0, "flag-name-6721"
+//   6722: group 0, "flag-name-6722"
+//   6723: group 0, "flag-name-6723"
+//   6724: group 0, "flag-name-6724"
+//   6725: group 0, "flag-name-6725"
+//   6726: group 0, "flag-name-6726"
+//   6727: group 0, "flag-name-6727"
+//   6728: group 0, "flag-name-6728"
+//   6729: group 0, "flag-name-6729"
+//   6730: group 0, "flag-name-6730"
+//   6731: group 0, "flag-name-6731"
+//   6732: group 0, "flag-name-6732"
+//   6733: group 0, "flag-name-6733"
+//   6734: group 0, "flag-name-6734"
+//   6735: group 0, "flag-name-6735"
+//   6736: group 0, "flag-name-6736"
+//   6737: group 0, "flag-name-6737"
+//   6738: group 0, "flag-name-6738"
+//   6739: group 0, "flag-name-6739"
+//   6740: group 0, "flag-name-6740"
+//   6741: group 0, "flag-name-6741"
+//   6742: group 0, "flag-name-6742"
+//   6743: group 0, "flag-name-6743"
+//   6744: group 0, "flag-name-6744"
+//   6745: group 0, "flag-name-6745"
+//   6746: group 0, "flag-name-6746"
+//   6747: group 0, "flag-name-6747"
+//   6748: group 0, "flag-name-6748"
+//   6749: group 0, "flag-name-6749"
+//   6750: group 0, "flag-name-6750"
+//   6751: group 0, "flag-name-6751"
+//   6752: group 0, "flag-name-6752"
+//   6753: group 0, "flag-name-6753"
+//   6754: group 0, "flag-name-6754"
+//   6755: group 0, "flag-name-6755"
+//   6756: group 0, "flag-name-6756"
+//   6757: group 0, "flag-name-6757"
+//   6758: group 0, "flag-name-6758"
+//   6759: group 0, "flag-name-6759"
+//   6760: group 0, "flag-name-6760"
+//   6761: group 0, "flag-name-6761"
+//   6762: group 0, "flag-name-6762"
+//   6763: group 0, "flag-name-6763"
+//   6764: group 0, "flag-name-6764"
+//   6765: group 0, "flag-name-6765"
+//   6766: group 0, "flag-name-6766"
+//   6767: group 0, "flag-name-6767"
+//   6768: group 0, "flag-name-6768"
+//   6769: group 0, "flag-name-6769"
+//   6770: group 0, "flag-name-6770"
+//   6771: group 0, "flag-name-6771"
+//   6772: group 0, "flag-name-6772"
+//   6773: group 0, "flag-name-6773"
+//   6774: group 0, "flag-name-6774"
+//   6775: group 0, "flag-name-6775"
+//   6776: group 0, "flag-name-6776"
+//   6777: group 0, "flag-name-6777"
+//   6778: group 0, "flag-name-6778"
+//   6779: group 0, "flag-name-6779"
+//   6780: group 0, "flag-name-6780"
+//   6781: group 0, "flag-name-6781"
+//   6782: group 0, "flag-name-6782"
+//   6783: group 0, "flag-name-6783"
+//   6784: group 0, "flag-name-6784"
+//   6785: group 0, "flag-name-6785"
+//   6786: group 0, "flag-name-6786"
+//   6787: group 0, "flag-name-6787"
+//   6788: group 0, "flag-name-6788"
+//   6789: group 0, "flag-name-6789"
+//   6790: group 0, "flag-name-6790"
+//   6791: group 0, "flag-name-6791"
+//   6792: group 0, "flag-name-6792"
+//   6793: group 0, "flag-name-6793"
+//   6794: group 0, "flag-name-6794"
+//   6795: group 0, "flag-name-6795"
+//   6796: group 0, "flag-name-6796"
+//   6797: group 0, "flag-name-6797"
+//   6798: group 0, "flag-name-6798"
+//   6799: group 0, "flag-name-6799"
+//   6800: group 0, "flag-name-6800"
+//   6801: group 0, "flag-name-6801"
+//   6802: group 0, "flag-name-6802"
+//   6803: group 0, "flag-name-6803"
+//   6804: group 0, "flag-name-6804"
+//   6805: group 0, "flag-name-6805"
+//   6806: group 0, "flag-name-6806"
+//   6807: group 0, "flag-name-6807"
+//   6808: group 0, "flag-name-6808"
+//   6809: group 0, "flag-name-6809"
+//   6810: group 0, "flag-name-6810"
+//   6811: group 0, "flag-name-6811"
+//   6812: group 0, "flag-name-6812"
+//   6813: group 0, "flag-name-6813"
+//   6814: group 0, "flag-name-6814"
+//   6815: group 0, "flag-name-6815"
+//   6816: group 0, "flag-name-6816"
+//   6817: group 0, "flag-name-6817"
+//   6818: group 0, "flag-name-6818"
+//   6819: group 0, "flag-name-6819"
+//   6820: group 0, "flag-name-6820"
+//   6821: group 0, "flag-name-6821"
+//   6822: group 0, "flag-name-6822"
+//   6823: group 0, "flag-name-6823"
+//   6824: group 0, "flag-name-6824"
+//   6825: group 0, "flag-name-6825"
+//   6826: group 0, "flag-name-6826"
+//   6827: group 0, "flag-name-6827"
+//   6828: group 0, "flag-name-6828"
+//   6829: group 0, "flag-name-6829"
+//   6830: group 0, "flag-name-6830"
+//   6831: group 0, "flag-name-6831"
+//   6832: group 0, "flag-name-6832"
+//   6833: group 0, "flag-name-6833"
+//   6834: group 0, "flag-name-6834"
+//   6835: group 0, "flag-name-6835"
+//   6836: group 0, "flag-name-6836"
+//   6837: group 0, "flag-name-6837"
+//   6838: group 0, "flag-name-6838"
+//   6839: group 0, "flag-name-6839"
+//   6840: group 0, "flag-name-6840"
+//   6841: group 0, "flag-name-6841"
+//   6842: group 0, "flag-name-6842"
+//   6843: group 0, "flag-name-6843"
+//   6844: group 0, "flag-name-6844"
+//   6845: group 0, "flag-name-6845"
+//   6846: group 0, "flag-name-6846"
+//   6847: group 0, "flag-name-6847"
+//   6848: group 0, "flag-name-6848"
+//   6849: group 0, "flag-name-6849"
+//   6850: group 0, "flag-name-6850"
+//   6851: group 0, "flag-name-6851"
+//   6852: group 0, "flag-name-6852"
+//   6853: group 0, "flag-name-6853"
+//   6854: group 0, "flag-name-6854"
+//   6855: group 0, "flag-name-6855"
+//   6856: group 0, "flag-name-6856"
+//   6857: group 0, "flag-name-6857"
+//   6858: group 0, "flag-name-6858"
+//   6859: group 0, "flag-name-6859"
+//   6860: group 0, "flag-name-6860"
+//   6861: group 0, "flag-name-6861"
+//   6862: group 0, "flag-name-6862"
+//   6863: group 0, "flag-name-6863"
+//   6864: group 0, "flag-name-6864"
+//   6865: group 0, "flag-name-6865"
+//   6866: group 0, "flag-name-6866"
+//   6867: group 0, "flag-name-6867"
+//   6868: group 0, "flag-name-6868"
+//   6869: group 0, "flag-name-6869"
+//   6870: group 0, "flag-name-6870"
+//   6871: group 0, "flag-name-6871"
+//   6872: group 0, "flag-name-6872"
+//   6873: group 0, "flag-name-6873"
+//   6874: group 0, "flag-name-6874"
+//   6875: group 0, "flag-name-6875"
+//   6876: group 0, "flag-name-6876"
+//   6877: group 0, "flag-name-6877"
+//   6878: group 0, "flag-name-6878"
+//   6879: group 0, "flag-name-6879"
+//   6880: group 0, "flag-name-6880"
+//   6881: group 0, "flag-name-6881"
+//   6882: group 0, "flag-name-6882"
+//   6883: group 0, "flag-name-6883"
+//   6884: group 0, "flag-name-6884"
+//   6885: group 0, "flag-name-6885"
+//   6886: group 0, "flag-name-6886"
+//   6887: group 0, "flag-name-6887"
+//   6888: group 0, "flag-name-6888"
+//   6889: group 0, "flag-name-6889"
+//   6890: group 0, "flag-name-6890"
+//   6891: group 0, "flag-name-6891"
+//   6892: group 0, "flag-name-6892"
+//   6893: group 0, "flag-name-6893"
+//   6894: group 0, "flag-name-6894"
+//   6895: group 0, "flag-name-6895"
+//   6896: group 0, "flag-name-6896"
+//   6897: group 0, "flag-name-6897"
+//   6898: group 0, "flag-name-6898"
+//   6899: group 0, "flag-name-6899"
+//   6900: group 0, "flag-name-6900"
+//   6901: group 0, "flag-name-6901"
+//   6902: group 0, "flag-name-6902"
+//   6903: group 0, "flag-name-6903"
+//   6904: group 0, "flag-name-6904"
+//   6905: group 0, "flag-name-6905"
+//   6906: group 0, "flag-name-6906"
+//   6907: group 0, "flag-name-6907"
+//   6908: group 0, "flag-name-6908"
+//   6909: group 0, "flag-name-6909"
+//   6910: group 0, "flag-name-6910"
+//   6911: group 0, "flag-name-6911"
+//   6912: group 0, "flag-name-6912"
+//   6913: group 0, "flag-name-6913"
+//   6914: group 0, "flag-name-6914"
+//   6915: group 0, "flag-name-6915"
+//   6916: group 0, "flag-name-6916"
+//   6917: group 0, "flag-name-6917"
+//   6918: group 0, "flag-name-6918"
+//   6919: group 0, "flag-name-6919"
+//   6920: group 0, "flag-name-6920"
+//   6921: group 0, "flag-name-6921"
+//   6922: group 0, "flag-name-6922"
+//   6923: group 0, "flag-name-6923"
+//   6924: group 0, "flag-name-6924"
+//   6925: group 0, "flag-name-6925"
+//   6926: group 0, "flag-name-6926"
+//   6927: group 0, "flag-name-6927"
+//   6928: group 0, "flag-name-6928"
+//   6929: group 0, "flag-name-6929"
+//   6930: group 0, "flag-name-6930"
+//   6931: group 0, "flag-name-6931"
+//   6932: group 0, "flag-name-6932"
+//   6933: group 0, "flag-name-6933"
+//   6934: group 0, "flag-name-6934"
+//   6935: group 0, "flag-name-6935"
+//   6936: group 0, "flag-name-6936"
+//   6937: group 0, "flag-name-6937"
+//   6938: group 0, "flag-name-6938"
+//   6939: group 0, "flag-name-6939"
+//   6940: group 0, "flag-name-6940"
+//   6941: group 0, "flag-name-6941"
+//   6942: group 0, "flag-name-6942"
+//   6943: group 0, "flag-name-6943"
+//   6944: group 0, "flag-name-6944"
+//   6945: group 0, "flag-name-6945"
+//   6946: group 0, "flag-name-6946"
+//   6947: group 0, "flag-name-6947"
+//   6948: group 0, "flag-name-6948"
+//   6949: group 0, "flag-name-6949"
+//   6950: group 0, "flag-name-6950"
+//   6951: group 0, "flag-name-6951"
+//   6952: group 0, "flag-name-6952"
+//   6953: group 0, "flag-name-6953"
+//   6954: group 0, "flag-name-6954"
+//   6955: group 0, "flag-name-6955"
+//   6956: group 0, "flag-name-6956"
+//   6957: group 0, "flag-name-6957"
+//   6958: group 0, "flag-name-6958"
+//   6959: group 0, "flag-name-6959"
+//   6960: group 0, "flag-name-6960"
+//   6961: group 0, "flag-name-6961"
+//   6962: group 0, "flag-name-6962"
+//   6963: group 0, "flag-name-6963"
+//   6964: group 0, "flag-name-6964"
+//   6965: group 0, "flag-name-6965"
+//   6966: group 0, "flag-name-6966"
+//   6967: group 0, "flag-name-6967"
+//   6968: group 0, "flag-name-6968"
+//   6969: group 0, "flag-name-6969"
+//   6970: group 0, "flag-name-6970"
+//   6971: group 0, "flag-name-6971"
+//   6972: group 0, "flag-name-6972"
+//   6973: group 0, "flag-name-6973"
+//   6974: group 0, "flag-name-6974"
+//   6975: group 0, "flag-name-6975"
+//   6976: group 0, "flag-name-6976"
+//   6977: group 0, "flag-name-6977"
+//   6978: group 0, "flag-name-6978"
+//   6979: group 0, "flag-name-6979"
+//   6980: group 0, "flag-name-6980"
+//   6981: group 0, "flag-name-6981"
+//   6982: group 0, "flag-name-6982"
+//   6983: group 0, "flag-name-6983"
+//   6984: group 0, "flag-name-6984"
+//   6985: group 0, "flag-name-6985"
+//   6986: group 0, "flag-name-6986"
+//   6987: group 0, "flag-name-6987"
+//   6988: group 0, "flag-name-6988"
+//   6989: group 0, "flag-name-6989"
+//   6990: group 0, "flag-name-6990"
+//   6991: group 0, "flag-name-6991"
+//   6992: group 0, "flag-name-6992"
+//   6993: group 0, "flag-name-6993"
+//   6994: group 0, "flag-name-6994"
+//   6995: group 0, "flag-name-6995"
+//   6996: group 0, "flag-name-6996"
+//   6997: group 0, "flag-name-6997"
+//   6998: group 0, "flag-name-6998"
+//   6999: group 0, "flag-name-6999"
+//   7000: group 0, "flag-name-7000"
+//   7001: group 0, "flag-name-7001"
+//   7002: group 0, "flag-name-7002"
+//   7003: group 0, "flag-name-7003"
+//   7004: group 0, "flag-name-7004"
+//   7005: group 0, "flag-name-7005"
+//   7006: group 0, "flag-name-7006"
+//   7007: group 0, "flag-name-7007"
+//   7008: group 0, "flag-name-7008"
+//   7009: group 0, "flag-name-7009"
+//   7010: group 0, "flag-name-7010"
+//   7011: group 0, "flag-name-7011"
+//   7012: group 0, "flag-name-7012"
+//   7013: group 0, "flag-name-7013"
+//   7014: group 0, "flag-name-7014"
+//   7015: group 0, "flag-name-7015"
+//   7016: group 0, "flag-name-7016"
+//   7017: group 0, "flag-name-7017"
+//   7018: group 0, "flag-name-7018"
+//   7019: group 0, "flag-name-7019"
+//   7020: group 0, "flag-name-7020"
+//   7021: group 0, "flag-name-7021"
+//   7022: group 0, "flag-name-7022"
+//   7023: group 0, "flag-name-7023"
+//   7024: group 0, "flag-name-7024"
+//   7025: group 0, "flag-name-7025"
+//   7026: group 0, "flag-name-7026"
+//   7027: group 0, "flag-name-7027"
+//   7028: group 0, "flag-name-7028"
+//   7029: group 0, "flag-name-7029"
+//   7030: group 0, "flag-name-7030"
+//   7031: group 0, "flag-name-7031"
+//   7032: group 0, "flag-name-7032"
+//   7033: group 0, "flag-name-7033"
+//   7034: group 0, "flag-name-7034"
+//   7035: group 0, "flag-name-7035"
+//   7036: group 0, "flag-name-7036"
+//   7037: group 0, "flag-name-7037"
+//   7038: group 0, "flag-name-7038"
+//   7039: group 0, "flag-name-7039"
+//   7040: group 0, "flag-name-7040"
+//   7041: group 0, "flag-name-7041"
+//   7042: group 0, "flag-name-7042"
+//   7043: group 0, "flag-name-7043"
+//   7044: group 0, "flag-name-7044"
+//   7045: group 0, "flag-name-7045"
+//   7046: group 0, "flag-name-7046"
+//   7047: group 0, "flag-name-7047"
+//   7048: group 0, "flag-name-7048"
+//   7049: group 0, "flag-name-7049"
+//   7050: group 0, "flag-name-7050"
+//   7051: group 0, "flag-name-7051"
+//   7052: group 0, "flag-name-7052"
+//   7053: group 0, "flag-name-7053"
+//   7054: group 0, "flag-name-7054"
+//   7055: group 0, "flag-name-7055"
+//   7056: group 0, "flag-name-7056"
+//   7057: group 0, "flag-name-7057"
+//   7058: group 0, "flag-name-7058"
+//   7059: group 0, "flag-name-7059"
+//   7060: group 0, "flag-name-7060"
+//   7061: group 0, "flag-name-7061"
+//   7062: group 0, "flag-name-7062"
+//   7063: group 0, "flag-name-7063"
+//   7064: group 0, "flag-name-7064"
+//   7065: group 0, "flag-name-7065"
+//   7066: group 0, "flag-name-7066"
+//   7067: group 0, "flag-name-7067"
+//   7068: group 0, "flag-name-7068"
+//   7069: group 0, "flag-name-7069"
+//   7070: group 0, "flag-name-7070"
+//   7071: group 0, "flag-name-7071"
+//   7072: group 0, "flag-name-7072"
+//   7073: group 0, "flag-name-7073"
+//   7074: group 0, "flag-name-7074"
+//   7075: group 0, "flag-name-7075"
+//   7076: group 0, "flag-name-7076"
+//   7077: group 0, "flag-name-7077"
+//   7078: group 0, "flag-name-7078"
+//   7079: group 0, "flag-name-7079"
+//   7080: group 0, "flag-name-7080"
+//   7081: group 0, "flag-name-7081"
+//   7082: group 0, "flag-name-7082"
+//   7083: group 0, "flag-name-7083"
+//   7084: group 0, "flag-name-7084"
+//   7085: group 0, "flag-name-7085"
+//   7086: group 0, "flag-name-7086"
+//   7087: group 0, "flag-name-7087"
+//   7088: group 0, "flag-name-7088"
+//   7089: group 0, "flag-name-7089"
+//   7090: group 0, "flag-name-7090"
+//   7091: group 0, "flag-name-7091"
+//   7092: group 0, "flag-name-7092"
+//   7093: group 0, "flag-name-7093"
+//   7094: group 0, "flag-name-7094"
+//   7095: group 0, "flag-name-7095"
+//   7096: group 0, "flag-name-7096"
+//   7097: group 0, "flag-name-7097"
+//   7098: group 0, "flag-name-7098"
+//   7099: group 0, "flag-name-7099"
+//   7100: group 0, "flag-name-7100"
+//   7101: group 0, "flag-name-7101"
+//   7102: group 0, "flag-name-7102"
+//   7103: group 0, "flag-name-7103"
+//   7104: group 0, "flag-name-7104"
+//   7105: group 0, "flag-name-7105"
+//   7106: group 0, "flag-name-7106"
+//   7107: group 0, "flag-name-7107"
+//   7108: group 0, "flag-name-7108"
+//   7109: group 0, "flag-name-7109"
+//   7110: group 0, "flag-name-7110"
+//   7111: group 0, "flag-name-7111"
+//   7112: group 0, "flag-name-7112"
+//   7113: group 0, "flag-name-7113"
+//   7114: group 0, "flag-name-7114"
+//   7115: group 0, "flag-name-7115"
+//   7116: group 0, "flag-name-7116"
+//   7117: group 0, "flag-name-7117"
+//   7118: group 0, "flag-name-7118"
+//   7119: group 0, "flag-name-7119"
+//   7120: group 0, "flag-name-7120"
+//   7121: group 0, "flag-name-7121"
+//   7122: group 0, "flag-name-7122"
+//   7123: group 0, "flag-name-7123"
+//   7124: group 0, "flag-name-7124"
+//   7125: group 0, "flag-name-7125"
+//   7126: group 0, "flag-name-7126"
+//   7127: group 0, "flag-name-7127"
+//   7128: group 0, "flag-name-7128"
+//   7129: group 0, "flag-name-7129"
+//   7130: group 0, "flag-name-7130"
+//   7131: group 0, "flag-name-7131"
+//   7132: group 0, "flag-name-7132"
+//   7133: group 0, "flag-name-7133"
+//   7134: group 0, "flag-name-7134"
+//   7135: group 0, "flag-name-7135"
+//   7136: group 0, "flag-name-7136"
+//   7137: group 0, "flag-name-7137"
+//   7138: group 0, "flag-name-7138"
+//   7139: group 0, "flag-name-7139"
+//   7140: group 0, "flag-name-7140"
+//   7141: group 0, "flag-name-7141"
+//   7142: group 0, "flag-name-7142"
+//   7143: group 0, "flag-name-7143"
+//   7144: group 0, "flag-name-7144"
+//   7145: group 0, "flag-name-7145"
+//   7146: group 0, "flag-name-7146"
+//   7147: group 0, "flag-name-7147"
+//   7148: group 0, "flag-name-7148"
+//   7149: group 0, "flag-name-7149"
+//   7150: group 0, "flag-name-7150"
+//   7151: group 0, "flag-name-7151"
+//   7152: group 0, "flag-name-7152"
+//   7153: group 0, "flag-name-7153"
+//   7154: group 0, "flag-name-7154"
+//   7155: group 0, "flag-name-7155"
+//   7156: group 0, "flag-name-7156"
+//   7157: group 0, "flag-name-7157"
+//   7158: group 0, "flag-name-7158"
+//   7159: group 0, "flag-name-7159"
+//   7160: group 0, "flag-name-7160"
+//   7161: group 0, "flag-name-7161"
+//   7162: group 0, "flag-name-7162"
+//   7163: group 0, "flag-name-7163"
+//   7164: group 0, "flag-name-7164"
+//   7165: group 0, "flag-name-7165"
+//   7166: group 0, "flag-name-7166"
+//   7167: group 0, "flag-name-7167"
+//   7168: group 0, "flag-name-7168"
+//   7169: group 0, "flag-name-7169"
+//   7170: group 0, "flag-name-7170"
+//   7171: group 0, "flag-name-7171"
+//   7172: group 0, "flag-name-7172"
+//   7173: group 0, "flag-name-7173"
+//   7174: group 0, "flag-name-7174"
+//   7175: group 0, "flag-name-7175"
+//   7176: group 0, "flag-name-7176"
+//   7177: group 0, "flag-name-7177"
+//   7178: group 0, "flag-name-7178"
+//   7179: group 0, "flag-name-7179"
+//   7180: group 0, "flag-name-7180"
+//   7181: group 0, "flag-name-7181"
+//   7182: group 0, "flag-name-7182"
+//   7183: group 0, "flag-name-7183"
+//   7184: group 0, "flag-name-7184"
+//   7185: group 0, "flag-name-7185"
+//   7186: group 0, "flag-name-7186"
+//   7187: group 0, "flag-name-7187"
+//   7188: group 0, "flag-name-7188"
+//   7189: group 0, "flag-name-7189"
+//   7190: group 0, "flag-name-7190"
+//   7191: group 0, "flag-name-7191"
+//   7192: group 0, "flag-name-7192"
+//   7193: group 0, "flag-name-7193"
+//   7194: group 0, "flag-name-7194"
+//   7195: group 0, "flag-name-7195"
+//   7196: group 0, "flag-name-7196"
+//   7197: group 0, "flag-name-7197"
+//   7198: group 0, "flag-name-7198"
+//   7199: group 0, "flag-name-7199"
+//   7200: group 0, "flag-name-7200"
+//   7201: group 0, "flag-name-7201"
+//   7202: group 0, "flag-name-7202"
+//   7203: group 0, "flag-name-7203"
+//   7204: group 0, "flag-name-7204"
+//   7205: group 0, "flag-name-7205"
+//   7206: group 0, "flag-name-7206"
+//   7207: group 0, "flag-name-7207"
+//   7208: group 0, "flag-name-7208"
+//   7209: group 0, "flag-name-7209"
+//   7210: group 0, "flag-name-7210"
+//   7211: group 0, "flag-name-7211"
+//   7212: group 0, "flag-name-7212"
+//   7213: group 0, "flag-name-7213"
+//   7214: group 0, "flag-name-7214"
+//   7215: group 0, "flag-name-7215"
+//   7216: group 0, "flag-name-7216"
+//   7217: group 0, "flag-name-7217"
+//   7218: group 0, "flag-name-7218"
+//   7219: group 0, "flag-name-7219"
+//   7220: group 0, "flag-name-7220"
+//   7221: group 0, "flag-name-7221"
+//   7222: group 0, "flag-name-7222"
+//   7223: group 0, "flag-name-7223"
+//   7224: group 0, "flag-name-7224"
+//   7225: group 0, "flag-name-7225"
+//   7226: group 0, "flag-name-7226"
+//   7227: group 0, "flag-name-7227"
+//   7228: group 0, "flag-name-7228"
+//   7229: group 0, "flag-name-7229"
+//   7230: group 0, "flag-name-7230"
+//   7231: group 0, "flag-name-7231"
+//   7232: group 0, "flag-name-7232"
+//   7233: group 0, "flag-name-7233"
+//   7234: group 0, "flag-name-7234"
+//   7235: group 0, "flag-name-7235"
+//   7236: group 0, "flag-name-7236"
+//   7237: group 0, "flag-name-7237"
+//   7238: group 0, "flag-name-7238"
+//   7239: group 0, "flag-name-7239"
+//   7240: group 0, "flag-name-7240"
+//   7241: group 0, "flag-name-7241"
+//   7242: group 0, "flag-name-7242"
+//   7243: group 0, "flag-name-7243"
+//   7244: group 0, "flag-name-7244"
+//   7245: group 0, "flag-name-7245"
+//   7246: group 0, "flag-name-7246"
+//   7247: group 0, "flag-name-7247"
+//   7248: group 0, "flag-name-7248"
+//   7249: group 0, "flag-name-7249"
+//   7250: group 0, "flag-name-7250"
+//   7251: group 0, "flag-name-7251"
+//   7252: group 0, "flag-name-7252"
+//   7253: group 0, "flag-name-7253"
+//   7254: group 0, "flag-name-7254"
+//   7255: group 0, "flag-name-7255"
+//   7256: group 0, "flag-name-7256"
+//   7257: group 0, "flag-name-7257"
+//   7258: group 0, "flag-name-7258"
+//   7259: group 0, "flag-name-7259"
+//   7260: group 0, "flag-name-7260"
+//   7261: group 0, "flag-name-7261"
+//   7262: group 0, "flag-name-7262"
+//   7263: group 0, "flag-name-7263"
+//   7264: group 0, "flag-name-7264"
+//   7265: group 0, "flag-name-7265"
+//   7266: group 0, "flag-name-7266"
+//   7267: group 0, "flag-name-7267"
+//   7268: group 0, "flag-name-7268"
+//   7269: group 0, "flag-name-7269"
+//   7270: group 0, "flag-name-7270"
+//   7271: group 0, "flag-name-7271"
+//   7272: group 0, "flag-name-7272"
+//   7273: group 0, "flag-name-7273"
+//   7274: group 0, "flag-name-7274"
+//   7275: group 0, "flag-name-7275"
+//   7276: group 0, "flag-name-7276"
+//   7277: group 0, "flag-name-7277"
+//   7278: group 0, "flag-name-7278"
+//   7279: group 0, "flag-name-7279"
+//   7280: group 0, "flag-name-7280"
+//   7281: group 0, "flag-name-7281"
+//   7282: group 0, "flag-name-7282"
+//   7283: group 0, "flag-name-7283"
+//   7284: group 0, "flag-name-7284"
+//   7285: group 0, "flag-name-7285"
+//   7286: group 0, "flag-name-7286"
+//   7287: group 0, "flag-name-7287"
+//   7288: group 0, "flag-name-7288"
+//   7289: group 0, "flag-name-7289"
+//   7290: group 0, "flag-name-7290"
+//   7291: group 0, "flag-name-7291"
+//   7292: group 0, "flag-name-7292"
+//   7293: group 0, "flag-name-7293"
+//   7294: group 0, "flag-name-7294"
+//   7295: group 0, "flag-name-7295"
+//   7296: group 0, "flag-name-7296"
+//   7297: group 0, "flag-name-7297"
+//   7298: group 0, "flag-name-7298"
+//   7299: group 0, "flag-name-7299"
+//   7300: group 0, "flag-name-7300"
+//   7301: group 0, "flag-name-7301"
+//   7302: group 0, "flag-name-7302"
+//   7303: group 0, "flag-name-7303"
+//   7304: group 0, "flag-name-7304"
+//   7305: group 0, "flag-name-7305"
+//   7306: group 0, "flag-name-7306"
+//   7307: group 0, "flag-name-7307"
+//   7308: group 0, "flag-name-7308"
+//   7309: group 0, "flag-name-7309"
+//   7310: group 0, "flag-name-7310"
+//   7311: group 0, "flag-name-7311"
+//   7312: group 0, "flag-name-7312"
+//   7313: group 0, "flag-name-7313"
+//   7314: group 0, "flag-name-7314"
+//   7315: group 0, "flag-name-7315"
+//   7316: group 0, "flag-name-7316"
+//   7317: group 0, "flag-name-7317"
+//   7318: group 0, "flag-name-7318"
+//   7319: group 0, "flag-name-7319"
+//   7320: group 0, "flag-name-7320"
+//   7321: group 0, "flag-name-7321"
+//   7322: group 0, "flag-name-7322"
+//   7323: group 0, "flag-name-7323"
+//   7324: group 0, "flag-name-7324"
+//   7325: group 0, "flag-name-7325"
+//   7326: group 0, "flag-name-7326"
+//   7327: group 0, "flag-name-7327"
+//   7328: group 0, "flag-name-7328"
+//   7329: group 0, "flag-name-7329"
+//   7330: group 0, "flag-name-7330"
+//   7331: group 0, "flag-name-7331"
+//   7332: group 0, "flag-name-7332"
+//   7333: group 0, "flag-name-7333"
+//   7334: group 0, "flag-name-7334"
+//   7335: group 0, "flag-name-7335"
+//   7336: group 0, "flag-name-7336"
+//   7337: group 0, "flag-name-7337"
+//   7338: group 0, "flag-name-7338"
+//   7339: group 0, "flag-name-7339"
+//   7340: group 0, "flag-name-7340"
+//   7341: group 0, "flag-name-7341"
+//   7342: group 0, "flag-name-7342"
+//   7343: group 0, "flag-name-7343"
+//   7344: group 0, "flag-name-7344"
+//   7345: group 0, "flag-name-7345"
+//   7346: group 0, "flag-name-7346"
+//   7347: group 0, "flag-name-7347"
+//   7348: group 0, "flag-name-7348"
+//   7349: group 0, "flag-name-7349"
+//   7350: group 0, "flag-name-7350"
+//   7351: group 0, "flag-name-7351"
+//   7352: group 0, "flag-name-7352"
+//   7353: group 0, "flag-name-7353"
+//   7354: group 0, "flag-name-7354"
+//   7355: group 0, "flag-name-7355"
+//   7356: group 0, "flag-name-7356"
+//   7357: group 0, "flag-name-7357"
+//   7358: group 0, "flag-name-7358"
+//   7359: group 0, "flag-name-7359"
+//   7360: group 0, "flag-name-7360"
+//   7361: group 0, "flag-name-7361"
+//   7362: group 0, "flag-name-7362"
+//   7363: group 0, "flag-name-7363"
+//   7364: group 0, "flag-name-7364"
+//   7365: group 0, "flag-name-7365"
+//   7366: group 0, "flag-name-7366"
+//   7367: group 0, "flag-name-7367"
+//   7368: group 0, "flag-name-7368"
+//   7369: group 0, "flag-name-7369"
+//   7370: group 0, "flag-name-7370"
+//   7371: group 0, "flag-name-7371"
+//   7372: group 0, "flag-name-7372"
+//   7373: group 0, "flag-name-7373"
+//   7374: group 0, "flag-name-7374"
+//   7375: group 0, "flag-name-7375"
+//   7376: group 0, "flag-name-7376"
+//   7377: group 0, "flag-name-7377"
+//   7378: group 0, "flag-name-7378"
+//   7379: group 0, "flag-name-7379"
+//   7380: group 0, "flag-name-7380"
+//   7381: group 0, "flag-name-7381"
+//   7382: group 0, "flag-name-7382"
+//   7383: group 0, "flag-name-7383"
+//   7384: group 0, "flag-name-7384"
+//   7385: group 0, "flag-name-7385"
+//   7386: group 0, "flag-name-7386"
+//   7387: group 0, "flag-name-7387"
+//   7388: group 0, "flag-name-7388"
+//   7389: group 0, "flag-name-7389"
+//   7390: group 0, "flag-name-7390"
+//   7391: group 0, "flag-name-7391"
+//   7392: group 0, "flag-name-7392"
+//   7393: group 0, "flag-name-7393"
+//   7394: group 0, "flag-name-7394"
+//   7395: group 0, "flag-name-7395"
+//   7396: group 0, "flag-name-7396"
+//   7397: group 0, "flag-name-7397"
+//   7398: group 0, "flag-name-7398"
+//   7399: group 0, "flag-name-7399"
+//   7400: group 0, "flag-name-7400"
+//   7401: group 0, "flag-name-7401"
+//   7402: group 0, "flag-name-7402"
+//   7403: group 0, "flag-name-7403"
+//   7404: group 0, "flag-name-7404"
+//   7405: group 0, "flag-name-7405"
+//   7406: group 0, "flag-name-7406"
+//   7407: group 0, "flag-name-7407"
+//   7408: group 0, "flag-name-7408"
+//   7409: group 0, "flag-name-7409"
+//   7410: group 0, "flag-name-7410"
+//   7411: group 0, "flag-name-7411"
+//   7412: group 0, "flag-name-7412"
+//   7413: group 0, "flag-name-7413"
+//   7414: group 0, "flag-name-7414"
+//   7415: group 0, "flag-name-7415"
+//   7416: group 0, "flag-name-7416"
+//   7417: group 0, "flag-name-7417"
+//   7418: group 0, "flag-name-7418"
+//   7419: group 0, "flag-name-7419"
+//   7420: group 0, "flag-name-7420"
+//   7421: group 0, "flag-name-7421"
+//   7422: group 0, "flag-name-7422"
+//   7423: group 0, "flag-name-7423"
+//   7424: group 0, "flag-name-7424"
+//   7425: group 0, "flag-name-7425"
+//   7426: group 0, "flag-name-7426"
+//   7427: group 0, "flag-name-7427"
+//   7428: group 0, "flag-name-7428"
+//   7429: group 0, "flag-name-7429"
+//   7430: group 0, "flag-name-7430"
+//   7431: group 0, "flag-name-7431"
+//   7432: group 0, "flag-name-7432"
+//   7433: group 0, "flag-name-7433"
+//   7434: group 0, "flag-name-7434"
+//   7435: group 0, "flag-name-7435"
+//   7436: group 0, "flag-name-7436"
+//   7437: group 0, "flag-name-7437"
+//   7438: group 0, "flag-name-7438"
+//   7439: group 0, "flag-name-7439"
+//   7440: group 0, "flag-name-7440"
+//   7441: group 0, "flag-name-7441"
+//   7442: group 0, "flag-name-7442"
+//   7443: group 0, "flag-name-7443"
+//   7444: group 0, "flag-name-7444"
+//   7445: group 0, "flag-name-7445"
+//   7446: group 0, "flag-name-7446"
+//   7447: group 0, "flag-name-7447"
+//   7448: group 0, "flag-name-7448"
+//   7449: group 0, "flag-name-7449"
+//   7450: group 0, "flag-name-7450"
+//   7451: group 0, "flag-name-7451"
+//   7452: group 0, "flag-name-7452"
+//   7453: group 0, "flag-name-7453"
+//   7454: group 0, "flag-name-7454"
+//   7455: group 0, "flag-name-7455"
+//   7456: group 0, "flag-name-7456"
+//   7457: group 0, "flag-name-7457"
+//   7458: group 0, "flag-name-7458"
+//   7459: group 0, "flag-name-7459"
+//   7460: group 0, "flag-name-7460"
+//   7461: group 0, "flag-name-7461"
+//   7462: group 0, "flag-name-7462"
+//   7463: group 0, "flag-name-7463"
+//   7464: group 0, "flag-name-7464"
+//   7465: group 0, "flag-name-7465"
+//   7466: group 0, "flag-name-7466"
+//   7467: group 0, "flag-name-7467"
+//   7468: group 0, "flag-name-7468"
+//   7469: group 0, "flag-name-7469"
+//   7470: group 0, "flag-name-7470"
+//   7471: group 0, "flag-name-7471"
+//   7472: group 0, "flag-name-7472"
+//   7473: group 0, "flag-name-7473"
+//   7474: group 0, "flag-name-7474"
+//   7475: group 0, "flag-name-7475"
+//   7476: group 0, "flag-name-7476"
+//   7477: group 0, "flag-name-7477"
+//   7478: group 0, "flag-name-7478"
+//   7479: group 0, "flag-name-7479"
+//   7480: group 0, "flag-name-7480"
+//   7481: group 0, "flag-name-7481"
+//   7482: group 0, "flag-name-7482"
+//   7483: group 0, "flag-name-7483"
+//   7484: group 0, "flag-name-7484"
+//   7485: group 0, "flag-name-7485"
+//   7486: group 0, "flag-name-7486"
+//   7487: group 0, "flag-name-7487"
+//   7488: group 0, "flag-name-7488"
+//   7489: group 0, "flag-name-7489"
+//   7490: group 0, "flag-name-7490"
+//   7491: group 0, "flag-name-7491"
+//   7492: group 0, "flag-name-7492"
+//   7493: group 0, "flag-name-7493"
+//   7494: group 0, "flag-name-7494"
+//   7495: group 0, "flag-name-7495"
+//   7496: group 0, "flag-name-7496"
+//   7497: group 0, "flag-name-7497"
+//   7498: group 0, "flag-name-7498"
+//   7499: group 0, "flag-name-7499"
+//   7500: group 0, "flag-name-7500"
+//   7501: group 0, "flag-name-7501"
+//   7502: group 0, "flag-name-7502"
+//   7503: group 0, "flag-name-7503"
+//   7504: group 0, "flag-name-7504"
+//   7505: group 0, "flag-name-7505"
+//   7506: group 0, "flag-name-7506"
+//   7507: group 0, "flag-name-7507"
+//   7508: group 0, "flag-name-7508"
+//   7509: group 0, "flag-name-7509"
+//   7510: group 0, "flag-name-7510"
+//   7511: group 0, "flag-name-7511"
+//   7512: group 0, "flag-name-7512"
+//   7513: group 0, "flag-name-7513"
+//   7514: group 0, "flag-name-7514"
+//   7515: group 0, "flag-name-7515"
+//   7516: group 0, "flag-name-7516"
+//   7517: group 0, "flag-name-7517"
+//   7518: group 0, "flag-name-7518"
+//   7519: group 0, "flag-name-7519"
+//   7520: group 0, "flag-name-7520"
+//   7521: group 0, "flag-name-7521"
+//   7522: group 0, "flag-name-7522"
+//   7523: group 0, "flag-name-7523"
+//   7524: group 0, "flag-name-7524"
+//   7525: group 0, "flag-name-7525"
+//   7526: group 0, "flag-name-7526"
+//   7527: group 0, "flag-name-7527"
+//   7528: group 0, "flag-name-7528"
+//   7529: group 0, "flag-name-7529"
+//   7530: group 0, "flag-name-7530"
+//   7531: group 0, "flag-name-7531"
+//   7532: group 0, "flag-name-7532"
+//   7533: group 0, "flag-name-7533"
+//   7534: group 0, "flag-name-7534"
+//   7535: group 0, "flag-name-7535"
+//   7536: group 0, "flag-name-7536"
+//   7537: group 0, "flag-name-7537"
+//   7538: group 0, "flag-name-7538"
+//   7539: group 0, "flag-name-7539"
+//   7540: group 0, "flag-name-7540"
+//   7541: group 0, "flag-name-7541"
+//   7542: group 0, "flag-name-7542"
+//   7543: group 0, "flag-name-7543"
+//   7544: group 0, "flag-name-7544"
+//   7545: group 0, "flag-name-7545"
+//   7546: group 0, "flag-name-7546"
+//   7547: group 0, "flag-name-7547"
+//   7548: group 0, "flag-name-7548"
+//   7549: group 0, "flag-name-7549"
+//   7550: group 0, "flag-name-7550"
+//   7551: group 0, "flag-name-7551"
+//   7552: group 0, "flag-name-7552"
+//   7553: group 0, "flag-name-7553"
+//   7554: group 0, "flag-name-7554"
+//   7555: group 0, "flag-name-7555"
+//   7556: group 0, "flag-name-7556"
+//   7557: group 0, "flag-name-7557"
+//   7558: group 0, "flag-name-7558"
+//   7559: group 0, "flag-name-7559"
+//   7560: group 0, "flag-name-7560"
+//   7561: group 0, "flag-name-7561"
+//   7562: group 0, "flag-name-7562"
+//   7563: group 0, "flag-name-7563"
+//   7564: group 0, "flag-name-7564"
+//   7565: group 0, "flag-name-7565"
+//   7566: group 0, "flag-name-7566"
+//   7567: group 0, "flag-name-7567"
+//   7568: group 0, "flag-name-7568"
+//   7569: group 0, "flag-name-7569"
+//   7570: group 0, "flag-name-7570"
+//   7571: group 0, "flag-name-7571"
+//   7572: group 0, "flag-name-7572"
+//   7573: group 0, "flag-name-7573"
+//   7574: group 0, "flag-name-7574"
+//   7575: group 0, "flag-name-7575"
+//   7576: group 0, "flag-name-7576"
+//   7577: group 0, "flag-name-7577"
+//   7578: group 0, "flag-name-7578"
+//   7579: group 0, "flag-name-7579"
+//   7580: group 0, "flag-name-7580"
+//   7581: group 0, "flag-name-7581"
+//   7582: group 0, "flag-name-7582"
+//   7583: group 0, "flag-name-7583"
+//   7584: group 0, "flag-name-7584"
+//   7585: group 0, "flag-name-7585"
+//   7586: group 0, "flag-name-7586"
+//   7587: group 0, "flag-name-7587"
+//   7588: group 0, "flag-name-7588"
+//   7589: group 0, "flag-name-7589"
+//   7590: group 0, "flag-name-7590"
+//   7591: group 0, "flag-name-7591"
+//   7592: group 0, "flag-name-7592"
+//   7593: group 0, "flag-name-7593"
+//   7594: group 0, "flag-name-7594"
+//   7595: group 0, "flag-name-7595"
+//   7596: group 0, "flag-name-7596"
+//   7597: group 0, "flag-name-7597"
+//   7598: group 0, "flag-name-7598"
+//   7599: group 0, "flag-name-7599"
+//   7600: group 0, "flag-name-7600"
+//   7601: group 0, "flag-name-7601"
+//   7602: group 0, "flag-name-7602"
+//   7603: group 0, "flag-name-7603"
+//   7604: group 0, "flag-name-7604"
+//   7605: group 0, "flag-name-7605"
+//   7606: group 0, "flag-name-7606"
+//   7607: group 0, "flag-name-7607"
+//   7608: group 0, "flag-name-7608"
+//   7609: group 0, "flag-name-7609"
+//   7610: group 0, "flag-name-7610"
+//   7611: group 0, "flag-name-7611"
+//   7612: group 0, "flag-name-7612"
+//   7613: group 0, "flag-name-7613"
+//   7614: group 0, "flag-name-7614"
+//   7615: group 0, "flag-name-7615"
+//   7616: group 0, "flag-name-7616"
+//   7617: group 0, "flag-name-7617"
+//   7618: group 0, "flag-name-7618"
+//   7619: group 0, "flag-name-7619"
+//   7620: group 0, "flag-name-7620"
+//   7621: group 0, "flag-name-7621"
+//   7622: group 0, "flag-name-7622"
+//   7623: group 0, "flag-name-7623"
+//   7624: group 0, "flag-name-7624"
+//   7625: group 0, "flag-name-7625"
+//   7626: group 0, "flag-name-7626"
+//   7627: group 0, "flag-name-7627"
+//   7628: group 0, "flag-name-7628"
+//   7629: group 0, "flag-name-7629"
+//   7630: group 0, "flag-name-7630"
+//   7631: group 0, "flag-name-7631"
+//   7632: group 0, "flag-name-7632"
+//   7633: group 0, "flag-name-7633"
+//   7634: group 0, "flag-name-7634"
+//   7635: group 0, "flag-name-7635"
+//   7636: group 0, "flag-name-7636"
+//   7637: group 0, "flag-name-7637"
+//   7638: group 0, "flag-name-7638"
+//   7639: group 0, "flag-name-7639"
+//   7640: group 0, "flag-name-7640"
+//   7641: group 0, "flag-name-7641"
+//   7642: group 0, "flag-name-7642"
+//   7643: group 0, "flag-name-7643"
+//   7644: group 0, "flag-name-7644"
+//   7645: group 0, "flag-name-7645"
+//   7646: group 0, "flag-name-7646"
+//   7647: group 0, "flag-name-7647"
+//   7648: group 0, "flag-name-7648"
+//   7649: group 0, "flag-name-7649"
+//   7650: group 0, "flag-name-7650"
+//   7651: group 0, "flag-name-7651"
+//   7652: group 0, "flag-name-7652"
+//   7653: group 0, "flag-name-7653"
+//   7654: group 0, "flag-name-7654"
+//   7655: group 0, "flag-name-7655"
+//   7656: group 0, "flag-name-7656"
+//   7657: group 0, "flag-name-7657"
+//   7658: group 0, "flag-name-7658"
+//   7659: group 0, "flag-name-7659"
+//   7660: group 0, "flag-name-7660"
+//   7661: group 0, "flag-name-7661"
+//   7662: group 0, "flag-name-7662"
+//   7663: group 0, "flag-name-7663"
+//   7664: group 0, "flag-name-7664"
+//   7665: group 0, "flag-name-7665"
+//   7666: group 0, "flag-name-7666"
+//   7667: group 0, "flag-name-7667"
+//   7668: group 0, "flag-name-7668"
+//   7669: group 0, "flag-name-7669"
+//   7670: group 0, "flag-name-7670"
+//   7671: group 0, "flag-name-7671"
+//   7672: group 0, "flag-name-7672"
+//   7673: group 0, "flag-name-7673"
+//   7674: group 0, "flag-name-7674"
+//   7675: group 0, "flag-name-7675"
+//   7676: group 0, "flag-name-7676"
+//   7677: group 0, "flag-name-7677"
+//   7678: group 0, "flag-name-7678"
+//   7679: group 0, "flag-name-7679"
+//   7680: group 0, "flag-name-7680"
+//   7681: group 0, "flag-name-7681"
+//   7682: group 0, "flag-name-7682"
+//   7683: group 0, "flag-name-7683"
+//   7684: group 0, "flag-name-7684"
+//   7685: group 0, "flag-name-7685"
+//   7686: group 0, "flag-name-7686"
+//   7687: group 0, "flag-name-7687"
+//   7688: group 0, "flag-name-7688"
+//   7689: group 0, "flag-name-7689"
+//   7690: group 0, "flag-name-7690"
+//   7691: group 0, "flag-name-7691"
+//   7692: group 0, "flag-name-7692"
+//   7693: group 0, "flag-name-7693"
+//   7694: group 0, "flag-name-7694"
+//   7695: group 0, "flag-name-7695"
+//   7696: group 0, "flag-name-7696"
+//   7697: group 0, "flag-name-7697"
+//   7698: group 0, "flag-name-7698"
+//   7699: group 0, "flag-name-7699"
+//   7700: group 0, "flag-name-7700"
+//   7701: group 0, "flag-name-7701"
+//   7702: group 0, "flag-name-7702"
+//   7703: group 0, "flag-name-7703"
+//   7704: group 0, "flag-name-7704"
+//   7705: group 0, "flag-name-7705"
+//   7706: group 0, "flag-name-7706"
+//   7707: group 0, "flag-name-7707"
+//   7708: group 0, "flag-name-7708"
+//   7709: group 0, "flag-name-7709"
+//   7710: group 0, "flag-name-7710"
+//   7711: group 0, "flag-name-7711"
+//   7712: group 0, "flag-name-7712"
+//   7713: group 0, "flag-name-7713"
+//   7714: group 0, "flag-name-7714"
+//   7715: group 0, "flag-name-7715"
+//   7716: group 0, "flag-name-7716"
+//   7717: group 0, "flag-name-7717"
+//   7718: group 0, "flag-name-7718"
+//   7719: group 0, "flag-name-7719"
+//   7720: group 0, "flag-name-7720"
+//   7721: group 0, "flag-name-7721"
+//   7722: group 0, "flag-name-7722"
+//   7723: group 0, "flag-name-7723"
+//   7724: group 0, "flag-name-7724"
+//   7725: group 0, "flag-name-7725"
+//   7726: group 0, "flag-name-7726"
+//   7727: group 0, "flag-name-7727"
+//   7728: group 0, "flag-name-7728"
+//   7729: group 0, "flag-name-7729"
+//   7730: group 0, "flag-name-7730"
+//   7731: group 0, "flag-name-7731"
+//   7732: group 0, "flag-name-7732"
+//   7733: group 0, "flag-name-7733"
+//   7734: group 0, "flag-name-7734"
+//   7735: group 0, "flag-name-7735"
+//   7736: group 0, "flag-name-7736"
+//   7737: group 0, "flag-name-7737"
+//   7738: group 0, "flag-name-7738"
+//   7739: group 0, "flag-name-7739"
+//   7740: group 0, "flag-name-7740"
+//   7741: group 0, "flag-name-7741"
+//   7742: group 0, "flag-name-7742"
+//   7743: group 0, "flag-name-7743"
+//   7744: group 0, "flag-name-7744"
+//   7745: group 0, "flag-name-7745"
+//   7746: group 0, "flag-name-7746"
+//   7747: group 0, "flag-name-7747"
+//   7748: group 0, "flag-name-7748"
+//   7749: group 0, "flag-name-7749"
+//   7750: group 0, "flag-name-7750"
+//   7751: group 0, "flag-name-7751"
+//   7752: group 0, "flag-name-7752"
+//   7753: group 0, "flag-name-7753"
+//   7754: group 0, "flag-name-7754"
+//   7755: group 0, "flag-name-7755"
+//   7756: group 0, "flag-name-7756"
+//   7757: group 0, "flag-name-7757"
+//   7758: group 0, "flag-name-7758"
+//   7759: group 0, "flag-name-7759"
+//   7760: group 0, "flag-name-7760"
+//   7761: group 0, "flag-name-7761"
+//   7762: group 0, "flag-name-7762"
+//   7763: group 0, "flag-name-7763"
+//   7764: group 0, "flag-name-7764"
+//   7765: group 0, "flag-name-7765"
+//   7766: group 0, "flag-name-7766"
+//   7767: group 0, "flag-name-7767"
+//   7768: group 0, "flag-name-7768"
+//   7769: group 0, "flag-name-7769"
+//   7770: group 0, "flag-name-7770"
+//   7771: group 0, "flag-name-7771"
+//   7772: group 0, "flag-name-7772"
+//   7773: group 0, "flag-name-7773"
+//   7774: group 0, "flag-name-7774"
+//   7775: group 0, "flag-name-7775"
+//   7776: group 0, "flag-name-7776"
+//   7777: group 0, "flag-name-7777"
+//   7778: group 0, "flag-name-7778"
+//   7779: group 0, "flag-name-7779"
+//   7780: group 0, "flag-name-7780"
+//   7781: group 0, "flag-name-7781"
+//   7782: group 0, "flag-name-7782"
+//   7783: group 0, "flag-name-7783"
+//   7784: group 0, "flag-name-7784"
+//   7785: group 0, "flag-name-7785"
+//   7786: group 0, "flag-name-7786"
+//   7787: group 0, "flag-name-7787"
+//   7788: group 0, "flag-name-7788"
+//   7789: group 0, "flag-name-7789"
+//   7790: group 0, "flag-name-7790"
+//   7791: group 0, "flag-name-7791"
+//   7792: group 0, "flag-name-7792"
+//   7793: group 0, "flag-name-7793"
+//   7794: group 0, "flag-name-7794"
+//   7795: group 0, "flag-name-7795"
+//   7796: group 0, "flag-name-7796"
+//   7797: group 0, "flag-name-7797"
+//   7798: group 0, "flag-name-7798"
+//   7799: group 0, "flag-name-7799"
+//   7800: group 0, "flag-name-7800"
+//   7801: group 0, "flag-name-7801"
+//   7802: group 0, "flag-name-7802"
+//   7803: group 0, "flag-name-7803"
+//   7804: group 0, "flag-name-7804"
+//   7805: group 0, "flag-name-7805"
+//   7806: group 0, "flag-name-7806"
+//   7807: group 0, "flag-name-7807"
+//   7808: group 0, "flag-name-7808"
+//   7809: group 0, "flag-name-7809"
+//   7810: group 0, "flag-name-7810"
+//   7811: group 0, "flag-name-7811"
+//   7812: group 0, "flag-name-7812"
+//   7813: group 0, "flag-name-7813"
+//   7814: group 0, "flag-name-7814"
+//   7815: group 0, "flag-name-7815"
+//   7816: group 0, "flag-name-7816"
+//   7817: group 0, "flag-name-7817"
+//   7818: group 0, "flag-name-7818"
+//   7819: group 0, "flag-name-7819"
+//   7820: group 0, "flag-name-7820"
+//   7821: group 0, "flag-name-7821"
+//   7822: group 0, "flag-name-7822"
+//   7823: group 0, "flag-name-7823"
+//   7824: group 0, "flag-name-7824"
+//   7825: group 0, "flag-name-7825"
+//   7826: group 0, "flag-name-7826"
+//   7827: group 0, "flag-name-7827"
+//   7828: group 0, "flag-name-7828"
+//   7829: group 0, "flag-name-7829"
+//   7830: group 0, "flag-name-7830"
+//   7831: group 0, "flag-name-7831"
+//   7832: group 0, "flag-name-7832"
+//   7833: group 0, "flag-name-7833"
+//   7834: group 0, "flag-name-7834"
+//   7835: group 0, "flag-name-7835"
+//   7836: group 0, "flag-name-7836"
+//   7837: group 0, "flag-name-7837"
+//   7838: group 0, "flag-name-7838"
+//   7839: group 0, "flag-name-7839"
+//   7840: group 0, "flag-name-7840"
+//   7841: group 0, "flag-name-7841"
+//   7842: group 0, "flag-name-7842"
+//   7843: group 0, "flag-name-7843"
+//   7844: group 0, "flag-name-7844"
+//   7845: group 0, "flag-name-7845"
+//   7846: group 0, "flag-name-7846"
+//   7847: group 0, "flag-name-7847"
+//   7848: group 0, "flag-name-7848"
+//   7849: group 0, "flag-name-7849"
+//   7850: group 0, "flag-name-7850"
+//   7851: group 0, "flag-name-7851"
+//   7852: group 0, "flag-name-7852"
+//   7853: group 0, "flag-name-7853"
+//   7854: group 0, "flag-name-7854"
+//   7855: group 0, "flag-name-7855"
+//   7856: group 0, "flag-name-7856"
+//   7857: group 0, "flag-name-7857"
+//   7858: group 0, "flag-name-7858"
+//   7859: group 0, "flag-name-7859"
+//   7860: group 0, "flag-name-7860"
+//   7861: group 0, "flag-name-7861"
+//   7862: group 0, "flag-name-7862"
+//   7863: group 0, "flag-name-7863"
+//   7864: group 0, "flag-name-7864"
+//   7865: group 0, "flag-name-7865"
+//   7866: group 0, "flag-name-7866"
+//   7867: group 0, "flag-name-7867"
+//   7868: group 0, "flag-name-7868"
+//   7869: group 0, "flag-name-7869"
+//   7870: group 0, "flag-name-7870"
+//   7871: group 0, "flag-name-7871"
+//   7872: group 0, "flag-name-7872"
+//   7873: group 0, "flag-name-7873"
+//   7874: group 0, "flag-name-7874"
+//   7875: group 0, "flag-name-7875"
+//   7876: group 0, "flag-name-7876"
+//   7877: group 0, "flag-name-7877"
+//   7878: group 0, "flag-name-7878"
+//   7879: group 0, "flag-name-7879"
+//   7880: group 0, "flag-name-7880"
+//   7881: group 0, "flag-name-7881"
+//   7882: group 0, "flag-name-7882"
+//   7883: group 0, "flag-name-7883"
+//   7884: group 0, "flag-name-7884"
+//   7885: group 0, "flag-name-7885"
+//   7886: group 0, "flag-name-7886"
+//   7887: group 0, "flag-name-7887"
+//   7888: group 0, "flag-name-7888"
+//   7889: group 0, "flag-name-7889"
+//   7890: group 0, "flag-name-7890"
+//   7891: group 0, "flag-name-7891"
+//   7892: group 0, "flag-name-7892"
+//   7893: group 0, "flag-name-7893"
+//   7894: group 0, "flag-name-7894"
+//   7895: group 0, "flag-name-7895"
+//   7896: group 0, "flag-name-7896"
+//   7897: group 0, "flag-name-7897"
+//   7898: group 0, "flag-name-7898"
+//   7899: group 0, "flag-name-7899"
+//   7900: group 0, "flag-name-7900"
+//   7901: group 0, "flag-name-7901"
+//   7902: group 0, "flag-name-7902"
+//   7903: group 0, "flag-name-7903"
+//   7904: group 0, "flag-name-7904"
+//   7905: group 0, "flag-name-7905"
+//   7906: group 0, "flag-name-7906"
+//   7907: group 0, "flag-name-7907"
+//   7908: group 0, "flag-name-7908"
+//   7909: group 0, "flag-name-7909"
+//   7910: group 0, "flag-name-7910"
+//   7911: group 0, "flag-name-7911"
+//   7912: group 0, "flag-name-7912"
+//   7913: group 0, "flag-name-7913"
+//   7914: group 0, "flag-name-7914"
+//   7915: group 0, "flag-name-7915"
+//   7916: group 0, "flag-name-7916"
+//   7917: group 0, "flag-name-7917"
+//   7918: group 0, "flag-name-7918"
+//   7919: group 0, "flag-name-7919"
+//   7920: group 0, "flag-name-7920"
+//   7921: group 0, "flag-name-7921"
+//   7922: group 0, "flag-name-7922"
+//   7923: group 0, "flag-name-7923"
+//   7924: group 0, "flag-name-7924"
+//   7925: group 0, "flag-name-7925"
+//   7926: group 0, "flag-name-7926"
+//   7927: group 0, "flag-name-7927"
+//   7928: group 0, "flag-name-7928"
+//   7929: group 0, "flag-name-7929"
+//   7930: group 0, "flag-name-7930"
+//   7931: group 0, "flag-name-7931"
+//   7932: group 0, "flag-name-7932"
+//   7933: group 0, "flag-name-7933"
+//   7934: group 0, "flag-name-7934"
+//   7935: group 0, "flag-name-7935"
+//   7936: group 0, "flag-name-7936"
+//   7937: group 0, "flag-name-7937"
+//   7938: group 0, "flag-name-7938"
+//   7939: group 0, "flag-name-7939"
+//   7940: group 0, "flag-name-7940"
+//   7941: group 0, "flag-name-7941"
+//   7942: group 0, "flag-name-7942"
+//   7943: group 0, "flag-name-7943"
+//   7944: group 0, "flag-name-7944"
+//   7945: group 0, "flag-name-7945"
+//   7946: group 0, "flag-name-7946"
+//   7947: group 0, "flag-name-7947"
+//   7948: group 0, "flag-name-7948"
+//   7949: group 0, "flag-name-7949"
+//   7950: group 0, "flag-name-7950"
+//   7951: group 0, "flag-name-7951"
+//   7952: group 0, "flag-name-7952"
+//   7953: group 0, "flag-name-7953"
+//   7954: group 0, "flag-name-7954"
+//   7955: group 0, "flag-name-7955"
+//   7956: group 0, "flag-name-7956"
+//   7957: group 0, "flag-name-7957"
+//   7958: group 0, "flag-name-7958"
+//   7959: group 0, "flag-name-7959"
+//   7960: group 0, "flag-name-7960"
+//   7961: group 0, "flag-name-7961"
+//   7962: group 0, "flag-name-7962"
+//   7963: group 0, "flag-name-7963"
+//   7964: group 0, "flag-name-7964"
+//   7965: group 0, "flag-name-7965"
+//   7966: group 0, "flag-name-7966"
+//   7967: group 0, "flag-name-7967"
+//   7968: group 0, "flag-name-7968"
+//   7969: group 0, "flag-name-7969"
+//   7970: group 0, "flag-name-7970"
+//   7971: group 0, "flag-name-7971"
+//   7972: group 0, "flag-name-7972"
+//   7973: group 0, "flag-name-7973"
+//   7974: group 0, "flag-name-7974"
+//   7975: group 0, "flag-name-7975"
+//   7976: group 0, "flag-name-7976"
+//   7977: group 0, "flag-name-7977"
+//   7978: group 0, "flag-name-7978"
+//   7979: group 0, "flag-name-7979"
+//   7980: group 0, "flag-name-7980"
+//   7981: group 0, "flag-name-7981"
+//   7982: group 0, "flag-name-7982"
+//   7983: group 0, "flag-name-7983"
+//   7984: group 0, "flag-name-7984"
+//   7985: group 0, "flag-name-7985"
+//   7986: group 0, "flag-name-7986"
+//   7987: group 0, "flag-name-7987"
+//   7988: group 0, "flag-name-7988"
+//   7989: group 0, "flag-name-7989"
+//   7990: group 0, "flag-name-7990"
+//   7991: group 0, "flag-name-7991"
+//   7992: group 0, "flag-name-7992"
+//   7993: group 0, "flag-name-7993"
+//   7994: group 0, "flag-name-7994"
+//   7995: group 0, "flag-name-7995"
+//   7996: group 0, "flag-name-7996"
+//   7997: group 0, "flag-name-7997"
+//   7998: group 0, "flag-name-7998"
+//   7999: group 0, "flag-name-7999"
+//   8000: group 0, "flag-name-8000"
+//   8001: group 0, "flag-name-8001"
+//   8002: group 0, "flag-name-8002"
+//   8003: group 0, "flag-name-8003"
+//   8004: group 0, "flag-name-8004"
+//   8005: group 0, "flag-name-8005"
+//   8006: group 0, "flag-name-8006"
+//   8007: group 0, "flag-name-8007"
+//   8008: group 0, "flag-name-8008"
+//   8009: group 0, "flag-name-8009"
+//   8010: group 0, "flag-name-8010"
+//   8011: group 0, "flag-name-8011"
+//   8012: group 0, "flag-name-8012"
+//   8013: group 0, "flag-name-8013"
+//   8014: group 0, "flag-name-8014"
+//   8015: group 0, "flag-name-8015"
+//   8016: group 0, "flag-name-8016"
+//   8017: group 0, "flag-name-8017"
+//   8018: group 0, "flag-name-8018"
+//   8019: group 0, "flag-name-8019"
+//   8020: group 0, "flag-name-8020"
+//   8021: group 0, "flag-name-8021"
+//   8022: group 0, "flag-name-8022"
+//   8023: group 0, "flag-name-8023"
+//   8024: group 0, "flag-name-8024"
+//   8025: group 0, "flag-name-8025"
+//   8026: group 0, "flag-name-8026"
+//   8027: group 0, "flag-name-8027"
+//   8028: group 0, "flag-name-8028"
+//   8029: group 0, "flag-name-8029"
+//   8030: group 0, "flag-name-8030"
+//   8031: group 0, "flag-name-8031"
+//   8032: group 0, "flag-name-8032"
+//   8033: group 0, "flag-name-8033"
+//   8034: group 0, "flag-name-8034"
+//   8035: group 0, "flag-name-8035"
+//   8036: group 0, "flag-name-8036"
+//   8037: group 0, "flag-name-8037"
+//   8038: group 0, "flag-name-8038"
+//   8039: group 0, "flag-name-8039"
+//   8040: group 0, "flag-name-8040"
+//   8041: group 0, "flag-name-8041"
+//   8042: group 0, "flag-name-8042"
+//   8043: group 0, "flag-name-8043"
+//   8044: group 0, "flag-name-8044"
+//   8045: group 0, "flag-name-8045"
+//   8046: group 0, "flag-name-8046"
+//   8047: group 0, "flag-name-8047"
+//   8048: group 0, "flag-name-8048"
+//   8049: group 0, "flag-name-8049"
+//   8050: group 0, "flag-name-8050"
+//   8051: group 0, "flag-name-8051"
+//   8052: group 0, "flag-name-8052"
+//   8053: group 0, "flag-name-8053"
+//   8054: group 0, "flag-name-8054"
+//   8055: group 0, "flag-name-8055"
+//   8056: group 0, "flag-name-8056"
+//   8057: group 0, "flag-name-8057"
+//   8058: group 0, "flag-name-8058"
+//   8059: group 0, "flag-name-8059"
+//   8060: group 0, "flag-name-8060"
+//   8061: group 0, "flag-name-8061"
+//   8062: group 0, "flag-name-8062"
+//   8063: group 0, "flag-name-8063"
+//   8064: group 0, "flag-name-8064"
+//   8065: group 0, "flag-name-8065"
+//   8066: group 0, "flag-name-8066"
+//   8067: group 0, "flag-name-8067"
+//   8068: group 0, "flag-name-8068"
+//   8069: group 0, "flag-name-8069"
+//   8070: group 0, "flag-name-8070"
+//   8071: group 0, "flag-name-8071"
+//   8072: group 0, "flag-name-8072"
+//   8073: group 0, "flag-name-8073"
+//   8074: group 0, "flag-name-8074"
+//   8075: group 0, "flag-name-8075"
+//   8076: group 0, "flag-name-8076"
+//   8077: group 0, "flag-name-8077"
+//   8078: group 0, "flag-name-8078"
+//   8079: group 0, "flag-name-8079"
+//   8080: group 0, "flag-name-8080"
+//   8081: group 0, "flag-name-8081"
+//   8082: group 0, "flag-name-8082"
+//   8083: group 0, "flag-name-8083"
+//   8084: group 0, "flag-name-8084"
+//   8085: group 0, "flag-name-8085"
+//   8086: group 0, "flag-name-8086"
+//   8087: group 0, "flag-name-8087"
+//   8088: group 0, "flag-name-8088"
+//   8089: group 0, "flag-name-8089"
+//   8090: group 0, "flag-name-8090"
+//   8091: group 0, "flag-name-8091"
+//   8092: group 0, "flag-name-8092"
+//   8093: group 0, "flag-name-8093"
+//   8094: group 0, "flag-name-8094"
+//   8095: group 0, "flag-name-8095"
+//   8096: group 0, "flag-name-8096"
+//   8097: group 0, "flag-name-8097"
+//   8098: group 0, "flag-name-8098"
+//   8099: group 0, "flag-name-8099"
+//   8100: group 0, "flag-name-8100"
+//   8101: group 0, "flag-name-8101"
+//   8102: group 0, "flag-name-8102"
+//   8103: group 0, "flag-name-8103"
+//   8104: group 0, "flag-name-8104"
+//   8105: group 0, "flag-name-8105"
+//   8106: group 0, "flag-name-8106"
+//   8107: group 0, "flag-name-8107"
+//   8108: group 0, "flag-name-8108"
+//   8109: group 0, "flag-name-8109"
+//   8110: group 0, "flag-name-8110"
+//   8111: group 0, "flag-name-8111"
+//   8112: group 0, "flag-name-8112"
+//   8113: group 0, "flag-name-8113"
+//   8114: group 0, "flag-name-8114"
+//   8115: group 0, "flag-name-8115"
+//   8116: group 0, "flag-name-8116"
+//   8117: group 0, "flag-name-8117"
+//   8118: group 0, "flag-name-8118"
+//   8119: group 0, "flag-name-8119"
+//   8120: group 0, "flag-name-8120"
+//   8121: group 0, "flag-name-8121"
+//   8122: group 0, "flag-name-8122"
+//   8123: group 0, "flag-name-8123"
+//   8124: group 0, "flag-name-8124"
+//   8125: group 0, "flag-name-8125"
+//   8126: group 0, "flag-name-8126"
+//   8127: group 0, "flag-name-8127"
+//   8128: group 0, "flag-name-8128"
+//   8129: group 0, "flag-name-8129"
+//   8130: group 0, "flag-name-8130"
+//   8131: group 0, "flag-name-8131"
+//   8132: group 0, "flag-name-8132"
+//   8133: group 0, "flag-name-8133"
+//   8134: group 0, "flag-name-8134"
+//   8135: group 0, "flag-name-8135"
+//   8136: group 0, "flag-name-8136"
+//   8137: group 0, "flag-name-8137"
+//   8138: group 0, "flag-name-8138"
+//   8139: group 0, "flag-name-8139"
+//   8140: group 0, "flag-name-8140"
+//   8141: group 0, "flag-name-8141"
+//   8142: group 0, "flag-name-8142"
+//   8143: group 0, "flag-name-8143"
+//   8144: group 0, "flag-name-8144"
+//   8145: group 0, "flag-name-8145"
+//   8146: group 0, "flag-name-8146"
+//   8147: group 0, "flag-name-8147"
+//   8148: group 0, "flag-name-8148"
+//   8149: group 0, "flag-name-8149"
+//   8150: group 0, "flag-name-8150"
+//   8151: group 0, "flag-name-8151"
+//   8152: group 0, "flag-name-8152"
+//   8153: group 0, "flag-name-8153"
+//   8154: group 0, "flag-name-8154"
+//   8155: group 0, "flag-name-8155"
+//   8156: group 0, "flag-name-8156"
+//   8157: group 0, "flag-name-8157"
+//   8158: group 0, "flag-name-8158"
+//   8159: group 0, "flag-name-8159"
+//   8160: group 0, "flag-name-8160"
+//   8161: group 0, "flag-name-8161"
+//   8162: group 0, "flag-name-8162"
+//   8163: group 0, "flag-name-8163"
+//   8164: group 0, "flag-name-8164"
+//   8165: group 0, "flag-name-8165"
+//   8166: group 0, "flag-name-8166"
+//   8167: group 0, "flag-name-8167"
+//   8168: group 0, "flag-name-8168"
+//   8169: group 0, "flag-name-8169"
+//   8170: group 0, "flag-name-8170"
+//   8171: group 0, "flag-name-8171"
+//   8172: group 0, "flag-name-8172"
+//   8173: group 0, "flag-name-8173"
+//   8174: group 0, "flag-name-8174"
+//   8175: group 0, "flag-name-8175"
+//   8176: group 0, "flag-name-8176"
+//   8177: group 0, "flag-name-8177"
+//   8178: group 0, "flag-name-8178"
+//   8179: group 0, "flag-name-8179"
+//   8180: group 0, "flag-name-8180"
+//   8181: group 0, "flag-name-8181"
+//   8182: group 0, "flag-name-8182"
+//   8183: group 0, "flag-name-8183"
+//   8184: group 0, "flag-name-8184"
+//   8185: group 0, "flag-name-8185"
+//   8186: group 0, "flag-name-8186"
+//   8187: group 0, "flag-name-8187"
+//   8188: group 0, "flag-name-8188"
+//   8189: group 0, "flag-name-8189"
+//   8190: group 0, "flag-name-8190"
+//   8191: group 0, "flag-name-8191"
+//   8192: group 0, "flag-name-8192"
+//   8193: group 0, "flag-name-8193"
+//   8194: group 0, "flag-name-8194"
+//   8195: group 0, "flag-name-8195"
+//   8196: group 0, "flag-name-8196"
+//   8197: group 0, "flag-name-8197"
+//   8198: group 0, "flag-name-8198"
+//   8199: group 0, "flag-name-8199"
+//   8200: group 0, "flag-name-8200"
+//   8201: group 0, "flag-name-8201"
+//   8202: group 0, "flag-name-8202"
+//   8203: group 0, "flag-name-8203"
+//   8204: group 0, "flag-name-8204"
+//   8205: group 0, "flag-name-8205"
+//   8206: group 0, "flag-name-8206"
+//   8207: group 0, "flag-name-8207"
+//   8208: group 0, "flag-name-8208"
+//   8209: group 0, "flag-name-8209"
+//   8210: group 0, "flag-name-8210"
+//   8211: group 0, "flag-name-8211"
+//   8212: group 0, "flag-name-8212"
+//   8213: group 0, "flag-name-8213"
+//   8214: group 0, "flag-name-8214"
+//   8215: group 0, "flag-name-8215"
+//   8216: group 0, "flag-name-8216"
+//   8217: group 0, "flag-name-8217"
+//   8218: group 0, "flag-name-8218"
+//   8219: group 0, "flag-name-8219"
+//   8220: group 0, "flag-name-8220"
+//   8221: group 0, "flag-name-8221"
+//   8222: group 0, "flag-name-8222"
+//   8223: group 0, "flag-name-8223"
+//   8224: group 0, "flag-name-8224"
+//   8225: group 0, "flag-name-8225"
+//   8226: group 0, "flag-name-8226"
+//   8227: group 0, "flag-name-8227"
+//   8228: group 0, "flag-name-8228"
+//   8229: group 0, "flag-name-8229"
+//   8230: group 0, "flag-name-8230"
+//   8231: group 0, "flag-name-8231"
+//   8232: group 0, "flag-name-8232"
+//   8233: group 0, "flag-name-8233"
+//   8234: group 0, "flag-name-8234"
+//   8235: group 0, "flag-name-8235"
+//   8236: group 0, "flag-name-8236"
+//   8237: group 0, "flag-name-8237"
+//   8238: group 0, "flag-name-8238"
+//   8239: group 0, "flag-name-8239"
+//   8240: group 0, "flag-name-8240"
+//   8241: group 0, "flag-name-8241"
+//   8242: group 0, "flag-name-8242"
+//   8243: group 0, "flag-name-8243"
+//   8244: group 0, "flag-name-8244"
+//   8245: group 0, "flag-name-8245"
+//   8246: group 0, "flag-name-8246"
+//   8247: group 0, "flag-name-8247"
+//   8248: group 0, "flag-name-8248"
+//   8249: group 0, "flag-name-8249"
+//   8250: group 0, "flag-name-8250"
+//   8251: group 0, "flag-name-8251"
+//   8252: group 0, "flag-name-8252"
+//   8253: group 0, "flag-name-8253"
+//   8254: group 0, "flag-name-8254"
+//   8255: group 0, "flag-name-8255"
+//   8256: group 0, "flag-name-8256"
+//   8257: group 0, "flag-name-8257"
+//   8258: group 0, "flag-name-8258"
+//   8259: group 0, "flag-name-8259"
+//   8260: group 0, "flag-name-8260"
+//   8261: group 0, "flag-name-8261"
+//   8262: group 0, "flag-name-8262"
+//   8263: group 0, "flag-name-8263"
+//   8264: group 0, "flag-name-8264"
+//   8265: group 0, "flag-name-8265"
+//   8266: group 0, "flag-name-8266"
+//   8267: group 0, "flag-name-8267"
+//   8268: group 0, "flag-name-8268"
+//   8269: group 0, "flag-name-8269"
+//   8270: group 0, "flag-name-8270"
+//   8271: group 0, "flag-name-8271"
+//   8272: group 0, "flag-name-8272"
+//   8273: group 0, "flag-name-8273"
+//   8274: group 0, "flag-name-8274"
+//   8275: group 0, "flag-name-8275"
+//   8276: group 0, "flag-name-8276"
+//   8277: group 0, "flag-name-8277"
+//   8278: group 0, "flag-name-8278"
+//   8279: group 0, "flag-name-8279"
+//   8280: group 0, "flag-name-8280"
+//   8281: group 0, "flag-name-8281"
+//   8282: group 0, "flag-name-8282"
+//   8283: group 0, "flag-name-8283"
+//   8284: group 0, "flag-name-8284"
+//   8285: group 0, "flag-name-8285"
+//   8286: group 0, "flag-name-8286"
+//   8287: group 0, "flag-name-8287"
+//   8288: group 0, "flag-name-8288"
+//   8289: group 0, "flag-name-8289"
+//   8290: group 0, "flag-name-8290"
+//   8291: group 0, "flag-name-8291"
+//   8292: group 0, "flag-name-8292"
+//   8293: group 0, "flag-name-8293"
+//   8294: group 0, "flag-name-8294"
+//   8295: group 0, "flag-name-8295"
+//   8296: group 0, "flag-name-8296"
+//   8297: group 0, "flag-name-8297"
+//   8298: group 0, "flag-name-8298"
+//   8299: group 0, "flag-name-8299"
+//   8300: group 0, "flag-name-8300"
+//   8301: group 0, "flag-name-8301"
+//   8302: group 0, "flag-name-8302"
+//   8303: group 0, "flag-name-8303"
+//   8304: group 0, "flag-name-8304"
+//   8305: group 0, "flag-name-8305"
+//   8306: group 0, "flag-name-8306"
+//   8307: group 0, "flag-name-8307"
+//   8308: group 0, "flag-name-8308"
+//   8309: group 0, "flag-name-8309"
+//   8310: group 0, "flag-name-8310"
+//   8311: group 0, "flag-name-8311"
+//   8312: group 0, "flag-name-8312"
+//   8313: group 0, "flag-name-8313"
+//   8314: group 0, "flag-name-8314"
+//   8315: group 0, "flag-name-8315"
+//   8316: group 0, "flag-name-8316"
+//   8317: group 0, "flag-name-8317"
+//   8318: group 0, "flag-name-8318"
+//   8319: group 0, "flag-name-8319"
+//   8320: group 0, "flag-name-8320"
+//   8321: group 0, "flag-name-8321"
+//   8322: group 0, "flag-name-8322"
+//   8323: group 0, "flag-name-8323"
+//   8324: group 0, "flag-name-8324"
+//   8325: group 0, "flag-name-8325"
+//   8326: group 0, "flag-name-8326"
+//   8327: group 0, "flag-name-8327"
+//   8328: group 0, "flag-name-8328"
+//   8329: group 0, "flag-name-8329"
+//   8330: group 0, "flag-name-8330"
+//   8331: group 0, "flag-name-8331"
+//   8332: group 0, "flag-name-8332"
+//   8333: group 0, "flag-name-8333"
+//   8334: group 0, "flag-name-8334"
+//   8335: group 0, "flag-name-8335"
+//   8336: group 0, "flag-name-8336"
+//   8337: group 0, "flag-name-8337"
+//   8338: group 0, "flag-name-8338"
+//   8339: group 0, "flag-name-8339"
+//   8340: group 0, "flag-name-8340"
+//   8341: group 0, "flag-name-8341"
+//   8342: group 0, "flag-name-8342"
+//   8343: group 0, "flag-name-8343"
+//   8344: group 0, "flag-name-8344"
+//   8345: group 0, "flag-name-8345"
+//   8346: group 0, "flag-name-8346"
+//   8347: group 0, "flag-name-8347"
+//   8348: group 0, "flag-name-8348"
+//   8349: group 0, "flag-name-8349"
+//   8350: group 0, "flag-name-8350"
+//   8351: group 0, "flag-name-8351"
+//   8352: group 0, "flag-name-8352"
+//   8353: group 0, "flag-name-8353"
+//   8354: group 0, "flag-name-8354"
+//   8355: group 0, "flag-name-8355"
+//   8356: group 0, "flag-name-8356"
+//   8357: group 0, "flag-name-8357"
+//   8358: group 0, "flag-name-8358"
+//   8359: group 0, "flag-name-8359"
+//   8360: group 0, "flag-name-8360"
+//   8361: group 0, "flag-name-8361"
+//   8362: group 0, "flag-name-8362"
+//   8363: group 0, "flag-name-8363"
+//   8364: group 0, "flag-name-8364"
+//   8365: group 0, "flag-name-8365"
+//   8366: group 0, "flag-name-8366"
+//   8367: group 0, "flag-name-8367"
+//   8368: group 0, "flag-name-8368"
+//   8369: group 0, "flag-name-8369"
+//   8370: group 0, "flag-name-8370"
+//   8371: group 0, "flag-name-8371"
+//   8372: group 0, "flag-name-8372"
+//   8373: group 0, "flag-name-8373"
+//   8374: group 0, "flag-name-8374"
+//   8375: group 0, "flag-name-8375"
+//   8376: group 0, "flag-name-8376"
+//   8377: group 0, "flag-name-8377"
+//   8378: group 0, "flag-name-8378"
+//   8379: group 0, "flag-name-8379"
+//   8380: group 0, "flag-name-8380"
+//   8381: group 0, "flag-name-8381"
+//   8382: group 0, "flag-name-8382"
+//   8383: group 0, "flag-name-8383"
+//   8384: group 0, "flag-name-8384"
+//   8385: group 0, "flag-name-8385"
+//   8386: group 0, "flag-name-8386"
+//   8387: group 0, "flag-name-8387"
+//   8388: group 0, "flag-name-8388"
+//   8389: group 0, "flag-name-8389"
+//   8390: group 0, "flag-name-8390"
+//   8391: group 0, "flag-name-8391"
+//   8392: group 0, "flag-name-8392"
+//   8393: group 0, "flag-name-8393"
+//   8394: group 0, "flag-name-8394"
+//   8395: group 0, "flag-name-8395"
+//   8396: group 0, "flag-name-8396"
+//   8397: group 0, "flag-name-8397"
+//   8398: group 0, "flag-name-8398"
+//   8399: group 0, "flag-name-8399"
+//   8400: group 0, "flag-name-8400"
+//   8401: group 0, "flag-name-8401"
+//   8402: group 0, "flag-name-8402"
+//   8403: group 0, "flag-name-8403"
+//   8404: group 0, "flag-name-8404"
+//   8405: group 0, "flag-name-8405"
+//   8406: group 0, "flag-name-8406"
+//   8407: group 0, "flag-name-8407"
+//   8408: group 0, "flag-name-8408"
+//   8409: group 0, "flag-name-8409"
+//   8410: group 0, "flag-name-8410"
+//   8411: group 0, "flag-name-8411"
+//   8412: group 0, "flag-name-8412"
+//   8413: group 0, "flag-name-8413"
+//   8414: group 0, "flag-name-8414"
+//   8415: group 0, "flag-name-8415"
+//   8416: group 0, "flag-name-8416"
+//   8417: group 0, "flag-name-8417"
+//   8418: group 0, "flag-name-8418"
+//   8419: group 0, "flag-name-8419"
+//   8420: group 0, "flag-name-8420"
+//   8421: group 0, "flag-name-8421"
+//   8422: group 0, "flag-name-8422"
+//   8423: group 0, "flag-name-8423"
+//   8424: group 0, "flag-name-8424"
+//   8425: group 0, "flag-name-8425"
+//   8426: group 0, "flag-name-8426"
+//   8427: group 0, "flag-name-8427"
+//   8428: group 0, "flag-name-8428"
+//   8429: group 0, "flag-name-8429"
+//   8430: group 0, "flag-name-8430"
+//   8431: group 0, "flag-name-8431"
+//   8432: group 0, "flag-name-8432"
+//   8433: group 0, "flag-name-8433"
+//   8434: group 0, "flag-name-8434"
+//   8435: group 0, "flag-name-8435"
+//   8436: group 0, "flag-name-8436"
+//   8437: group 0, "flag-name-8437"
+//   8438: group 0, "flag-name-8438"
+//   8439: group 0, "flag-name-8439"
+//   8440: group 0, "flag-name-8440"
+//   8441: group 0, "flag-name-8441"
+//   8442: group 0, "flag-name-8442"
+//   8443: group 0, "flag-name-8443"
+//   8444: group 0, "flag-name-8444"
+//   8445: group 0, "flag-name-8445"
+//   8446: group 0, "flag-name-8446"
+//   8447: group 0, "flag-name-8447"
+//   8448: group 0, "flag-name-8448"
+//   8449: group 0, "flag-name-8449"
+//   8450: group 0, "flag-name-8450"
+//   8451: group 0, "flag-name-8451"
+//   8452: group 0, "flag-name-8452"
+//   8453: group 0, "flag-name-8453"
+//   8454: group 0, "flag-name-8454"
+//   8455: group 0, "flag-name-8455"
+//   8456: group 0, "flag-name-8456"
+//   8457: group 0, "flag-name-8457"
+//   8458: group 0, "flag-name-8458"
+//   8459: group 0, "flag-name-8459"
+//   8460: group 0, "flag-name-8460"
+//   8461: group 0, "flag-name-8461"
+//   8462: group 0, "flag-name-8462"
+//   8463: group 0, "flag-name-8463"
+//   8464: group 0, "flag-name-8464"
+//   8465: group 0, "flag-name-8465"
+//   8466: group 0, "flag-name-8466"
+//   8467: group 0, "flag-name-8467"
+//   8468: group 0, "flag-name-8468"
+//   8469: group 0, "flag-name-8469"
+//   8470: group 0, "flag-name-8470"
+//   8471: group 0, "flag-name-8471"
+//   8472: group 0, "flag-name-8472"
+//   8473: group 0, "flag-name-8473"
+//   8474: group 0, "flag-name-8474"
+//   8475: group 0, "flag-name-8475"
+//   8476: group 0, "flag-name-8476"
+//   8477: group 0, "flag-name-8477"
+//   8478: group 0, "flag-name-8478"
+//   8479: group 0, "flag-name-8479"
+//   8480: group 0, "flag-name-8480"
+//   8481: group 0, "flag-name-8481"
+//   8482: group 0, "flag-name-8482"
+//   8483: group 0, "flag-name-8483"
+//   8484: group 0, "flag-name-8484"
+//   8485: group 0, "flag-name-8485"
+//   8486: group 0, "flag-name-8486"
+//   8487: group 0, "flag-name-8487"
+//   8488: group 0, "flag-name-8488"
+//   8489: group 0, "flag-name-8489"
+//   8490: group 0, "flag-name-8490"
+//   8491: group 0, "flag-name-8491"
+//   8492: group 0, "flag-name-8492"
+//   8493: group 0, "flag-name-8493"
+//   8494: group 0, "flag-name-8494"
+//   8495: group 0, "flag-name-8495"
+//   8496: group 0, "flag-name-8496"
+//   8497: group 0, "flag-name-8497"
+//   8498: group 0, "flag-name-8498"
+//   8499: group 0, "flag-name-8499"
+//   8500: group 0, "flag-name-8500"
+//   8501: group 0, "flag-name-8501"
+//   8502: group 0, "flag-name-8502"
+//   8503: group 0, "flag-name-8503"
+//   8504: group 0, "flag-name-8504"
+//   8505: group 0, "flag-name-8505"
+//   8506: group 0, "flag-name-8506"
+//   8507: group 0, "flag-name-8507"
+//   8508: group 0, "flag-name-8508"
+//   8509: group 0, "flag-name-8509"
+//   8510: group 0, "flag-name-8510"
+//   8511: group 0, "flag-name-8511"
+//   8512: group 0, "flag-name-8512"
+//   8513: group 0, "flag-name-8513"
+//   8514: group 0, "flag-name-8514"
+//   8515: group 0, "flag-name-8515"
+//   8516: group 0, "flag-name-8516"
+//   8517: group 0, "flag-name-8517"
+//   8518: group 0, "flag-name-8518"
+//   8519: group 0, "flag-name-8519"
+//   8520: group 0, "flag-name-8520"
+//   8521: group 0, "flag-name-8521"
+//   8522: group 0, "flag-name-8522"
+//   8523: group 0, "flag-name-8523"
+//   8524: group 0, "flag-name-8524"
+//   8525: group 0, "flag-name-8525"
+//   8526: group 0, "flag-name-8526"
+//   8527: group 0, "flag-name-8527"
+//   8528: group 0, "flag-name-8528"
+//   8529: group 0, "flag-name-8529"
+//   8530: group 0, "flag-name-8530"
+//   8531: group 0, "flag-name-8531"
+//   8532: group 0, "flag-name-8532"
+//   8533: group 0, "flag-name-8533"
+//   8534: group 0, "flag-name-8534"
+//   8535: group 0, "flag-name-8535"
+//   8536: group 0, "flag-name-8536"
+//   8537: group 0, "flag-name-8537"
+//   8538: group 0, "flag-name-8538"
+//   8539: group 0, "flag-name-8539"
+//   8540: group 0, "flag-name-8540"
+//   8541: group 0, "flag-name-8541"
+//   8542: group 0, "flag-name-8542"
+//   8543: group 0, "flag-name-8543"
+//   8544: group 0, "flag-name-8544"
+//   8545: group 0, "flag-name-8545"
+//   8546: group 0, "flag-name-8546"
+//   8547: group 0, "flag-name-8547"
+//   8548: group 0, "flag-name-8548"
+//   8549: group 0, "flag-name-8549"
+//   8550: group 0, "flag-name-8550"
+//   8551: group 0, "flag-name-8551"
+//   8552: group 0, "flag-name-8552"
+//   8553: group 0, "flag-name-8553"
+//   8554: group 0, "flag-name-8554"
+//   8555: group 0, "flag-name-8555"
+//   8556: group 0, "flag-name-8556"
+//   8557: group 0, "flag-name-8557"
+//   8558: group 0, "flag-name-8558"
+//   8559: group 0, "flag-name-8559"
+//   8560: group 0, "flag-name-8560"
+//   8561: group 0, "flag-name-8561"
+//   8562: group 0, "flag-name-8562"
+//   8563: group 0, "flag-name-8563"
+//   8564: group 0, "flag-name-8564"
+//   8565: group 0, "flag-name-8565"
+//   8566: group 0, "flag-name-8566"
+//   8567: group 0, "flag-name-8567"
+//   8568: group 0, "flag-name-8568"
+//   8569: group 0, "flag-name-8569"
+//   8570: group 0, "flag-name-8570"
+//   8571: group 0, "flag-name-8571"
+//   8572: group 0, "flag-name-8572"
+//   8573: group 0, "flag-name-8573"
+//   8574: group 0, "flag-name-8574"
+//   8575: group 0, "flag-name-8575"
+//   8576: group 0, "flag-name-8576"
+//   8577: group 0, "flag-name-8577"
+//   8578: group 0, "flag-name-8578"
+//   8579: group 0, "flag-name-8579"
+//   8580: group 0, "flag-name-8580"
+//   8581: group 0, "flag-name-8581"
+//   8582: group 0, "flag-name-8582"
+//   8583: group 0, "flag-name-8583"
+//   8584: group 0, "flag-name-8584"
+//   8585: group 0, "flag-name-8585"
+//   8586: group 0, "flag-name-8586"
+//   8587: group 0, "flag-name-8587"
+//   8588: group 0, "flag-name-8588"
+//   8589: group 0, "flag-name-8589"
+//   8590: group 0, "flag-name-8590"
+//   8591: group 0, "flag-name-8591"
+//   8592: group 0, "flag-name-8592"
+//   8593: group 0, "flag-name-8593"
+//   8594: group 0, "flag-name-8594"
+//   8595: group 0, "flag-name-8595"
+//   8596: group 0, "flag-name-8596"
+//   8597: group 0, "flag-name-8597"
+//   8598: group 0, "flag-name-8598"
+//   8599: group 0, "flag-name-8599"
+//   8600: group 0, "flag-name-8600"
+//   8601: group 0, "flag-name-8601"
+//   8602: group 0, "flag-name-8602"
+//   8603: group 0, "flag-name-8603"
+//   8604: group 0, "flag-name-8604"
+//   8605: group 0, "flag-name-8605"
+//   8606: group 0, "flag-name-8606"
+//   8607: group 0, "flag-name-8607"
+//   8608: group 0, "flag-name-8608"
+//   8609: group 0, "flag-name-8609"
+//   8610: group 0, "flag-name-8610"
+//   8611: group 0, "flag-name-8611"
+//   8612: group 0, "flag-name-8612"
+//   8613: group 0, "flag-name-8613"
+//   8614: group 0, "flag-name-8614"
+//   8615: group 0, "flag-name-8615"
+//   8616: group 0, "flag-name-8616"
+//   8617: group 0, "flag-name-8617"
+//   8618: group 0, "flag-name-8618"
+//   8619: group 0, "flag-name-8619"
+//   8620: group 0, "flag-name-8620"
+//   8621: group 0, "flag-name-8621"
+//   8622: group 0, "flag-name-8622"
+//   8623: group 0, "flag-name-8623"
+//   8624: group 0, "flag-name-8624"
+//   8625: group 0, "flag-name-8625"
+//   8626: group 0, "flag-name-8626"
+//   8627: group 0, "flag-name-8627"
+//   8628: group 0, "flag-name-8628"
+//   8629: group 0, "flag-name-8629"
+//   8630: group 0, "flag-name-8630"
+//   8631: group 0, "flag-name-8631"
+//   8632: group 0, "flag-name-8632"
+//   8633: group 0, "flag-name-8633"
+//   8634: group 0, "flag-name-8634"
+//   8635: group 0, "flag-name-8635"
+//   8636: group 0, "flag-name-8636"
+//   8637: group 0, "flag-name-8637"
+//   8638: group 0, "flag-name-8638"
+//   8639: group 0, "flag-name-8639"
+//   8640: group 0, "flag-name-8640"
+//   8641: group 0, "flag-name-8641"
+//   8642: group 0, "flag-name-8642"
+//   8643: group 0, "flag-name-8643"
+//   8644: group 0, "flag-name-8644"
+//   8645: group 0, "flag-name-8645"
+//   8646: group 0, "flag-name-8646"
+//   8647: group 0, "flag-name-8647"
+//   8648: group 0, "flag-name-8648"
+//   8649: group 0, "flag-name-8649"
+//   8650: group 0, "flag-name-8650"
+//   8651: group 0, "flag-name-8651"
+//   8652: group 0, "flag-name-8652"
+//   8653: group 0, "flag-name-8653"
+//   8654: group 0, "flag-name-8654"
+//   8655: group 0, "flag-name-8655"
+//   8656: group 0, "flag-name-8656"
+//   8657: group 0, "flag-name-8657"
+//   8658: group 0, "flag-name-8658"
+//   8659: group 0, "flag-name-8659"
+//   8660: group 0, "flag-name-8660"
+//   8661: group 0, "flag-name-8661"
+//   8662: group 0, "flag-name-8662"
+//   8663: group 0, "flag-name-8663"
+//   8664: group 0, "flag-name-8664"
+//   8665: group 0, "flag-name-8665"
+//   8666: group 0, "flag-name-8666"
+//   8667: group 0, "flag-name-8667"
+//   8668: group 0, "flag-name-8668"
+//   8669: group 0, "flag-name-8669"
+//   8670: group 0, "flag-name-8670"
+//   8671: group 0, "flag-name-8671"
+//   8672: group 0, "flag-name-8672"
+//   8673: group 0, "flag-name-8673"
+//   8674: group 0, "flag-name-8674"
+//   8675: group 0, "flag-name-8675"
+//   8676: group 0, "flag-name-8676"
+//   8677: group 0, "flag-name-8677"
+//   8678: group 0, "flag-name-8678"
+//   8679: group 0, "flag-name-8679"
+//   8680: group 0, "flag-name-8680"
+//   8681: group 0, "flag-name-8681"
+//   8682: group 0, "flag-name-8682"
+//   8683: group 0, "flag-name-8683"
+//   8684: group 0, "flag-name-8684"
+//   8685: group 0, "flag-name-8685"
+//   8686: group 0, "flag-name-8686"
+//   8687: group 0, "flag-name-8687"
+//   8688: group 0, "flag-name-8688"
+//   8689: group 0, "flag-name-8689"
+//   8690: group 0, "flag-name-8690"
+//   8691: group 0, "flag-name-8691"
+//   8692: group 0, "flag-name-8692"
+//   8693: group 0, "flag-name-8693"
+//   8694: group 0, "flag-name-8694"
+//   8695: group 0, "flag-name-8695"
+//   8696: group 0, "flag-name-8696"
+//   8697: group 0, "flag-name-8697"
+//   8698: group 0, "flag-name-8698"
+//   8699: group 0, "flag-name-8699"
+//   8700: group 0, "flag-name-8700"
+//   8701: group 0, "flag-name-8701"
+//   8702: group 0, "flag-name-8702"
+//   8703: group 0, "flag-name-8703"
+//   8704: group 0, "flag-name-8704"
+//   8705: group 0, "flag-name-8705"
+//   8706: group 0, "flag-name-8706"
+//   8707: group 0, "flag-name-8707"
+//   8708: group 0, "flag-name-8708"
+//   8709: group 0, "flag-name-8709"
+//   8710: group 0, "flag-name-8710"
+//   8711: group 0, "flag-name-8711"
+//   8712: group 0, "flag-name-8712"
+//   8713: group 0, "flag-name-8713"
+//   8714: group 0, "flag-name-8714"
+//   8715: group 0, "flag-name-8715"
+//   8716: group 0, "flag-name-8716"
+//   8717: group 0, "flag-name-8717"
+//   8718: group 0, "flag-name-8718"
+//   8719: group 0, "flag-name-8719"
+//   8720: group 0, "flag-name-8720"
+//   8721: group 0, "flag-name-8721"
+//   8722: group 0, "flag-name-8722"
+//   8723: group 0, "flag-name-8723"
+//   8724: group 0, "flag-name-8724"
+//   8725: group 0, "flag-name-8725"
+//   8726: group 0, "flag-name-8726"
+//   8727: group 0, "flag-name-8727"
+//   8728: group 0, "flag-name-8728"
+//   8729: group 0, "flag-name-8729"
+//   8730: group 0, "flag-name-8730"
+//   8731: group 0, "flag-name-8731"
+//   8732: group 0, "flag-name-8732"
+//   8733: group 0, "flag-name-8733"
+//   8734: group 0, "flag-name-8734"
+//   8735: group 0, "flag-name-8735"
+//   8736: group 0, "flag-name-8736"
+//   8737: group 0, "flag-name-8737"
+//   8738: group 0, "flag-name-8738"
+//   8739: group 0, "flag-name-8739"
+//   8740: group 0, "flag-name-8740"
+//   8741: group 0, "flag-name-8741"
+//   8742: group 0, "flag-name-8742"
+//   8743: group 0, "flag-name-8743"
+//   8744: group 0, "flag-name-8744"
+//   8745: group 0, "flag-name-8745"
+//   8746: group 0, "flag-name-8746"
+//   8747: group 0, "flag-name-8747"
+//   8748: group 0, "flag-name-8748"
+//   8749: group 0, "flag-name-8749"
+//   8750: group 0, "flag-name-8750"
+//   8751: group 0, "flag-name-8751"
+//   8752: group 0, "flag-name-8752"
+//   8753: group 0, "flag-name-8753"
+//   8754: group 0, "flag-name-8754"
+//   8755: group 0, "flag-name-8755"
+//   8756: group 0, "flag-name-8756"
+//   8757: group 0, "flag-name-8757"
+//   8758: group 0, "flag-name-8758"
+//   8759: group 0, "flag-name-8759"
+//   8760: group 0, "flag-name-8760"
+//   8761: group 0, "flag-name-8761"
+//   8762: group 0, "flag-name-8762"
+//   8763: group 0, "flag-name-8763"
+//   8764: group 0, "flag-name-8764"
+//   8765: group 0, "flag-name-8765"
+//   8766: group 0, "flag-name-8766"
+//   8767: group 0, "flag-name-8767"
+//   8768: group 0, "flag-name-8768"
+//   8769: group 0, "flag-name-8769"
+//   8770: group 0, "flag-name-8770"
+//   8771: group 0, "flag-name-8771"
+//   8772: group 0, "flag-name-8772"
+//   8773: group 0, "flag-name-8773"
+//   8774: group 0, "flag-name-8774"
+//   8775: group 0, "flag-name-8775"
+//   8776: group 0, "flag-name-8776"
+//   8777: group 0, "flag-name-8777"
+//   8778: group 0, "flag-name-8778"
+//   8779: group 0, "flag-name-8779"
+//   8780: group 0, "flag-name-8780"
+//   8781: group 0, "flag-name-8781"
+//   8782: group 0, "flag-name-8782"
+//   8783: group 0, "flag-name-8783"
+//   8784: group 0, "flag-name-8784"
+//   8785: group 0, "flag-name-8785"
+//   8786: group 0, "flag-name-8786"
+//   8787: group 0, "flag-name-8787"
+//   8788: group 0, "flag-name-8788"
+//   8789: group 0, "flag-name-8789"
+//   8790: group 0, "flag-name-8790"
+//   8791: group 0, "flag-name-8791"
+//   8792: group 0, "flag-name-8792"
+//   8793: group 0, "flag-name-8793"
+//   8794: group 0, "flag-name-8794"
+//   8795: group 0, "flag-name-8795"
+//   8796: group 0, "flag-name-8796"
+//   8797: group 0, "flag-name-8797"
+//   8798: group 0, "flag-name-8798"
+//   8799: group 0, "flag-name-8799"
+//   8800: group 0, "flag-name-8800"
+//   8801: group 0, "flag-name-8801"
+//   8802: group 0, "flag-name-8802"
+//   8803: group 0, "flag-name-8803"
+//   8804: group 0, "flag-name-8804"
+//   8805: group 0, "flag-name-8805"
+//   8806: group 0, "flag-name-8806"
+//   8807: group 0, "flag-name-8807"
+//   8808: group 0, "flag-name-8808"
+//   8809: group 0, "flag-name-8809"
+//   8810: group 0, "flag-name-8810"
+//   8811: group 0, "flag-name-8811"
+//   8812: group 0, "flag-name-8812"
+//   8813: group 0, "flag-name-8813"
+//   8814: group 0, "flag-name-8814"
+//   8815: group 0, "flag-name-8815"
+//   8816: group 0, "flag-name-8816"
+//   8817: group 0, "flag-name-8817"
+//   8818: group 0, "flag-name-8818"
+//   8819: group 0, "flag-name-8819"
+//   8820: group 0, "flag-name-8820"
+//   8821: group 0, "flag-name-8821"
+//   8822: group 0, "flag-name-8822"
+//   8823: group 0, "flag-name-8823"
+//   8824: group 0, "flag-name-8824"
+//   8825: group 0, "flag-name-8825"
+//   8826: group 0, "flag-name-8826"
+//   8827: group 0, "flag-name-8827"
+//   8828: group 0, "flag-name-8828"
+//   8829: group 0, "flag-name-8829"
+//   8830: group 0, "flag-name-8830"
+//   8831: group 0, "flag-name-8831"
+//   8832: group 0, "flag-name-8832"
+//   8833: group 0, "flag-name-8833"
+//   8834: group 0, "flag-name-8834"
+//   8835: group 0, "flag-name-8835"
+//   8836: group 0, "flag-name-8836"
+//   8837: group 0, "flag-name-8837"
+//   8838: group 0, "flag-name-8838"
+//   8839: group 0, "flag-name-8839"
+//   8840: group 0, "flag-name-8840"
+//   8841: group 0, "flag-name-8841"
+//   8842: group 0, "flag-name-8842"
+//   8843: group 0, "flag-name-8843"
+//   8844: group 0, "flag-name-8844"
+//   8845: group 0, "flag-name-8845"
+//   8846: group 0, "flag-name-8846"
+//   8847: group 0, "flag-name-8847"
+//   8848: group 0, "flag-name-8848"
+//   8849: group 0, "flag-name-8849"
+//   8850: group 0, "flag-name-8850"
+//   8851: group 0, "flag-name-8851"
+//   8852: group 0, "flag-name-8852"
+//   8853: group 0, "flag-name-8853"
+//   8854: group 0, "flag-name-8854"
+//   8855: group 0, "flag-name-8855"
+//   8856: group 0, "flag-name-8856"
+//   8857: group 0, "flag-name-8857"
+//   8858: group 0, "flag-name-8858"
+//   8859: group 0, "flag-name-8859"
+//   8860: group 0, "flag-name-8860"
+//   8861: group 0, "flag-name-8861"
+//   8862: group 0, "flag-name-8862"
+//   8863: group 0, "flag-name-8863"
+//   8864: group 0, "flag-name-8864"
+//   8865: group 0, "flag-name-8865"
+//   8866: group 0, "flag-name-8866"
+//   8867: group 0, "flag-name-8867"
+//   8868: group 0, "flag-name-8868"
+//   8869: group 0, "flag-name-8869"
+//   8870: group 0, "flag-name-8870"
+//   8871: group 0, "flag-name-8871"
+//   8872: group 0, "flag-name-8872"
+//   8873: group 0, "flag-name-8873"
+//   8874: group 0, "flag-name-8874"
+//   8875: group 0, "flag-name-8875"
+//   8876: group 0, "flag-name-8876"
+//   8877: group 0, "flag-name-8877"
+//   8878: group 0, "flag-name-8878"
+//   8879: group 0, "flag-name-8879"
+//   8880: group 0, "flag-name-8880"
+//   8881: group 0, "flag-name-8881"
+//   8882: group 0, "flag-name-8882"
+//   8883: group 0, "flag-name-8883"
+//   8884: group 0, "flag-name-8884"
+//   8885: group 0, "flag-name-8885"
+//   8886: group 0, "flag-name-8886"
+//   8887: group 0, "flag-name-8887"
+//   8888: group 0, "flag-name-8888"
+//   8889: group 0, "flag-name-8889"
+//   8890: group 0, "flag-name-8890"
+//   8891: group 0, "flag-name-8891"
+//   8892: group 0, "flag-name-8892"
+//   8893: group 0, "flag-name-8893"
+//   8894: group 0, "flag-name-8894"
+//   8895: group 0, "flag-name-8895"
+//   8896: group 0, "flag-name-8896"
+//   8897: group 0, "flag-name-8897"
+//   8898: group 0, "flag-name-8898"
+//   8899: group 0, "flag-name-8899"
+//   8900: group 0, "flag-name-8900"
+//   8901: group 0, "flag-name-8901"
+//   8902: group 0, "flag-name-8902"
+//   8903: group 0, "flag-name-8903"
+//   8904: group 0, "flag-name-8904"
+//   8905: group 0, "flag-name-8905"
+//   8906: group 0, "flag-name-8906"
+//   8907: group 0, "flag-name-8907"
+//   8908: group 0, "flag-name-8908"
+//   8909: group 0, "flag-name-8909"
+//   8910: group 0, "flag-name-8910"
+//   8911: group 0, "flag-name-8911"
+//   8912: group 0, "flag-name-8912"
+//   8913: group 0, "flag-name-8913"
+//   8914: group 0, "flag-name-8914"
+//   8915: group 0, "flag-name-8915"
+//   8916: group 0, "flag-name-8916"
+//   8917: group 0, "flag-name-8917"
+//   8918: group 0, "flag-name-8918"
+//   8919: group 0, "flag-name-8919"
+//   8920: group 0, "flag-name-8920"
+//   8921: group 0, "flag-name-8921"
+//   8922: group 0, "flag-name-8922"
+//   8923: group 0, "flag-name-8923"
+//   8924: group 0, "flag-name-8924"
+//   8925: group 0, "flag-name-8925"
+//   8926: group 0, "flag-name-8926"
+//   8927: group 0, "flag-name-8927"
+//   8928: group 0, "flag-name-8928"
+//   8929: group 0, "flag-name-8929"
+//   8930: group 0, "flag-name-8930"
+//   8931: group 0, "flag-name-8931"
+//   8932: group 0, "flag-name-8932"
+//   8933: group 0, "flag-name-8933"
+//   8934: group 0, "flag-name-8934"
+//   8935: group 0, "flag-name-8935"
+//   8936: group 0, "flag-name-8936"
+//   8937: group 0, "flag-name-8937"
+//   8938: group 0, "flag-name-8938"
+//   8939: group 0, "flag-name-8939"
+//   8940: group 0, "flag-name-8940"
+//   8941: group 0, "flag-name-8941"
+//   8942: group 0, "flag-name-8942"
+//   8943: group 0, "flag-name-8943"
+//   8944: group 0, "flag-name-8944"
+//   8945: group 0, "flag-name-8945"
+//   8946: group 0, "flag-name-8946"
+//   8947: group 0, "flag-name-8947"
+//   8948: group 0, "flag-name-8948"
+//   8949: group 0, "flag-name-8949"
+//   8950: group 0, "flag-name-8950"
+//   8951: group 0, "flag-name-8951"
+//   8952: group 0, "flag-name-8952"
+//   8953: group 0, "flag-name-8953"
+//   8954: group 0, "flag-name-8954"
+//   8955: group 0, "flag-name-8955"
+//   8956: group 0, "flag-name-8956"
+//   8957: group 0, "flag-name-8957"
+//   8958: group 0, "flag-name-8958"
+//   8959: group 0, "flag-name-8959"
+//   8960: group 0, "flag-name-8960"
+//   8961: group 0, "flag-name-8961"
+//   8962: group 0, "flag-name-8962"
+//   8963: group 0, "flag-name-8963"
+//   8964: group 0, "flag-name-8964"
+//   8965: group 0, "flag-name-8965"
+//   8966: group 0, "flag-name-8966"
+//   8967: group 0, "flag-name-8967"
+//   8968: group 0, "flag-name-8968"
+//   8969: group 0, "flag-name-8969"
+//   8970: group 0, "flag-name-8970"
+//   8971: group 0, "flag-name-8971"
+//   8972: group 0, "flag-name-8972"
+//   8973: group 0, "flag-name-8973"
+//   8974: group 0, "flag-name-8974"
+//   8975: group 0, "flag-name-8975"
+//   8976: group 0, "flag-name-8976"
+//   8977: group 0, "flag-name-8977"
+//   8978: group 0, "flag-name-8978"
+//   8979: group 0, "flag-name-8979"
+//   8980: group 0, "flag-name-8980"
+//   8981: group 0, "flag-name-8981"
+//   8982: group 0, "flag-name-8982"
+//   8983: group 0, "flag-name-8983"
+//   8984: group 0, "flag-name-8984"
+//   8985: group 0, "flag-name-8985"
+//   8986: group 0, "flag-name-8986"
+//   8987: group 0, "flag-name-8987"
+//   8988: group 0, "flag-name-8988"
+//   8989: group 0, "flag-name-8989"
+//   8990: group 0, "flag-name-8990"
+//   8991: group 0, "flag-name-8991"
+//   8992: group 0, "flag-name-8992"
+//   8993: group 0, "flag-name-8993"
+//   8994: group 0, "flag-name-8994"
+//   8995: group 0, "flag-name-8995"
+//   8996: group 0, "flag-name-8996"
+//   8997: group 0, "flag-name-8997"
+//   8998: group 0, "flag-name-8998"
+//   8999: group 0, "flag-name-8999"
+//   9000: group 0, "flag-name-9000"
+//   9001: group 0, "flag-name-9001"
+//   9002: group 0, "flag-name-9002"
+//   9003: group 0, "flag-name-9003"
+//   9004: group 0, "flag-name-9004"
+//   9005: group 0, "flag-name-9005"
+//   9006: group 0, "flag-name-9006"
+//   9007: group 0, "flag-name-9007"
+//   9008: group 0, "flag-name-9008"
+//   9009: group 0, "flag-name-9009"
+//   9010: group 0, "flag-name-9010"
+//   9011: group 0, "flag-name-9011"
+//   9012: group 0, "flag-name-9012"
+//   9013: group 0, "flag-name-9013"
+//   9014: group 0, "flag-name-9014"
+//   9015: group 0, "flag-name-9015"
+//   9016: group 0, "flag-name-9016"
+//   9017: group 0, "flag-name-9017"
+//   9018: group 0, "flag-name-9018"
+//   9019: group 0, "flag-name-9019"
+//   9020: group 0, "flag-name-9020"
+//   9021: group 0, "flag-name-9021"
+//   9022: group 0, "flag-name-9022"
+//   9023: group 0, "flag-name-9023"
+//   9024: group 0, "flag-name-9024"
+//   9025: group 0, "flag-name-9025"
+//   9026: group 0, "flag-name-9026"
+//   9027: group 0, "flag-name-9027"
+//   9028: group 0, "flag-name-9028"
+//   9029: group 0, "flag-name-9029"
+//   9030: group 0, "flag-name-9030"
+//   9031: group 0, "flag-name-9031"
+//   9032: group 0, "flag-name-9032"
+//   9033: group 0, "flag-name-9033"
+//   9034: group 0, "flag-name-9034"
+//   9035: group 0, "flag-name-9035"
+//   9036: group 0, "flag-name-9036"
+//   9037: group 0, "flag-name-9037"
+//   9038: group 0, "flag-name-9038"
+//   9039: group 0, "flag-name-9039"
+//   9040: group 0, "flag-name-9040"
+//   9041: group 0, "flag-name-9041"
+//   9042: group 0, "flag-name-9042"
+//   9043: group 0, "flag-name-9043"
+//   9044: group 0, "flag-name-9044"
+//   9045: group 0, "flag-name-9045"
+//   9046: group 0, "flag-name-9046"
+//   9047: group 0, "flag-name-9047"
+//   9048: group 0, "flag-name-9048"
+//   9049: group 0, "flag-name-9049"
+//   9050: group 0, "flag-name-9050"
+//   9051: group 0, "flag-name-9051"
+//   9052: group 0, "flag-name-9052"
+//   9053: group 0, "flag-name-9053"
+//   9054: group 0, "flag-name-9054"
+//   9055: group 0, "flag-name-9055"
+//   9056: group 0, "flag-name-9056"
+//   9057: group 0, "flag-name-9057"
+//   9058: group 0, "flag-name-9058"
+//   9059: group 0, "flag-name-9059"
+//   9060: group 0, "flag-name-9060"
+//   9061: group 0, "flag-name-9061"
+//   9062: group 0, "flag-name-9062"
+//   9063: group 0, "flag-name-9063"
+//   9064: group 0, "flag-name-9064"
+//   9065: group 0, "flag-name-9065"
+//   9066: group 0, "flag-name-9066"
+//   9067: group 0, "flag-name-9067"
+//   9068: group 0, "flag-name-9068"
+//   9069: group 0, "flag-name-9069"
+//   9070: group 0, "flag-name-9070"
+//   9071: group 0, "flag-name-9071"
+//   9072: group 0, "flag-name-9072"
+//   9073: group 0, "flag-name-9073"
+//   9074: group 0, "flag-name-9074"
+//   9075: group 0, "flag-name-9075"
+//   9076: group 0, "flag-name-9076"
+//   9077: group 0, "flag-name-9077"
+//   9078: group 0, "flag-name-9078"
+//   9079: group 0, "flag-name-9079"
+//   9080: group 0, "flag-name-9080"
+//   9081: group 0, "flag-name-9081"
+//   9082: group 0, "flag-name-9082"
+//   9083: group 0, "flag-name-9083"
+//   9084: group 0, "flag-name-9084"
+//   9085: group 0, "flag-name-9085"
+//   9086: group 0, "flag-name-9086"
+//   9087: group 0, "flag-name-9087"
+//   9088: group 0, "flag-name-9088"
+//   9089: group 0, "flag-name-9089"
+//   9090: group 0, "flag-name-9090"
+//   9091: group 0, "flag-name-9091"
+//   9092: group 0, "flag-name-9092"
+//   9093: group 0, "flag-name-9093"
+//   9094: group 0, "flag-name-9094"
+//   9095: group 0, "flag-name-9095"
+//   9096: group 0, "flag-name-9096"
+//   9097: group 0, "flag-name-9097"
+//   9098: group 0, "flag-name-9098"
+//   9099: group 0, "flag-name-9099"
+//   9100: group 0, "flag-name-9100"
+//   9101: group 0, "flag-name-9101"
+//   9102: group 0, "flag-name-9102"
+//   9103: group 0, "flag-name-9103"
+//   9104: group 0, "flag-name-9104"
+//   9105: group 0, "flag-name-9105"
+//   9106: group 0, "flag-name-9106"
+//   9107: group 0, "flag-name-9107"
+//   9108: group 0, "flag-name-9108"
+//   9109: group 0, "flag-name-9109"
+//   9110: group 0, "flag-name-9110"
+//   9111: group 0, "flag-name-9111"
+//   9112: group 0, "flag-name-9112"
+//   9113: group 0, "flag-name-9113"
+//   9114: group 0, "flag-name-9114"
+//   9115: group 0, "flag-name-9115"
+//   9116: group 0, "flag-name-9116"
+//   9117: group 0, "flag-name-9117"
+//   9118: group 0, "flag-name-9118"
+//   9119: group 0, "flag-name-9119"
+//   9120: group 0, "flag-name-9120"
+//   9121: group 0, "flag-name-9121"
+//   9122: group 0, "flag-name-9122"
+//   9123: group 0, "flag-name-9123"
+//   9124: group 0, "flag-name-9124"
+//   9125: group 0, "flag-name-9125"
+//   9126: group 0, "flag-name-9126"
+//   9127: group 0, "flag-name-9127"
+//   9128: group 0, "flag-name-9128"
+//   9129: group 0, "flag-name-9129"
+//   9130: group 0, "flag-name-9130"
+//   9131: group 0, "flag-name-9131"
+//   9132: group 0, "flag-name-9132"
+//   9133: group 0, "flag-name-9133"
+//   9134: group 0, "flag-name-9134"
+//   9135: group 0, "flag-name-9135"
+//   9136: group 0, "flag-name-9136"
+//   9137: group 0, "flag-name-9137"
+//   9138: group 0, "flag-name-9138"
+//   9139: group 0, "flag-name-9139"
+//   9140: group 0, "flag-name-9140"
+//   9141: group 0, "flag-name-9141"
+//   9142: group 0, "flag-name-9142"
+//   9143: group 0, "flag-name-9143"
+//   9144: group 0, "flag-name-9144"
+//   9145: group 0, "flag-name-9145"
+//   9146: group 0, "flag-name-9146"
+//   9147: group 0, "flag-name-9147"
+//   9148: group 0, "flag-name-9148"
+//   9149: group 0, "flag-name-9149"
+//   9150: group 0, "flag-name-9150"
+//   9151: group 0, "flag-name-9151"
+//   9152: group 0, "flag-name-9152"
+//   9153: group 0, "flag-name-9153"
+//   9154: group 0, "flag-name-9154"
+//   9155: group 0, "flag-name-9155"
+//   9156: group 0, "flag-name-9156"
+//   9157: group 0, "flag-name-9157"
+//   9158: group 0, "flag-name-9158"
+//   9159: group 0, "flag-name-9159"
+//   9160: group 0, "flag-name-9160"
+//   9161: group 0, "flag-name-9161"
+//   9162: group 0, "flag-name-9162"
+//   9163: group 0, "flag-name-9163"
+//   9164: group 0, "flag-name-9164"
+//   9165: group 0, "flag-name-9165"
+//   9166: group 0, "flag-name-9166"
+//   9167: group 0, "flag-name-9167"
+//   9168: group 0, "flag-name-9168"
+//   9169: group 0, "flag-name-9169"
+//   9170: group 0, "flag-name-9170"
+//   9171: group 0, "flag-name-9171"
+//   9172: group 0, "flag-name-9172"
+//   9173: group 0, "flag-name-9173"
+//   9174: group 0, "flag-name-9174"
+//   9175: group 0, "flag-name-9175"
+//   9176: group 0, "flag-name-9176"
+//   9177: group 0, "flag-name-9177"
+//   9178: group 0, "flag-name-9178"
+//   9179: group 0, "flag-name-9179"
+//   9180: group 0, "flag-name-9180"
+//   9181: group 0, "flag-name-9181"
+//   9182: group 0, "flag-name-9182"
+//   9183: group 0, "flag-name-9183"
+//   9184: group 0, "flag-name-9184"
+//   9185: group 0, "flag-name-9185"
+//   9186: group 0, "flag-name-9186"
+//   9187: group 0, "flag-name-9187"
+//   9188: group 0, "flag-name-9188"
+//   9189: group 0, "flag-name-9189"
+//   9190: group 0, "flag-name-9190"
+//   9191: group 0, "flag-name-9191"
+//   9192: group 0, "flag-name-9192"
+//   9193: group 0, "flag-name-9193"
+//   9194: group 0, "flag-name-9194"
+//   9195: group 0, "flag-name-9195"
+//   9196: group 0, "flag-name-9196"
+//   9197: group 0, "flag-name-9197"
+//   9198: group 0, "flag-name-9198"
+//   9199: group 0, "flag-name-9199"
+//   9200: group 0, "flag-name-9200"
+//   9201: group 0, "flag-name-9201"
+//   9202: group 0, "flag-name-9202"
+//   9203: group 0, "flag-name-9203"
+//   9204: group 0, "flag-name-9204"
+//   9205: group 0, "flag-name-9205"
+//   9206: group 0, "flag-name-9206"
+//   9207: group 0, "flag-name-9207"
+//   9208: group 0, "flag-name-9208"
+//   9209: group 0, "flag-name-9209"
+//   9210: group 0, "flag-name-9210"
+//   9211: group 0, "flag-name-9211"
+//   9212: group 0, "flag-name-9212"
+//   9213: group 0, "flag-name-9213"
+//   9214: group 0, "flag-name-9214"
+//   9215: group 0, "flag-name-9215"
+//   9216: group 0, "flag-name-9216"
+//   9217: group 0, "flag-name-9217"
+//   9218: group 0, "flag-name-9218"
+//   9219: group 0, "flag-name-9219"
+//   9220: group 0, "flag-name-9220"
+//   9221: group 0, "flag-name-9221"
+//   9222: group 0, "flag-name-9222"
+//   9223: group 0, "flag-name-9223"
+//   9224: group 0, "flag-name-9224"
+//   9225: group 0, "flag-name-9225"
+//   9226: group 0, "flag-name-9226"
+//   9227: group 0, "flag-name-9227"
+//   9228: group 0, "flag-name-9228"
+//   9229: group 0, "flag-name-9229"
+//   9230: group 0, "flag-name-9230"
+//   9231: group 0, "flag-name-9231"
+//   9232: group 0, "flag-name-9232"
+//   9233: group 0, "flag-name-9233"
+//   9234: group 0, "flag-name-9234"
+//   9235: group 0, "flag-name-9235"
+//   9236: group 0, "flag-name-9236"
+//   9237: group 0, "flag-name-9237"
+//   9238: group 0, "flag-name-9238"
+//   9239: group 0, "flag-name-9239"
+//   9240: group 0, "flag-name-9240"
+//   9241: group 0, "flag-name-9241"
+//   9242: group 0, "flag-name-9242"
+//   9243: group 0, "flag-name-9243"
+//   9244: group 0, "flag-name-9244"
+//   9245: group 0, "flag-name-9245"
+//   9246: group 0, "flag-name-9246"
+//   9247: group 0, "flag-name-9247"
+//   9248: group 0, "flag-name-9248"
+//   9249: group 0, "flag-name-9249"
+//   9250: group 0, "flag-name-9250"
+//   9251: group 0, "flag-name-9251"
+//   9252: group 0, "flag-name-9252"
+//   9253: group 0, "flag-name-9253"
+//   9254: group 0, "flag-name-9254"
+//   9255: group 0, "flag-name-9255"
+//   9256: group 0, "flag-name-9256"
+//   9257: group 0, "flag-name-9257"
+//   9258: group 0, "flag-name-9258"
+//   9259: group 0, "flag-name-9259"
+//   9260: group 0, "flag-name-9260"
+//   9261: group 0, "flag-name-9261"
+//   9262: group 0, "flag-name-9262"
+//   9263: group 0, "flag-name-9263"
+//   9264: group 0, "flag-name-9264"
+//   9265: group 0, "flag-name-9265"
+//   9266: group 0, "flag-name-9266"
+//   9267: group 0, "flag-name-9267"
+//   9268: group 0, "flag-name-9268"
+//   9269: group 0, "flag-name-9269"
+//   9270: group 0, "flag-name-9270"
+//   9271: group 0, "flag-name-9271"
+//   9272: group 0, "flag-name-9272"
+//   9273: group 0, "flag-name-9273"
+//   9274: group 0, "flag-name-9274"
+//   9275: group 0, "flag-name-9275"
+//   9276: group 0, "flag-name-9276"
+//   9277: group 0, "flag-name-9277"
+//   9278: group 0, "flag-name-9278"
+//   9279: group 0, "flag-name-9279"
+//   9280: group 0, "flag-name-9280"
+//   9281: group 0, "flag-name-9281"
+//   9282: group 0, "flag-name-9282"
+//   9283: group 0, "flag-name-9283"
+//   9284: group 0, "flag-name-9284"
+//   9285: group 0, "flag-name-9285"
+//   9286: group 0, "flag-name-9286"
+//   9287: group 0, "flag-name-9287"
+//   9288: group 0, "flag-name-9288"
+//   9289: group 0, "flag-name-9289"
+//   9290: group 0, "flag-name-9290"
+//   9291: group 0, "flag-name-9291"
+//   9292: group 0, "flag-name-9292"
+//   9293: group 0, "flag-name-9293"
+//   9294: group 0, "flag-name-9294"
+//   9295: group 0, "flag-name-9295"
+//   9296: group 0, "flag-name-9296"
+//   9297: group 0, "flag-name-9297"
+//   9298: group 0, "flag-name-9298"
+//   9299: group 0, "flag-name-9299"
+//   9300: group 0, "flag-name-9300"
+//   9301: group 0, "flag-name-9301"
+//   9302: group 0, "flag-name-9302"
+//   9303: group 0, "flag-name-9303"
+//   9304: group 0, "flag-name-9304"
+//   9305: group 0, "flag-name-9305"
+//   9306: group 0, "flag-name-9306"
+//   9307: group 0, "flag-name-9307"
+//   9308: group 0, "flag-name-9308"
+//   9309: group 0, "flag-name-9309"
+//   9310: group 0, "flag-name-9310"
+//   9311: group 0, "flag-name-9311"
+//   9312: group 0, "flag-name-9312"
+//   9313: group 0, "flag-name-9313"
+//   9314: group 0, "flag-name-9314"
+//   9315: group 0, "flag-name-9315"
+//   9316: group 0, "flag-name-9316"
+//   9317: group 0, "flag-name-9317"
+//   9318: group 0, "flag-name-9318"
+//   9319: group 0, "flag-name-9319"
+//   9320: group 0, "flag-name-9320"
+//   9321: group 0, "flag-name-9321"
+//   9322: group 0, "flag-name-9322"
+//   9323: group 0, "flag-name-9323"
+//   9324: group 0, "flag-name-9324"
+//   9325: group 0, "flag-name-9325"
+//   9326: group 0, "flag-name-9326"
+//   9327: group 0, "flag-name-9327"
+//   9328: group 0, "flag-name-9328"
+//   9329: group 0, "flag-name-9329"
+//   9330: group 0, "flag-name-9330"
+//   9331: group 0, "flag-name-9331"
+//   9332: group 0, "flag-name-9332"
+//   9333: group 0, "flag-name-9333"
+//   9334: group 0, "flag-name-9334"
+//   9335: group 0, "flag-name-9335"
+//   9336: group 0, "flag-name-9336"
+//   9337: group 0, "flag-name-9337"
+//   9338: group 0, "flag-name-9338"
+//   9339: group 0, "flag-name-9339"
+//   9340: group 0, "flag-name-9340"
+//   9341: group 0, "flag-name-9341"
+//   9342: group 0, "flag-name-9342"
+//   9343: group 0, "flag-name-9343"
+//   9344: group 0, "flag-name-9344"
+//   9345: group 0, "flag-name-9345"
+//   9346: group 0, "flag-name-9346"
+//   9347: group 0, "flag-name-9347"
+//   9348: group 0, "flag-name-9348"
+//   9349: group 0, "flag-name-9349"
+//   9350: group 0, "flag-name-9350"
+//   9351: group 0, "flag-name-9351"
+//   9352: group 0, "flag-name-9352"
+//   9353: group 0, "flag-name-9353"
+//   9354: group 0, "flag-name-9354"
+//   9355: group 0, "flag-name-9355"
+//   9356: group 0, "flag-name-9356"
+//   9357: group 0, "flag-name-9357"
+//   9358: group 0, "flag-name-9358"
+//   9359: group 0, "flag-name-9359"
+//   9360: group 0, "flag-name-9360"
+//   9361: group 0, "flag-name-9361"
+//   9362: group 0, "flag-name-9362"
+//   9363: group 0, "flag-name-9363"
+//   9364: group 0, "flag-name-9364"
+//   9365: group 0, "flag-name-9365"
+//   9366: group 0, "flag-name-9366"
+//   9367: group 0, "flag-name-9367"
+//   9368: group 0, "flag-name-9368"
+//   9369: group 0, "flag-name-9369"
+//   9370: group 0, "flag-name-9370"
+//   9371: group 0, "flag-name-9371"
+//   9372: group 0, "flag-name-9372"
+//   9373: group 0, "flag-name-9373"
+//   9374: group 0, "flag-name-9374"
+//   9375: group 0, "flag-name-9375"
+//   9376: group 0, "flag-name-9376"
+//   9377: group 0, "flag-name-9377"
+//   9378: group 0, "flag-name-9378"
+//   9379: group 0, "flag-name-9379"
+//   9380: group 0, "flag-name-9380"
+//   9381: group 0, "flag-name-9381"
+//   9382: group 0, "flag-name-9382"
+//   9383: group 0, "flag-name-9383"
+//   9384: group 0, "flag-name-9384"
+//   9385: group 0, "flag-name-9385"
+//   9386: group 0, "flag-name-9386"
+//   9387: group 0, "flag-name-9387"
+//   9388: group 0, "flag-name-9388"
+//   9389: group 0, "flag-name-9389"
+//   9390: group 0, "flag-name-9390"
+//   9391: group 0, "flag-name-9391"
+//   9392: group 0, "flag-name-9392"
+//   9393: group 0, "flag-name-9393"
+//   9394: group 0, "flag-name-9394"
+//   9395: group 0, "flag-name-9395"
+//   9396: group 0, "flag-name-9396"
+//   9397: group 0, "flag-name-9397"
+//   9398: group 0, "flag-name-9398"
+//   9399: group 0, "flag-name-9399"
+//   9400: group 0, "flag-name-9400"
+//   9401: group 0, "flag-name-9401"
+//   9402: group 0, "flag-name-9402"
+//   9403: group 0, "flag-name-9403"
+//   9404: group 0, "flag-name-9404"
+//   9405: group 0, "flag-name-9405"
+//   9406: group 0, "flag-name-9406"
+//   9407: group 0, "flag-name-9407"
+//   9408: group 0, "flag-name-9408"
+//   9409: group 0, "flag-name-9409"
+//   9410: group 0, "flag-name-9410"
+//   9411: group 0, "flag-name-9411"
+//   9412: group 0, "flag-name-9412"
+//   9413: group 0, "flag-name-9413"
+//   9414: group 0, "flag-name-9414"
+//   9415: group 0, "flag-name-9415"
+//   9416: group 0, "flag-name-9416"
+//   9417: group 0, "flag-name-9417"
+//   9418: group 0, "flag-name-9418"
+//   9419: group 0, "flag-name-9419"
+//   9420: group 0, "flag-name-9420"
+//   9421: group 0, "flag-name-9421"
+//   9422: group 0, "flag-name-9422"
+//   9423: group 0, "flag-name-9423"
+//   9424: group 0, "flag-name-9424"
+//   9425: group 0, "flag-name-9425"
+//   9426: group 0, "flag-name-9426"
+//   9427: group 0, "flag-name-9427"
+//   9428: group 0, "flag-name-9428"
+//   9429: group 0, "flag-name-9429"
+//   9430: group 0, "flag-name-9430"
+//   9431: group 0, "flag-name-9431"
+//   9432: group 0, "flag-name-9432"
+//   9433: group 0, "flag-name-9433"
+//   9434: group 0, "flag-name-9434"
+//   9435: group 0, "flag-name-9435"
+//   9436: group 0, "flag-name-9436"
+//   9437: group 0, "flag-name-9437"
+//   9438: group 0, "flag-name-9438"
+//   9439: group 0, "flag-name-9439"
+//   9440: group 0, "flag-name-9440"
+//   9441: group 0, "flag-name-9441"
+//   9442: group 0, "flag-name-9442"
+//   9443: group 0, "flag-name-9443"
+//   9444: group 0, "flag-name-9444"
+//   9445: group 0, "flag-name-9445"
+//   9446: group 0, "flag-name-9446"
+//   9447: group 0, "flag-name-9447"
+//   9448: group 0, "flag-name-9448"
+//   9449: group 0, "flag-name-9449"
+//   9450: group 0, "flag-name-9450"
+//   9451: group 0, "flag-name-9451"
+//   9452: group 0, "flag-name-9452"
+//   9453: group 0, "flag-name-9453"
+//   9454: group 0, "flag-name-9454"
+//   9455: group 0, "flag-name-9455"
+//   9456: group 0, "flag-name-9456"
+//   9457: group 0, "flag-name-9457"
+//   9458: group 0, "flag-name-9458"
+//   9459: group 0, "flag-name-9459"
+//   9460: group 0, "flag-name-9460"
+//   9461: group 0, "flag-name-9461"
+//   9462: group 0, "flag-name-9462"
+//   9463: group 0, "flag-name-9463"
+//   9464: group 0, "flag-name-9464"
+//   9465: group 0, "flag-name-9465"
+//   9466: group 0, "flag-name-9466"
+//   9467: group 0, "flag-name-9467"
+//   9468: group 0, "flag-name-9468"
+//   9469: group 0, "flag-name-9469"
+//   9470: group 0, "flag-name-9470"
+//   9471: group 0, "flag-name-9471"
+//   9472: group 0, "flag-name-9472"
+//   9473: group 0, "flag-name-9473"
+//   9474: group 0, "flag-name-9474"
+//   9475: group 0, "flag-name-9475"
+//   9476: group 0, "flag-name-9476"
+//   9477: group 0, "flag-name-9477"
+//   9478: group 0, "flag-name-9478"
+//   9479: group 0, "flag-name-9479"
+//   9480: group 0, "flag-name-9480"
+//   9481: group 0, "flag-name-9481"
+//   9482: group 0, "flag-name-9482"
+//   9483: group 0, "flag-name-9483"
+//   9484: group 0, "flag-name-9484"
+//   9485: group 0, "flag-name-9485"
+//   9486: group 0, "flag-name-9486"
+//   9487: group 0, "flag-name-9487"
+//   9488: group 0, "flag-name-9488"
+//   9489: group 0, "flag-name-9489"
+//   9490: group 0, "flag-name-9490"
+//   9491: group 0, "flag-name-9491"
+//   9492: group 0, "flag-name-9492"
+//   9493: group 0, "flag-name-9493"
+//   9494: group 0, "flag-name-9494"
+//   9495: group 0, "flag-name-9495"
+//   9496: group 0, "flag-name-9496"
+//   9497: group 0, "flag-name-9497"
+//   9498: group 0, "flag-name-9498"
+//   9499: group 0, "flag-name-9499"
+//   9500: group 0, "flag-name-9500"
+//   9501: group 0, "flag-name-9501"
+//   9502: group 0, "flag-name-9502"
+//   9503: group 0, "flag-name-9503"
+//   9504: group 0, "flag-name-9504"
+//   9505: group 0, "flag-name-9505"
+//   9506: group 0, "flag-name-9506"
+//   9507: group 0, "flag-name-9507"
+//   9508: group 0, "flag-name-9508"
+//   9509: group 0, "flag-name-9509"
+//   9510: group 0, "flag-name-9510"
+//   9511: group 0, "flag-name-9511"
+//   9512: group 0, "flag-name-9512"
+//   9513: group 0, "flag-name-9513"
+//   9514: group 0, "flag-name-9514"
+//   9515: group 0, "flag-name-9515"
+//   9516: group 0, "flag-name-9516"
+//   9517: group 0, "flag-name-9517"
+//   9518: group 0, "flag-name-9518"
+//   9519: group 0, "flag-name-9519"
+//   9520: group 0, "flag-name-9520"
+//   9521: group 0, "flag-name-9521"
+//   9522: group 0, "flag-name-9522"
+//   9523: group 0, "flag-name-9523"
+//   9524: group 0, "flag-name-9524"
+//   9525: group 0, "flag-name-9525"
+//   9526: group 0, "flag-name-9526"
+//   9527: group 0, "flag-name-9527"
+//   9528: group 0, "flag-name-9528"
+//   9529: group 0, "flag-name-9529"
+//   9530: group 0, "flag-name-9530"
+//   9531: group 0, "flag-name-9531"
+//   9532: group 0, "flag-name-9532"
+//   9533: group 0, "flag-name-9533"
+//   9534: group 0, "flag-name-9534"
+//   9535: group 0, "flag-name-9535"
+//   9536: group 0, "flag-name-9536"
+//   9537: group 0, "flag-name-9537"
+//   9538: group 0, "flag-name-9538"
+//   9539: group 0, "flag-name-9539"
+//   9540: group 0, "flag-name-9540"
+//   9541: group 0, "flag-name-9541"
+//   9542: group 0, "flag-name-9542"
+//   9543: group 0, "flag-name-9543"
+//   9544: group 0, "flag-name-9544"
+//   9545: group 0, "flag-name-9545"
+//   9546: group 0, "flag-name-9546"
+//   9547: group 0, "flag-name-9547"
+//   9548: group 0, "flag-name-9548"
+//   9549: group 0, "flag-name-9549"
+//   9550: group 0, "flag-name-9550"
+//   9551: group 0, "flag-name-9551"
+//   9552: group 0, "flag-name-9552"
+//   9553: group 0, "flag-name-9553"
+//   9554: group 0, "flag-name-9554"
+//   9555: group 0, "flag-name-9555"
+//   9556: group 0, "flag-name-9556"
+//   9557: group 0, "flag-name-9557"
+//   9558: group 0, "flag-name-9558"
+//   9559: group 0, "flag-name-9559"
+//   9560: group 0, "flag-name-9560"
+//   9561: group 0, "flag-name-9561"
+//   9562: group 0, "flag-name-9562"
+//   9563: group 0, "flag-name-9563"
+//   9564: group 0, "flag-name-9564"
+//   9565: group 0, "flag-name-9565"
+//   9566: group 0, "flag-name-9566"
+//   9567: group 0, "flag-name-9567"
+//   9568: group 0, "flag-name-9568"
+//   9569: group 0, "flag-name-9569"
+//   9570: group 0, "flag-name-9570"
+//   9571: group 0, "flag-name-9571"
+//   9572: group 0, "flag-name-9572"
+//   9573: group 0, "flag-name-9573"
+//   9574: group 0, "flag-name-9574"
+//   9575: group 0, "flag-name-9575"
+//   9576: group 0, "flag-name-9576"
+//   9577: group 0, "flag-name-9577"
+//   9578: group 0, "flag-name-9578"
+//   9579: group 0, "flag-name-9579"
+//   9580: group 0, "flag-name-9580"
+//   9581: group 0, "flag-name-9581"
+//   9582: group 0, "flag-name-9582"
+//   9583: group 0, "flag-name-9583"
+//   9584: group 0, "flag-name-9584"
+//   9585: group 0, "flag-name-9585"
+//   9586: group 0, "flag-name-9586"
+//   9587: group 0, "flag-name-9587"
+//   9588: group 0, "flag-name-9588"
+//   9589: group 0, "flag-name-9589"
+//   9590: group 0, "flag-name-9590"
+//   9591: group 0, "flag-name-9591"
+//   9592: group 0, "flag-name-9592"
+//   9593: group 0, "flag-name-9593"
+//   9594: group 0, "flag-name-9594"
+//   9595: group 0, "flag-name-9595"
+//   9596: group 0, "flag-name-9596"
+//   9597: group 0, "flag-name-9597"
+//   9598: group 0, "flag-name-9598"
+//   9599: group 0, "flag-name-9599"
+//   9600: group 0, "flag-name-9600"
+//   9601: group 0, "flag-name-9601"
+//   9602: group 0, "flag-name-9602"
+//   9603: group 0, "flag-name-9603"
+//   9604: group 0, "flag-name-9604"
+//   9605: group 0, "flag-name-9605"
+//   9606: group 0, "flag-name-9606"
+//   9607: group 0, "flag-name-9607"
+//   9608: group 0, "flag-name-9608"
+//   9609: group 0, "flag-name-9609"
+//   9610: group 0, "flag-name-9610"
+//   9611: group 0, "flag-name-9611"
+//   9612: group 0, "flag-name-9612"
+//   9613: group 0, "flag-name-9613"
+//   9614: group 0, "flag-name-9614"
+//   9615: group 0, "flag-name-9615"
+//   9616: group 0, "flag-name-9616"
+//   9617: group 0, "flag-name-9617"
+//   9618: group 0, "flag-name-9618"
+//   9619: group 0, "flag-name-9619"
+//   9620: group 0, "flag-name-9620"
+//   9621: group 0, "flag-name-9621"
+//   9622: group 0, "flag-name-9622"
+//   9623: group 0, "flag-name-9623"
+//   9624: group 0, "flag-name-9624"
+//   9625: group 0, "flag-name-9625"
+//   9626: group 0, "flag-name-9626"
+//   9627: group 0, "flag-name-9627"
+//   9628: group 0, "flag-name-9628"
+//   9629: group 0, "flag-name-9629"
+//   9630: group 0, "flag-name-9630"
+//   9631: group 0, "flag-name-9631"
+//   9632: group 0, "flag-name-9632"
+//   9633: group 0, "flag-name-9633"
+//   9634: group 0, "flag-name-9634"
+//   9635: group 0, "flag-name-9635"
+//   9636: group 0, "flag-name-9636"
+//   9637: group 0, "flag-name-9637"
+//   9638: group 0, "flag-name-9638"
+//   9639: group 0, "flag-name-9639"
+//   9640: group 0, "flag-name-9640"
+//   9641: group 0, "flag-name-9641"
+//   9642: group 0, "flag-name-9642"
+//   9643: group 0, "flag-name-9643"
+//   9644: group 0, "flag-name-9644"
+//   9645: group 0, "flag-name-9645"
+//   9646: group 0, "flag-name-9646"
+//   9647: group 0, "flag-name-9647"
+//   9648: group 0, "flag-name-9648"
+//   9649: group 0, "flag-name-9649"
+//   9650: group 0, "flag-name-9650"
+//   9651: group 0, "flag-name-9651"
+//   9652: group 0, "flag-name-9652"
+//   9653: group 0, "flag-name-9653"
+//   9654: group 0, "flag-name-9654"
+//   9655: group 0, "flag-name-9655"
+//   9656: group 0, "flag-name-9656"
+//   9657: group 0, "flag-name-9657"
+//   9658: group 0, "flag-name-9658"
+//   9659: group 0, "flag-name-9659"
+//   9660: group 0, "flag-name-9660"
+//   9661: group 0, "flag-name-9661"
+//   9662: group 0, "flag-name-9662"
+//   9663: group 0, "flag-name-9663"
+//   9664: group 0, "flag-name-9664"
+//   9665: group 0, "flag-name-9665"
+//   9666: group 0, "flag-name-9666"
+//   9667: group 0, "flag-name-9667"
+//   9668: group 0, "flag-name-9668"
+//   9669: group 0, "flag-name-9669"
+//   9670: group 0, "flag-name-9670"
+//   9671: group 0, "flag-name-9671"
+//   9672: group 0, "flag-name-9672"
+//   9673: group 0, "flag-name-9673"
+//   9674: group 0, "flag-name-9674"
+//   9675: group 0, "flag-name-9675"
+//   9676: group 0, "flag-name-9676"
+//   9677: group 0, "flag-name-9677"
+//   9678: group 0, "flag-name-9678"
+//   9679: group 0, "flag-name-9679"
+//   9680: group 0, "flag-name-9680"
+//   9681: group 0, "flag-name-9681"
+//   9682: group 0, "flag-name-9682"
+//   9683: group 0, "flag-name-9683"
+//   9684: group 0, "flag-name-9684"
+//   9685: group 0, "flag-name-9685"
+//   9686: group 0, "flag-name-9686"
+//   9687: group 0, "flag-name-9687"
+//   9688: group 0, "flag-name-9688"
+//   9689: group 0, "flag-name-9689"
+//   9690: group 0, "flag-name-9690"
+//   9691: group 0, "flag-name-9691"
+//   9692: group 0, "flag-name-9692"
+//   9693: group 0, "flag-name-9693"
+//   9694: group 0, "flag-name-9694"
+//   9695: group 0, "flag-name-9695"
+//   9696: group 0, "flag-name-9696"
+//   9697: group 0, "flag-name-9697"
+//   9698: group 0, "flag-name-9698"
+//   9699: group 0, "flag-name-9699"
+//   9700: group 0, "flag-name-9700"
+//   9701: group 0, "flag-name-9701"
+//   9702: group 0, "flag-name-9702"
+//   9703: group 0, "flag-name-9703"
+//   9704: group 0, "flag-name-9704"
+//   9705: group 0, "flag-name-9705"
+//   9706: group 0, "flag-name-9706"
+//   9707: group 0, "flag-name-9707"
+//   9708: group 0, "flag-name-9708"
+//   9709: group 0, "flag-name-9709"
+//   9710: group 0, "flag-name-9710"
+//   9711: group 0, "flag-name-9711"
+//   9712: group 0, "flag-name-9712"
+//   9713: group 0, "flag-name-9713"
+//   9714: group 0, "flag-name-9714"
+//   9715: group 0, "flag-name-9715"
+//   9716: group 0, "flag-name-9716"
+//   9717: group 0, "flag-name-9717"
+//   9718: group 0, "flag-name-9718"
+//   9719: group 0, "flag-name-9719"
+//   9720: group 0, "flag-name-9720"
+//   9721: group 0, "flag-name-9721"
+//   9722: group 0, "flag-name-9722"
+//   9723: group 0, "flag-name-9723"
+//   9724: group 0, "flag-name-9724"
+//   9725: group 0, "flag-name-9725"
+//   9726: group 0, "flag-name-9726"
+//   9727: group 0, "flag-name-9727"
+//   9728: group 0, "flag-name-9728"
+//   9729: group 0, "flag-name-9729"
+//   9730: group 0, "flag-name-9730"
+//   9731: group 0, "flag-name-9731"
+//   9732: group 0, "flag-name-9732"
+//   9733: group 0, "flag-name-9733"
+//   9734: group 0, "flag-name-9734"
+//   9735: group 0, "flag-name-9735"
+//   9736: group 0, "flag-name-9736"
+//   9737: group 0, "flag-name-9737"
+//   9738: group 0, "flag-name-9738"
+//   9739: group 0, "flag-name-9739"
+//   9740: group 0, "flag-name-9740"
+//   9741: group 0, "flag-name-9741"
+//   9742: group 0, "flag-name-9742"
+//   9743: group 0, "flag-name-9743"
+//   9744: group 0, "flag-name-9744"
+//   9745: group 0, "flag-name-9745"
+//   9746: group 0, "flag-name-9746"
+//   9747: group 0, "flag-name-9747"
+//   9748: group 0, "flag-name-9748"
+//   9749: group 0, "flag-name-9749"
+//   9750: group 0, "flag-name-9750"
+//   9751: group 0, "flag-name-9751"
+//   9752: group 0, "flag-name-9752"
+//   9753: group 0, "flag-name-9753"
+//   9754: group 0, "flag-name-9754"
+//   9755: group 0, "flag-name-9755"
+//   9756: group 0, "flag-name-9756"
+//   9757: group 0, "flag-name-9757"
+//   9758: group 0, "flag-name-9758"
+//   9759: group 0, "flag-name-9759"
+//   9760: group 0, "flag-name-9760"
+//   9761: group 0, "flag-name-9761"
+//   9762: group 0, "flag-name-9762"
+//   9763: group 0, "flag-name-9763"
+//   9764: group 0, "flag-name-9764"
+//   9765: group 0, "flag-name-9765"
+//   9766: group 0, "flag-name-9766"
+//   9767: group 0, "flag-name-9767"
+//   9768: group 0, "flag-name-9768"
+//   9769: group 0, "flag-name-9769"
+//   9770: group 0, "flag-name-9770"
+//   9771: group 0, "flag-name-9771"
+//   9772: group 0, "flag-name-9772"
+//   9773: group 0, "flag-name-9773"
+//   9774: group 0, "flag-name-9774"
+//   9775: group 0, "flag-name-9775"
+//   9776: group 0, "flag-name-9776"
+//   9777: group 0, "flag-name-9777"
+//   9778: group 0, "flag-name-9778"
+//   9779: group 0, "flag-name-9779"
+//   9780: group 0, "flag-name-9780"
+//   9781: group 0, "flag-name-9781"
+//   9782: group 0, "flag-name-9782"
+//   9783: group 0, "flag-name-9783"
+//   9784: group 0, "flag-name-9784"
+//   9785: group 0, "flag-name-9785"
+//   9786: group 0, "flag-name-9786"
+//   9787: group 0, "flag-name-9787"
+//   9788: group 0, "flag-name-9788"
+//   9789: group 0, "flag-name-9789"
+//   9790: group 0, "flag-name-9790"
+//   9791: group 0, "flag-name-9791"
+//   9792: group 0, "flag-name-9792"
+//   9793: group 0, "flag-name-9793"
+//   9794: group 0, "flag-name-9794"
+//   9795: group 0, "flag-name-9795"
+//   9796: group 0, "flag-name-9796"
+//   9797: group 0, "flag-name-9797"
+//   9798: group 0, "flag-name-9798"
+//   9799: group 0, "flag-name-9799"
+//   9800: group 0, "flag-name-9800"
+//   9801: group 0, "flag-name-9801"
+//   9802: group 0, "flag-name-9802"
+//   9803: group 0, "flag-name-9803"
+//   9804: group 0, "flag-name-9804"
+//   9805: group 0, "flag-name-9805"
+//   9806: group 0, "flag-name-9806"
+//   9807: group 0, "flag-name-9807"
+//   9808: group 0, "flag-name-9808"
+//   9809: group 0, "flag-name-9809"
+//   9810: group 0, "flag-name-9810"
+//   9811: group 0, "flag-name-9811"
+//   9812: group 0, "flag-name-9812"
+//   9813: group 0, "flag-name-9813"
+//   9814: group 0, "flag-name-9814"
+//   9815: group 0, "flag-name-9815"
+//   9816: group 0, "flag-name-9816"
+//   9817: group 0, "flag-name-9817"
+//   9818: group 0, "flag-name-9818"
+//   9819: group 0, "flag-name-9819"
+//   9820: group 0, "flag-name-9820"
+//   9821: group 0, "flag-name-9821"
+//   9822: group 0, "flag-name-9822"
+//   9823: group 0, "flag-name-9823"
+//   9824: group 0, "flag-name-9824"
+//   9825: group 0, "flag-name-9825"
+//   9826: group 0, "flag-name-9826"
+//   9827: group 0, "flag-name-9827"
+//   9828: group 0, "flag-name-9828"
+//   9829: group 0, "flag-name-9829"
+//   9830: group 0, "flag-name-9830"
+//   9831: group 0, "flag-name-9831"
+//   9832: group 0, "flag-name-9832"
+//   9833: group 0, "flag-name-9833"
+//   9834: group 0, "flag-name-9834"
+//   9835: group 0, "flag-name-9835"
+//   9836: group 0, "flag-name-9836"
+//   9837: group 0, "flag-name-9837"
+//   9838: group 0, "flag-name-9838"
+//   9839: group 0, "flag-name-9839"
+//   9840: group 0, "flag-name-9840"
+//   9841: group 0, "flag-name-9841"
+//   9842: group 0, "flag-name-9842"
+//   9843: group 0, "flag-name-9843"
+//   9844: group 0, "flag-name-9844"
+//   9845: group 0, "flag-name-9845"
+//   9846: group 0, "flag-name-9846"
+//   9847: group 0, "flag-name-9847"
+//   9848: group 0, "flag-name-9848"
+//   9849: group 0, "flag-name-9849"
+//   9850: group 0, "flag-name-9850"
+//   9851: group 0, "flag-name-9851"
+//   9852: group 0, "flag-name-9852"
+//   9853: group 0, "flag-name-9853"
+//   9854: group 0, "flag-name-9854"
+//   9855: group 0, "flag-name-9855"
+//   9856: group 0, "flag-name-9856"
+//   9857: group 0, "flag-name-9857"
+//   9858: group 0, "flag-name-9858"
+//   9859: group 0, "flag-name-9859"
+//   9860: group 0, "flag-name-9860"
+//   9861: group 0, "flag-name-9861"
+//   9862: group 0, "flag-name-9862"
+//   9863: group 0, "flag-name-9863"
+//   9864: group 0, "flag-name-9864"
+//   9865: group 0, "flag-name-9865"
+//   9866: group 0, "flag-name-9866"
+//   9867: group 0, "flag-name-9867"
+//   9868: group 0, "flag-name-9868"
+//   9869: group 0, "flag-name-9869"
+//   9870: group 0, "flag-name-9870"
+//   9871: group 0, "flag-name-9871"
+//   9872: group 0, "flag-name-9872"
+//   9873: group 0, "flag-name-9873"
+//   9874: group 0, "flag-name-9874"
+//   9875: group 0, "flag-name-9875"
+//   9876: group 0, "flag-name-9876"
+//   9877: group 0, "flag-name-9877"
+//   9878: group 0, "flag-name-9878"
+//   9879: group 0, "flag-name-9879"
+//   9880: group 0, "flag-name-9880"
+//   9881: group 0, "flag-name-9881"
+//   9882: group 0, "flag-name-9882"
+//   9883: group 0, "flag-name-9883"
+//   9884: group 0, "flag-name-9884"
+//   9885: group 0, "flag-name-9885"
+//   9886: group 0, "flag-name-9886"
+//   9887: group 0, "flag-name-9887"
+//   9888: group 0, "flag-name-9888"
+//   9889: group 0, "flag-name-9889"
+//   9890: group 0, "flag-name-9890"
+//   9891: group 0, "flag-name-9891"
+//   9892: group 0, "flag-name-9892"
+//   9893: group 0, "flag-name-9893"
+//   9894: group 0, "flag-name-9894"
+//   9895: group 0, "flag-name-9895"
+//   9896: group 0, "flag-name-9896"
+//   9897: group 0, "flag-name-9897"
+//   9898: group 0, "flag-name-9898"
+//   9899: group 0, "flag-name-9899"
+//   9900: group 0, "flag-name-9900"
+//   9901: group 0, "flag-name-9901"
+//   9902: group 0, "flag-name-9902"
+//   9903: group 0, "flag-name-9903"
+//   9904: group 0, "flag-name-9904"
+//   9905: group 0, "flag-name-9905"
+//   9906: group 0, "flag-name-9906"
+//   9907: group 0, "flag-name-9907"
+//   9908: group 0, "flag-name-9908"
+//   9909: group 0, "flag-name-9909"
+//   9910: group 0, "flag-name-9910"
+//   9911: group 0, "flag-name-9911"
+//   9912: group 0, "flag-name-9912"
+//   9913: group 0, "flag-name-9913"
+//   9914: group 0, "flag-name-9914"
+//   9915: group 0, "flag-name-9915"
+//   9916: group 0, "flag-name-9916"
+//   9917: group 0, "flag-name-9917"
+//   9918: group 0, "flag-name-9918"
+//   9919: group 0, "flag-name-9919"
+//   9920: group 0, "flag-name-9920"
+//   9921: group 0, "flag-name-9921"
+//   9922: group 0, "flag-name-9922"
+//   9923: group 0, "flag-name-9923"
+//   9924: group 0, "flag-name-9924"
+//   9925: group 0, "flag-name-9925"
+//   9926: group 0, "flag-name-9926"
+//   9927: group 0, "flag-name-9927"
+//   9928: group 0, "flag-name-9928"
+//   9929: group 0, "flag-name-9929"
+//   9930: group 0, "flag-name-9930"
+//   9931: group 0, "flag-name-9931"
+//   9932: group 0, "flag-name-9932"
+//   9933: group 0, "flag-name-9933"
+//   9934: group 0, "flag-name-9934"
+//   9935: group 0, "flag-name-9935"
+//   9936: group 0, "flag-name-9936"
+//   9937: group 0, "flag-name-9937"
+//   9938: group 0, "flag-name-9938"
+//   9939: group 0, "flag-name-9939"
+//   9940: group 0, "flag-name-9940"
+//   9941: group 0, "flag-name-9941"
+//   9942: group 0, "flag-name-9942"
+//   9943: group 0, "flag-name-9943"
+//   9944: group 0, "flag-name-9944"
+//   9945: group 0, "flag-name-9945"
+//   9946: group 0, "flag-name-9946"
+//   9947: group 0, "flag-name-9947"
+//   9948: group 0, "flag-name-9948"
+//   9949: group 0, "flag-name-9949"
+//   9950: group 0, "flag-name-9950"
+//   9951: group 0, "flag-name-9951"
+//   9952: group 0, "flag-name-9952"
+//   9953: group 0, "flag-name-9953"
+//   9954: group 0, "flag-name-9954"
+//   9955: group 0, "flag-name-9955"
+//   9956: group 0, "flag-name-9956"
+//   9957: group 0, "flag-name-9957"
+//   9958: group 0, "flag-name-9958"
+//   9959: group 0, "flag-name-9959"
+//   9960: group 0, "flag-name-9960"
+//   9961: group 0, "flag-name-9961"
+//   9962: group 0, "flag-name-9962"
+//   9963: group 0, "flag-name-9963"
+//   9964: group 0, "flag-name-9964"
+//   9965: group 0, "flag-name-9965"
+//   9966: group 0, "flag-name-9966"
+//   9967: group 0, "flag-name-9967"
+//   9968: group 0, "flag-name-9968"
+//   9969: group 0, "flag-name-9969"
+//   9970: group 0, "flag-name-9970"
+//   9971: group 0, "flag-name-9971"
+//   9972: group 0, "flag-name-9972"
+//   9973: group 0, "flag-name-9973"
+//   9974: group 0, "flag-name-9974"
+//   9975: group 0, "flag-name-9975"
+//   9976: group 0, "flag-name-9976"
+//   9977: group 0, "flag-name-9977"
+//   9978: group 0, "flag-name-9978"
+//   9979: group 0, "flag-name-9979"
+//   9980: group 0, "flag-name-9980"
+//   9981: group 0, "flag-name-9981"
+//   9982: group 0, "flag-name-9982"
+//   9983: group 0, "flag-name-9983"
+//   9984: group 0, "flag-name-9984"
+//   9985: group 0, "flag-name-9985"
+//   9986: group 0, "flag-name-9986"
+//   9987: group 0, "flag-name-9987"
+//   9988: group 0, "flag-name-9988"
+//   9989: group 0, "flag-name-9989"
+//   9990: group 0, "flag-name-9990"
+//   9991: group 0, "flag-name-9991"
+//   9992: group 0, "flag-name-9992"
+//   9993: group 0, "flag-name-9993"
+//   9994: group 0, "flag-name-9994"
+//   9995: group 0, "flag-name-9995"
+//   9996: group 0, "flag-name-9996"
+//   9997: group 0, "flag-name-9997"
+//   9998: group 0, "flag-name-9998"
+//   9999: group 0, "flag-name-9999"
+//
+// extern const struct ArgpxStaticIndex bm_static_flags_index;
+
+#include "argpx/argpx.h"
+
+static const uint32_t bm_static_flags_index_disp_v_[2501] = {
+    208, 21, 2, 162, 50, 18, 14, 0, 20, 8, 4, 6,
+    0, 8, 1, 7, 45, 1, 0, 34, 111, 42, 3, 49,
+    5, 4, 6, 2, 54, 13, 41, 31, 1, 41, 31, 9,
+    100, 216, 78, 26, 5, 0, 20, 59, 0, 23, 0, 19,
+    77, 4, 8, 19, 23, 7, 0, 0, 17, 1, 5, 5,
+    254, 0, 0, 67, 0, 63, 61, 12, 7, 273, 212, 13,
+    2, 12, 2, 65, 34, 0, 40, 117, 66, 15, 53, 0,
+    32, 280, 3, 25, 155, 34, 37, 0, 76, 10, 394, 42,
+    0, 2, 53, 12, 2, 8, 167, 1, 5, 0, 4, 313,
+    104, 25, 19, 39, 66, 11, 5, 0, 0, 1, 1, 16,
+    29, 12, 127, 29, 2, 1, 101, 4, 25, 77, 0, 20,
+    25, 0, 4, 238, 2, 88, 175, 30, 4, 4, 107, 0,
+    26, 78, 5, 39, 5, 23, 28, 10, 75, 6, 31, 251,
+    14, 18, 6, 141, 0, 28, 2, 5, 219, 229, 18, 75,
+    14, 93, 1, 42, 12, 82, 1, 0, 3, 37, 34, 3,
+    32, 314, 107, 10, 114, 156, 110, 68, 29, 4, 4, 7,
+    166, 16, 23, 1, 26, 32, 13, 4, 13, 93, 66, 1,
+    234, 5, 9, 5, 0, 31, 2, 4, 0, 4, 104, 78,
+    7, 3, 20, 22, 4, 43, 0, 51, 125, 1, 133, 2,
+    11, 169, 10, 177, 224, 28, 191, 129, 9, 0, 23, 2,
+    0, 162, 20, 10, 6, 0, 170, 59, 19, 45, 10, 19,
+    235, 108, 28, 2, 124, 1, 162, 44, 12, 52, 230, 28,
+    1, 133, 60, 112, 94, 24, 28, 82, 0, 5, 672, 15,
+    42, 5, 41, 2, 28, 204, 11, 1, 5, 164, 6, 1,
+    1, 399, 6, 114, 2, 7, 1, 37, 148, 30, 95, 16,
+    45, 9, 2, 68, 21, 0, 4, 1, 2, 163, 50, 220,
+    40, 266, 13, 2, 21, 50, 25, 24, 22, 3, 13, 12,
+    3, 66, 0, 226, 98, 0, 103, 10, 51, 294, 5, 0,
+    22, 1, 92, 59, 19, 199, 6, 53, 18, 18, 80, 148,
+    147, 0, 129, 35, 27, 1, 0, 202, 37, 15, 0, 67,
+    4, 227, 96, 140, 81, 40, 8, 18, 20, 3, 40, 9,
+    42, 279, 78, 60, 0, 59, 0, 2, 66, 1, 27, 144,
+    2, 15, 6, 44, 364, 1, 21, 1, 26, 94, 77, 27,
+    2, 27, 114, 3, 176, 15, 3, 2, 207, 0, 3, 310,
+    1, 13, 277, 9, 0, 105, 70, 9, 3, 10, 2, 49,
+    3, 31, 28, 26, 294, 33, 26, 56, 0, 5, 219, 0,
+    738, 6, 185, 420, 339, 273, 15, 122, 80, 0, 5, 21,
+    9, 3, 0, 18, 0, 253, 47, 4, 80, 17, 270, 0,
+    5, 36, 10, 85, 30, 2, 315, 3, 53, 1, 5, 26,
+    175, 57, 12, 12, 29, 227, 0, 1, 28, 85, 1, 0,
+    7, 140, 76, 4, 14, 8, 2, 45, 50, 789, 1, 44,
+    21, 9, 5, 1, 30, 1, 12, 360, 19, 463, 0, 76,
+    282, 4, 269, 84, 7, 115, 43, 40, 0, 2, 5, 1,
+    59, 74, 0, 7, 241, 10, 1, 1, 35, 2, 8, 11,
+    32, 430, 165, 168, 1, 24, 0, 49, 30, 94, 0, 56,
+    5, 32, 3, 29, 1, 10, 12, 50, 161, 76, 19, 148,
+    0, 71, 3, 2, 5, 1, 59, 10, 23, 50, 32, 203,
+    13, 26, 49, 3, 2, 3, 65, 13, 0, 124, 8, 23,
+    30, 0, 160, 0, 347, 0, 4, 18, 273, 232, 0, 35,
+    0, 553, 2, 0, 147, 137, 0, 300, 225, 66, 25, 50,
+    277, 55, 65, 71, 3, 14, 14, 3, 0, 11, 76, 25,
+    27, 157, 0, 150, 20, 0, 2, 1, 20, 14, 76, 2,
+    19, 24, 50, 25, 51, 0, 31, 0, 27, 0, 1, 36,
+    2, 40, 181, 2, 4, 31, 58, 2, 5, 689, 2, 16,
+    154, 10, 83, 28, 12, 2, 101, 40, 1, 4, 325, 284,
+    0, 0, 117, 44, 14, 1, 3, 0, 2, 0, 0, 26,
+    43, 1, 50, 100, 1, 14, 48, 0, 0, 11, 88, 15,
+    12, 16, 13, 176, 339, 1, 62, 31, 45, 9, 13, 0,
+    0, 172, 2, 12, 117, 75, 359, 2, 105, 0, 41, 126,
+    9, 10, 290, 3, 17, 29, 20, 14, 0, 11, 1, 26,
+    85, 67, 18, 0, 302, 12, 14, 53, 30, 52, 0, 26,
+    185, 26, 500, 1, 41, 32, 132, 52, 7, 1, 0, 0,
+    17, 178, 0, 158, 9, 315, 62, 29, 277, 4, 18, 36,
+    746, 32, 13, 0, 18, 164, 599, 0, 15, 11, 588, 56,
+    2, 28, 223, 58, 201, 11, 0, 28, 63, 42, 6, 3,
+    58, 64, 22, 54, 19, 9, 109, 5, 6, 125, 0, 180,
+    23, 0, 91, 11, 1, 0, 1, 212, 21, 13, 15, 114,
+    95, 14, 39, 224, 132, 531, 116, 6, 1, 116, 42, 51,
+    5, 82, 16, 27, 102, 71, 32, 32, 34, 0, 0, 6,
+    34, 15, 2, 318, 7, 81, 78, 30, 200, 19, 22, 0,
+    3, 0, 33, 0, 0, 37, 79, 9, 101, 0, 10, 66,
+    104, 452, 136, 77, 36, 17, 2, 302, 172, 82, 12, 146,
+    1, 68, 52, 0, 0, 17, 29, 36, 31, 14, 1, 0,
+    50, 26, 0, 195, 35, 2, 5, 61, 99, 12, 0, 0,
+    0, 47, 32, 216, 8, 37, 4, 0, 131, 8, 224, 118,
+    89, 26, 4, 9, 3, 124, 1, 57, 9, 14, 179, 2,
+    96, 0, 0, 33, 1, 1, 109, 262, 217, 0, 8, 274,
+    0, 260, 91, 397, 165, 134, 62, 108, 1, 14, 38, 120,
+    140, 1, 26, 9, 16, 2, 31, 111, 6, 18, 32, 2,
+    352, 18, 32, 6, 7, 2, 58, 78, 99, 94, 935, 3,
+    20, 3, 89, 257, 44, 24, 65, 394, 97, 52, 4, 11,
+    234, 6, 12, 36, 1, 314, 23, 2, 146, 0, 54, 24,
+    0, 0, 147, 35, 30, 3, 2, 92, 0, 97, 3, 146,
+    38, 50, 7, 0, 13, 69, 4, 162, 114, 495, 97, 5,
+    57, 24, 4, 42, 90, 43, 381, 312, 59, 71, 4, 17,
+    26, 0, 102, 227, 284, 14, 1, 1, 81, 71, 48, 7,
+    323, 29, 12, 9, 3, 16, 229, 1, 1, 0, 251, 207,
+    5, 6, 16, 320, 108, 4, 2, 8, 164, 13, 145, 8,
+    29, 97, 32, 456, 22, 41, 395, 23, 246, 4, 173, 108,
+    0, 64, 236, 1, 9, 13, 0, 61, 36, 18, 6, 17,
+    56, 431, 39, 489, 243, 3, 0, 10, 3, 14, 133, 8,
+    374, 1, 14, 24, 62, 0, 287, 622, 6, 42, 243, 152,
+    702, 62, 7, 41, 37, 77, 98, 5, 84, 21, 69, 0,
+    43, 9, 406, 144, 223, 138, 717, 118, 7, 50, 288, 57,
+    394, 18, 398, 76, 49, 68, 140, 5, 26, 456, 200, 1,
+    102, 0, 3, 5, 3, 230, 280, 5, 0, 334, 34, 59,
+    136, 390, 417, 112, 883, 488, 60, 36, 2, 25, 17, 1,
+    435, 0, 323, 8, 120, 17, 96, 11, 59, 5, 123, 8,
+    23, 108, 107, 191, 145, 1, 24, 124, 0, 72, 1, 177,
+    107, 0, 164, 0, 692, 70, 228, 48, 19, 23, 4, 50,
+    23, 247, 20, 35, 138, 22, 196, 686, 59, 0, 323, 45,
+    225, 177, 59, 180, 154, 7, 0, 193, 28, 26, 0, 731,
+    1084, 16, 6, 13, 0, 3, 29, 33, 71, 27, 37, 491,
+    2, 73, 1, 4, 127, 1, 947, 129, 0, 143, 9, 2348,
+    17, 133, 306, 19, 19, 160, 98, 34, 51, 17, 319, 0,
+    41, 130, 1, 15, 44, 0, 0, 131, 36, 306, 442, 112,
+    61, 910, 39, 3, 0, 105, 16, 7, 37, 67, 15, 12,
+    256, 67, 6, 0, 2, 20, 26, 3, 239, 92, 35, 134,
+    27, 617, 1238, 86, 94, 412, 0, 1, 8, 9, 8, 0,
+    59, 85, 223, 250, 12, 105, 362, 165, 23, 56, 226, 512,
+    16, 82, 28, 114, 119, 0, 10, 74, 50, 479, 5, 179,
+    114, 185, 6, 3, 5, 190, 0, 254, 99, 77, 239, 9,
+    370, 2, 21, 104, 283, 178, 8, 37, 4, 16, 101, 14,
+    88, 217, 13, 5, 78, 455, 0, 42, 246, 35, 439, 6,
+    5, 22, 345, 0, 0, 229, 58, 0, 5, 225, 2, 318,
+    366, 6, 0, 190, 638, 13, 18, 1, 35, 736, 316, 304,
+    2, 141, 0, 24, 52, 166, 44, 219, 0, 1, 238, 25,
+    0, 312, 4, 271, 34, 98, 46, 92, 24, 174, 4, 29,
+    219, 0, 153, 0, 1, 122, 390, 86, 46, 984, 683, 3,
+    22, 253, 37, 191, 14, 286, 136, 0, 13, 5, 135, 19,
+    351, 134, 0, 13, 9, 32, 44, 18, 1, 319, 1, 18,
+    86, 124, 54, 3415, 2, 14, 20, 203, 66, 162, 68, 718,
+    161, 0, 25, 16, 0, 105, 1, 251, 82, 118, 2, 180,
+    301, 2, 29, 4, 9, 244, 144, 525, 82, 11, 923, 166,
+    314, 10, 798, 49, 62, 6, 108, 24, 9, 0, 131, 0,
+    215, 362, 8, 16, 0, 583, 1, 0, 1036, 48, 108, 52,
+    21, 6, 0, 56, 10, 500, 578, 0, 52, 21, 600, 930,
+    1, 725, 1, 0, 13, 28, 548, 25, 503, 53, 71, 144,
+    5, 1254, 331, 0, 23, 75, 472, 88, 19, 99, 5, 77,
+    695, 149, 186, 140, 689, 135, 131, 185, 0, 34, 25, 25,
+    459, 282, 0, 6, 32, 0, 0, 0, 24, 55, 0, 49,
+    515, 3, 7, 107, 14, 706, 0, 43, 365, 59, 198, 0,
+    217, 18, 73, 14, 557, 208, 14, 7, 928, 0, 33, 10,
+    434, 10, 116, 0, 199, 0, 0, 0, 177, 11, 1, 0,
+    180, 230, 0, 214, 280, 57, 437, 87, 16, 33, 24, 0,
+    6, 1, 249, 441, 27, 177, 551, 366, 3, 115, 235, 52,
+    26, 113, 254, 11, 157, 92, 20, 44, 150, 37, 172, 36,
+    14, 7, 265, 17, 8, 0, 45, 159, 1, 2, 66, 1,
+    35, 2, 314, 82, 23, 710, 61, 115, 216, 940, 169, 12,
+    8, 352, 59, 29, 135, 664, 481, 1323, 130, 238, 333, 34,
+    17, 272, 47, 348, 47, 0, 0, 0, 23, 534, 1, 629,
+    133, 21, 672, 7, 26, 198, 116, 43, 2, 0, 8, 0,
+    43, 7, 1223, 93, 215, 5, 678, 205, 171, 550, 25, 781,
+    2, 266, 17, 659, 232, 125, 0, 301, 301, 876, 291, 0,
+    130, 648, 124, 264, 0, 38, 4, 1888, 184, 25, 415, 35,
+    1155, 1, 2, 16, 126, 5, 224, 1, 0, 138, 242, 19,
+    2, 101, 2, 1, 5, 0, 13, 70, 35, 389, 17, 362,
+    2, 4, 136, 1323, 649, 12, 566, 0, 98, 0, 0, 41,
+    423, 0, 244, 0, 1987, 68, 100, 269, 7, 355, 498, 50,
+    40, 26, 57, 90, 4, 996, 2, 451, 193, 108, 756, 12,
+    31, 2, 4, 79, 4, 280, 71, 166, 34, 22, 76, 24,
+    18, 10, 642, 3, 5, 3, 83, 24, 94, 8, 508, 871,
+    82, 0, 1342, 100, 200, 16, 19, 1, 243, 5, 17, 43,
+    0, 348, 101, 14, 0, 56, 40, 33, 0, 5, 1, 224,
+    42, 4, 31, 27, 7, 10, 14, 552, 517, 6, 34, 15,
+    2, 291, 981, 15, 501, 353, 543, 247, 79, 188, 254, 748,
+    1081, 7, 736, 97, 78, 270, 0, 83, 7, 0, 309, 667,
+    21, 498, 0, 123, 13, 64, 19, 142, 0, 658, 35, 2,
+    2, 129, 38, 192, 304, 172, 533, 13, 517, 0, 8, 334,
+    187, 32, 24, 12, 114, 156, 209, 85, 160, 964, 12, 1219,
+    1, 192, 407, 1, 7, 0, 3959, 78, 0, 19, 1097, 6,
+    104, 0, 0, 1011, 186, 600, 6, 888, 287, 2165, 500, 183,
+    2708, 67, 10, 123, 13, 1092, 193, 231, 3, 6, 56, 1,
+    58, 13, 65, 979, 1, 60, 257, 415, 341, 8, 243, 9,
+    739, 144, 2, 792, 6, 42, 79, 0, 111, 328, 192, 114,
+    645, 348, 828, 276, 44, 5, 74, 370, 823, 316, 75, 366,
+    43, 308, 166, 0, 133, 405, 26, 0, 302, 252, 525, 175,
+    445, 922, 473, 18, 36, 62, 9, 735, 23, 637, 23, 1130,
+    1399, 2, 36, 116, 60, 142, 3, 102, 379, 56, 78, 1,
+    0, 678, 220, 702, 7, 156, 364, 86, 84, 888, 993, 237,
+    150, 8, 2, 343, 0, 7, 381, 284, 90, 2, 5, 185,
+    1203, 131, 168, 51, 6, 5, 16, 46, 1800, 193, 508, 415,
+    214, 411, 1181, 21, 782, 0, 51, 134, 88, 186, 124, 925,
+    29, 2, 649, 366, 1109, 3215, 375, 1, 157, 76, 4, 35,
+    2, 0, 3910, 89, 0, 140, 1733, 79, 1, 224, 139, 0,
+    31, 1729, 1003, 230, 6, 84, 13, 519, 144, 148, 31, 151,
+    143, 620, 10, 210, 0, 3767, 547, 3, 4, 134, 18, 33,
+    32, 9, 4, 1048, 1182, 0, 2012, 8, 3692, 82, 28, 14,
+    104, 661, 3, 1, 405, 41, 519, 129, 85, 1449, 16, 481,
+    10, 3, 236, 3, 306, 2, 288, 276, 66, 278, 7, 19,
+    841, 792, 6, 2, 1, 5, 56, 16, 4, 12, 1970, 666,
+    5, 47, 302, 867, 297, 24, 7, 440, 151, 1, 2743, 456,
+    342, 0, 27, 370, 117, 2044, 1359, 310, 623, 1049, 909, 19,
+    2, 70, 0, 176, 614, 71, 49, 29, 148, 11, 699, 0,
+    6, 641, 1, 384, 0, 69, 84, 98, 136, 738, 7, 32,
+    0, 223, 0, 14, 68, 168, 416, 0, 45, 966, 1306, 955,
+    11, 4, 958, 2, 109, 1834, 19, 363, 25, 120, 131, 196,
+    170, 4, 88, 7, 505, 382, 34, 4778, 254, 928, 90, 250,
+    94, 929, 128, 45, 3, 18, 154, 6, 4, 311, 248, 569,
+    212, 9, 47, 435, 0, 1012, 4, 21, 117, 36, 576, 51,
+    15, 671, 107, 464, 5, 365, 1666, 2, 2, 2631, 24, 266,
+    55, 52, 58, 2068, 943, 5, 1943, 28, 701, 1052, 18, 6802,
+    1, 129, 46, 0, 39, 99, 402, 0, 163, 587, 49, 1232,
+    2, 1, 1092, 15, 1251, 2, 1248, 327, 27, 1, 2, 3242,
+    3308, 354, 43, 12, 63, 371, 0, 1218, 0, 0, 547, 86,
+    167, 350, 3062, 600, 8, 1046, 0, 2, 76, 14, 196, 715,
+    148, 26, 131, 2602, 32, 1, 14, 1, 1514, 6, 5550, 273,
+    0, 210, 0, 10, 3554, 645, 0, 316, 3, 9, 471, 252,
+    52, 576, 1374, 0, 854, 82, 194, 630, 3, 1749, 127, 0,
+    6, 403, 726, 140, 2134, 29, 0, 473, 109, 3400, 340, 0,
+    19, 526, 1420, 203, 512, 49, 1, 587, 507, 12, 863, 34,
+    4427, 404, 12, 2970, 3, 349, 577, 9, 177, 4131, 1774, 143,
+    12, 1594, 5, 7616, 438, 1224, 0, 136, 1652, 18, 44, 2350,
+    9, 1665, 0, 5, 8286, 15, 4029, 25, 526, 54, 335, 27,
+    440, 110, 42, 873, 531, 0, 620, 135, 31, 1447, 112, 3120,
+    355, 6, 1670, 1, 147, 53, 7, 0, 152, 174, 15, 119,
+    12892, 20, 169, 400, 55, 511, 128, 947, 0, 2, 0, 1223,
+    134, 72, 914, 2038, 19, 3792, 192, 479, 1614, 426, 684, 84,
+    721, 121, 22, 150, 2872
+};
+
+static const int32_t bm_static_flags_index_slot_v_[10000] = {
+    9079, 9043, 3583, 2557, 2409, 6183, 8516, 4991, 4462, 7098, 3681, 5312,
+    4186, 2546, 2545, 6594, 7008, 7318, 4877, 5439, 9345, 6983, 1660, 6345,
+    3558, 8072, 8585, 1008, 1486, 8083, 296, 3003, 4292, 2163, 84, 1824,
+    8189, 5980, 6140, 5507, 2, 518, 7717, 9024, 5228, 2217, 3369, 4953,
+    2013, 9478, 4513, 2381, 515, 6973, 847, 107, 692, 195, 2788, 9870,
+    6185, 7617, 5274, 8639, 5772, 7140, 9781, 3882, 8183, 5486, 3181, 1778,
+    6838, 8393, 7157, 546, 6584, 5531, 2299, 7434, 9605, 8834, 4021, 4733,
+    5108, 4701, 7555, 8034, 7788, 7185, 3918, 5695, 6910, 5626, 6954, 1939,
+    940, 5383, 5412, 5100, 8288, 9869, 1403, 6809, 9045, 7708, 7363, 9695,
+    9818, 3200, 5764, 1283, 2946, 7401, 4088, 4750, 7540, 418, 5224, 953,
+    3565, 1135, 1533, 7037, 9497, 7723, 9550, 7400, 7611, 2107, 894, 138,
+    683, 8845, 5335, 7796, 9553, 6363, 5740, 2539, 1307, 3788, 8574, 2385,
+    382, 4269, 2280, 915, 2547, 8890, 9274, 8163, 7444, 8610, 8012, 7143,
+    7113, 3597, 1101, 8636, 5423, 5876, 1351, 7916, 3656, 5190, 1221, 1834,
+    8136, 9067, 6851, 5910, 9956, 1215, 1668, 484, 3894, 5928, 2750, 2279,
+    5682, 1188, 1693, 2197, 562, 3526, 612, 1494, 2705, 3657, 7257, 8031,
+    7747, 2867, 4979, 9665, 5914, 5991, 5651, 2945, 2434, 5267, 4872, 9700,
+    2183, 330, 7568, 4766, 1815, 5435, 9224, 9789, 441, 3488, 7297, 8000,
+    4519, 1640, 6903, 4602, 8839, 3037, 1850, 7666, 5720, 4256, 5011, 6716,
+    9462, 4725, 2229, 6995, 6401, 6449, 2290, 5629, 8114, 7473, 8270, 8158,
+    513, 6546, 4140, 3351, 5661, 5161, 8080, 1730, 7973, 6397, 1577, 4574,
+    70, 2205, 6947, 4143, 9935, 3235, 6763, 1588, 804, 3770, 1876, 7086,
+    8418, 610, 6156, 160, 7102, 7343, 9651, 4126, 5051, 8451, 8366, 7743,
+    3038, 3014, 9270, 1005, 6519, 2604, 6923, 606, 7892, 7739, 8739, 8138,
+    5187, 3492, 4703, 4679, 5871, 9423, 1334, 6044, 1356, 7839, 2039, 4115,
+    5667, 6736, 8934, 8853, 4096, 4894, 8692, 1263, 2991, 5828, 4173, 7567,
+    8444, 7050, 3807, 3872, 6960, 3162, 8349, 8410, 3833, 3131, 6010, 3638,
+    4257, 1532, 6946, 9498, 6760, 5220, 7222, 2454, 3792, 5792, 892, 1656,
+    5211, 7388, 7582, 6399, 9195, 9614, 9599, 9339, 1812, 2527, 8328, 1051,
+    8415, 8329, 5577, 3571, 5726, 2866, 8757, 8076, 5915, 7094, 681, 4160,
+    6808, 9861, 3132, 2169, 2297, 287, 7177, 2865, 7441, 346, 8945, 4369,
+    5633, 2488, 4389, 6338, 682, 4835, 4288, 3964, 2413, 9479, 5255, 573,
+    5509, 8938, 5378, 5361, 7432, 7923, 6476, 6354, 9843, 3513, 7097, 8843,
+    5071, 5889, 300, 4992, 5804, 2485, 2777, 4607, 9724, 167, 4927, 792,
+    9102, 4020, 3306, 5960, 1257, 7860, 7710, 2378, 8202, 1708, 6106, 8591,
+    9354, 2105, 9289, 4493, 4896, 5567, 3902, 2662, 1865, 9834, 3368, 5363,
+    1831, 4819, 2987, 721, 9873, 7702, 3393, 5534, 1549, 9637, 8873, 2715,
+    6190, 7125, 8498, 8462, 910, 2307, 4955, 1733, 6707, 8947, 6543, 3557,
+    4999, 2856, 4103, 8057, 7403, 1264, 4429, 2871, 1372, 5418, 7489, 1590,
+    1734, 8222, 6090, 82, 2440, 6228, 528, 5292, 5883, 4879, 1704, 3861,
+    1642, 2983, 1259, 5898, 9636, 9591, 9684, 7893, 4012, 9648, 1383, 2541,
+    159, 1672, 2916, 8217, 4550, 1636, 2703, 6662, 3768, 1639, 3197, 1277,
+    4227, 9227, 6492, 3427, 4827, 6648, 4852, 6, 4548, 4456, 5495, 651,
+    8125, 373, 1933, 9233, 1216, 8818, 5548, 3498, 4838, 9946, 4215, 9327,
+    1364, 7336, 8082, 1128, 9555, 3052, 8047, 1542, 8133, 3365, 6859, 5090,
+    5407, 4058, 7448, 9201, 9662, 4837, 4652, 9519, 9969, 8335, 3259, 6862,
+    5153, 3150, 8176, 7409, 8561, 1044, 5973, 5305, 4391, 461, 7729, 8956,
+    4751, 6079, 6154, 5523, 1551, 3660, 492, 7880, 8623, 8394, 603, 1069,
+    1785, 9620, 2552, 8380, 4813, 4627, 3891, 2177, 8257, 921, 2232, 6688,
+    1617, 5756, 1576, 6658, 4944, 2088, 8033, 175, 1029, 7104, 8763, 5558,
+    152, 9013, 165, 9792, 4829, 2670, 2065, 2161, 6601, 6866, 674, 7247,
+    1039, 2560, 8110, 6314, 1354, 6343, 9055, 3281, 7358, 5198, 7121, 1318,
+    7186, 4762, 2026, 7983, 1445, 6069, 1355, 4231, 4272, 9828, 8340, 1484,
+    3468, 3945, 5829, 1671, 1501, 5466, 9373, 841, 2262, 9230, 5181, 7484,
+    2597, 7309, 3529, 9204, 4551, 6675, 5135, 5885, 7371, 6652, 2507, 6286,
+    7636, 1114, 5169, 8041, 2887, 3924, 9919, 9314, 929, 3295, 2671, 4494,
+    1150, 4891, 3342, 9776, 5543, 9573, 9387, 1136, 5332, 6117, 6254, 3887,
+    4597, 4209, 3824, 437, 5, 9749, 7234, 6977, 5160, 4589, 2997, 7806,
+    3088, 4418, 1316, 9565, 1422, 7964, 1592, 3870, 9904, 2937, 246, 7586,
+    2993, 3633, 6676, 4374, 1483, 5768, 1485, 2383, 9321, 7768, 6759, 636,
+    679, 2721, 192, 2641, 4168, 9743, 6046, 2754, 5805, 6621, 5417, 9541,
+    8432, 5424, 1894, 9451, 7138, 7069, 3780, 2109, 1040, 8940, 6922, 3883,
+    5717, 2740, 6147, 7232, 4282, 771, 4195, 9948, 9255, 7115, 8345, 8608,
+    5594, 1446, 6034, 6239, 4934, 4876, 6030, 5935, 1595, 3595, 4109, 8828,
+    9250, 1344, 9159, 667, 5421, 6549, 6402, 7894, 5745, 9774, 1006, 4344,
+    7913, 1666, 312, 3232, 9708, 3300, 1184, 716, 1741, 1288, 412, 6404,
+    6597, 6199, 9434, 9424, 765, 1453, 7766, 8699, 825, 4744, 7025, 9128,
+    4655, 2315, 9104, 4980, 7273, 279, 8002, 530, 4136, 8769, 3341, 5073,
+    3063, 2215, 3852, 2079, 3766, 3761, 7253, 2384, 9328, 9414, 6724, 289,
+    2393, 6027, 5612, 1580, 3959, 7071, 413, 4878, 2858, 1658, 753, 4754,
+    8937, 7356, 4974, 4000, 3397, 5524, 2359, 3231, 803, 6986, 2680, 4054,
+    5468, 1988, 1928, 7881, 3051, 8840, 8225, 8704, 6184, 144, 4353, 7351,
+    8977, 2968, 9081, 3664, 4690, 9313, 5693, 5310, 7226, 3552, 5955, 234,
+    6327, 6956, 1272, 1232, 8463, 8674, 1846, 8427, 7070, 1078, 5732, 6824,
+    4083, 1466, 6970, 644, 4541, 8253, 8682, 419, 5655, 8395, 8318, 9683,
+    10, 9577, 1250, 161, 1289, 2932, 3391, 2918, 5266, 1675, 7260, 9712,
+    9465, 2115, 9170, 8944, 5808, 874, 4262, 7334, 988, 2400, 2347, 6182,
+    1151, 5416, 1511, 2134, 8601, 4254, 298, 9632, 8659, 6738, 7905, 2313,
+    372, 3169, 9741, 5729, 5192, 9421, 615, 8875, 4153, 3684, 2430, 7754,
+    5042, 4411, 9600, 7778, 6550, 5014, 6834, 235, 6388, 3745, 818, 7193,
+    4317, 724, 1010, 9112, 7681, 1970, 9209, 2982, 1375, 1260, 9841, 8144,
+    9301, 749, 8486, 1536, 872, 3184, 3994, 6172, 8618, 468, 9796, 2295,
+    3904, 9672, 5454, 3472, 6624, 5678, 2580, 4104, 5591, 6582, 2401, 8813,
+    5527, 4611, 7854, 498, 3577, 1081, 6581, 2388, 5374, 7188, 7315, 5905,
+    8203, 628, 886, 2020, 5352, 760, 3804, 9228, 2977, 2220, 2496, 8773,
+    1801, 7110, 901, 2868, 1048, 2198, 1680, 7900, 1805, 8218, 3496, 4011,
+    2285, 7843, 3431, 1062, 1240, 2230, 9986, 6911, 2309, 1783, 2620, 6509,
+    4250, 3118, 4712, 7776, 5891, 8255, 8325, 2455, 430, 7746, 3737, 7810,
+    1204, 2518, 1149, 6800, 567, 4583, 8213, 6816, 3857, 9394, 3553, 5796,
+    7346, 6768, 8300, 358, 5318, 465, 22, 9737, 3718, 8022, 948, 4014,
+    6890, 8359, 6113, 1901, 6310, 9396, 5640, 7438, 4741, 639, 7498, 1522,
+    3103, 5152, 4913, 9739, 5447, 2467, 9343, 4322, 5855, 3113, 3008, 1022,
+    2465, 6703, 5830, 3954, 9471, 9050, 757, 1619, 7533, 1127, 5430, 3210,
+    1187, 5131, 4487, 5137, 1545, 8450, 8968, 2081, 2807, 6692, 1798, 347,
+    6394, 5969, 5783, 6355, 9466, 3343, 9068, 3970, 5573, 7826, 9445, 4755,
+    7985, 453, 3010, 5494, 2479, 7359, 4698, 8350, 6131, 9782, 6552, 4506,
+    9454, 1993, 3928, 6175, 699, 3031, 5006, 1099, 5481, 6869, 7979, 6636,
+    9190, 7594, 6632, 41, 4259, 6917, 1766, 8998, 8735, 1381, 8979, 180,
+    2928, 8453, 1544, 315, 613, 8370, 1909, 5941, 6467, 9260, 866, 8492,
+    1365, 2862, 3564, 5972, 8830, 7381, 2255, 1809, 5265, 2659, 9318, 734,
+    8389, 8246, 5062, 3756, 8731, 7265, 233, 9015, 9212, 7311, 4900, 6758,
+    755, 489, 9008, 5375, 5226, 297, 8907, 8570, 8563, 6796, 6227, 821,
+    8791, 4936, 8223, 7652, 7915, 8568, 4383, 6830, 1878, 9383, 5549, 3686,
+    7116, 2883, 8832, 1515, 2494, 8914, 32, 4455, 9184, 5237, 3649, 5760,
+    3372, 2234, 1197, 5987, 2850, 1271, 2047, 3199, 201, 7490, 619, 9266,
+    4196, 5658, 2635, 4567, 2375, 6446, 4811, 7512, 7246, 1308, 785, 6807,
+    9063, 4159, 1722, 3319, 538, 5641, 1304, 1776, 8455, 4792, 1569, 1418,
+    5646, 5017, 8099, 4502, 3710, 1854, 1694, 974, 4356, 7748, 6413, 6965,
+    3827, 6341, 5233, 9542, 3797, 5236, 8469, 8816, 7762, 4472, 9064, 3525,
+    6628, 1804, 6502, 5396, 6153, 8416, 8915, 9379, 2654, 7558, 49, 8103,
+    1179, 1003, 219, 8159, 6019, 9628, 1696, 3889, 798, 6360, 5092, 5672,
+    6005, 6920, 4069, 4460, 7422, 3590, 2509, 1464, 5286, 8794, 476, 4767,
+    3739, 8909, 9382, 858, 9945, 4178, 3543, 1065, 2321, 2314, 3834, 8434,
+    6777, 1984, 2306, 4970, 4438, 4885, 5428, 1339, 299, 3835, 3676, 4297,
+    3692, 8891, 9320, 7817, 2219, 89, 5238, 1363, 1747, 6269, 2185, 249,
+    1226, 8245, 9699, 6846, 2523, 4419, 571, 4932, 4016, 9666, 2521, 9643,
+    150, 5797, 4924, 7135, 4649, 8264, 207, 5219, 8927, 4623, 4041, 483,
+    6803, 1972, 4224, 4743, 9520, 8619, 2806, 6541, 3375, 5203, 6222, 6309,
+    9838, 5440, 7528, 2837, 497, 9482, 4051, 2575, 6428, 3535, 9539, 2738,
+    4545, 2765, 4848, 966, 9528, 8029, 381, 8190, 9187, 7749, 9959, 6683,
+    8701, 4654, 5750, 1519, 7515, 1033, 4642, 7921, 922, 835, 5170, 8160,
+    8896, 7577, 4938, 8087, 7888, 8461, 1324, 5813, 809, 9060, 6747, 556,
+    9676, 908, 8595, 9237, 6333, 7211, 2264, 6761, 2241, 8771, 137, 8707,
+    1370, 229, 8413, 8786, 7738, 4605, 9788, 209, 5334, 8823, 194, 1404,
+    332, 8212, 2034, 4804, 3021, 7612, 2367, 5903, 2135, 3550, 6437, 816,
+    2203, 3976, 8973, 4718, 8209, 733, 2730, 4075, 7404, 4315, 1678, 8265,
+    4523, 7133, 6257, 242, 5406, 9491, 5097, 4327, 8130, 3190, 1591, 3273,
+    1647, 9914, 8262, 3402, 5676, 2857, 6823, 1607, 8518, 4517, 4068, 6300,
+    2561, 2645, 2619, 694, 9771, 5933, 8901, 7942, 6706, 5046, 9878, 1649,
+    7446, 424, 1139, 1978, 6921, 479, 3721, 3219, 8146, 7966, 9340, 2317,
+    3562, 6289, 8599, 1835, 7021, 3271, 2373, 2277, 7437, 4871, 2775, 7547,
+    6281, 2650, 9761, 1802, 158, 5116, 8155, 5999, 7727, 140, 1755, 7182,
+    7485, 1454, 2374, 1883, 1676, 8364, 5271, 3779, 2133, 6924, 1961, 8263,
+    6595, 6075, 5966, 5013, 4692, 2829, 3982, 4439, 605, 1164, 7683, 3741,
+    7825, 3688, 392, 590, 6771, 1206, 8269, 1875, 1700, 2533, 3482, 3471,
+    7367, 2357, 4620, 3127, 4031, 9682, 3542, 3839, 5040, 6696, 2301, 179,
+    957, 3760, 5405, 774, 2817, 8375, 4401, 5472, 3783, 6522, 3777, 9773,
+    5357, 9125, 3366, 4474, 7130, 3630, 3539, 9896, 9730, 9775, 5623, 5862,
+    2443, 4435, 6086, 5899, 8181, 9489, 9422, 4926, 1881, 4828, 5204, 9205,
+    8848, 4940, 2963, 7553, 6457, 1713, 3425, 2166, 8607, 2562, 3236, 9206,
+    3250, 3260, 5526, 2213, 11, 8587, 8911, 3487, 9458, 7250, 5434, 2602,
+    2294, 4038, 3538, 7858, 4870, 5917, 6176, 8471, 368, 3055, 8553, 277,
+    2113, 7056, 7219, 5001, 9944, 4170, 4098, 9610, 1559, 3191, 2481, 7757,
+    3639, 746, 907, 2038, 9440, 4555, 9370, 5634, 2543, 3099, 1337, 9090,
+    2691, 4674, 3286, 8423, 7354, 8502, 3694, 1673, 7451, 7406, 9437, 3168,
+    7850, 3892, 9675, 7761, 7992, 5460, 8297, 2036, 2555, 2114, 9856, 8275,
+    3853, 2331, 128, 4539, 4989, 2893, 1037, 7647, 5529, 5218, 8942, 6701,
+    7866, 3330, 2908, 521, 6261, 1493, 1118, 7474, 1681, 8742, 1119, 4659,
+    7937, 3501, 6253, 7564, 6475, 4656, 7239, 4650, 80, 9286, 5838, 8504,
+    8111, 1455, 9702, 9151, 9890, 5865, 7524, 2909, 3914, 3733, 6551, 1790,
+    7712, 5950, 2959, 7465, 5583, 9375, 7095, 9402, 8347, 1652, 3560, 9853,
+    8602, 6298, 7368, 7767, 321, 5098, 2108, 4844, 8392, 8635, 7566, 2251,
+    9399, 3919, 4880, 5088, 1541, 1810, 9016, 4585, 8711, 5832, 9715, 4211,
+    5074, 7079, 9, 8400, 4600, 759, 4286, 588, 4899, 1587, 5877, 7440,
+    5058, 6561, 3604, 1975, 5758, 6331, 5636, 2207, 3313, 1321, 5930, 5164,
+    5136, 193, 3076, 2090, 114, 9123, 2024, 7101, 5814, 817, 3018, 6080,
+    547, 7060, 6099, 102, 3848, 5177, 4874, 8802, 1553, 1867, 8049, 4498,
+    3044, 5622, 9617, 3173, 8373, 2579, 3189, 5049, 4365, 569, 3715, 8320,
+    3955, 7625, 5579, 4914, 1921, 1297, 2110, 7303, 9331, 2341, 7317, 4291,
+    8716, 8169, 6879, 3720, 2187, 8239, 6088, 1998, 5827, 6084, 5268, 7187,
+    6647, 7052, 8697, 8126, 4351, 8856, 6818, 4074, 7685, 7956, 8720, 4485,
+    3933, 794, 8694, 1947, 1228, 6229, 8505, 539, 1374, 2027, 265, 1162,
+    8327, 4670, 6424, 9175, 2913, 8356, 4615, 5617, 2556, 2687, 9879, 4714,
+    5769, 3105, 2516, 9734, 3079, 5780, 7192, 1113, 7574, 8783, 2004, 4189,
+    8817, 863, 3510, 5738, 2158, 7671, 3654, 7078, 4415, 1227, 3850, 7209,
+    2226, 677, 900, 2640, 221, 8232, 9094, 9940, 9830, 7513, 6430, 9499,
+    390, 6850, 8743, 862, 5479, 9244, 4452, 3912, 4825, 4349, 9404, 8219,
+    782, 8357, 3991, 2195, 7856, 2574, 8688, 7818, 5476, 4409, 9888, 7320,
+    2969, 2845, 9336, 1254, 5261, 2655, 5199, 2238, 2882, 5802, 3753, 6637,
+    9305, 6625, 5587, 1347, 8484, 745, 6031, 404, 2248, 1298, 69, 459,
+    9574, 3449, 591, 1478, 5951, 9691, 1056, 7852, 9299, 5330, 4709, 3026,
+    4920, 1306, 7539, 2962, 7698, 1417, 94, 7867, 9156, 3773, 5979, 9566,
+    3499, 3515, 889, 1510, 2439, 9483, 1439, 6352, 5110, 5364, 2171, 6786,
+    3379, 4240, 2239, 8198, 9397, 4390, 9283, 7506, 1563, 7527, 302, 324,
+    6719, 6779, 8933, 5165, 7082, 3262, 5513, 9800, 9584, 8319, 2697, 8957,
+    600, 4993, 5393, 8009, 7009, 9172, 923, 7959, 1385, 6882, 3532, 529,
+    2099, 1570, 7811, 3544, 3349, 6496, 3717, 2131, 4748, 23, 4573, 5432,
+    662, 9981, 7816, 3350, 1954, 4049, 8487, 685, 3020, 3494, 5773, 8980,
+    8201, 1720, 6795, 3476, 6755, 6791, 843, 2591, 4197, 4895, 371, 8224,
+    861, 7208, 2275, 171, 2910, 4473, 8654, 8137, 5175, 4700, 6776, 8376,
+    9793, 238, 2692, 4609, 7714, 1169, 6461, 4990, 51, 2054, 7194, 5234,
+    2259, 1245, 9760, 482, 7462, 1327, 8476, 1394, 2023, 2449, 4191, 7846,
+    4592, 7174, 3465, 5705, 4565, 954, 2247, 7649, 962, 4764, 6052, 7178,
+    7607, 6930, 7988, 6916, 6271, 4202, 376, 7006, 9188, 4354, 8660, 6381,
+    1525, 9036, 9378, 6627, 3842, 9085, 776, 1028, 2352, 6447, 1740, 72,
+    3521, 4119, 5785, 3751, 4147, 2637, 9073, 5800, 1217, 8021, 7412, 3500,
+    5377, 3757, 3628, 2340, 8323, 9663, 2756, 3896, 911, 656, 9686, 1274,
+    5843, 3111, 8631, 1124, 4951, 6880, 2838, 8847, 9464, 9630, 4205, 6458,
+    2154, 6612, 7763, 6326, 9728, 4645, 3517, 7918, 146, 3697, 7862, 630,
+    8483, 1980, 4293, 560, 310, 4377, 7851, 6482, 8767, 2648, 6382, 344,
+    1214, 5490, 9544, 2067, 9121, 6302, 7509, 6858, 3607, 4987, 5510, 2864,
+    7390, 3570, 3045, 3329, 7266, 1208, 5156, 2748, 8604, 5171, 6232, 2811,
+    4042, 7684, 2406, 1735, 5143, 9556, 2935, 5048, 3233, 3357, 5342, 2846,
+    6709, 149, 3417, 9194, 8523, 8457, 2884, 6948, 549, 2895, 8778, 2427,
+    6417, 2395, 4382, 9575, 2302, 3709, 284, 7781, 3574, 8142, 2104, 2658,
+    5497, 4234, 4135, 887, 9587, 3296, 5427, 9293, 8748, 7325, 3177, 7840,
+    6047, 8849, 607, 7885, 4711, 2505, 2077, 103, 3367, 6197, 4509, 1557,
+    8037, 2690, 9066, 3301, 4547, 5351, 1042, 6308, 5257, 6691, 7476, 2196,
+    7041, 4594, 6193, 9026, 7967, 365, 4637, 727, 4124, 6406, 3903, 7543,
+    5281, 3145, 7166, 5270, 9113, 2437, 2358, 2847, 2872, 9596, 305, 1330,
+    9963, 1795, 8229, 8374, 6102, 3339, 9359, 4756, 9933, 5715, 3420, 1952,
+    9091, 6024, 2665, 2681, 938, 6721, 4070, 8842, 3809, 7299, 467, 5888,
+    2761, 672, 5118, 5892, 3591, 5244, 822, 2376, 3728, 5450, 1601, 3648,
+    5671, 6978, 477, 3613, 5033, 1985, 3799, 1425, 8148, 4822, 6133, 2209,
+    8976, 4577, 4616, 1813, 6739, 8353, 3953, 4347, 2716, 6828, 8358, 3719,
+    9044, 5895, 1828, 1031, 7134, 5630, 3386, 1691, 2304, 6718, 768, 937,
+    9897, 2228, 6941, 2841, 7902, 671, 5311, 379, 564, 8586, 7165, 7207,
+    5464, 4966, 4514, 1620, 9863, 1025, 2048, 326, 6474, 4535, 7057, 951,
+    1158, 5107, 4521, 9798, 3154, 3619, 6927, 8811, 6124, 6376, 9131, 255,
+    8172, 1524, 4113, 8464, 7316, 8046, 4863, 7601, 2548, 1830, 8548, 7423,
+    9074, 1462, 1739, 3793, 8647, 8596, 9927, 8134, 2911, 1645, 1655, 1292,
+    7405, 7397, 4832, 4603, 5004, 1621, 8289, 4324, 826, 8396, 9913, 1239,
+    2677, 5438, 9507, 401, 3209, 8522, 3687, 3908, 4948, 3278, 1872, 4868,
+    6216, 2989, 3738, 6420, 5744, 6346, 1133, 9609, 5367, 2142, 4362, 8272,
+    7580, 3782, 6623, 3464, 9701, 3011, 801, 8695, 4950, 9999, 2458, 7734,
+    90, 7458, 2661, 2422, 7991, 491, 4713, 6048, 4732, 5278, 1997, 3432,
+    3844, 6822, 9639, 7064, 1419, 199, 7112, 7427, 6188, 4150, 6835, 6953,
+    3208, 7926, 9426, 4504, 7073, 5207, 250, 964, 8088, 979, 4154, 9167,
+    2586, 7865, 8030, 6731, 3299, 8642, 3403, 2445, 1605, 7048, 1084, 7161,
+    113, 3983, 3234, 9893, 5879, 799, 780, 2173, 3001, 9019, 9285, 9559,
+    7015, 9985, 478, 6173, 7657, 7201, 7124, 6158, 3806, 5925, 736, 8671,
+    2160, 91, 6769, 5103, 8333, 3854, 2600, 2007, 5724, 3586, 9629, 5842,
+    4921, 9023, 9510, 2249, 2782, 16, 9148, 9750, 5213, 3869, 1378, 6969,
+    5536, 6096, 7569, 713, 503, 7789, 1983, 197, 5913, 2752, 7081, 1669,
+    3094, 8279, 9529, 2903, 8658, 7674, 1086, 4528, 5694, 3265, 5642, 8680,
+    9864, 2420, 7370, 2764, 5776, 580, 3589, 8537, 444, 5844, 1556, 9114,
+    3909, 4413, 1742, 741, 6264, 9932, 2502, 8679, 148, 9900, 1237, 2769,
+    4520, 690, 7210, 3410, 7644, 3362, 9780, 6035, 2992, 4238, 81, 2892,
+    7951, 978, 1391, 3148, 8069, 1505, 2855, 135, 5875, 57, 2296, 4457,
+    8174, 4590, 6303, 341, 8117, 2244, 1690, 3986, 4328, 1786, 5983, 7031,
+    6357, 6848, 4120, 6587, 9660, 6263, 5341, 7803, 5445, 5459, 9171, 6207,
+    4052, 8963, 3974, 9385, 7952, 2735, 977, 4496, 2889, 5601, 7873, 4130,
+    6235, 9560, 5122, 2536, 166, 2354, 4248, 6370, 6403, 5674, 9674, 4206,
+    2720, 4681, 3194, 648, 6794, 4024, 511, 6155, 5402, 8841, 3317, 53,
+    2800, 4268, 2028, 6781, 2582, 9052, 7896, 604, 7046, 2904, 7482, 8381,
+    2810, 8637, 4080, 616, 7638, 58, 6205, 2821, 3207, 5936, 9191, 2696,
+    1951, 1794, 939, 93, 6268, 4348, 2952, 1697, 789, 2767, 8662, 8236,
+    4672, 9501, 7379, 7782, 8578, 3247, 1209, 8355, 2140, 3860, 6590, 3171,
+    1144, 6667, 8073, 7912, 8858, 2322, 4492, 6279, 1958, 7433, 6545, 359,
+    4553, 425, 1373, 7758, 5041, 1357, 5984, 88, 5275, 3764, 8040, 3855,
+    6577, 1914, 9612, 1108, 1968, 7080, 4323, 2610, 6994, 3328, 1342, 9296,
+    9804, 3361, 3726, 8206, 8495, 1480, 936, 6535, 3942, 2616, 6477, 730,
+    5614, 4843, 5144, 1091, 3603, 7623, 6045, 9569, 2923, 8458, 777, 8541,
+    678, 9038, 7887, 8779, 4778, 5771, 6454, 416, 5024, 5026, 4734, 4029,
+    9351, 3846, 2617, 5924, 6515, 1299, 7369, 645, 9219, 3104, 8917, 9693,
+    8661, 1196, 7529, 6105, 2451, 196, 8059, 7276, 1896, 8215, 8112, 8036,
+    7744, 9105, 8254, 1623, 1869, 15, 4116, 9329, 3046, 1791, 7099, 4304,
+    707, 8193, 7859, 8703, 669, 737, 6998, 4137, 4770, 7875, 7090, 8972,
+    6536, 1305, 9726, 9297, 9685, 6292, 8582, 6875, 1537, 6633, 5918, 8993,
+    55, 1401, 9964, 844, 4050, 9505, 9143, 8872, 8863, 4078, 2744, 6641,
+    837, 8386, 421, 8113, 3071, 251, 9495, 2592, 5037, 4749, 6100, 1189,
+    4385, 1400, 3129, 7821, 31, 9416, 778, 764, 7861, 5299, 2328, 9984,
+    5500, 7036, 9162, 620, 8528, 7450, 8874, 622, 262, 834, 6542, 1799,
+    4648, 6217, 796, 2271, 9829, 5606, 1396, 8837, 3416, 9570, 1398, 9116,
+    4976, 8295, 4529, 4491, 9268, 5155, 6247, 2644, 6142, 6299, 3711, 329,
+    624, 8605, 8226, 6059, 87, 9353, 6585, 9436, 6618, 4151, 8806, 991,
+    6644, 6638, 8620, 30, 6854, 9518, 5291, 4699, 2421, 2272, 2073, 292,
+    8489, 9012, 7653, 1506, 48, 5415, 6379, 4935, 9080, 6949, 1132, 9419,
+    8753, 1286, 6889, 6273, 4719, 3666, 6562, 2860, 7338, 6544, 5120, 4333,
+    6210, 6209, 5023, 1593, 9315, 6856, 9874, 7105, 1059, 5737, 6533, 4962,
+    6490, 6218, 2267, 3443, 5552, 5021, 2912, 5452, 2886, 5239, 8493, 1902,
+    7139, 2743, 8233, 6425, 7753, 8677, 8565, 7327, 1710, 2273, 8391, 4883,
+    7293, 8855, 5485, 7914, 8569, 8546, 7160, 6460, 9300, 1442, 1844, 3932,
+    8652, 1009, 6132, 8971, 5340, 6661, 5839, 388, 9431, 3714, 2125, 9352,
+    4444, 7284, 7572, 3547, 2098, 64, 9048, 7805, 9656, 5819, 4796, 5343,
+    6365, 4516, 5809, 7626, 3039, 4639, 6305, 5206, 3838, 5306, 9803, 8746,
+    8952, 2801, 6908, 5718, 4179, 2953, 423, 8883, 1303, 3895, 2524, 1295,
+    4239, 3400, 350, 4538, 4233, 9108, 7960, 537, 4774, 7575, 5241, 2396,
+    3508, 7443, 3407, 8921, 2578, 8165, 8564, 3159, 5754, 4928, 3206, 8477,
+    931, 5287, 8143, 3867, 7184, 3771, 4387, 7361, 303, 3213, 8343, 1728,
+    3080, 4081, 3690, 9912, 6727, 8287, 9950, 8965, 6663, 4942, 5581, 1296,
+    5920, 869, 420, 9381, 4379, 2980, 3778, 7471, 6877, 725, 9363, 7328,
+    1013, 9709, 283, 7552, 2041, 5028, 4887, 8512, 4759, 4560, 738, 4558,
+    2978, 3927, 3650, 9766, 969, 7501, 5142, 999, 5158, 1266, 6634, 1023,
+    7108, 3322, 7491, 5787, 3473, 8185, 3573, 6116, 6766, 3965, 5618, 1508,
+    7908, 8630, 1924, 2634, 5414, 5860, 8615, 4303, 769, 1165, 2751, 3226,
+    1547, 7162, 3906, 1384, 506, 1428, 8011, 8086, 9767, 9513, 9193, 6657,
+    8836, 592, 4581, 975, 6042, 2833, 6734, 4886, 4518, 4307, 9292, 3327,
+    433, 4407, 598, 4614, 4204, 8314, 7452, 182, 6714, 5505, 6334, 1459,
+    3086, 6907, 5730, 9166, 3438, 9967, 7244, 7581, 6241, 184, 9435, 1891,
+    5501, 2334, 4576, 8238, 4525, 7004, 9722, 5372, 6078, 1919, 2489, 1185,
+    6125, 9811, 4100, 1965, 8412, 6265, 4469, 6772, 5985, 5807, 7366, 4897,
+    3888, 5542, 9740, 6589, 2318, 8066, 6112, 9681, 8738, 6039, 217, 5214,
+    5491, 7557, 4666, 1246, 9561, 4903, 7736, 1294, 7673, 4865, 8003, 7242,
+    5551, 6651, 8383, 1653, 7055, 5974, 6089, 2699, 1608, 8892, 2646, 1331,
+    3503, 640, 6487, 4301, 4094, 3160, 4768, 178, 6874, 7436, 9071, 7883,
+    4300, 3898, 4626, 4612, 7933, 3364, 8588, 9947, 1369, 9718, 3456, 5956,
+    9161, 2362, 8447, 5516, 3358, 7740, 9494, 2549, 5401, 4881, 9446, 3110,
+    6972, 5303, 6678, 9025, 2760, 5499, 5344, 4570, 5188, 8280, 6054, 7920,
+    45, 3441, 3143, 9041, 9126, 4847, 360, 1907, 8260, 6517, 3466, 9147,
+    1874, 7692, 8055, 1718, 8010, 8491, 6699, 8348, 8978, 6085, 6389, 3724,
+    2944, 2049, 2614, 62, 3446, 4763, 6119, 4508, 9658, 7835, 3408, 7538,
+    8292, 1180, 1738, 4093, 6422, 5631, 5210, 8611, 1820, 3228, 9852, 4486,
+    8782, 1887, 7750, 6813, 3314, 9891, 5301, 1482, 5463, 3158, 2353, 2672,
+    254, 7278, 7677, 5826, 8792, 8503, 8539, 8399, 7705, 5016, 7606, 3188,
+    7106, 6944, 60, 2852, 1540, 4363, 3798, 5851, 1343, 5659, 3937, 897,
+    8625, 4002, 5246, 5824, 6929, 2319, 5691, 173, 3527, 1201, 8897, 7411,
+    1837, 4933, 6350, 8090, 9723, 5778, 5333, 9236, 4998, 4357, 3707, 1826,
+    8536, 3900, 3102, 1157, 8852, 259, 1, 2668, 8440, 7120, 5123, 8175,
+    2433, 8530, 5380, 2967, 4808, 4862, 9670, 7721, 7144, 589, 8902, 7879,
+    5520, 6166, 2652, 2423, 6690, 3198, 6906, 6720, 3201, 729, 2221, 1255,
+    2823, 5988, 4858, 2907, 8140, 6479, 9657, 3706, 6902, 4540, 1287, 7981,
+    3502, 3691, 6485, 6375, 7769, 633, 5345, 348, 443, 8614, 141, 5929,
+    3331, 7733, 3575, 2734, 3185, 3238, 4809, 1842, 1859, 502, 4522, 9746,
+    8928, 4489, 2150, 1648, 2702, 6942, 7890, 2757, 990, 9778, 6556, 7224,
+    2506, 153, 2403, 1203, 883, 6700, 1531, 793, 2377, 9525, 208, 3795,
+    4454, 5331, 1402, 4775, 9736, 5055, 8986, 4428, 8640, 7779, 5789, 3156,
+    5360, 4246, 240, 5394, 2961, 495, 345, 7745, 7000, 5469, 9138, 4360,
+    1934, 3534, 214, 5325, 7087, 8876, 9652, 9098, 577, 7256, 7955, 3242,
+    4467, 9717, 8693, 7655, 6669, 9848, 9511, 7724, 7024, 446, 9240, 2818,
+    512, 3174, 4177, 7676, 2397, 7415, 4861, 1908, 6328, 2469, 1717, 6790,
+    3978, 9880, 9261, 5978, 8338, 2092, 5313, 4866, 1036, 1104, 9962, 6351,
+    7764, 6356, 2435, 6712, 320, 4995, 9763, 1117, 7970, 7741, 2570, 2044,
+    8128, 8750, 9118, 8071, 2170, 2920, 8749, 956, 3683, 7726, 2981, 6387,
+    6066, 7507, 2625, 7701, 1367, 6307, 3275, 7833, 2762, 876, 903, 2491,
+    6203, 9808, 1575, 6591, 226, 8435, 129, 4671, 898, 1861, 5070, 6687,
+    4738, 555, 3220, 2921, 6056, 4162, 110, 3282, 5003, 8118, 4423, 2391,
+    9842, 3128, 4946, 3524, 1248, 5194, 2144, 1349, 2605, 2964, 8882, 5141,
+    2497, 3385, 1171, 3069, 6092, 52, 4968, 7238, 7398, 1053, 2876, 5521,
+    2305, 8081, 2410, 44, 2831, 5996, 6963, 4279, 1860, 4448, 8759, 4641,
+    9653, 4562, 3611, 1534, 8, 1014, 4073, 6801, 2398, 6635, 9616, 2061,
+    2515, 6665, 230, 3490, 750, 5697, 9306, 1923, 1782, 4187, 1211, 2798,
+    6832, 3308, 5707, 4172, 9990, 125, 8958, 3477, 8496, 8007, 115, 8473,
+    5094, 9826, 6315, 7834, 7430, 463, 5086, 7252, 2758, 2994, 2037, 1207,
+    9982, 5592, 1839, 6493, 4480, 5931, 6077, 2243, 5840, 9154, 533, 8293,
+    6378, 2813, 3070, 9278, 8920, 1629, 5970, 7732, 1280, 5384, 4669, 2483,
+    3241, 142, 7290, 2693, 2146, 8903, 4117, 7496, 7429, 4388, 7269, 8696,
+    9111, 9490, 4849, 5482, 9755, 9101, 8991, 7123, 7245, 8534, 3192, 5157,
+    6723, 3153, 9812, 2478, 7639, 8939, 4325, 7259, 1879, 4129, 2288, 947,
+    5854, 28, 670, 2320, 1560, 9447, 2639, 5444, 2132, 2191, 9477, 228,
+    813, 5308, 632, 7976, 1760, 5441, 275, 8382, 132, 6744, 3436, 8467,
+    9664, 8311, 7946, 4972, 5178, 6937, 5767, 7689, 7693, 42, 121, 9039,
+    7384, 7305, 3592, 3216, 6491, 2492, 9859, 2361, 8234, 4225, 2759, 4047,
+    157, 9937, 7470, 7658, 2176, 6672, 1759, 6609, 2891, 1944, 9799, 9527,
+    7146, 1527, 9413, 1390, 9452, 54, 9115, 3950, 7640, 9994, 5675, 871,
+    6278, 2942, 1604, 8459, 1788, 1399, 1481, 3847, 5522, 6578, 594, 6904,
+    8509, 8912, 3929, 8436, 3620, 7928, 6553, 3520, 8211, 8589, 3451, 263,
+    5627, 9640, 5569, 8698, 8708, 215, 8820, 9850, 992, 4373, 7906, 1596,
+    1309, 8894, 8889, 8334, 3845, 4406, 6244, 119, 6666, 839, 6414, 9548,
+    8139, 766, 5202, 8079, 602, 3495, 4281, 9697, 5230, 6654, 8369, 3622,
+    9502, 7938, 7775, 2022, 8017, 8514, 4063, 7562, 4004, 4402, 7519, 4983,
+    6797, 6320, 1737, 517, 6815, 7362, 4618, 1518, 9871, 6814, 5125, 8519,
+    3302, 1552, 5422, 3305, 9470, 3922, 9362, 6784, 6693, 3634, 2840, 7043,
+    2971, 5355, 7759, 7435, 6847, 1074, 8799, 1335, 1957, 8941, 2595, 1955,
+    2083, 7971, 1096, 6445, 6588, 4568, 5112, 9654, 3689, 3340, 5926, 5087,
+    1886, 912, 2025, 9626, 5563, 2794, 2096, 8540, 2111, 1279, 460, 7204,
+    5799, 3631, 8313, 1749, 787, 3732, 1504, 9955, 7291, 7074, 1514, 7720,
+    3084, 9141, 5201, 406, 7481, 9908, 9086, 4182, 2053, 2939, 5545, 932,
+    9291, 374, 2008, 6656, 2201, 2308, 1218, 1490, 342, 1864, 544, 927,
+    8446, 4289, 7857, 1143, 1904, 6529, 9271, 260, 1931, 9729, 559, 1603,
+    3448, 3968, 4174, 9769, 8028, 7838, 9259, 5395, 8857, 8833, 1956, 7931,
+    7812, 4376, 2324, 532, 8013, 4285, 6909, 8043, 7054, 6642, 7664, 8643,
+    2266, 7700, 7385, 5902, 2741, 104, 108, 8829, 1026, 7615, 8666, 2175,
+    5113, 8443, 9647, 7944, 8001, 7716, 3396, 6249, 7168, 2842, 9360, 2771,
+    5880, 9823, 6951, 5894, 6103, 4873, 6868, 9238, 8676, 756, 3211, 367,
+    8402, 1423, 2550, 4571, 6174, 7807, 96, 9787, 6168, 1020, 363, 5993,
+    5410, 4629, 2805, 7258, 1889, 4247, 8955, 8403, 361, 8668, 2563, 8672,
+    5585, 8844, 1530, 3748, 9835, 3489, 8762, 5457, 9134, 7376, 1178, 5869,
+    8344, 7225, 3893, 5580, 8401, 551, 5034, 4884, 7963, 17, 4579, 4040,
+    3652, 3310, 8283, 1827, 369, 5962, 4831, 5742, 9784, 2447, 2270, 1977,
+    2809, 9009, 5786, 9062, 9954, 7408, 9425, 7348, 2366, 5746, 6987, 3512,
+    6377, 286, 3677, 972, 256, 6620, 6728, 1959, 7280, 7560, 8184, 9144,
+    2999, 1380, 6371, 706, 870, 9197, 278, 6412, 7895, 5666, 1002, 7563,
+    4216, 5997, 582, 6939, 7595, 3246, 4198, 885, 5489, 5777, 1199, 2010,
+    1018, 308, 4965, 661, 8433, 7925, 3374, 2157, 5961, 6456, 7272, 8077,
+    3450, 415, 8008, 9530, 4276, 820, 3880, 9448, 6316, 403, 4981, 4636,
+    7466, 6626, 8431, 3415, 7402, 8665, 7751, 7126, 2615, 322, 1457, 5195,
+    2242, 6742, 3559, 4266, 3614, 1618, 2387, 1224, 3092, 1278, 3187, 6013,
+    8520, 4668, 8946, 3784, 7536, 9833, 4840, 5736, 4319, 994, 8282, 1936,
+    9827, 68, 4165, 7725, 6037, 9615, 3765, 3255, 2828, 2618, 2553, 1853,
+    8170, 6971, 6861, 3735, 126, 4111, 4833, 1774, 4416, 1168, 827, 6130,
+    1175, 4169, 1643, 1625, 1962, 2337, 5515, 4055, 4171, 2679, 2419, 5277,
+    7149, 9777, 6613, 5687, 5127, 9200, 3470, 1046, 6319, 1156, 5665, 9622,
+    8251, 7878, 9476, 3840, 9252, 9840, 1011, 3025, 6161, 43, 349, 8249,
+    5817, 9706, 3545, 301, 164, 8485, 2986, 6416, 8354, 8304, 6789, 8670,
+    6483, 7958, 7735, 8648, 9679, 6162, 7377, 3336, 6358, 7598, 4378, 6765,
+    5000, 8301, 5836, 8638, 8422, 4338, 7842, 9407, 4740, 1159, 3064, 791,
+    3221, 3808, 8556, 2686, 7837, 3823, 9242, 3587, 4643, 1319, 2390, 8543,
+    4305, 6520, 5663, 7001, 1112, 2974, 8567, 3183, 2722, 762, 378, 7943,
+    1999, 5456, 2394, 3107, 8475, 3528, 393, 4426, 6599, 7742, 2471, 7783,
+    4604, 6919, 8557, 4122, 8521, 6702, 2293, 1667, 5872, 1657, 5253, 3270,
+    500, 2459, 2808, 6074, 3142, 5012, 7344, 6060, 3642, 8851, 7924, 8291,
+    4128, 5302, 654, 3121, 3926, 6827, 8732, 2789, 1516, 896, 7463, 8097,
+    5250, 8173, 1685, 5882, 7990, 9180, 9281, 584, 2070, 4724, 1097, 4815,
+    913, 5604, 2836, 2097, 8515, 2408, 2402, 323, 1093, 6844, 1724, 8606,
+    3569, 8886, 4925, 9567, 536, 1771, 3514, 6694, 357, 7034, 2298, 8119,
+    2504, 7770, 1823, 111, 6275, 9703, 7183, 8634, 1797, 1858, 7167, 6959,
+    5801, 410, 9696, 2976, 7978, 4806, 824, 5699, 136, 1770, 1789, 9943,
+    5054, 2078, 7007, 5528, 5408, 9406, 7221, 3135, 8804, 2281, 4693, 9415,
+    2118, 2603, 5052, 6486, 7993, 1456, 9909, 5298, 4661, 6195, 1368, 8713,
+    19, 475, 3137, 331, 578, 1075, 5433, 8324, 2853, 6870, 2874, 3672,
+    7173, 6867, 2627, 6732, 720, 8385, 4447, 4941, 5492, 4475, 7665, 7621,
+    4929, 860, 1212, 6685, 8809, 2726, 4499, 2776, 7847, 7556, 61, 3615,
+    398, 3346, 9558, 968, 1012, 9592, 92, 9122, 2854, 3967, 838, 3674,
+    6494, 130, 3588, 4640, 3435, 4249, 9189, 5248, 3480, 9164, 2050, 6530,
+    2463, 2137, 3879, 4633, 471, 2147, 8898, 7889, 6780, 4274, 9710, 9241,
+    3195, 73, 7236, 1616, 5692, 4131, 1981, 5793, 3186, 156, 2190, 6152,
+    4309, 6451, 4476, 5757, 7156, 6984, 8068, 3670, 708, 3812, 8408, 3033,
+    4922, 9282, 285, 7561, 5316, 5247, 5820, 432, 4097, 9966, 4727, 4121,
+    1387, 1930, 8684, 1586, 7706, 5078, 8371, 7141, 1769, 1581, 1513, 6135,
+    6251, 1816, 4253, 396, 8092, 980, 1202, 4584, 8259, 811, 7909, 4931,
+    8058, 899, 6655, 2424, 6710, 881, 8861, 6767, 3877, 8740, 7696, 5020,
+    9140, 7322, 8754, 2793, 855, 7283, 7301, 3036, 6007, 3389, 1712, 4084,
+    6272, 4396, 1925, 6511, 9210, 2954, 3387, 609, 7169, 1793, 6196, 9133,
+    6087, 6820, 7688, 4647, 2569, 5887, 6150, 9467, 472, 8781, 4511, 836,
+    6976, 1781, 2412, 6608, 3606, 8846, 3140, 3123, 9042, 6408, 6234, 8714,
+    3555, 4997, 2442, 8507, 9298, 4569, 4694, 6274, 5227, 7511, 1176, 3291,
+    8987, 3774, 4910, 8653, 3130, 4043, 2773, 7565, 2428, 9280, 9753, 7233,
+    5586, 8452, 1435, 2621, 5784, 5258, 3354, 7382, 6968, 4996, 1256, 6418,
+    7223, 9751, 9247, 663, 3998, 2559, 576, 652, 8559, 6952, 6829, 1085,
+    3699, 8187, 1236, 2749, 3859, 1225, 8984, 4820, 6321, 397, 4284, 1825,
+    5388, 9380, 3675, 2822, 5235, 9014, 1736, 5959, 9401, 2246, 2731, 6419,
+    9579, 772, 2551, 2812, 5761, 2495, 4422, 6735, 5610, 9272, 7815, 2360,
+    7261, 9523, 8627, 4915, 4336, 8321, 7083, 8398, 9457, 9372, 3481, 8281,
+    4587, 2100, 7504, 6011, 8244, 118, 673, 8442, 6836, 3881, 8490, 2167,
+    3326, 1049, 473, 20, 715, 9907, 9524, 9554, 2791, 5582, 5151, 5044,
+    2369, 8954, 3731, 1142, 7480, 2745, 6323, 5431, 545, 8621, 7697, 4790,
+    1868, 6943, 5264, 8149, 314, 5845, 3166, 5562, 7939, 9692, 9333, 4386,
+    2737, 9018, 3050, 8812, 2165, 7790, 2948, 2257, 522, 9152, 6547, 2772,
+    8116, 3007, 8951, 1857, 3293, 3829, 4079, 3106, 4798, 8299, 7656, 2462,
+    9745, 9625, 7203, 1535, 8573, 2102, 7076, 7084, 7181, 2227, 9235, 2503,
+    264, 3392, 9030, 3943, 7279, 6555, 9690, 5326, 5174, 4635, 1929, 5608,
+    2414, 997, 8284, 5039, 3218, 6434, 6120, 4345, 4468, 9921, 4906, 7585,
+    86, 6442, 7929, 6600, 4578, 1574, 4298, 3962, 5385, 4045, 1138, 6695,
+    3582, 3383, 9017, 335, 698, 3067, 2418, 2316, 9783, 8960, 6523, 97,
+    5245, 2519, 7332, 6580, 5554, 2066, 6893, 9011, 5602, 8702, 3636, 9033,
+    7389, 8664, 7998, 7065, 4229, 6283, 5093, 3034, 6567, 5115, 9203, 675,
+    4294, 2830, 6324, 806, 9371, 1974, 4399, 6398, 3668, 1438, 8880, 2076,
+    3462, 8532, 5994, 6860, 9779, 7255, 3934, 6082, 519, 819, 3058, 1610,
+    8517, 24, 2723, 400, 9996, 9168, 4680, 4824, 4723, 2753, 7032, 595,
+    1528, 6353, 4617, 6393, 6849, 3009, 2717, 9618, 535, 2899, 3915, 205,
+    4053, 1918, 8633, 3794, 2035, 5082, 5089, 9576, 4330, 1366, 6705, 9279,
+    2711, 7231, 4072, 3635, 4898, 740, 5815, 8552, 1137, 4761, 7603, 6470,
+    3505, 187, 5619, 1701, 2470, 2566, 370, 3685, 1338, 5884, 3263, 5759,
+    5561, 5932, 4975, 8456, 1045, 7011, 7047, 36, 3984, 9915, 1314, 2972,
+    8317, 9601, 783, 133, 9325, 6857, 7798, 8881, 5833, 7830, 5138, 4619,
+    1877, 9733, 1496, 9590, 6992, 8511, 5986, 6163, 2965, 1251, 9633, 7534,
+    3394, 3266, 5735, 6840, 3243, 352, 3439, 3172, 7061, 1043, 7793, 4742,
+    8107, 5525, 9357, 4427, 9568, 9973, 5446, 6181, 8918, 854, 1258, 2732,
+    1899, 5496, 3202, 3817, 7051, 417, 2181, 1526, 711, 4366, 6563, 2014,
+    5981, 1757, 5324, 4622, 3939, 9894, 383, 9671, 1847, 2941, 7864, 8305,
+    281, 9139, 8247, 7392, 7331, 7554, 4271, 7312, 6481, 8547, 1628, 7836,
+    6221, 2698, 3126, 4853, 5483, 5976, 9145, 4146, 572, 1253, 5150, 116,
+    7872, 5835, 8800, 6134, 9624, 6374, 8788, 6510, 239, 1100, 6266, 3956,
+    3224, 4152, 1602, 526, 5639, 8096, 9284, 4296, 5493, 680, 4326, 5409,
+    2059, 6121, 3980, 427, 7801, 8719, 2193, 5232, 5706, 3578, 2742, 77,
+    8106, 1475, 8150, 726, 6548, 629, 4208, 814, 1477, 1817, 851, 550,
+    5848, 1172, 3617, 4704, 7096, 7243, 6062, 9716, 6725, 4314, 8322, 5511,
+    1166, 4957, 1600, 5949, 6465, 9687, 6774, 5654, 3923, 8179, 840, 2056,
+    3285, 4112, 8342, 3284, 9264, 2274, 6598, 1392, 8243, 3028, 6236, 7919,
+    6604, 890, 4757, 4320, 9178, 2890, 4479, 1953, 1353, 6997, 1476, 5002,
+    2583, 9534, 4453, 5398, 8650, 973, 5811, 8060, 2074, 3060, 1948, 832,
+    2596, 7217, 6245, 454, 3810, 8723, 6571, 5176, 9813, 2411, 2787, 1687,
+    3251, 9377, 9765, 3457, 2450, 2943, 2223, 1539, 8822, 8051, 4653, 6500,
+    2613, 3077, 6764, 8168, 3081, 2033, 1479, 3227, 5964, 3292, 5083, 6717,
+    4089, 5389, 2814, 2631, 7578, 9902, 188, 6009, 9752, 6171, 7514, 4410,
+    3680, 9668, 8825, 1880, 1183, 169, 1986, 8988, 2508, 3458, 3987, 5390,
+    9910, 9149, 8182, 1361, 3742, 8466, 8337, 5309, 717, 1467, 6295, 2429,
+    8474, 5240, 5371, 34, 6439, 6532, 1852, 3551, 3979, 3836, 4306, 1761,
+    2695, 3567, 6682, 3767, 1210, 8023, 3536, 5429, 4889, 7215, 5304, 7972,
+    1638, 222, 4959, 2522, 3637, 2930, 4201, 8258, 1664, 3155, 8135, 1840,
+    5743, 380, 8109, 2405, 4556, 1594, 1089, 8363, 1684, 83, 1651, 6312,
+    6957, 455, 9390, 9931, 3276, 7132, 6180, 6863, 924, 6650, 3801, 2006,
+    6246, 3651, 626, 8242, 8127, 9506, 5995, 6785, 4226, 4263, 7042, 4228,
+    3089, 5273, 7460, 3837, 4810, 5045, 8932, 2153, 4662, 8724, 1001, 601,
+    752, 7066, 191, 1726, 1333, 4644, 3139, 9317, 2931, 8303, 6697, 7030,
+    930, 8085, 7899, 9225, 399, 9410, 8482, 5794, 2713, 4210, 4803, 2513,
+    8826, 1302, 5795, 7059, 5590, 5362, 2127, 9532, 6213, 4157, 6886, 2130,
+    8657, 1571, 456, 1849, 6287, 3430, 6787, 5992, 4580, 5145, 9846, 981,
+    464, 6431, 5557, 8352, 5723, 6277, 6225, 9516, 4772, 1072, 8124, 6426,
+    1546, 3518, 2441, 9438, 5857, 2960, 5105, 7996, 8404, 1521, 3989, 6852,
+    1906, 2486, 8717, 3975, 1106, 5537, 9968, 4947, 5733, 6748, 7205, 3540,
+    5366, 3951, 6498, 2535, 5958, 2005, 9588, 735, 2126, 6737, 9120, 9262,
+    1644, 566, 2084, 3601, 3406, 6722, 7752, 1665, 3701, 5249, 4845, 8214,
+    7355, 1461, 9895, 4214, 2121, 8893, 7634, 1950, 3781, 7502, 6974, 189,
+    4721, 7648, 4736, 9303, 4960, 4939, 3, 4355, 1233, 7804, 9160, 493,
+    7220, 3117, 593, 3769, 2725, 7319, 8930, 9957, 2849, 4, 147, 6899,
+    5977, 9704, 2947, 9898, 7694, 1379, 4964, 5923, 3182, 1293, 9659, 6018,
+    3401, 6291, 7212, 9307, 1523, 9508, 6503, 2995, 3100, 6097, 1170, 9254,
+    5079, 1566, 3030, 3244, 1007, 9400, 5810, 5259, 9251, 9456, 4242, 7310,
+    4688, 3280, 5584, 4856, 3215, 1626, 8558, 4017, 9092, 1447, 4156, 145,
+    236, 6495, 3493, 8250, 4816, 1152, 7530, 2712, 7360, 9925, 6914, 8736,
+    5912, 3655, 2282, 6958, 4405, 2149, 8494, 7118, 7819, 7200, 5379, 8197,
+    5025, 8538, 4826, 5806, 1615, 9814, 7940, 1427, 6833, 4341, 4834, 8309,
+    4414, 2660, 0, 9707, 697, 2426, 1242, 552, 4527, 9845, 3059, 2630,
+    6186, 5370, 7179, 8721, 389, 6631, 1558, 7350, 4180, 2069, 722, 2164,
+    9801, 4432, 882, 4675, 8877, 1285, 7631, 8737, 1838, 5896, 5382, 1406,
+    7335, 2436, 5437, 2063, 4339, 4273, 5502, 5965, 984, 6115, 9538, 7100,
+    6743, 3946, 3786, 2701, 8850, 2287, 244, 2224, 1890, 2348, 8465, 3626,
+    6400, 8093, 9388, 6689, 3453, 1935, 8186, 531, 1982, 9239, 8678, 1976,
+    9504, 2001, 7249, 3758, 8052, 9310, 8524, 3294, 2694, 261, 6123, 8420,
+    8814, 4302, 4278, 7468, 4392, 4632, 4106, 9721, 9142, 1382, 754, 2581,
+    6332, 7063, 4490, 2554, 9103, 7026, 5462, 1472, 7669, 3452, 6564, 631,
+    2781, 7756, 1068, 1884, 8276, 9920, 7053, 8061, 7932, 8770, 6384, 4860,
+    4134, 2906, 435, 2425, 6913, 8961, 6441, 7704, 6497, 3658, 2708, 3831,
+    4001, 8252, 5449, 2256, 5229, 7153, 7616, 6966, 9594, 290, 3977, 6499,
+    6179, 4481, 5669, 2825, 6344, 9061, 7137, 5252, 6554, 9997, 9198, 2355,
+    9418, 3696, 2068, 4470, 3460, 6297, 1709, 9515, 1431, 6887, 7531, 3599,
+    5847, 9053, 7848, 8424, 748, 3762, 3133, 7620, 9634, 8315, 7372, 3304,
+    2649, 5540, 6845, 7445, 7661, 1449, 9006, 6270, 2985, 9832, 2339, 5208,
+    2958, 5550, 4161, 4512, 5858, 7049, 4705, 9442, 3653, 1622, 9001, 4114,
+    5909, 8472, 831, 5625, 2878, 29, 8157, 6267, 3484, 1222, 4800, 9344,
+    7604, 6938, 9217, 2276, 5598, 2607, 8916, 50, 3196, 1979, 9991, 611,
+    9580, 3312, 3384, 2851, 3907, 5358, 9738, 9302, 27, 4397, 6293, 9459,
+    8549, 554, 8397, 3729, 8513, 4367, 4905, 7227, 6095, 7614, 3167, 8506,
+    2156, 928, 8741, 6126, 1468, 523, 1265, 7927, 1492, 4631, 2896, 4342,
+    9374, 9093, 9980, 2984, 5010, 4482, 5863, 4255, 9807, 4331, 8583, 2510,
+    2827, 1705, 2901, 2678, 1897, 1064, 9597, 5015, 6566, 4101, 9428, 7459,
+    8926, 2590, 7886, 1630, 7456, 7038, 2106, 4065, 9369, 9816, 4071, 7863,
+    5975, 7525, 7248, 9911, 9020, 1910, 1502, 3115, 5149, 508, 6256, 1465,
+    6464, 1807, 4076, 65, 7941, 5280, 1670, 4595, 4316, 1598, 5841, 3179,
+    7023, 548, 5775, 8478, 7975, 8545, 6280, 6233, 5467, 2261, 507, 3418,
+    7827, 7353, 9978, 1332, 3890, 9533, 7853, 4260, 4440, 4781, 6505, 480,
+    1698, 7608, 5076, 770, 3421, 1088, 1269, 864, 8409, 5162, 9070, 4497,
+    5812, 617, 7306, 6411, 2633, 8015, 6359, 6534, 7488, 7277, 9942, 6311,
+    6215, 666, 2531, 2269, 8220, 5645, 7984, 5349, 3901, 7777, 6093, 1497,
+    7910, 5314, 6508, 7950, 6260, 8919, 9034, 6157, 8026, 336, 6415, 5102,
+    5132, 5689, 646, 641, 2642, 7119, 429, 2202, 9253, 1146, 4793, 779,
+    9376, 3749, 7659, 280, 1024, 3641, 8379, 9211, 6825, 4048, 8581, 458,
+    3941, 85, 247, 311, 2071, 6514, 2667, 4192, 2629, 1052, 8798, 4773,
+    5749, 6026, 3178, 7017, 5067, 2526, 5681, 9772, 3479, 8622, 5908, 2900,
+    8368, 3814, 1405, 4687, 6622, 6250, 6304, 4720, 5648, 1041, 6204, 9688,
+    8065, 8122, 7680, 7395, 3640, 4213, 334, 8970, 6423, 3821, 7093, 925,
+    8100, 3239, 7573, 6876, 1565, 1441, 7072, 4777, 7544, 3885, 6128, 1971,
+    3556, 2162, 2530, 4022, 2129, 3972, 6438, 5458, 7442, 6975, 4370, 1922,
+    3916, 6407, 3581, 71, 67, 4495, 6421, 8032, 3830, 6016, 2168, 5448,
+    1725, 7151, 2778, 7254, 1130, 1632, 4582, 3004, 7663, 4027, 9214, 7691,
+    543, 1579, 5338, 3424, 7103, 6616, 2499, 5465, 486, 7667, 1856, 3459,
+    8686, 9794, 8216, 100, 1050, 7526, 1213, 2094, 9851, 9831, 1915, 462,
+    7467, 6243, 4082, 5850, 1654, 3659, 8141, 1503, 47, 1829, 1160, 8164,
+    4912, 2746, 8062, 5600, 2210, 9056, 4625, 1631, 3548, 6891, 5881, 2915,
+    5154, 9411, 6711, 9485, 2799, 1800, 2284, 541, 9719, 8777, 9330, 586,
+    2949, 1787, 3596, 865, 8098, 117, 2520, 1873, 2589, 1047, 1912, 2796,
+    7549, 5295, 143, 3222, 9220, 9627, 5353, 4660, 9263, 2593, 4236, 4678,
+    6480, 5484, 8248, 7155, 4780, 4060, 1067, 842, 4888, 3800, 9177, 5952,
+    9202, 7678, 8718, 3334, 9995, 1312, 5728, 8966, 5656, 1122, 5480, 4125,
+    4450, 6252, 7068, 1015, 3120, 5007, 8962, 8551, 3475, 8624, 7820, 9460,
+    2058, 3486, 4591, 6525, 6237, 5256, 5704, 3332, 4691, 3608, 2143, 5643,
+    2859, 859, 8597, 4025, 723, 6061, 5059, 8989, 7044, 364, 5470, 7869,
+    9173, 4739, 9356, 6888, 4275, 3818, 696, 6878, 190, 3566, 4961, 3352,
+    6881, 5698, 5064, 4287, 7486, 2042, 608, 7040, 8592, 5635, 5596, 2040,
+    6729, 7760, 2093, 9641, 3012, 9469, 3307, 599, 7814, 9809, 8529, 4667,
+    7731, 7516, 9711, 4008, 1882, 8867, 4788, 9678, 747, 9858, 4035, 5368,
+    5030, 8274, 4745, 6041, 8326, 4544, 5038, 9368, 5096, 5710, 7997, 810,
+    9785, 3454, 9537, 7131, 1284, 4722, 9595, 3995, 1661, 2651, 6262, 6330,
+    9862, 815, 4823, 4893, 2815, 3455, 5099, 6507, 8014, 4471, 7523, 4310,
+    8616, 5628, 5734, 6372, 1888, 313, 3621, 7122, 1686, 6118, 3609, 3825,
+    6726, 7535, 3949, 9694, 7128, 2389, 6745, 3390, 8728, 570, 9153, 2141,
+    8922, 6055, 4566, 7190, 35, 9441, 1103, 6905, 8205, 7995, 9705, 9876,
+    9163, 3442, 1323, 5392, 4358, 4144, 181, 7464, 1913, 1397, 2204, 5101,
+    4295, 5262, 3960, 2123, 5075, 4500, 6177, 4606, 1424, 873, 2636, 5336,
+    8089, 9979, 4258, 7901, 5861, 7019, 7682, 6596, 8617, 3708, 1715, 1499,
+    9623, 657, 4559, 1291, 5649, 9398, 3175, 8437, 2517, 3973, 5578, 7845,
+    8655, 3399, 9185, 2584, 2085, 2664, 3444, 5541, 3963, 4715, 2934, 823,
+    5443, 5231, 2956, 6230, 4685, 8479, 955, 4375, 8815, 4095, 3750, 1719,
+    6991, 2656, 2349, 37, 8191, 2332, 5022, 5719, 9951, 211, 4707, 3363,
+    6677, 8064, 5556, 3380, 2514, 4018, 1241, 812, 2461, 362, 5504, 7453,
+    8091, 4501, 9095, 4613, 5620, 4812, 6540, 9450, 916, 1057, 5683, 8774,
+    8793, 5989, 3040, 3868, 8377, 6340, 4530, 6057, 4537, 5688, 306, 1568,
+    2537, 7191, 1554, 4864, 4308, 1235, 2914, 6192, 6659, 7797, 8801, 2588,
+    6194, 9795, 8974, 9304, 1699, 8860, 447, 4689, 7550, 695, 3618, 4219,
+    1017, 4483, 6872, 407, 1893, 8063, 6967, 3897, 5354, 7584, 7654, 7022,
+    8095, 6680, 5816, 4028, 1412, 8048, 4445, 5263, 2194, 442, 7349, 9444,
+    6864, 9040, 8207, 4608, 2998, 5605, 8683, 5381, 6788, 4408, 7337, 3602,
+    5474, 5721, 1898, 1561, 9347, 4449, 8070, 9972, 4267, 8789, 8204, 904,
+    9934, 7018, 1359, 9571, 3700, 1659, 5337, 8271, 7588, 3002, 917, 5148,
+    2370, 3049, 5544, 452, 786, 5068, 5546, 1683, 168, 3828, 3947, 4737,
+    4009, 2790, 9866, 4425, 6928, 2363, 6455, 2182, 4978, 6527, 7235, 2573,
+    2289, 1230, 9817, 9965, 4842, 3005, 9267, 8105, 3878, 6993, 2002, 6660,
+    8407, 9604, 4771, 6925, 291, 6528, 9989, 1646, 8542, 4836, 1627, 1386,
+    9606, 9192, 4735, 9391, 7522, 884, 9453, 3074, 9496, 1517, 8308, 8531,
+    1411, 2327, 8441, 691, 4194, 6855, 8784, 8964, 2087, 8593, 1750, 5575,
+    4032, 8629, 6746, 7510, 2336, 5290, 9563, 5193, 7786, 4572, 6429, 918,
+    6988, 1509, 4729, 6223, 6999, 328, 470, 3134, 6783, 3864, 8949, 5574,
+    8772, 4066, 7645, 2493, 3899, 3114, 5535, 3612, 6645, 6892, 2080, 9480,
+    6516, 9806, 3258, 2577, 9032, 2780, 4368, 6006, 343, 7237, 3423, 2438,
+    3695, 5347, 1030, 5638, 4846, 7772, 8555, 1634, 6139, 7930, 5866, 739,
+    4533, 2490, 2012, 1917, 1473, 1192, 9127, 5339, 4534, 3579, 5576, 5791,
+    4510, 4394, 4443, 961, 520, 9939, 1082, 3249, 9176, 1444, 7308, 8151,
+    5036, 9867, 4400, 1677, 183, 7413, 1942, 3093, 3876, 6369, 1070, 7953,
+    2673, 9275, 3646, 3309, 1219, 8067, 5615, 6409, 6538, 963, 3624, 2139,
+    8005, 7609, 5788, 3600, 9004, 6296, 3095, 9949, 9764, 8132, 4596, 5673,
+    79, 8199, 1811, 510, 8108, 8094, 185, 2072, 1550, 8378, 9021, 3214,
+    7163, 4183, 3957, 5166, 4421, 2881, 8673, 1862, 945, 7262, 5907, 9165,
+    8775, 6349, 4244, 8261, 7039, 7695, 7737, 7002, 6762, 4039, 4505, 807,
+    7492, 8609, 1032, 1125, 9311, 2576, 8020, 7824, 3116, 7218, 2608, 4785,
+    449, 9150, 4442, 9319, 8838, 3533, 4746, 7352, 3151, 3930, 8831, 8712,
+    496, 2174, 5803, 4657, 4417, 8339, 585, 7718, 1275, 6810, 3066, 2368,
+    8764, 3253, 6607, 4945, 5893, 9029, 1940, 5050, 5946, 1320, 2189, 1281,
+    1181, 8734, 4030, 8195, 4664, 177, 2019, 5376, 983, 1470, 445, 8756,
+    3338, 6029, 8056, 2739, 4311, 1231, 4193, 2926, 1458, 340, 5356, 39,
+    4013, 4904, 7229, 8950, 9646, 4352, 1153, 1780, 8042, 6935, 7129, 8807,
+    391, 4730, 8024, 2669, 8167, 8290, 5680, 1098, 1674, 3969, 2966, 1775,
+    7791, 4188, 848, 7136, 4166, 2951, 967, 5091, 2714, 9952, 4232, 4716,
+    9613, 3398, 2897, 3035, 7635, 705, 3616, 7703, 3289, 989, 4943, 4155,
+    8332, 7999, 934, 6782, 5285, 6380, 176, 1573, 9488, 1430, 2468, 3204,
+    784, 2145, 6410, 6802, 6290, 3323, 4706, 5317, 9097, 3665, 6664, 6757,
+    8729, 6778, 2030, 893, 7145, 2544, 8430, 7271, 2265, 2186, 7784, 6605,
+    9335, 4102, 700, 9403, 3723, 6448, 7785, 8411, 8975, 6799, 1763, 3605,
+    1414, 3584, 1102, 8854, 8102, 8913, 1562, 4830, 8999, 995, 5442, 4563,
+    6049, 1238, 5060, 9731, 7935, 7147, 7497, 2501, 8669, 1989, 9046, 5180,
+    5029, 4601, 2990, 6472, 4477, 5779, 5184, 9540, 9231, 7583, 9854, 3944,
+    248, 2344, 4786, 3485, 6169, 949, 5327, 3948, 687, 5921, 9887, 2323,
+    8733, 2415, 4220, 4037, 8361, 7675, 1190, 4916, 4033, 575, 1746, 5254,
+    5968, 4546, 3024, 7503, 4850, 1322, 6570, 1198, 6462, 6926, 9323, 3405,
+    9207, 982, 1061, 9269, 9222, 5185, 3999, 9970, 8210, 1408, 2351, 3921,
+    6934, 643, 9839, 5560, 3594, 4105, 5047, 905, 5874, 6593, 1440, 3053,
+    6473, 9744, 3704, 9645, 3016, 2820, 2484, 7989, 7029, 3254, 2225, 1949,
+    6643, 8177, 5566, 101, 1841, 7150, 4346, 5739, 3230, 7016, 6114, 3015,
+    5147, 525, 7904, 5731, 9535, 8533, 8577, 6301, 327, 7, 9727, 3240,
+    5653, 5272, 7542, 4673, 6901, 1054, 4437, 3874, 7202, 8054, 7314, 6559,
+    318, 2877, 8584, 2120, 2379, 4911, 8497, 2364, 9395, 8681, 6015, 2564,
+    5031, 6294, 1848, 7067, 1094, 2534, 7304, 4710, 5197, 3355, 9181, 7713,
+    9287, 5588, 8527, 3320, 2472, 4123, 5119, 186, 268, 6023, 2709, 6107,
+    3325, 4044, 490, 7792, 5063, 3775, 5727, 689, 3124, 891, 7947, 1832,
+    6151, 3112, 2416, 6206, 6212, 9002, 241, 1488, 2199, 4465, 6469, 941,
+    3531, 6798, 1916, 3849, 122, 95, 3256, 5657, 2979, 7197, 8705, 252,
+    216, 1200, 6220, 688, 1345, 9998, 9199, 4760, 3858, 9819, 1193, 9732,
+    6821, 7487, 5798, 1371, 9531, 109, 6373, 271, 7884, 1753, 8899, 5530,
+    1155, 6842, 7285, 3303, 8651, 3925, 8480, 220, 3866, 7472, 5700, 2464,
+    1452, 8123, 4802, 8194, 9106, 3822, 9232, 1729, 1779, 9215, 4222, 2869,
+    40, 2917, 253, 7393, 7813, 597, 2572, 9256, 7196, 2894, 2902, 451,
+    5035, 7171, 6322, 8706, 4395, 6583, 2835, 4814, 1767, 8421, 5708, 9552,
+    3644, 9720, 1413, 7028, 224, 5508, 2333, 2587, 7870, 2927, 3985, 8982,
+    2338, 1434, 4875, 8084, 8414, 3744, 1567, 4464, 9136, 1926, 5945, 422,
+    8905, 5821, 1095, 3554, 5822, 9346, 2326, 9003, 317, 9124, 4280, 8700,
+    579, 8953, 2365, 1585, 9324, 3754, 5066, 8994, 8526, 8768, 4628, 9642,
+    6043, 7394, 9088, 1927, 7127, 4634, 3958, 8004, 4797, 561, 7651, 8156,
+    4371, 3170, 8285, 9621, 2082, 614, 2528, 5725, 1360, 7292, 1290, 4532,
+    9961, 3997, 258, 9987, 4908, 3785, 3268, 9975, 8923, 6396, 8675, 2476,
+    9977, 4549, 5294, 7600, 2870, 8931, 8895, 4270, 5411, 408, 2571, 6646,
+    1229, 8868, 5677, 1268, 4430, 9484, 6865, 5321, 2179, 1714, 625, 1564,
+    8810, 3461, 5990, 9714, 2452, 4526, 4145, 6081, 8667, 1420, 7518, 5927,
+    879, 709, 7027, 5498, 3419, 5133, 1611, 2075, 9157, 6569, 9899, 5183,
+    3413, 9257, 3730, 5763, 7281, 3796, 4805, 4683, 8689, 2598, 9493, 8161,
+    3832, 8752, 8575, 1836, 2148, 4593, 5570, 9461, 4359, 668, 9433, 213,
+    781, 8797, 6673, 4026, 9608, 6617, 8417, 6065, 4665, 9698, 3734, 63,
+    5350, 7111, 7546, 4695, 4728, 1186, 7391, 7058, 773, 12, 4458, 120,
+    3027, 9386, 7294, 5652, 1903, 2567, 3029, 5547, 6198, 5315, 8766, 4892,
+    4747, 920, 2325, 5963, 8025, 325, 6282, 1340, 9107, 4158, 6649, 4799,
+    7773, 3072, 46, 7003, 5609, 4677, 2996, 4384, 6611, 8035, 8967, 647,
+    5323, 8924, 9179, 5517, 1994, 6982, 4393, 6741, 1129, 7559, 4265, 3147,
+    3541, 1851, 5906, 6427, 4599, 3318, 7324, 943, 1087, 218, 2763, 7330,
+    4791, 7957, 2594, 2417, 9759, 8237, 2955, 7378, 3819, 3935, 431, 7092,
+    4361, 7945, 5790, 9770, 4372, 4663, 2122, 9481, 7605, 4090, 9182, 3032,
+    7418, 3274, 8367, 4890, 5140, 8646, 7195, 8470, 3119, 2152, 9598, 7624,
+    9820, 4149, 7780, 2628, 9342, 5488, 2477, 6996, 1328, 7765, 797, 231,
+    702, 4110, 3017, 8510, 2622, 8730, 8499, 4610, 9638, 9350, 9223, 1679,
+    7230, 8115, 9389, 7730, 9337, 9847, 9882, 5128, 8761, 4108, 3698, 3537,
+    9294, 6940, 8390, 7075, 1597, 621, 6122, 3157, 877, 7357, 5279, 6012,
+    5690, 8644, 4552, 2031, 172, 5413, 4446, 6686, 2898, 7715, 106, 5043,
+    9557, 1584, 8406, 7965, 3841, 4909, 7545, 3043, 3905, 3585, 1436, 7307,
+    3056, 8307, 2802, 2480, 7613, 7728, 878, 6980, 5477, 2779, 638, 2456,
+    7077, 2017, 6083, 6021, 8562, 7414, 9938, 2155, 7632, 8481, 4167, 1818,
+    2151, 7841, 563, 5451, 6614, 9308, 3725, 9877, 6004, 375, 5182, 9348,
+    9089, 946, 4789, 8016, 3478, 504, 8613, 1938, 7596, 8870, 9581, 4624,
+    162, 9316, 7175, 7424, 5134, 9790, 9186, 5215, 6670, 5716, 623, 3091,
+    1996, 5916, 8235, 2180, 78, 7396, 7449, 1624, 4963, 3467, 2311, 1911,
+    436, 7719, 660, 9248, 5400, 2747, 3743, 9427, 9941, 6463, 5365, 1764,
+    9562, 7948, 4841, 2055, 2346, 6964, 8983, 5818, 3165, 9583, 2128, 2404,
+    9589, 112, 3136, 3576, 1688, 4919, 6201, 9083, 2606, 8827, 1110, 1498,
+    3992, 3426, 1433, 7590, 5404, 3042, 4217, 7387, 3971, 7520, 6148, 7494,
+    8808, 9953, 2834, 6918, 4139, 1421, 3519, 2051, 5085, 2350, 7709, 8044,
+    6730, 5478, 6579, 2356, 2432, 8594, 5825, 5900, 2611, 1662, 9756, 1038,
+    8997, 3217, 2929, 2235, 5722, 3988, 895, 4451, 1034, 1055, 3277, 9713,
+    8131, 6362, 1772, 3000, 3161, 4015, 6489, 704, 8879, 3572, 6749, 6367,
+    1489, 1702, 3938, 5897, 6038, 4436, 4676, 952, 1589, 542, 405, 7711,
+    7898, 5081, 6715, 7799, 7548, 2222, 8192, 4969, 5426, 8910, 4988, 426,
+    3863, 2371, 8929, 8266, 6936, 8372, 5057, 4420, 1415, 5611, 4484, 6839,
+    6539, 5243, 8598, 155, 7268, 6468, 5359, 4543, 4869, 9035, 2718, 7267,
+    9976, 14, 3434, 1220, 6348, 7977, 2885, 203, 8865, 5369, 8166, 8425,
+    5475, 6450, 3678, 3353, 996, 5506, 9099, 728, 9923, 8943, 868, 9762,
+    6610, 6531, 5644, 9087, 965, 5870, 411, 718, 387, 8449, 3006, 6098,
+    4503, 8776, 935, 4901, 3377, 9543, 4364, 4064, 6679, 5018, 5954, 4404,
+    3663, 8632, 4403, 9443, 1027, 9358, 2482, 3279, 1751, 8663, 4381, 6001,
+    3886, 1784, 402, 5849, 9669, 3205, 5209, 1692, 7679, 4902, 8656, 8006,
+    4003, 5766, 9393, 3463, 1520, 2710, 6335, 6385, 9924, 3865, 5419, 7499,
+    1161, 5065, 9137, 2231, 7844, 5191, 664, 9905, 4917, 448, 2212, 3966,
+    9680, 339, 1606, 9216, 440, 9474, 8045, 6752, 527, 4463, 7891, 5539,
+    1076, 7170, 3705, 5461, 6962, 6405, 9586, 3509, 4515, 25, 1194, 1723,
+    5391, 8278, 5212, 9546, 1682, 9007, 1768, 2599, 355, 307, 4686, 1866,
+    3290, 3180, 8780, 9243, 1073, 294, 3041, 4335, 8554, 1995, 98, 2260,
+    4918, 2888, 6841, 6094, 5752, 7787, 5008, 5781, 3068, 581, 1105, 9603,
+    9245, 9110, 3469, 4598, 2342, 8145, 9655, 8544, 7341, 6932, 2052, 5168,
+    4807, 5939, 5300, 701, 1756, 8286, 5328, 3078, 6138, 4343, 2609, 9906,
+    8445, 7809, 8468, 5061, 5284, 8959, 9500, 6512, 7288, 790, 7670, 6753,
+    8765, 3376, 2453, 5329, 8727, 7630, 2045, 9805, 2029, 3820, 7629, 5831,
+    9109, 9602, 1016, 6504, 3996, 3283, 5668, 6524, 1582, 6025, 7994, 8803,
+    7264, 1663, 7342, 9844, 5890, 8935, 6366, 7832, 8405, 2117, 377, 3563,
+    3075, 4782, 4118, 6214, 9677, 7686, 5386, 8162, 4839, 6149, 5919, 2970,
+    5216, 1721, 8885, 2498, 3671, 1863, 18, 3727, 8312, 8535, 2258, 8992,
+    7010, 4148, 3747, 7551, 395, 744, 7618, 9549, 4765, 4091, 6704, 3083,
+    7323, 8751, 6255, 1443, 2500, 6259, 5747, 466, 6572, 9578, 3682, 7690,
+    7012, 867, 5607, 9430, 5455, 7641, 9526, 7159, 8221, 3920, 5069, 9836,
+    3483, 9872, 74, 9988, 8365, 8050, 5104, 7903, 1808, 9649, 3755, 3229,
+    9825, 8787, 2666, 8268, 7420, 665, 2538, 9096, 333, 4956, 3993, 3645,
+    4283, 4696, 6573, 4817, 2444, 950, 719, 7198, 1140, 9420, 6837, 6853,
+    5032, 4061, 8805, 5593, 8129, 9290, 7383, 8755, 1410, 3101, 3269, 1310,
+    3940, 4776, 9747, 223, 4682, 6325, 3647, 3911, 6488, 8018, 1270, 958,
+    6110, 9883, 6008, 3703, 2188, 8053, 2653, 6317, 2755, 5189, 3843, 9384,
+    6603, 5664, 7033, 993, 485, 540, 5684, 534, 7828, 6453, 1821, 7214,
+    2457, 6452, 1407, 6981, 3661, 9065, 1792, 9928, 5599, 3813, 2268, 9463,
+    2875, 6392, 1578, 7426, 9958, 4133, 414, 8824, 8231, 9174, 7822, 1066,
+    2925, 5934, 4007, 5713, 3347, 3580, 1843, 8227, 6459, 9822, 5948, 3722,
+    2253, 6368, 7419, 1116, 5685, 1325, 2392, 2792, 9611, 269, 6575, 5942,
+    1892, 2804, 2880, 4930, 2159, 7274, 4019, 1083, 4207, 3141, 7005, 2046,
+    4731, 6804, 4185, 4318, 151, 880, 5053, 7020, 8267, 1855, 9786, 7172,
+    4638, 2335, 5251, 6159, 1252, 8859, 1716, 38, 6629, 4651, 2192, 8310,
+    6884, 5559, 267, 8862, 1650, 2086, 7148, 7282, 2766, 3057, 1991, 1992,
+    2233, 5512, 7829, 8580, 4142, 1806, 6160, 6108, 505, 8019, 1487, 9889,
+    6773, 2032, 6819, 3917, 7755, 2116, 5751, 3936, 902, 4783, 9661, 8488,
+    6602, 4163, 3497, 5741, 4087, 971, 6466, 9797, 5186, 1348, 4200, 2922,
+    1336, 7340, 4478, 9196, 852, 4784, 9971, 3062, 9332, 3673, 1613, 1932,
+    3359, 5322, 9886, 9754, 139, 9309, 1111, 2343, 5027, 8790, 7521, 6521,
+    6191, 9077, 1450, 1451, 8448, 2919, 4433, 3223, 5397, 2529, 8685, 3990,
+    642, 1377, 732, 9129, 8628, 3109, 5901, 7189, 6058, 6258, 5217, 2487,
+    516, 9226, 9258, 206, 830, 1711, 5179, 1754, 3333, 4290, 7579, 5703,
+    6792, 7495, 5647, 6898, 8900, 6167, 5111, 4099, 3746, 1555, 1261, 9364,
+    3447, 5637, 487, 4036, 1773, 751, 5095, 9983, 6211, 274, 4184, 1273,
+    3504, 2211, 7347, 9667, 3264, 767, 3414, 6568, 1090, 7849, 4334, 1744,
+    959, 8454, 8074, 6050, 6639, 7240, 7882, 3096, 6141, 5403, 3085, 5957,
+    2704, 304, 1641, 2568, 9585, 6817, 353, 1614, 3789, 9917, 6526, 4787,
+    3023, 853, 4277, 2647, 3625, 8500, 6391, 1822, 337, 5624, 1703, 3422,
+    2303, 6386, 6751, 8388, 7228, 1004, 712, 4056, 4085, 6557, 7662, 6831,
+    829, 212, 8590, 676, 4190, 6955, 7091, 7576, 2676, 8760, 6684, 8709,
+    9918, 2124, 1174, 7911, 5621, 2736, 8796, 3826, 2200, 2399, 2988, 3873,
+    1134, 4752, 2879, 627, 3662, 4398, 1429, 8277, 4005, 6805, 6248, 1376,
+    5126, 7251, 6770, 3522, 9367, 574, 6361, 3875, 2819, 1943, 2184, 2532,
+    8888, 6484, 6337, 849, 650, 4531, 4235, 5514, 9355, 7117, 7373, 9249,
+    9028, 7795, 1077, 914, 1115, 6014, 6219, 3412, 3272, 659, 998, 9273,
+    7425, 8200, 3193, 1282, 3913, 942, 6342, 2957, 4857, 2021, 3098, 9572,
+    1777, 9276, 3523, 4986, 2372, 3736, 7517, 850, 1583, 5904, 553, 6276,
+    8600, 1388, 2950, 6576, 6615, 257, 9564, 163, 3061, 5911, 9936, 9155,
+    5938, 8722, 9392, 1234, 6740, 7808, 1079, 8501, 9082, 7637, 4984, 3225,
+    5868, 5632, 4958, 1474, 7532, 5242, 1058, 4923, 5947, 8726, 7823, 2214,
+    1803, 9810, 1409, 6313, 8121, 5221, 9748, 6040, 7597, 8744, 7628, 5296,
+    1920, 3311, 3445, 1362, 9522, 6306, 8426, 5009, 3740, 9885, 2905, 8579,
+    7936, 131, 1141, 7386, 7974, 154, 6145, 4621, 9903, 2292, 8566, 2682,
+    3125, 5834, 1900, 649, 232, 3884, 8985, 684, 8027, 134, 7380, 7508,
+    4855, 5538, 6053, 1315, 6912, 8336, 7469, 7300, 5555, 2300, 775, 3568,
+    5167, 7954, 1080, 9455, 1745, 6653, 4230, 6395, 474, 3371, 1471, 731,
+    7477, 9815, 1063, 1249, 7199, 7592, 6187, 2386, 3267, 1732, 7660, 8990,
+    2785, 6961, 6793, 6070, 3713, 5518, 6051, 9901, 351, 2310, 309, 7416,
+    4646, 9076, 9509, 3910, 6681, 1495, 7672, 428, 6883, 9135, 944, 494,
+    5307, 3335, 1548, 933, 9503, 6812, 4241, 2565, 1300, 2719, 5867, 3203,
+    8230, 7987, 3961, 7619, 6146, 8038, 6565, 204, 2172, 4859, 7461, 9169,
+    3237, 4199, 7410, 5565, 9234, 6574, 3593, 7455, 2512, 385, 9521, 926,
+    3816, 3667, 8296, 524, 9517, 3981, 4332, 9146, 4630, 5886, 5173, 1871,
+    272, 439, 3297, 8906, 9892, 7417, 4127, 2683, 9673, 4221, 833, 8306,
+    8384, 8691, 6022, 8171, 9432, 1437, 9100, 9791, 5940, 1035, 568, 3507,
+    7922, 9821, 4264, 1109, 7457, 6945, 7591, 469, 4212, 693, 4967, 7599,
+    7610, 9213, 2060, 7868, 7505, 2786, 6339, 1223, 9058, 3287, 5503, 6443,
+    1743, 9361, 8302, 758, 7771, 21, 2460, 4971, 4046, 6071, 1393, 3073,
+    316, 5982, 5856, 4588, 3087, 8687, 1126, 4329, 1814, 7089, 3324, 9849,
+    1731, 9078, 4218, 9930, 7802, 6109, 3164, 2448, 7152, 2632, 6329, 1177,
+    9689, 976, 1963, 9582, 4708, 8785, 9049, 7874, 6032, 9593, 7722, 4507,
+    6560, 394, 5159, 5320, 9366, 856, 1460, 7206, 4702, 618, 2774, 6478,
+    565, 9884, 7934, 6640, 210, 7313, 4059, 6698, 8331, 2345, 8180, 6170,
+    7298, 4818, 763, 434, 5106, 8419, 6671, 3952, 5139, 174, 4851, 3382,
+    3549, 59, 2707, 8641, 5553, 6513, 4985, 2178, 2612, 9365, 4023, 800,
+    9468, 4982, 1301, 7374, 3790, 6933, 5568, 2975, 3763, 9037, 9635, 5711,
+    635, 4412, 4769, 3395, 9341, 1507, 7541, 1572, 5696, 919, 6733, 7431,
+    857, 5679, 6619, 9974, 4854, 4557, 9926, 3802, 4086, 9412, 9075, 170,
+    5283, 8821, 4251, 655, 2940, 9010, 845, 2863, 8256, 4252, 2848, 5420,
+    7646, 6072, 1765, 6754, 3623, 2312, 5519, 384, 1946, 2009, 1426, 1329,
+    3252, 6506, 5571, 637, 2091, 4006, 1389, 5276, 4321, 1937, 5005, 9492,
+    3388, 5269, 2018, 8758, 4441, 6708, 6129, 9221, 703, 9860, 5436, 9000,
+    9084, 8153, 3122, 7114, 2674, 8078, 2240, 558, 6364, 7593, 3152, 3378,
+    7213, 202, 2218, 293, 7986, 1145, 8294, 1491, 3772, 5288, 4586, 5774,
+    1543, 2601, 4684, 5922, 3409, 6873, 9005, 6224, 2525, 875, 1352, 66,
+    4459, 5971, 2685, 5714, 2768, 4424, 7045, 5755, 9857, 2000, 9536, 3097,
+    5762, 7537, 6433, 2826, 6518, 3787, 8747, 366, 8925, 8936, 9117, 7286,
+    9132, 6895, 5837, 1243, 4203, 1599, 3530, 2973, 742, 1147, 5944, 7447,
+    288, 99, 7295, 4223, 2245, 6931, 9916, 5399, 8208, 2724, 802, 3598,
+    4299, 7329, 3931, 7321, 6101, 5572, 1612, 198, 6127, 9072, 6067, 1706,
+    225, 9768, 8690, 3702, 6950, 9473, 5852, 26, 6630, 9619, 2542, 6985,
+    5373, 5114, 8795, 3108, 4801, 5146, 9960, 6242, 499, 7969, 2103, 1060,
+    7949, 4536, 7500, 3871, 8612, 7876, 8550, 9322, 9881, 5770, 9051, 8120,
+    7483, 9449, 6033, 9119, 2558, 1637, 5163, 1969, 8178, 5056, 4952, 5130,
+    6238, 2832, 3411, 5289, 6137, 2015, 1990, 1727, 9735, 1689, 8330, 9054,
+    33, 9057, 1071, 8428, 7375, 1432, 8228, 3321, 2924, 6189, 1635, 2688,
+    587, 9487, 7642, 3404, 906, 2206, 4658, 3791, 9868, 56, 2728, 3019,
+    6143, 3048, 1107, 8745, 2101, 2540, 5260, 8887, 2291, 7475, 8904, 7589,
+    9993, 5200, 7687, 1633, 457, 4350, 4795, 6444, 2474, 7794, 7216, 7980,
+    1964, 5121, 7493, 1895, 8560, 5124, 1195, 805, 8884, 1529, 6713, 8241,
+    9512, 3370, 808, 2873, 2783, 3144, 501, 1262, 1326, 3345, 1905, 2136,
+    6285, 4937, 9514, 7339, 1416, 1752, 5589, 6558, 6226, 9855, 481, 356,
+    5172, 2216, 2784, 7982, 3054, 8864, 9439, 3433, 5532, 3344, 2407, 2254,
+    227, 9338, 5282, 3776, 2933, 2797, 6674, 2064, 2119, 8341, 7570, 1247,
+    686, 3348, 2138, 6165, 5293, 1120, 9246, 5196, 5701, 3316, 5846, 3759,
+    4380, 1833, 9551, 5222, 2283, 2475, 5319, 1167, 7107, 7421, 4107, 8819,
+    2689, 596, 409, 1121, 1191, 3716, 3337, 4141, 3632, 9929, 2844, 5662,
+    9218, 6064, 9742, 5709, 5702, 6003, 9992, 2770, 1758, 6471, 3149, 7855,
+    5670, 6284, 8360, 1173, 5782, 7587, 6915, 2043, 514, 6750, 1845, 3440,
+    8439, 6989, 4794, 2095, 653, 2626, 6036, 1182, 8995, 4132, 354, 4821,
+    2237, 1358, 5077, 7263, 3506, 2382, 1966, 8508, 2252, 6144, 3669, 8429,
+    450, 6200, 4726, 1500, 2089, 9650, 3610, 9288, 7333, 7643, 7241, 1313,
+    8715, 6288, 8147, 1350, 2511, 266, 3862, 6347, 5616, 4340, 8154, 2062,
+    1148, 8878, 2278, 3288, 6002, 4758, 2684, 7164, 1163, 7627, 5953, 7088,
+    4312, 4313, 6894, 1092, 4176, 7326, 7831, 5019, 3679, 6017, 8387, 7142,
+    5297, 5564, 5473, 7897, 386, 5712, 3373, 6435, 8866, 8101, 7180, 8196,
+    2329, 7707, 3643, 6063, 7571, 8075, 6436, 7407, 909, 2733, 3627, 2861,
+    1317, 3811, 509, 7109, 3176, 6178, 270, 6501, 9409, 5967, 9047, 8725,
+    3803, 5117, 4466, 3629, 5998, 2700, 8603, 295, 6871, 7275, 7289, 1000,
+    123, 9312, 6073, 8273, 7158, 5387, 6806, 5072, 9031, 8996, 6896, 8871,
+    3516, 4010, 6240, 8152, 200, 8571, 1987, 6885, 4034, 3856, 4245, 4488,
+    6028, 7062, 3360, 5943, 243, 1973, 2446, 9405, 7176, 3248, 2623, 5346,
+    2657, 788, 9349, 4954, 986, 5453, 3474, 4057, 9265, 7399, 6164, 6111,
+    5613, 1762, 4077, 6336, 2643, 9757, 6586, 5471, 3257, 105, 1512, 5753,
+    2473, 7428, 4164, 8969, 2466, 3693, 4779, 1346, 8869, 7650, 6104, 557,
+    5878, 2286, 8351, 8626, 4994, 7917, 5225, 2003, 438, 1945, 1748, 9326,
+    8362, 1707, 6811, 3851, 5686, 2011, 8438, 7479, 7962, 3712, 634, 4697,
+    2263, 6668, 4575, 7968, 4337, 9547, 7774, 8240, 5823, 7699, 3428, 9607,
+    4973, 9429, 9486, 245, 1469, 1276, 2727, 3065, 7302, 7365, 6775, 4261,
+    4717, 9475, 9408, 8576, 6897, 273, 9022, 2431, 8645, 237, 8835, 2938,
+    4138, 5660, 3437, 3561, 9027, 4092, 8908, 2839, 7668, 8298, 6076, 3356,
+    5487, 6440, 4907, 3090, 6383, 6826, 3511, 8316, 6537, 2250, 2624, 4461,
+    6136, 2016, 75, 8649, 3146, 4062, 2675, 7633, 7345, 6091, 6202, 7287,
+    3022, 2638, 2663, 1019, 1131, 9208, 2816, 5205, 9824, 4753, 9130, 2795,
+    7907, 7877, 7364, 6318, 8188, 6843, 8710, 1395, 6756, 4561, 1267, 9229,
+    9183, 4181, 2380, 5348, 8039, 3429, 8981, 4524, 5748, 1609, 7014, 5859,
+    5853, 2803, 6592, 9158, 3013, 7035, 714, 7622, 319, 7454, 8948, 7961,
+    8525, 6000, 9725, 4243, 338, 3082, 4949, 7871, 9417, 9069, 4434, 2843,
+    9758, 9334, 7800, 8104, 6900, 9472, 4977, 7478, 1967, 1021, 1123, 4431,
+    7154, 4175, 8346, 710, 2729, 658, 3047, 5937, 9295, 9875, 5533, 127,
+    2112, 5109, 7296, 6606, 761, 4554, 888, 1311, 846, 5084, 9802, 1205,
+    4237, 282, 5080, 7602, 8572, 6432, 1885, 1695, 1154, 2585, 276, 5425,
+    4542, 3163, 3261, 7085, 1463, 5223, 3212, 4867, 3752, 960, 1244, 9277,
+    76, 1941, 970, 4882, 1448, 9545, 1538, 2330, 3138, 5864, 5650, 3491,
+    9631, 4564, 3245, 6390, 5129, 2208, 4067, 6231, 5765, 1819, 3298, 13,
+    828, 3815, 6208, 9644, 5873, 795, 8460, 5603, 9922, 743, 1960, 2824,
+    9837, 9865, 2057, 1796, 6990, 2936, 7439, 5595, 1870, 583, 1341, 3805,
+    9059, 3381, 3546, 124, 6979, 985, 3315, 987, 7270, 6020, 5597, 2706,
+    7013, 488, 6068, 2236
+};
+
+const struct ArgpxStaticIndex bm_static_flags_index = {
+    .seed = 0u,
+    .bucket_c = 2501,
+    .disp_v = bm_static_flags_index_disp_v_,
+    .flag_c = 10000,
+    .slot_v = bm_static_flags_index_slot_v_,
+};
@@ -0,0 +1,207 @@
+/*
+    ArgpxSuggest() against a linear scan of the edit distance to every flag, the way a "did you mean" is usually
+    done. The flags are 100, 1k and 10k names of 2 or 3 words like "--cache-size-limit", the queries are names of
+    them with 1 or 2 typos.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <iso646.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "argpx/argpx.h"
+
+#define BM_QUERY_COUNT 1000
+// the best of the rounds, the machine is noisy
+#define BM_ROUND 5
+#define BM_NAME_SIZE 48
+
+static double NowNs_(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static const char *bm_word_v[] = {"cache", "size", "limit", "log", "level", "output", "input", "file", "dir", "max",
+    "min", "thread", "count", "no", "color", "verbose", "dry", "run", "config", "path", "user", "name", "time", "out",
+    "retry", "delay", "format", "json", "print", "stat", "debug", "trace", "host", "port", "key", "mode"};
+
+/*
+    The full table of the edit distance, no early exit.
+ */
+static int Distance_(const char *a, size_t a_len, const char *b, size_t b_len, int *row_v)
+{
+    for (size_t j = 0; j <= b_len; j++)
+        row_v[j] = (int)j;
+    for (size_t i = 1; i <= a_len; i++) {
+        int diag = row_v[0];
+        row_v[0] = (int)i;
+        for (size_t j = 1; j <= b_len; j++) {
+            int replace = diag + (a[i - 1] != b[j - 1]);
+            int remove = row_v[j] + 1;
+            int insert = row_v[j - 1] + 1;
+            diag = row_v[j];
+            int best = replace < remove ? replace : remove;
+            row_v[j] = best < insert ? best : insert;
+        }
+    }
+    return row_v[b_len];
+}
+
+/*
+    The nearest 3 within max_distance, the same order as ArgpxSuggest().
+ */
+static int Linear_(struct ArgpxFlagSet *flag, const char *name, int max_distance, struct ArgpxSuggestion *out_v)
+{
+    int row_v[BM_NAME_SIZE + 1];
+    size_t name_len = strlen(name);
+    int found_c = 0;
+    for (int i = 0; i < flag->count; i++) {
+        int dist = Distance_(name, name_len, flag->ptr[i].name, strlen(flag->ptr[i].name), row_v);
+        if (dist > max_distance)
+            continue;
+        int pos = found_c;
+        while (pos > 0 and out_v[pos - 1].distance > dist)
+            pos -= 1;
+        if (pos >= ARGPX_SUGGEST_MAX)
+            continue;
+        int last = found_c < ARGPX_SUGGEST_MAX ? found_c : ARGPX_SUGGEST_MAX - 1;
+        memmove(&out_v[pos + 1], &out_v[pos], sizeof(struct ArgpxSuggestion) * (last - pos));
+        out_v[pos] = (struct ArgpxSuggestion){.conf = &flag->ptr[i], .distance = dist};
+        found_c += found_c < ARGPX_SUGGEST_MAX;
+    }
+    return found_c;
+}
+
+// the results go here, so nothing is optimized out
+static volatile int bm_sink;
+
+static void Run_(int flag_c, char (*name_v)[BM_NAME_SIZE], char (*query_v)[BM_NAME_SIZE])
+{
+    struct ArgpxStyle style = ARGPX_STYLE_INIT;
+    ArgpxGroupAppend(&style, ARGPX_GROUP_GNU);
+    struct ArgpxFlagSet flag = ARGPX_FLAGSET_INIT;
+    for (int i = 0; i < flag_c; i++) {
+        ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+            .group_idx = 0,
+            .name = name_v[i],
+            .action_type = kArgpxActionSetBool,
+        });
+    }
+
+    struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    opt.use_suggest = true;
+    struct ArgpxParser *parser;
+    double start = NowNs_();
+    if (ArgpxCompile(&parser, &style, &flag, &opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX compile error\n");
+        exit(EXIT_FAILURE);
+    }
+    double compile_ns = NowNs_() - start;
+
+    double linear_ns = 0;
+    double tree_ns = 0;
+    int found_c = 0;
+    for (int r = 0; r < BM_ROUND; r++) {
+        struct ArgpxSuggestion linear_v[ARGPX_SUGGEST_MAX];
+        struct ArgpxSuggestion tree_v[ARGPX_SUGGEST_MAX];
+
+        start = NowNs_();
+        for (int i = 0; i < BM_QUERY_COUNT; i++) {
+            bm_sink = Linear_(&flag, query_v[i], 4, linear_v);
+        }
+        double ns = (NowNs_() - start) / BM_QUERY_COUNT;
+        if (r == 0 or ns < linear_ns)
+            linear_ns = ns;
+
+        start = NowNs_();
+        found_c = 0;
+        for (int i = 0; i < BM_QUERY_COUNT; i++) {
+            int count = ArgpxSuggest(parser, 0, query_v[i], strlen(query_v[i]), 4, tree_v, ARGPX_SUGGEST_MAX);
+            found_c += count > 0;
+        }
+        ns = (NowNs_() - start) / BM_QUERY_COUNT;
+        if (r == 0 or ns < tree_ns)
+            tree_ns = ns;
+    }
+
+    // the same answer, or it's not worth timing
+    for (int i = 0; i < BM_QUERY_COUNT; i++) {
+        struct ArgpxSuggestion linear_v[ARGPX_SUGGEST_MAX];
+        struct ArgpxSuggestion tree_v[ARGPX_SUGGEST_MAX];
+        int linear_c = Linear_(&flag, query_v[i], 4, linear_v);
+        int tree_c = ArgpxSuggest(parser, 0, query_v[i], strlen(query_v[i]), 4, tree_v, ARGPX_SUGGEST_MAX);
+        bool same = linear_c == tree_c;
+        for (int j = 0; same == true and j < tree_c; j++)
+            same = linear_v[j].conf == tree_v[j].conf and linear_v[j].distance == tree_v[j].distance;
+        if (same == false) {
+            printf("wrong result of \"%s\"\n", query_v[i]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    printf("%6d flags: compile %8.1f us, linear %9.2f us/query, bk-tree %7.2f us/query, x%.1f, %d%% found\n", flag_c,
+        compile_ns / 1000, linear_ns / 1000, tree_ns / 1000, linear_ns / tree_ns, found_c * 100 / BM_QUERY_COUNT);
+
+    ArgpxParserFree(parser);
+    ArgpxStyleFree(&style);
+    ArgpxFlagFree(&flag);
+}
+
+int main(void)
+{
+    int word_c = sizeof(bm_word_v) / sizeof(bm_word_v[0]);
+    int flag_max = 10000;
+    char(*name_v)[BM_NAME_SIZE] = malloc(BM_NAME_SIZE * flag_max);
+    char(*query_v)[BM_NAME_SIZE] = malloc(BM_NAME_SIZE * BM_QUERY_COUNT);
+
+    // every pair of words first, then the triples, all different
+    int name_c = 0;
+    for (int i = 0; i < word_c and name_c < flag_max; i++) {
+        for (int j = 0; j < word_c and name_c < flag_max; j++) {
+            if (i != j)
+                snprintf(name_v[name_c++], BM_NAME_SIZE, "%s-%s", bm_word_v[i], bm_word_v[j]);
+        }
+    }
+    for (int n = 0; name_c < flag_max; n++) {
+        snprintf(name_v[name_c++], BM_NAME_SIZE, "%s-%s-%s", bm_word_v[n % word_c], bm_word_v[n / word_c % word_c],
+            bm_word_v[n / word_c / word_c % word_c]);
+    }
+    // shuffle them, a set of 100 has both kinds
+    srand(1);
+    for (int i = flag_max - 1; i > 0; i--) {
+        char tmp[BM_NAME_SIZE];
+        int j = rand() % (i + 1);
+        memcpy(tmp, name_v[i], BM_NAME_SIZE);
+        memcpy(name_v[i], name_v[j], BM_NAME_SIZE);
+        memcpy(name_v[j], tmp, BM_NAME_SIZE);
+    }
+
+    int flag_c_v[] = {100, 1000, 10000};
+    for (int s = 0; s < 3; s++) {
+        int flag_c = flag_c_v[s];
+        // a replaced letter, or a dropped one
+        for (int i = 0; i < BM_QUERY_COUNT; i++) {
+            char *query = query_v[i];
+            memcpy(query, name_v[rand() % flag_c], BM_NAME_SIZE);
+            int typo_c = 1 + rand() % 2;
+            for (int t = 0; t < typo_c; t++) {
+                size_t len = strlen(query);
+                size_t pos = (size_t)rand() % len;
+                if (rand() % 2 == 0)
+                    query[pos] = 'a' + rand() % 26;
+                else
+                    memmove(query + pos, query + pos + 1, len - pos);
+            }
+        }
+        Run_(flag_c, name_v, query_v);
+    }
+
+    free(name_v);
+    free(query_v);
+    return 0;
+}
@@ -1,10 +1,15 @@
 #include <iso646.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
 #include "argpx/argpx.h"
 
+extern char **environ;
+
 static void Error_(struct ArgpxResult *res)
 {
     if (res == NULL) {
@@ -14,6 +19,8 @@ static void Error_(struct ArgpxResult *res)
 
     printf("ArgParseX error [%d]: %s\n", res->status, ArgpxStatusString(res->status));
     printf("index: %d, str: %s\n", res->current_argv_idx, res->current_argv_ptr);
+    for (int i = 0; i < res->suggest_c; i++)
+        printf("did you mean: %s(%d)\n", res->suggest_v[i].conf->name, res->suggest_v[i].distance);
     exit(EXIT_FAILURE);
 }
 
@@ -25,20 +32,130 @@ static char *BoolToString_(bool input)
         return "false";
 }
 
+static bool test_use_arena = false;
+
+// generated from test.flags
+extern const struct ArgpxStaticIndex test_flags_index;
+
+// the output record of the .bind_offset flags
+struct TestRecord_ {
+    int level;
+    bool quiet;
+    struct ArgpxOutParamList tag;
+};
+
+// what the callbacks have seen, in the order they're called
+static uint64_t test_trace = 0;
+
+/*
+    FNV-1a of the bytes, NULL is different from an empty one.
+ */
+static uint64_t TestHash_(uint64_t hash, const void *ptr, size_t len)
+{
+    if (ptr == NULL)
+        return (hash ^ 0xff) * 0x100000001b3u;
+    for (size_t i = 0; i < len; i++)
+        hash = (hash ^ ((const unsigned char *)ptr)[i]) * 0x100000001b3u;
+    return (hash ^ len) * 0x100000001b3u;
+}
+
+static void Trace_(const char *tag, const char *str, size_t len)
+{
+    test_trace = TestHash_(test_trace, tag, strlen(tag));
+    test_trace = TestHash_(test_trace, str, len);
+}
+
+/*
+    A counting allocator. Every block carries a magic number, so a block of malloc() freed here or a block of here
+    passed to free() will abort, and the live count must be 0 at the end.
+ */
+#define TEST_ALLOC_MAGIC 0xa11c0a7eu
+
+struct TestAllocHead_ {
+    unsigned int magic;
+    // keep the user part aligned
+    long double align;
+};
+
+static long test_alloc_live = 0;
+static long test_alloc_total = 0;
+
+static void *TestAlloc_(void *ctx, size_t size)
+{
+    struct TestAllocHead_ *head = malloc(sizeof(struct TestAllocHead_) + size);
+    if (head == NULL)
+        return NULL;
+    head->magic = TEST_ALLOC_MAGIC;
+    test_alloc_live += 1;
+    test_alloc_total += 1;
+    return head + 1;
+}
+
+static struct TestAllocHead_ *TestAllocHead_(void *ptr)
+{
+    struct TestAllocHead_ *head = (struct TestAllocHead_ *)ptr - 1;
+    if (head->magic != TEST_ALLOC_MAGIC) {
+        printf("test allocator: foreign block %p\n", ptr);
+        abort();
+    }
+    return head;
+}
+
+static void *TestRealloc_(void *ctx, void *ptr, size_t old_size, size_t new_size)
+{
+    struct TestAllocHead_ *head = realloc(TestAllocHead_(ptr), sizeof(struct TestAllocHead_) + new_size);
+    if (head == NULL)
+        return NULL;
+    return head + 1;
+}
+
+static void TestFree_(void *ctx, void *ptr)
+{
+    struct TestAllocHead_ *head = TestAllocHead_(ptr);
+    head->magic = 0;
+    free(head);
+    test_alloc_live -= 1;
+}
+
+static const struct ArgpxAllocator test_allocator = {
+    .alloc_fn = TestAlloc_,
+    .realloc_fn = TestRealloc_,
+    .free_fn = TestFree_,
+    .ctx = NULL,
+};
+
+// free a string given by the library, like ArgpxOutXxxFree() does
+static void FreeOutString_(const struct ArgpxAllocator *allocator, char *str)
+{
+    if (test_use_arena == true or str == NULL)
+        return;
+    if (allocator == NULL)
+        free(str);
+    else
+        allocator->free_fn(allocator->ctx, str);
+}
+
 static void CbWin1_(void *action_load, void *param_in)
 {
     struct ArgpxOutParamSingle *out = action_load;
     printf("callback /win1: %s\n", *(char **)out->var_ptr);
+    Trace_("/win1", *(char **)out->var_ptr, strlen(*(char **)out->var_ptr));
+    FreeOutString_(out->allocator, *(char **)out->var_ptr);
 
-    ArgpxOutParamSingleFree(out);
+    // arena memory is released with the arena
+    if (test_use_arena == false)
+        ArgpxOutParamSingleFree(out);
 }
 
 static void CbWin2_(void *action_load, void *param_in)
 {
     struct ArgpxOutParamSingle *out = action_load;
     printf("callback /win2: %s\n", *(char **)out->var_ptr);
+    Trace_("/win2", *(char **)out->var_ptr, strlen(*(char **)out->var_ptr));
+    FreeOutString_(out->allocator, *(char **)out->var_ptr);
 
-    ArgpxOutParamSingleFree(out);
+    if (test_use_arena == false)
+        ArgpxOutParamSingleFree(out);
 }
 
 static void CbParamList_(void *action_load, void *param_in)
@@ -47,19 +164,121 @@ static void CbParamList_(void *action_load, void *param_in)
 
     for (int i = 0; i < out->out_count; i++) {
         printf("callback --paramlist: idx: %d, str: %s\n", i, out->out_list[i]);
+        Trace_("--paramlist", out->out_list[i], strlen(out->out_list[i]));
     }
 
-    ArgpxOutParamListFree(out);
+    if (test_use_arena == false)
+        ArgpxOutParamListFree(out);
+}
+
+static void CbParamListView_(void *action_load, void *param_in)
+{
+    struct ArgpxOutParamListView *out = action_load;
+
+    for (int i = 0; i < out->out_count; i++) {
+        printf("callback --listview: idx: %d, str: %.*s\n", i, (int)out->out_list[i].len, out->out_list[i].ptr);
+        Trace_("--listview", out->out_list[i].ptr, out->out_list[i].len);
+    }
+
+    if (test_use_arena == false)
+        ArgpxOutParamListViewFree(out);
 }
 
 static void CbSameNameGnu_(void *load, void *param)
 {
     puts("callback --samename");
+    Trace_("--samename", "", 0);
 }
 
 static void CbSameName1_(void *load, void *param)
 {
     puts("callback ++samename");
+    Trace_("++samename", "", 0);
+}
+
+static void PrintParam_(void *ctx, char *param)
+{
+    printf("%s\n", param);
+}
+
+/*
+    The outputs of a parse, so the one of ArgpxParseParallel() can be compared with the serial one.
+ */
+struct TestOutput_ {
+    const struct ArgpxAllocator *allocator;
+    char **str31;
+    bool *bool1;
+    bool *bool2;
+    int *int1;
+    int *param_int;
+    struct ArgpxStringView *view;
+    struct ArgpxOutParamLazy *lazy;
+    struct ArgpxOutParamLazy *lazy_str;
+    bool *xy;
+    bool *x;
+    bool *list;
+    bool *list_all;
+    int *level;
+    double *ratio;
+    struct TestRecord_ *record;
+};
+
+static uint64_t TestOutputHash_(const struct ArgpxResult *res, const struct TestOutput_ *out)
+{
+    uint64_t hash = test_trace;
+    hash = TestHash_(hash, &res->status, sizeof(res->status));
+    hash = TestHash_(hash, &res->current_argv_idx, sizeof(res->current_argv_idx));
+    if (res->status != kArgpxStatusSuccess and res->current_argv_ptr != NULL)
+        hash = TestHash_(hash, res->current_argv_ptr, strlen(res->current_argv_ptr));
+    hash = TestHash_(hash, &res->param_c, sizeof(res->param_c));
+    for (int i = 0; i < res->param_c; i++)
+        hash = TestHash_(hash, res->param_v[i], strlen(res->param_v[i]));
+
+    hash = TestHash_(hash, *out->str31, *out->str31 != NULL ? strlen(*out->str31) : 0);
+    hash = TestHash_(hash, out->bool1, sizeof(bool));
+    hash = TestHash_(hash, out->bool2, sizeof(bool));
+    hash = TestHash_(hash, out->int1, sizeof(int));
+    hash = TestHash_(hash, out->param_int, sizeof(int));
+    hash = TestHash_(hash, out->view->ptr, out->view->len);
+    hash = TestHash_(hash, out->lazy->raw.ptr, out->lazy->raw.len);
+    hash = TestHash_(hash, out->lazy_str->raw.ptr, out->lazy_str->raw.len);
+    hash = TestHash_(hash, out->xy, sizeof(bool));
+    hash = TestHash_(hash, out->x, sizeof(bool));
+    hash = TestHash_(hash, out->list, sizeof(bool));
+    hash = TestHash_(hash, out->list_all, sizeof(bool));
+    hash = TestHash_(hash, out->level, sizeof(int));
+    hash = TestHash_(hash, out->ratio, sizeof(double));
+    hash = TestHash_(hash, &out->record->level, sizeof(int));
+    hash = TestHash_(hash, &out->record->quiet, sizeof(bool));
+    for (int i = 0; i < out->record->tag.out_count; i++)
+        hash = TestHash_(hash, out->record->tag.out_list[i], strlen(out->record->tag.out_list[i]));
+    return hash;
+}
+
+/*
+    Back to the start of main(), for another parse.
+ */
+static void TestOutputReset_(const struct TestOutput_ *out)
+{
+    FreeOutString_(out->allocator, *out->str31);
+    *out->str31 = NULL;
+    *out->bool1 = false;
+    *out->bool2 = false;
+    *out->int1 = 0;
+    *out->param_int = 0;
+    *out->view = (struct ArgpxStringView){.ptr = "", .len = 0};
+    out->lazy->raw.ptr = NULL;
+    out->lazy_str->raw.ptr = NULL;
+    *out->xy = false;
+    *out->x = false;
+    *out->list = false;
+    *out->list_all = false;
+    *out->level = 0;
+    *out->ratio = 0;
+    if (test_use_arena == false)
+        ArgpxOutParamListFree(&out->record->tag);
+    *out->record = (struct TestRecord_){.level = 0, .quiet = false, .tag = {.out_count = 0, .out_list = NULL}};
+    test_trace = 0;
 }
 
 int main(int argc, char *argv[])
@@ -73,10 +292,26 @@ int main(int argc, char *argv[])
     bool test_bool2 = false;
 
     int test_int = 0;
+    struct ArgpxStringView test_view = {.ptr = "", .len = 0};
+    int test_param_int = 0;
+    int test_lazy_int = 0;
+    char *test_lazy_str = NULL;
+    bool test_xy = false;
+    bool test_x = false;
+    bool test_list = false;
+    bool test_list_all = false;
+    int test_level = 0;
+    double test_ratio = 0;
+    struct TestRecord_ record = {.level = 0, .quiet = false, .tag = {.out_count = 0, .out_list = NULL}};
 
     // clang-format off
 
+    // let the end-to-end test prove that no memory bypasses the allocator
+    bool use_allocator = getenv("ARGPX_TEST_USE_ALLOCATOR") != NULL;
+    const struct ArgpxAllocator *allocator = use_allocator == true ? &test_allocator : NULL;
+
     struct ArgpxStyle style = ARGPX_STYLE_INIT;
+    style.allocator = allocator;
     ArgpxGroupAppend(&style, ARGPX_GROUP_GNU);
     // https://stackoverflow.com/a/11152199/25416550
     // other element will be initialized implicitly
@@ -92,11 +327,26 @@ int main(int argc, char *argv[])
         .delimiter = ",",
         .attribute = ARGPX_ATTR_COMPOSABLE | ARGPX_ATTR_COMPOSABLE_NEED_PREFIX,
     });
+    // @file, the tokens of the file are parsed in place of it
+    ArgpxGroupAppend(&style, &(struct ArgpxGroup){
+        .prefix = "@",
+        .attribute = ARGPX_ATTR_RESPONSE_FILE,
+    });
+    // a unique start of a name works like getopt_long(), "+lev" is "+level"
+    ArgpxGroupAppend(&style, &(struct ArgpxGroup){
+        .prefix = "+",
+        .assigner = "=",
+        .delimiter = ",",
+        .attribute = ARGPX_ATTR_ABBREVIATION,
+    });
 
     ArgpxSymbolAppend(&style, ARGPX_SYMBOL_STOP_PARSING("--"));
     ArgpxSymbolAppend(&style, ARGPX_SYMBOL_STOP_PARSING("-"));
+    // the rest, and the environment, are never parsed
+    ArgpxSymbolAppend(&style, &(struct ArgpxSymbol){.str = "::", .type = kArgpxSymbolTerminateProcessing});
 
     struct ArgpxFlagSet flag = ARGPX_FLAGSET_INIT;
+    flag.allocator = allocator;
     // ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
     //     .group_idx = 0,
     //     .name = "test",
@@ -111,6 +361,7 @@ int main(int argc, char *argv[])
     ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
         .group_idx = 0,
         .name = "setbool",
+        .env_name = "ARGPX_TEST_SETBOOL",
         .action_type = kArgpxActionSetBool,
         .action_load.set_bool = {.source = true, .target_ptr = &test_bool},
     });
@@ -131,13 +382,33 @@ int main(int argc, char *argv[])
     //             {.type = kArgpxVarString, .var_ptr = &test_str22},
     //         },
     // });
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "view",
+        .action_type = kArgpxActionParamSingle,
+        .action_load.param_single = {.type = kArgpxVarStringView, .var_ptr = &test_view},
+    });
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "int",
+        .env_name = "ARGPX_TEST_INT",
+        .action_type = kArgpxActionParamSingle,
+        .action_load.param_single = {.type = kArgpxVarInt, .var_ptr = &test_param_int},
+    });
     ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
         .group_idx = 0,
         .name = "paramlist",
+        .env_name = "ARGPX_TEST_PARAMLIST",
         .action_type = kArgpxActionParamList,
         .action_load.param_list = {.max = 3},
         .callback = CbParamList_,
     });
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "listview",
+        .action_type = kArgpxActionParamListView,
+        .callback = CbParamListView_,
+    });
     ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
         .group_idx = 3,
         .name = "win1",
@@ -164,6 +435,27 @@ int main(int argc, char *argv[])
         .action_type = kArgpxActionParamSingle,
         .action_load.param_single = {.type = kArgpxVarString, .var_ptr = &test_str31},
     });
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "bind-level",
+        .action_type = kArgpxActionParamSingle,
+        .action_load.param_single = {.type = kArgpxVarInt},
+        ARGPX_BIND_OFFSET(struct TestRecord_, level),
+    });
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "bind-quiet",
+        .action_type = kArgpxActionSetBool,
+        .action_load.set_bool = {.source = true},
+        ARGPX_BIND_OFFSET(struct TestRecord_, quiet),
+    });
+    int bind_tag_idx = ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "bind-tag",
+        .action_type = kArgpxActionParamList,
+        .action_load.param_list = {.max = 4},
+        ARGPX_BIND_OFFSET(struct TestRecord_, tag),
+    });
     // --samename
     ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
         .group_idx = 0,
@@ -178,12 +470,209 @@ int main(int argc, char *argv[])
         .action_type = kArgpxActionCallbackOnly,
         .callback = CbSameName1_,
     });
+    // converted after the parse, and only the last one
+    int lazy_idx = ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "lazy",
+        .action_type = kArgpxActionParamLazy,
+        .action_load.param_lazy = {.type = kArgpxVarInt, .var_ptr = &test_lazy_int},
+    });
+    int lazy_str_idx = ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 0,
+        .name = "lazy-str",
+        .action_type = kArgpxActionParamLazy,
+        .action_load.param_lazy = {.type = kArgpxVarString, .var_ptr = &test_lazy_str},
+    });
+    // "/xy" is "xy" and not "x" + "y", the first appended name wins in a composable group
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 3,
+        .name = "xy",
+        .action_type = kArgpxActionSetBool,
+        .action_load.set_bool = {.source = true, .target_ptr = &test_xy},
+    });
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 3,
+        .name = "x",
+        .action_type = kArgpxActionSetBool,
+        .action_load.set_bool = {.source = true, .target_ptr = &test_x},
+    });
+    // "+list" is a whole name, so it's not ambiguous with "+list-all"
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 5,
+        .name = "list",
+        .action_type = kArgpxActionSetBool,
+        .action_load.set_bool = {.source = true, .target_ptr = &test_list},
+    });
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 5,
+        .name = "list-all",
+        .action_type = kArgpxActionSetBool,
+        .action_load.set_bool = {.source = true, .target_ptr = &test_list_all},
+    });
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 5,
+        .name = "level",
+        .action_type = kArgpxActionParamSingle,
+        .action_load.param_single = {.type = kArgpxVarInt, .var_ptr = &test_level},
+    });
+    // the parameter is a span of "/ratio=.../x", a long one can't be copied to the stack
+    ArgpxFlagAppend(&flag, &(struct ArgpxFlag){
+        .group_idx = 3,
+        .name = "ratio",
+        .action_type = kArgpxActionParamSingle,
+        .action_load.param_single = {.type = kArgpxVarDouble, .var_ptr = &test_ratio},
+    });
 
     struct ArgpxParseOption opt = ARGPX_PARSE_OPTION_INIT;
+    // let the end-to-end test cover the hash mode too
+    opt.use_hash = getenv("ARGPX_TEST_USE_HASH") != NULL;
+    opt.allocator = allocator;
+    opt.out_base = &record;
+    opt.use_suggest = true;
+    if (getenv("ARGPX_TEST_USE_STATIC") != NULL)
+        opt.static_index = &test_flags_index;
+    // and the caller supplied arena, start with a tiny buffer to get it grown
+    char arena_buf[64];
+    struct ArgpxArena arena;
+    test_use_arena = getenv("ARGPX_TEST_USE_ARENA") != NULL;
+    if (test_use_arena == true) {
+        ArgpxArenaInit(&arena, arena_buf, sizeof(arena_buf), true);
+        arena.allocator = allocator;
+        opt.arena = &arena;
+    }
+
+    struct ArgpxParser *parser;
+    if (ArgpxCompile(&parser, &style, &flag, &opt) != kArgpxStatusSuccess) {
+        printf("ArgParseX compile failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // the static index of another order is refused, instead of missing the flags
+    if (opt.static_index != NULL) {
+        struct ArgpxFlag swap = flag.ptr[0];
+        flag.ptr[0] = flag.ptr[1];
+        flag.ptr[1] = swap;
+        struct ArgpxParser *wrong_parser;
+        int wrong_status = ArgpxCompile(&wrong_parser, &style, &flag, &opt);
+        flag.ptr[1] = flag.ptr[0];
+        flag.ptr[0] = swap;
+        if (wrong_status != kArgpxStatusConfigInvalid) {
+            printf("ArgParseX compiled a wrong static index\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // so is an empty name
+    char *first_name = flag.ptr[0].name;
+    flag.ptr[0].name = "";
+    struct ArgpxParser *empty_parser;
+    int empty_status = ArgpxCompile(&empty_parser, &style, &flag, &opt);
+    flag.ptr[0].name = first_name;
+    if (empty_status != kArgpxStatusConfigInvalid) {
+        printf("ArgParseX compiled an empty flag name\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // and an environment variable of a flag out of the groups
+    flag.ptr[0].group_idx = style.group_c;
+    struct ArgpxParser *env_parser;
+    int env_status = ArgpxCompile(&env_parser, &style, &flag, &opt);
+    flag.ptr[0].group_idx = 0;
+    if (env_status != kArgpxStatusConfigInvalid) {
+        printf("ArgParseX compiled an environment variable out of the groups\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // or share the argv with a pool, it takes no stats
+    struct ArgpxPool *pool = NULL;
+    if (getenv("ARGPX_TEST_USE_PARALLEL") != NULL and ArgpxPoolCreate(&pool, 2, allocator) != kArgpxStatusSuccess) {
+        printf("ArgParseX pool failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    struct ArgpxParseStats stats;
+    opt.stats = pool == NULL ? &stats : NULL;
+    long alloc_before = test_alloc_total;
+
+    // or read the arguments from stdin, the tiny buffer gets them wrapped around
+    bool use_fd = getenv("ARGPX_TEST_USE_FD") != NULL;
+    char fd_buf[32];
+    struct ArgpxFdSource fd_source = {
+        .fd = STDIN_FILENO,
+        .buf = fd_buf,
+        .size = sizeof(fd_buf),
+        .param_fn = PrintParam_,
+    };
+
+    // or split a command line string, it's modified in place so parse a copy
+    const char *line_env = getenv("ARGPX_TEST_LINE");
+    char line_buf[1024];
+
     struct ArgpxResult res;
-    // skip the first arg, that's the exec command name
-    if (ArgpxParse(&res, argc - 1, argv + 1, &style, &flag, &opt) != kArgpxStatusSuccess) {
+    int status;
+    if (use_fd == true) {
+        printf("==== command parameters(streamed) ====\n");
+        status = ArgpxParseFd(&res, &fd_source, parser, &opt);
+    } else if (line_env != NULL) {
+        snprintf(line_buf, sizeof(line_buf), "%s", line_env);
+        status = ArgpxParseCommandLine(&res, line_buf, parser, &opt);
+    } else if (pool != NULL) {
+        status = ArgpxParseParallel(pool, &res, argc - 1, argv + 1, parser, &opt);
+    } else if (getenv("ARGPX_TEST_USE_ONESHOT") != NULL) {
+        // without the compiled parser, it builds its own every call
+        status = ArgpxParse(&res, argc - 1, argv + 1, &style, &flag, &opt);
+    } else {
+        // skip the first arg, that's the exec command name, and the ARGPX_TEST_* variables bound to flags come after
+        status = ArgpxParseEnv(&res, argc - 1, argv + 1, environ, parser, &opt);
+    }
+
+    // the parallel parse must give exactly what the serial one gives, an error included, so parse again and compare
+    if (pool != NULL) {
+        struct TestOutput_ output = {
+            .allocator = allocator,
+            .str31 = &test_str31,
+            .bool1 = &test_bool,
+            .bool2 = &test_bool2,
+            .int1 = &test_int,
+            .param_int = &test_param_int,
+            .view = &test_view,
+            .lazy = &flag.ptr[lazy_idx].action_load.param_lazy,
+            .lazy_str = &flag.ptr[lazy_str_idx].action_load.param_lazy,
+            .xy = &test_xy,
+            .x = &test_x,
+            .list = &test_list,
+            .list_all = &test_list_all,
+            .level = &test_level,
+            .ratio = &test_ratio,
+            .record = &record,
+        };
+        uint64_t parallel_hash = TestOutputHash_(&res, &output);
+        ArgpxResultFree(&res);
+        TestOutputReset_(&output);
+        status = ArgpxParseCompiled(&res, argc - 1, argv + 1, parser, &opt);
+        if (TestOutputHash_(&res, &output) != parallel_hash) {
+            printf("ArgpxParseParallel() differs from ArgpxParseCompiled()\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (status != kArgpxStatusSuccess)
         Error_(&res);
+
+    // every argument is counted(the tokens of response files too), and every allocation went through the counters
+    // the ones after the terminate symbol are never read
+    int read_c = argc - 1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "::") == 0) {
+            read_c = i;
+            break;
+        }
+    }
+    if (pool == NULL
+        and ((use_fd == false and stats.arg_c < (unsigned long)read_c)
+            or (use_allocator == true and test_use_arena == false and stats.alloc_c != test_alloc_total - alloc_before)))
+    {
+        printf("stats: %lu args, %lu allocations\n", stats.arg_c, stats.alloc_c);
+        exit(EXIT_FAILURE);
     }
 
     // clang-format on
@@ -194,14 +683,68 @@ int main(int argc, char *argv[])
     printf("--setbool:\t\t%s\n", BoolToString_(test_bool));
     printf("-a:\t\t\t%s\n", BoolToString_(test_bool2));
     printf("--setint:\t\t%d\n", test_int);
+    printf("--int:\t\t\t%d\n", test_param_int);
+    // a view into the stream buffer is gone already
+    if (use_fd == false)
+        printf("--view:\t\t\t%.*s\n", (int)test_view.len, test_view.ptr);
+    // the lazy parameters are left unconverted, but a stream has converted them at once
+    struct ArgpxOutParamLazy *lazy = &flag.ptr[lazy_idx].action_load.param_lazy;
+    struct ArgpxOutParamLazy *lazy_str = &flag.ptr[lazy_str_idx].action_load.param_lazy;
+    if (use_fd == false) {
+        status = ArgpxOutParamLazyGet(lazy);
+        if (status == kArgpxStatusSuccess)
+            status = ArgpxOutParamLazyGet(lazy_str);
+        if (status != kArgpxStatusSuccess) {
+            printf("lazy conversion error: %s\n", ArgpxStatusString(status));
+            exit(EXIT_FAILURE);
+        }
+    }
+    // with an arena, the string of --lazy-str is the last thing in it
+    if (test_use_arena == true and lazy_str->raw.ptr != NULL
+        and (test_lazy_str < arena.buf or test_lazy_str >= arena.buf + arena.used))
+    {
+        printf("--lazy-str: not from the arena\n");
+        exit(EXIT_FAILURE);
+    }
+    printf("--lazy:\t\t\t%d\n", test_lazy_int);
+    printf("--lazy-str:\t\t%s\n", test_lazy_str != NULL ? test_lazy_str : "(null)");
+    printf("/xy:\t\t\t%s\n", BoolToString_(test_xy));
+    printf("/x:\t\t\t%s\n", BoolToString_(test_x));
+    printf("+list:\t\t\t%s\n", BoolToString_(test_list));
+    printf("+list-all:\t\t%s\n", BoolToString_(test_list_all));
+    printf("+level:\t\t\t%d\n", test_level);
+    printf("/ratio:\t\t\t%g\n", test_ratio);
+    printf("--bind-level:\t\t%d\n", record.level);
+    printf("--bind-quiet:\t\t%s\n", BoolToString_(record.quiet));
+    for (int i = 0; i < record.tag.out_count; i++)
+        printf("--bind-tag:\t\t%s\n", record.tag.out_list[i]);
+
+    // a bound flag never writes to the flag set
+    if (flag.ptr[bind_tag_idx].action_load.param_list.out_list != NULL) {
+        printf("--bind-tag wrote to the flag set\n");
+        exit(EXIT_FAILURE);
+    }
+    if (test_use_arena == false)
+        ArgpxOutParamListFree(&record.tag);
 
     printf("==== command parameters ====\n");
     for (int i = 0; i < res.param_c; i++)
         printf("%s\n", res.param_v[i]);
 
+    ArgpxOutParamLazyFree(lazy_str);
     ArgpxResultFree(&res);
+    if (test_use_arena == true)
+        ArgpxArenaFree(&arena);
+    ArgpxParserFree(parser);
+    ArgpxPoolFree(pool);
+    FreeOutString_(allocator, test_str31);
     ArgpxStyleFree(&style);
     ArgpxFlagFree(&flag);
 
+    if (use_allocator == true and (test_alloc_live != 0 or test_alloc_total == 0)) {
+        printf("test allocator: %ld blocks alive, %ld allocated\n", test_alloc_live, test_alloc_total);
+        exit(EXIT_FAILURE);
+    }
+
     return 0;
 }
@@ -69,15 +69,159 @@ function AssertFailure {
 
 out='./test.out'
 
-AssertSuccess $out param1 param2 paramEnd
-AssertFailure $out --ffff
-AssertFailure $out -ffff
-AssertSuccess $out --setbool --setint paramEnd
-# AssertSuccess $out --test=testStr1,testStr2
-# AssertSuccess $out ++test2~str1-str2
-AssertSuccess $out -baac -a -- -ba paramEnd
-AssertSuccess $out /win1Param1/win2Param2 paramEnd
-AssertSuccess $out --samename ++samename
+function RunAll {
+    AssertSuccess $out param1 param2 paramEnd
+    AssertFailure $out --ffff
+    AssertFailure $out -ffff
+    # the typos print a "did you mean"
+    AssertFailure $out --setbol
+    AssertFailure $out --bind-lvel=3
+    # a unique start of a name in the "+" group, "+l" and "+li" are more than one, but "+list" is a whole one
+    AssertSuccess $out +lev=3 +le 2 +list-a +list- +list
+    AssertFailure $out +l
+    AssertFailure $out +li
+    AssertFailure $out +lx
+    # and not in the GNU one
+    AssertFailure $out --setb
+    AssertSuccess $out --setbool --setint paramEnd
+    AssertSuccess $out --setbool :: --int=x
+    # AssertSuccess $out --test=testStr1,testStr2
+    # AssertSuccess $out ++test2~str1-str2
+    AssertSuccess $out -baac -a -- -ba paramEnd
+    AssertSuccess $out /win1Param1/win2Param2 paramEnd
+    # "xy" is appended before "x", so it's never "x" + "y"
+    AssertSuccess $out /xy /x/xy /xy/x
+    AssertSuccess $out --samename ++samename
+    AssertSuccess $out --view=viewStr --view viewStr2
+    AssertSuccess $out --int=-12 --int 0x1F
+    AssertFailure $out --int=12x
+    AssertFailure $out --int=99999999999
+    AssertSuccess $out --paramlist=a,b,c --paramlist a
+    AssertFailure $out --paramlist=a,b,c,d
+    AssertFailure $out --paramlist=a,,b
+    AssertFailure $out --paramlist=a,b,
+    AssertSuccess $out --listview=a,b,c,d,e
+    AssertSuccess $out --bind-level=3 --bind-quiet --bind-tag=a,b,c
+    AssertFailure $out --bind-level=x
+    AssertFailure $out --bind-tag=a,b,c,d,e
+    AssertSuccess $out --lazy=1 --lazy=12 --lazy-str=a --lazy-str b
+    AssertFailure $out --lazy
+    AssertSuccess $out @test.rsp paramEnd
+    AssertFailure $out @test_loop.rsp
+    AssertFailure $out @test_unclosed.rsp
+    AssertFailure $out @test_missing.rsp
+}
+
+# the flags bound to the environment, only the argv parse reads it, but the argv wins
+function EnvAll {
+    ARGPX_TEST_INT=5 ARGPX_TEST_SETBOOL=1 ARGPX_TEST_PARAMLIST=a,b AssertSuccess $out --setint
+    ARGPX_TEST_INT=x AssertSuccess $out --int=3
+    ARGPX_TEST_SETBOOL=0 ARGPX_TEST_INT= AssertSuccess $out
+    ARGPX_TEST_INT=x AssertFailure $out
+    ARGPX_TEST_SETBOOL=yes AssertFailure $out
+    ARGPX_TEST_PARAMLIST=a,b,c,d AssertFailure $out
+    # the terminate symbol ends it all, the environment too
+    ARGPX_TEST_INT=x AssertSuccess $out --setint :: --int=x
+}
+
+RunAll
+EnvAll
+# a float parameter longer than the stack copy, in the middle of an argument(too long for the buffer of test_fd.sh)
+AssertSuccess $out /ratio=0.5000000000000000000000000000000000000000000000000000000000000000000001/x
+AssertFailure $out /ratio=0.5000000000000000000000000000000000000000000000000000000000000000000001x/x
+# only the last lazy one is converted(a stream converts each one, see below)
+AssertSuccess $out --lazy=x --lazy=12
+# and the one-shot ArgpxParse(), its parser is on the stack so the allocator sees only the parse
+export ARGPX_TEST_USE_ONESHOT=1
+ARGPX_TEST_USE_ALLOCATOR=1 RunAll
+ARGPX_TEST_USE_HASH=1 RunAll
+unset ARGPX_TEST_USE_ONESHOT
+# and again in hash mode
+export ARGPX_TEST_USE_HASH=1
+RunAll
+# and with an arena
+export ARGPX_TEST_USE_ARENA=1
+RunAll
+# and with an allocator, nothing may bypass it
+unset ARGPX_TEST_USE_ARENA
+export ARGPX_TEST_USE_ALLOCATOR=1
+RunAll
+# and with the static index made by argpx_gen
+export ARGPX_TEST_USE_STATIC=1
+RunAll
+EnvAll
+# and the parallel parse, the short ones fall back to the serial parse
+export ARGPX_TEST_USE_PARALLEL=1
+RunAll
+# so a long argv for the phases, test.c parses it again serially and compares everything
+# the composable ones, a ParamList and a response file sit across the chunk boundaries(1024 arguments)
+long_argv=$(for i in $(seq 0 3499); do
+    case $((i % 1024)) in
+    1020) echo "-aa" ;;
+    1021) echo "/win1P$i/xy" ;;
+    1022) echo "--paramlist" ;;
+    1023) echo "a,b,$i" ;;
+    0) echo "@test.rsp" ;;
+    1) echo "--int" ;;
+    2) echo "$i" ;;
+    *)
+        case $((i % 4)) in
+        0) echo "--int=$i" ;;
+        1) echo "file$i" ;;
+        2) echo "--setint" ;;
+        3) echo "--lazy=$i" ;;
+        esac
+        ;;
+    esac
+done)
+AssertSuccess $out $long_argv --int 7 -baac -a @test.rsp --view=v --lazy=3 -- --int=x
+AssertFailure $out $long_argv --int=x paramEnd
+AssertFailure $out $long_argv --int
+unset ARGPX_TEST_USE_PARALLEL
+out='./test_fd.sh'
+RunAll
+AssertFailure $out --lazy=x --lazy=12
+# and split from one command line string
+out='./test_line.sh'
+RunAll
+AssertSuccess $out "param 1" --view="a b" 'param\2' 'param"3'
+AssertFailure $out --lazy=1 --lazy=x
+ARGPX_TEST_LINE="param1 'param2" AssertFailure ./test.out
+ARGPX_TEST_LINE='param1 "param2' AssertFailure ./test.out
+
+separator - 3
+# a typo with a parameter is suggested by its name, the parameter isn't a part of it
+echo ">>> suggestion of --setbooll=12345"
+if ! ./test.out --setbooll=12345 | grep -q "did you mean: setbool"; then
+    echo "[Failure] Assert failed, no suggestion of setbool"
+    exit 1
+fi
+
+separator - 3
+# the quote is open at the end of the file, it's not a missing parameter of --int
+echo ">>> unclosed quote in @test_unclosed.rsp"
+if ! ./test.out @test_unclosed.rsp | grep -q "Quote is not closed"; then
+    echo "[Failure] Assert failed, the unclosed quote is not reported"
+    exit 1
+fi
+
+separator - 3
+# the buffer of test_fd.sh(32 bytes) is filled again after the lazy ones, they must be converted already
+echo ">>> lazy parameters in a wrapped stream buffer"
+lazy_out=$(./test_fd.sh --view=aaaaaaaaaaaaaaaaaaaa --lazy=12 --lazy-str=abcdefgh --view=bbbbbbbbbbbbbbbbbbbb \
+    --view=cccccccccccccccccccc)
+if ! grep -qF -e $'--lazy:\t\t\t12' <<<"$lazy_out" || ! grep -qF -e $'--lazy-str:\t\tabcdefgh' <<<"$lazy_out"; then
+    echo "[Failure] Assert failed, the lazy parameters are lost in the stream buffer"
+    exit 1
+fi
+
+separator - 3
+# the allocator is only reachable through argpx_alloc.c, no other file may call the C library directly
+echo ">>> direct allocation in source/"
+if grep -nE '\b(malloc|calloc|realloc|free)\(' ../source/*.c | grep -v '^../source/argpx_alloc.c:'; then
+    echo "[Failure] Assert failed, allocation bypasses ArgpxAllocator"
+    exit 1
+fi
 
 separator - 3
 echo "[Success] All test passed(only the return code is detected)"
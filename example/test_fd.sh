@@ -0,0 +1,4 @@
+#!/usr/bin/env bash
+
+# run test.out with the arguments streamed from stdin(NUL-delimited), instead of argv
+printf '%s\0' "$@" | ARGPX_TEST_USE_FD=1 ./test.out
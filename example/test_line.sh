@@ -0,0 +1,8 @@
+#!/usr/bin/env bash
+
+# run test.out with the arguments joined into one command line string, each one quoted
+line=''
+for arg in "$@"; do
+    line+="'${arg//\'/\'\\\'\'}' "
+done
+ARGPX_TEST_LINE="$line" ./test.out
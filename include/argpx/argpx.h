@@ -2,6 +2,7 @@
 #define ARGPX_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -23,6 +24,16 @@ enum ArgpxStatus {
     kArgpxStatusAssignmentDisallowTrailing,
     kArgpxStatusAssignmentDisallowArg,
     kArgpxStatusBizarreFormat,
+
+    kArgpxStatusConvertMalformed,
+    kArgpxStatusConvertTrailing,
+    kArgpxStatusConvertOutOfRange,
+
+    kArgpxStatusIoError,
+    kArgpxStatusArgumentTooLong,
+    kArgpxStatusResponseTooDeep,
+    kArgpxStatusUnclosedQuote,
+    kArgpxStatusAmbiguousFlag,
 };
 
 enum ArgpxActionType {
@@ -43,6 +54,10 @@ enum ArgpxActionType {
     // like SetBool, maybe enum need it
     // note: this action just uses the "int" type
     kArgpxActionSetInt,
+    // same as ParamList, but the list items point into the original argument, nothing is copied
+    kArgpxActionParamListView,
+    // same as ParamSingle, but only the parameter is kept, it's converted by ArgpxOutParamLazyGet()
+    kArgpxActionParamLazy,
 };
 
 #define ARGPX_ATTR_ASSIGNMENT_DISABLE_ASSIGNER 1 << 0
@@ -53,6 +68,12 @@ enum ArgpxActionType {
 #define ARGPX_ATTR_COMPOSABLE 1 << 3
 #define ARGPX_ATTR_COMPOSABLE_NEED_PREFIX 1 << 4
 
+// the rest of the argument after the prefix is a response file, its tokens are parsed in place of the argument
+#define ARGPX_ATTR_RESPONSE_FILE 1 << 5
+
+// a unique start of a flag name works like the whole name, like "--verb" of "--verbose". Not for a composable group
+#define ARGPX_ATTR_ABBREVIATION 1 << 6
+
 struct ArgpxGroup {
     // all group attribute
     uint16_t attribute;
@@ -75,6 +96,18 @@ enum ArgpxSymbolType {
     kArgpxSymbolCallback,
 };
 
+/*
+    Where the library gets its heap memory, set it to the "allocator" of a struct. A NULL one is malloc() and friends.
+    The realloc_fn also gets the old size, and it must keep the old memory untouched when it fails.
+ */
+struct ArgpxAllocator {
+    void *(*alloc_fn)(void *ctx, size_t size);
+    void *(*realloc_fn)(void *ctx, void *ptr, size_t old_size, size_t new_size);
+    void (*free_fn)(void *ctx, void *ptr);
+    // passed to all of the functions
+    void *ctx;
+};
+
 struct ArgpxSymbol {
     // key symbol array
     char *str;
@@ -91,12 +124,14 @@ struct ArgpxStyle {
     // for example, StopParsing symbol may like "--" or "-"
     int symbol_c;
     struct ArgpxSymbol *symbol_v;
+    // for group_v and symbol_v, don't change it after the first append
+    const struct ArgpxAllocator *allocator;
 };
 
 #define ARGPX_STYLE_INIT \
     (struct ArgpxStyle) \
     { \
-        .group_c = 0, .group_v = NULL, .symbol_c = 0, .symbol_v = NULL \
+        .group_c = 0, .group_v = NULL, .symbol_c = 0, .symbol_v = NULL, .allocator = NULL \
     }
 
 enum ArgpxVarType {
@@ -106,6 +141,14 @@ enum ArgpxVarType {
     kArgpxVarBool,
     kArgpxVarFloat,
     kArgpxVarDouble,
+    // a struct ArgpxStringView points into the original argument, no allocation
+    kArgpxVarStringView,
+};
+
+// a piece of string, it may not be terminated by \0
+struct ArgpxStringView {
+    const char *ptr;
+    size_t len;
 };
 
 // Convert a string in flag's parameter
@@ -113,6 +156,39 @@ struct ArgpxOutParamSingle {
     enum ArgpxVarType type;
     // a pointer to the actual variable
     void *var_ptr;
+    // set by the library, the one made the memory
+    const struct ArgpxAllocator *allocator;
+};
+
+// the variable of a bound struct ArgpxOutParamLazy, the member is the one of .type
+union ArgpxLazyValue {
+    char *as_string;
+    int as_int;
+    bool as_bool;
+    float as_float;
+    double as_double;
+    struct ArgpxStringView as_view;
+};
+
+/*
+    A flag parameter converted on the first ArgpxOutParamLazyGet(), the parse only keeps its string.
+    So a value never read or overridden by a later one costs nothing.
+    The raw string points into the original argument, the same as the string views.
+ */
+struct ArgpxOutParamLazy {
+    enum ArgpxVarType type;
+    // a pointer to the actual variable, written by ArgpxOutParamLazyGet()
+    void *var_ptr;
+    // set by the library: the last parameter of the flag, .ptr is NULL if the flag isn't given
+    struct ArgpxStringView raw;
+    // set by the library: var_ptr holds the value of raw
+    bool converted;
+    // set by the library, the one made the kArgpxVarString
+    const struct ArgpxAllocator *allocator;
+    // set by the library: the arena of the parse, if any, the kArgpxVarString comes from it then
+    struct ArgpxArena *arena;
+    // the variable of a flag bound by ARGPX_BIND_OFFSET(), .var_ptr points here then
+    union ArgpxLazyValue value;
 };
 
 struct ArgpxOutParamList {
@@ -120,6 +196,17 @@ struct ArgpxOutParamList {
     char **out_list;
     // if <= 0, no limit
     int max;
+    // set by the library, the one made the memory
+    const struct ArgpxAllocator *allocator;
+};
+
+struct ArgpxOutParamListView {
+    int out_count;
+    struct ArgpxStringView *out_list;
+    // if <= 0, no limit
+    int max;
+    // set by the library, the one made the memory
+    const struct ArgpxAllocator *allocator;
 };
 
 struct ArgpxOutSetMemory {
@@ -144,14 +231,18 @@ struct ArgpxFlag {
     // emm... I trust the programer can figure out the array index in their hands
     // then there is no need for a new hash table here
     int group_idx;
-    // name of flag, like the "flagName" of "--flagName"
+    // name of flag, like the "flagName" of "--flagName", an empty one is kArgpxStatusConfigInvalid
     char *name;
+    // if not NULL, the environment variable of the flag for ArgpxParseEnv(), like "APP_LEVEL". The group must exist
+    char *env_name;
 
     // one flag only have one action, but one action may need to define mutiple structures.
     enum ArgpxActionType action_type;
     union {
         struct ArgpxOutParamSingle param_single;
+        struct ArgpxOutParamLazy param_lazy;
         struct ArgpxOutParamList param_list;
+        struct ArgpxOutParamListView param_list_view;
         struct ArgpxOutSetMemory set_memory;
         struct ArgpxOutSetBool set_bool;
         struct ArgpxOutSetInt set_int;
@@ -163,30 +254,141 @@ struct ArgpxFlag {
     // if NULL, skip callback
     void (*callback)(void *action_load, void *param);
     void *callback_param;
+
+    // output binding, set both of them with ARGPX_BIND_OFFSET()
+    // if true, the output goes to .out_base of struct ArgpxParseOption plus out_offset, and the flag is never written
+    bool bind_offset;
+    size_t out_offset;
 };
 
+/*
+    Put it into the initializer of struct ArgpxFlag, the output will be the "member" of a "type" record.
+    What's at the offset:
+    - ParamSingle/ParamSingleOnDemand: the variable of .type, OnDemand allocates nothing in this mode
+    - ParamList/ParamListView: a struct ArgpxOutParamList/ArgpxOutParamListView
+    - ParamLazy: a struct ArgpxOutParamLazy, .type is copied from the flag and .var_ptr points to its own .value
+    - SetMemory: .size bytes, the .source_ptr is still a pointer
+    - SetBool/SetInt: a bool/int
+    The target pointers of action_load are ignored, and the callback gets a copy of action_load points to the record.
+ */
+#define ARGPX_BIND_OFFSET(type, member) .bind_offset = true, .out_offset = offsetof(type, member)
+
 struct ArgpxFlagSet {
     int count;
     struct ArgpxFlag *ptr;
+    // for ptr, don't change it after the first append
+    const struct ArgpxAllocator *allocator;
 };
 
 #define ARGPX_FLAGSET_INIT \
     (struct ArgpxFlagSet) \
     { \
-        .count = 0, .ptr = NULL \
+        .count = 0, .ptr = NULL, .allocator = NULL \
     }
 
+/*
+    A bump allocator, it serves all the memory of a parse if set to .arena of struct ArgpxParseOption.
+    Everything in it is released at once with ArgpxArenaReset(), no other free function should be called on them.
+    Use ArgpxArenaInit() to set it up, the elements marked private are managed by the library.
+ */
+struct ArgpxArena {
+    // current block, it can be supplied by the user
+    char *buf;
+    size_t size;
+    size_t used;
+    // if false, a full arena makes kArgpxStatusMemoryError
+    bool growable;
+    // private: the blocks allocated by the library
+    void *chain;
+    // private: total size of the chain
+    size_t chain_size;
+    // for the library blocks, set it after ArgpxArenaInit() if needed
+    const struct ArgpxAllocator *allocator;
+};
+
+/*
+    A minimal perfect hash of (group_idx, name) to the flag index, made at build time by tools/argpx_gen.c.
+    It's all constant, so the generated one lives in .rodata and needs no setup.
+    The flag set must be appended in the same order as the spec.
+ */
+struct ArgpxStaticIndex {
+    uint32_t seed;
+    // one displacement for each bucket
+    uint32_t bucket_c;
+    const uint32_t *disp_v;
+    // the flag index of each slot, there are exactly flag_c slots
+    int flag_c;
+    const int32_t *slot_v;
+};
+
+/*
+    Counters of one parse, set .stats of struct ArgpxParseOption to get them. They're zeroed when a parse starts.
+    Nothing is counted when the library is built with -DARGPX_NO_STATS.
+ */
+struct ArgpxParseStats {
+    // including the command parameters and the parameters of flags
+    unsigned long arg_c;
+    // prefix compares to find the group of an argument
+    unsigned long group_try_c;
+    // full compares of the symbols, the ones rejected by the first byte or length are not counted
+    unsigned long symbol_cmp_c;
+    // flag lookups of each way
+    unsigned long lookup_linear_c;
+    unsigned long lookup_hash_c;
+    unsigned long lookup_trie_c;
+    unsigned long lookup_static_c;
+    // index entries visited by the linear lookups, only the flags of the group
+    unsigned long linear_visit_c;
+    // hash table slots probed, in total and the longest one
+    unsigned long hash_probe_c;
+    unsigned long hash_probe_max;
+    // bytes scanned for an assigner, a prefix or a delimiter
+    unsigned long scan_byte_c;
+    // parameters converted to a type
+    unsigned long convert_c;
+    // from the arena or the allocator, the ones of the callbacks are not counted
+    unsigned long alloc_c;
+    unsigned long realloc_c;
+};
+
 struct ArgpxParseOption {
     int max_cmdparam;
     bool use_hash;
+    // if not NULL, all the memory of this parse comes from it
+    struct ArgpxArena *arena;
+    // keep the param_v memory of the given struct ArgpxResult, it must be ARGPX_RESULT_INIT or used by a parse before
+    bool reuse_result;
+    // the heap memory of ArgpxCompile() and the parse, when no arena is given
+    const struct ArgpxAllocator *allocator;
+    // the output record of the flags with .bind_offset
+    void *out_base;
+    // if not NULL, it replaces the flag lookup of the non-composable groups, only used by ArgpxCompile()
+    const struct ArgpxStaticIndex *static_index;
+    // if not NULL, the counters of the parse go to it
+    struct ArgpxParseStats *stats;
+    // build the index of ArgpxSuggest() for .suggest_v of the result, only used by ArgpxCompile()
+    bool use_suggest;
 };
 
 #define ARGPX_PARSE_OPTION_INIT \
     (struct ArgpxParseOption) \
     { \
-        .max_cmdparam = 0, .use_hash = false \
+        .max_cmdparam = 0, .use_hash = false, .arena = NULL, .reuse_result = false, .allocator = NULL, \
+        .out_base = NULL, .static_index = NULL, .stats = NULL, .use_suggest = false \
     }
 
+/*
+    A known flag close to an unknown name, see ArgpxSuggest().
+ */
+struct ArgpxSuggestion {
+    const struct ArgpxFlag *conf;
+    // the edit distance(Levenshtein) to the unknown name
+    int distance;
+};
+
+// the suggestions kept by struct ArgpxResult
+#define ARGPX_SUGGEST_MAX 3
+
 struct ArgpxResult {
     enum ArgpxStatus status;
     // index to the last parsed argument, processing maybe finished or maybe wrong
@@ -197,6 +399,73 @@ struct ArgpxResult {
     int param_c;
     // an array of command parameters
     char **param_v;
+    // the capacity of param_v
+    int param_cap;
+    // if not NULL, param_v lives in this arena
+    struct ArgpxArena *arena;
+    // otherwise param_v comes from this one
+    const struct ArgpxAllocator *allocator;
+    // private: the response files mapped by the parse, the strings from them live until ArgpxResultFree()
+    void *mapping;
+    // kArgpxStatusUnknownFlag of an independent group, the nearest known flags of the group. See .use_suggest
+    // or kArgpxStatusAmbiguousFlag, the shortest flags starting with the name
+    int suggest_c;
+    struct ArgpxSuggestion suggest_v[ARGPX_SUGGEST_MAX];
+};
+
+#define ARGPX_RESULT_INIT \
+    (struct ArgpxResult) \
+    { \
+        .status = kArgpxStatusSuccess, .current_argv_idx = 0, .current_argv_ptr = NULL, .param_c = 0, \
+        .param_v = NULL, .param_cap = 0, .arena = NULL, .allocator = NULL, .mapping = NULL, \
+        .suggest_c = 0 \
+    }
+
+/*
+    A compiled style and flag set, made by ArgpxCompile().
+    It's read only after compiled, the content is private.
+ */
+struct ArgpxParser;
+
+/*
+    A fixed set of worker threads for ArgpxParseBatch() and ArgpxParseParallel(), made by ArgpxPoolCreate().
+ */
+struct ArgpxPool;
+
+/*
+    One argv vector of a batch, and its own result.
+ */
+struct ArgpxBatchItem {
+    int arg_c;
+    char **arg_v;
+    // if not NULL, replace the .out_base of the option for this item
+    void *out_base;
+    struct ArgpxResult res;
+};
+
+/*
+    The input of ArgpxParseFd(), NUL-delimited arguments like the output of "find -print0".
+    The buffer is the caller's, and it's all the memory for the arguments, reused as a ring.
+    Any argument(with its NUL) up to a third of the size always fits, a longer one may be kArgpxStatusArgumentTooLong.
+ */
+struct ArgpxFdSource {
+    int fd;
+    char *buf;
+    size_t size;
+    // called for each command parameter, the string is only valid during the call, NULL: ignore them
+    void (*param_fn)(void *param_ctx, char *param);
+    void *param_ctx;
+};
+
+/*
+    Split a command line string into tokens in place, see ArgpxTokenizerNext().
+    The line must stay alive as long as the tokens are used.
+ */
+struct ArgpxTokenizer {
+    char *pos;
+    char *end;
+    // kArgpxStatusUnclosedQuote stops it
+    enum ArgpxStatus status;
 };
 
 char *ArgpxStatusString(enum ArgpxStatus status);
@@ -208,9 +477,41 @@ void ArgpxStyleFree(struct ArgpxStyle *style);
 int ArgpxFlagAppend(struct ArgpxFlagSet *set, const struct ArgpxFlag *new);
 void ArgpxFlagFree(struct ArgpxFlagSet *set);
 
+void ArgpxTokenizerInit(struct ArgpxTokenizer *tok, char *line);
+char *ArgpxTokenizerNext(struct ArgpxTokenizer *tok);
+
+void ArgpxArenaInit(struct ArgpxArena *arena, void *buf, size_t size, bool growable);
+void ArgpxArenaReset(struct ArgpxArena *arena);
+void ArgpxArenaFree(struct ArgpxArena *arena);
+
 void ArgpxResultFree(struct ArgpxResult *res);
 void ArgpxOutParamSingleFree(struct ArgpxOutParamSingle *out);
 void ArgpxOutParamListFree(struct ArgpxOutParamList *out);
+void ArgpxOutParamListViewFree(struct ArgpxOutParamListView *out);
+int ArgpxOutParamLazyGet(struct ArgpxOutParamLazy *out);
+void ArgpxOutParamLazyFree(struct ArgpxOutParamLazy *out);
+
+int ArgpxCompile(struct ArgpxParser **out_parser, struct ArgpxStyle *style, struct ArgpxFlagSet *flag,
+    struct ArgpxParseOption *option);
+void ArgpxParserFree(struct ArgpxParser *parser);
+
+int ArgpxParseCompiled(struct ArgpxResult *in_result, int in_arg_c, char **in_arg_v,
+    const struct ArgpxParser *in_parser, struct ArgpxParseOption *in_option);
+int ArgpxParseFd(struct ArgpxResult *in_result, struct ArgpxFdSource *in_source, const struct ArgpxParser *in_parser,
+    struct ArgpxParseOption *in_option);
+int ArgpxParseCommandLine(struct ArgpxResult *in_result, char *in_line, const struct ArgpxParser *in_parser,
+    struct ArgpxParseOption *in_option);
+int ArgpxPoolCreate(struct ArgpxPool **out_pool, int thread_c, const struct ArgpxAllocator *allocator);
+void ArgpxPoolFree(struct ArgpxPool *pool);
+int ArgpxParseBatch(struct ArgpxPool *pool, struct ArgpxBatchItem *item_v, int item_c, const struct ArgpxParser *parser,
+    struct ArgpxParseOption *option);
+int ArgpxParseParallel(struct ArgpxPool *pool, struct ArgpxResult *in_result, int in_arg_c, char **in_arg_v,
+    const struct ArgpxParser *in_parser, struct ArgpxParseOption *in_option);
+int ArgpxParseEnv(struct ArgpxResult *in_result, int in_arg_c, char **in_arg_v, char **in_env_v,
+    const struct ArgpxParser *in_parser, struct ArgpxParseOption *in_option);
+
+int ArgpxSuggest(const struct ArgpxParser *parser, int group_idx, const char *name, size_t name_len, int max_distance,
+    struct ArgpxSuggestion *out_v, int k);
 
 int ArgpxParse(struct ArgpxResult *in_result, int in_arg_c, char **in_arg_v, struct ArgpxStyle *in_style,
     struct ArgpxFlagSet *in_flag, struct ArgpxParseOption *in_option);
@@ -1,6 +1,8 @@
 /*
     Compiler macros(passing them with -D<macro> flag):
 
+    #define ARGPX_NO_STATS              // compile out the counters of struct ArgpxParseStats
+
     Deprecated macros:
     #define ARGPX_ENABLE_HASH           // when searching flags, use hash as much as possible
     #define ARGPX_ENABLE_BATCH_ALLOC    // reduce system calls during configuration
@@ -8,44 +10,107 @@
 #include "argpx/argpx.h"
 
 #include <assert.h>
+#include <ctype.h>
+#include <errno.h>
 #include <inttypes.h>
 #include <iso646.h>
+#include <limits.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "argpx_alloc.h"
+#include "argpx_arena.h"
+#include "argpx_batch.h"
 #include "argpx_hash.h"
+#include "argpx_response.h"
+#include "argpx_search.h"
+#include "argpx_static.h"
+#include "argpx_stream.h"
+#include "argpx_suggest.h"
 
+// the max load factor, the table size is always a power of 2
 #define ARGPX_FLAG_TABLE_LOADFACTOR 0.75
 
-struct FlagTableUnit_ {
-    // only check if the root key is used
-    bool root_used;
+// the stack buffer of the ArgpxParse() parser, enough for some dozens of flags in a few groups
+#define ARGPX_ONESHOT_LOCAL_SIZE 4096
+
+// how deep a response file can include another one
+#define ARGPX_RESPONSE_DEPTH_MAX 16
+
+// the arguments or conversions a worker of ArgpxParseParallel() takes at a time
+#define ARGPX_PARALLEL_CHUNK 1024
+
+// add n to a counter of struct ArgpxParseStats, without the stats it's one predictable branch
+#ifdef ARGPX_NO_STATS
+#define ARGPX_STATS_ADD(stats, member, n) ((void)0)
+#define ARGPX_STATS_MAX(stats, member, n) ((void)0)
+#else
+#define ARGPX_STATS_ADD(stats, member, n) \
+    do { \
+        if ((stats) != NULL) \
+            (stats)->member += (n); \
+    } while (0)
+#define ARGPX_STATS_MAX(stats, member, n) \
+    do { \
+        if ((stats) != NULL and (stats)->member < (n)) \
+            (stats)->member = (n); \
+    } while (0)
+#endif
+
+/*
+    An open addressing table with linear probing.
+    Everything for a quick reject is stored inline, the flag config only be touched for the final compare.
+ */
+struct FlagTableSlot_ {
+    // NULL: empty slot
     struct ArgpxFlag *conf;
-    // if not NULL, then it is a linked list
-    struct FlagTableUnit_ *next;
+    uint32_t hash;
+    // truncated name length, it's only a filter
+    uint32_t name_len;
 };
 
 struct FlagTable_ {
-    int count; // calculated by TABLE_LOADFACTOR dynamics
-    struct FlagTableUnit_ *array;
+    // slot count - 1
+    size_t mask;
+    struct FlagTableSlot_ *slot_v;
 };
 
 /*
-    An unified data of this library.
+    A prefix tree of the flag names in one group, so a name with unknown length can be matched in O(name length).
+    All of the nodes and edges are in a single allocation, node 0 is the root.
  */
-struct UnifiedData_ {
-    // the result structure must not be on the stack
-    struct ArgpxResult *res;
-    int arg_c;
-    char **arg_v;
-    // try to make it to record the last processed arg
-    int arg_idx;
-    struct ArgpxStyle style;
-    struct ArgpxFlagSet conf;
-    struct FlagTable_ conf_table;
-    struct ArgpxParseOption opt;
+struct FlagTrieNode_ {
+    // the flag whose name ends at this node, NULL: none
+    struct ArgpxFlag *conf;
+    // children are edge_*_v[edge_start, edge_start + edge_c), sorted by byte
+    int edge_start;
+    int edge_c;
+};
+
+struct FlagTrie_ {
+    // 0: the trie is not built
+    int node_c;
+    int edge_c;
+    struct FlagTrieNode_ *node_v;
+    unsigned char *edge_byte_v;
+    int *edge_child_v;
+};
+
+/*
+    The flags of each group in contiguous arrays, for MatchConfLinear_(). The lookup filters them by the length and the
+    first 8 bytes of the name, only the few survivors touch the flag config.
+    The names often share a prefix("flag-name-N"), so a lookup of a known length checks the last 8 bytes too.
+    Group g is [group_start_v[g], group_start_v[g + 1]) of the arrays, in the append order. All in a single allocation.
+ */
+struct FlagLinear_ {
+    // NULL: the index is not built
+    uint64_t *head_v;
+    uint64_t *tail_v;
+    uint32_t *name_len_v;
+    int *conf_idx_v;
+    int *group_start_v;
 };
 
 struct UnifiedGroupCache_ {
@@ -59,55 +124,125 @@ struct UnifiedGroupCache_ {
 };
 
 /*
-    Search "needle" in "haystack", limited to the first "len" chars of haystack.
+    The compiled form of a style and a flag set, see ArgpxCompile().
+    Nothing in here will be changed by the parsing.
  */
-static char *strnstr_(const void *haystack_in, const void *needle_in, size_t haystack_len)
-{
-    assert(haystack_in != NULL);
-    assert(needle_in != NULL);
-
-    // return memmem(haystack, len, needle, strlen(needle));
-    // from GNU libc
-    // this won't make benchmark faster, the haystack is too short, not even now
-
-    const char *haystack = haystack_in;
-    const char *needle = needle_in;
+struct ArgpxParser {
+    struct ArgpxStyle style;
+    struct ArgpxFlagSet conf;
+    bool use_hash;
+    // all the memory of the parser comes from it
+    const struct ArgpxAllocator *allocator;
+    // one cache for each group, same index as style.group_v
+    struct UnifiedGroupCache_ *group_v;
+    // groups dispatched by the first byte of their prefix, see MatchingGroup_()
+    // the bucket of byte b is group_order_v[dispatch_v[b], dispatch_v[b + 1]), longest prefix first
+    int dispatch_v[UCHAR_MAX + 2];
+    int *group_order_v;
+    // the group with an empty prefix, negative: none
+    int no_prefix_group_idx;
+    // strlen() of each symbol, same index as style.symbol_v
+    size_t *symbol_len_v;
+    size_t symbol_max_len;
+    // quick reject of MatchSymbol_(), bit n set: some symbol has length n(the longer ones use bit 63)
+    uint64_t symbol_len_mask;
+    // bit b set: some symbol starts with byte b
+    uint32_t symbol_head_v[(UCHAR_MAX + 1) / 32];
+    // strlen() of each flag name, same index as conf.ptr
+    size_t *name_len_v;
+    size_t name_max_len;
+    // the assigner and delimiter search, the best one of the CPU
+    ArgpxSearchFn search_fn;
+    struct FlagLinear_ linear;
+    // the conf_idx_v of the linear index, but sorted by name in the ARGPX_ATTR_ABBREVIATION groups
+    // NULL: no group has the attribute
+    int *sorted_idx_v;
+    // only available if use_hash is true
+    struct FlagTable_ conf_table;
+    // one trie for each group, same index as style.group_v
+    // only the composable groups have it, and only if use_hash is true
+    struct FlagTrie_ *trie_v;
+    // made at build time, it replaces conf_table if not NULL
+    const struct ArgpxStaticIndex *static_index;
+    // one BK-tree for each group, same index as style.group_v. Only if use_suggest is true
+    struct ArgpxSuggestTree *suggest_v;
+    // the flags by .env_name, slot_v is NULL if no flag has one
+    struct FlagTable_ env_table;
+    // bit n set: some .env_name has length n(the longer ones use bit 63)
+    uint64_t env_len_mask;
+};
 
-    if (needle[0] == '\0')
-        return (char *)haystack;
-    if (haystack_len == 0)
-        return NULL;
+/*
+    Where the memory of a parse comes from. A NULL arena means the allocator.
+ */
+struct MemSource_ {
+    struct ArgpxArena *arena;
+    const struct ArgpxAllocator *allocator;
+    // counts the allocations if not NULL
+    struct ArgpxParseStats *stats;
+};
 
-    for (size_t i = 0; i < haystack_len; i++) {
-        if (haystack[i] != needle[0])
-            continue;
-        for (size_t j = 0; i + j < haystack_len; j++) {
-            if (haystack[i + j] != needle[j])
-                break;
-            if (needle[j + 1] == '\0')
-                return (char *)&haystack[i];
-        }
-    }
+/*
+    A parameter converted ahead by ArgpxParseParallel(), the action takes it instead of converting again.
+ */
+struct ParamReady_ {
+    int status;
+    union {
+        int int_v;
+        bool bool_v;
+        float float_v;
+        double double_v;
+    } value;
+};
 
-    return NULL;
-}
+/*
+    An unified data of this library.
+ */
+struct UnifiedData_ {
+    // the result structure must not be on the stack
+    struct ArgpxResult *res;
+    int arg_c;
+    char **arg_v;
+    // try to make it to record the last processed arg
+    int arg_idx;
+    const struct ArgpxParser *parser;
+    struct ArgpxParseOption opt;
+    struct MemSource_ mem;
+    // only for ArgpxParseFd(), arg_c and arg_v are not used then
+    struct ArgpxStream *stream;
+    const struct ArgpxFdSource *fd_source;
+    // only for ArgpxParseCommandLine()
+    struct ArgpxTokenizer *tokenizer;
+    // the command parameters of a stream are not stored, this is the count
+    int stream_param_c;
+    // the response files being read, the last one is the innermost, they come before the argv or stream
+    int response_depth;
+    struct ArgpxResponse response_v[ARGPX_RESPONSE_DEPTH_MAX];
+    // only for ArgpxParseParallel(), the parameter of the action being run if not NULL
+    const struct ParamReady_ *ready;
+    // don't look for the suggestions of an unknown flag
+    bool no_suggest;
+    // only for ArgpxParseEnv(), bit n set: conf.ptr[n] has been run
+    uint64_t *seen_v;
+};
 
 /*
     Grow 1 slot for given array. If batch alloc enabled, it will allocate many items at a time.
     Return the array base pointer.
 
-    return NULL: error
+    return NULL: error, the old array is untouched
  */
-static void *ArrGrowOneSlot_(void *base, size_t unit_size, unsigned int current_c, unsigned int batch)
+static void *ArrGrowOneSlot_(
+    const struct ArgpxAllocator *allocator, void *base, size_t unit_size, unsigned int current_c, unsigned int batch)
 {
     assert(unit_size > 0);
     assert(batch > 0);
 
     if (base == NULL) {
-        base = malloc(unit_size * batch);
+        base = ArgpxMemAlloc(allocator, unit_size * batch);
     } else if (current_c % batch == 0) {
         // is full
-        base = realloc(base, unit_size * (current_c + batch));
+        base = ArgpxMemRealloc(allocator, base, unit_size * current_c, unit_size * (current_c + batch));
     }
 
     if (base == NULL)
@@ -116,6 +251,37 @@ static void *ArrGrowOneSlot_(void *base, size_t unit_size, unsigned int current_
     return base;
 }
 
+/*
+    return NULL: error
+ */
+static void *MemAlloc_(const struct MemSource_ *mem, size_t size)
+{
+    assert(mem != NULL);
+
+    ARGPX_STATS_ADD(mem->stats, alloc_c, 1);
+    if (mem->arena != NULL)
+        return ArgpxArenaAlloc(mem->arena, size);
+    return ArgpxMemAlloc(mem->allocator, size);
+}
+
+/*
+    The old_size is needed by the arena.
+
+    return NULL: error, the old memory is untouched
+ */
+static void *MemRealloc_(const struct MemSource_ *mem, void *ptr, size_t old_size, size_t new_size)
+{
+    assert(mem != NULL);
+
+    if (ptr == NULL)
+        ARGPX_STATS_ADD(mem->stats, alloc_c, 1);
+    else
+        ARGPX_STATS_ADD(mem->stats, realloc_c, 1);
+    if (mem->arena != NULL)
+        return ArgpxArenaRealloc(mem->arena, ptr, old_size, new_size);
+    return ArgpxMemRealloc(mem->allocator, ptr, old_size, new_size);
+}
+
 /*
     Convert structure ArgpxResult's ArgpxStatus enum to string.
  */
@@ -148,6 +314,22 @@ char *ArgpxStatusString(const enum ArgpxStatus status)
         return "Flag gets insufficient parameters";
     case kArgpxStatusBizarreFormat:
         return "Bizarre format occurs";
+    case kArgpxStatusConvertMalformed:
+        return "Flag parameter can't be converted to the required type";
+    case kArgpxStatusConvertTrailing:
+        return "Flag parameter has trailing characters after the value";
+    case kArgpxStatusConvertOutOfRange:
+        return "Flag parameter is out of the type's range";
+    case kArgpxStatusIoError:
+        return "Failed to read the arguments";
+    case kArgpxStatusArgumentTooLong:
+        return "Argument doesn't fit in the buffer";
+    case kArgpxStatusResponseTooDeep:
+        return "Response files are nested too deep";
+    case kArgpxStatusUnclosedQuote:
+        return "Quote is not closed in the command line or a response file";
+    case kArgpxStatusAmbiguousFlag:
+        return "Flag name is the start of more than one flag";
     default:
         return "[Status code not recorded]";
     }
@@ -166,9 +348,11 @@ int ArgpxGroupAppend(struct ArgpxStyle *style, const struct ArgpxGroup *new)
     assert(style != NULL);
     assert(new != NULL);
 
-    style->group_v = ArrGrowOneSlot_(style->group_v, sizeof(struct ArgpxGroup), style->group_c, 3);
-    if (style->group_v == NULL)
+    struct ArgpxGroup *new_v
+        = ArrGrowOneSlot_(style->allocator, style->group_v, sizeof(struct ArgpxGroup), style->group_c, 3);
+    if (new_v == NULL)
         return -1;
+    style->group_v = new_v;
 
     style->group_c += 1;
     int new_idx = style->group_c - 1;
@@ -188,9 +372,11 @@ int ArgpxSymbolAppend(struct ArgpxStyle *style, const struct ArgpxSymbol *new)
     assert(style != NULL);
     assert(new != NULL);
 
-    style->symbol_v = ArrGrowOneSlot_(style->symbol_v, sizeof(struct ArgpxSymbol), style->symbol_c, 3);
-    if (style->symbol_v == NULL)
+    struct ArgpxSymbol *new_v
+        = ArrGrowOneSlot_(style->allocator, style->symbol_v, sizeof(struct ArgpxSymbol), style->symbol_c, 3);
+    if (new_v == NULL)
         return -1;
+    style->symbol_v = new_v;
 
     style->symbol_c += 1;
     int new_idx = style->symbol_c - 1;
@@ -203,8 +389,8 @@ void ArgpxStyleFree(struct ArgpxStyle *style)
 {
     assert(style != NULL);
 
-    free(style->group_v);
-    free(style->symbol_v);
+    ArgpxMemFree(style->allocator, style->group_v);
+    ArgpxMemFree(style->allocator, style->symbol_v);
 }
 
 /*
@@ -218,9 +404,10 @@ int ArgpxFlagAppend(struct ArgpxFlagSet *set, const struct ArgpxFlag *new)
     assert(set != NULL);
     assert(new != NULL);
 
-    set->ptr = ArrGrowOneSlot_(set->ptr, sizeof(struct ArgpxFlag), set->count, 16);
-    if (set->ptr == NULL)
+    struct ArgpxFlag *new_v = ArrGrowOneSlot_(set->allocator, set->ptr, sizeof(struct ArgpxFlag), set->count, 16);
+    if (new_v == NULL)
         return -1;
+    set->ptr = new_v;
 
     set->count += 1;
     int new_idx = set->count - 1;
@@ -233,131 +420,540 @@ void ArgpxFlagFree(struct ArgpxFlagSet *set)
 {
     assert(set != NULL);
 
-    free(set->ptr);
+    ArgpxMemFree(set->allocator, set->ptr);
 }
 
+/*
+    The param_v in an arena is not freed here, but the result is always ready for reuse_result after that.
+ */
 void ArgpxResultFree(struct ArgpxResult *res)
 {
     assert(res != NULL);
 
-    free(res->param_v);
+    if (res->arena == NULL)
+        ArgpxMemFree(res->allocator, res->param_v);
+    ArgpxResponseUnmapAll(&res->mapping);
+    res->param_v = NULL;
+    res->param_c = 0;
+    res->param_cap = 0;
+    res->arena = NULL;
+}
+
+static uint32_t FlagTableHash_(const char *name, size_t name_len, int group_idx)
+{
+    uint32_t hash;
+    hash = ArgpxHashFnv1aB32(name, name_len, ARGPX_HASH_FNV1A_32_INIT);
+    hash = ArgpxHashFnv1aB32(&group_idx, sizeof(group_idx), hash);
+
+    return hash;
+}
+
+static void FlagTableFree_(const struct ArgpxAllocator *allocator, struct FlagTable_ *table)
+{
+    assert(table != NULL);
+
+    ArgpxMemFree(allocator, table->slot_v);
 }
 
 /*
-    Call this function if root_used is true. Otherwise use root entry directly.
+    Initialize the incoming table, it's a single allocation.
+    The name_len_v is the name length of each flag in flagset, same as the one of struct ArgpxParser.
 
+    return the "table" parameter self.
     return NULL: error
  */
-static struct FlagTableUnit_ *FlagTableEnterUnit_(struct FlagTableUnit_ *unit)
+static struct FlagTable_ *FlagTableMake_(const struct ArgpxAllocator *allocator, const struct ArgpxFlagSet *flagset,
+    const size_t *name_len_v, struct FlagTable_ *table)
 {
-    assert(unit != NULL);
+    assert(flagset != NULL);
+    assert(name_len_v != NULL || flagset->count == 0);
+    assert(table != NULL);
 
-    while (true) {
-        if (unit->next != NULL) {
-            unit = unit->next;
+    // there is always at least one empty slot to stop the probing
+    size_t slot_c = 1;
+    while (slot_c * ARGPX_FLAG_TABLE_LOADFACTOR < flagset->count or slot_c <= flagset->count)
+        slot_c *= 2;
+
+    table->mask = slot_c - 1;
+    table->slot_v = ArgpxMemAlloc(allocator, sizeof(struct FlagTableSlot_) * slot_c);
+    if (table->slot_v == NULL)
+        return NULL;
+    memset(table->slot_v, 0, sizeof(struct FlagTableSlot_) * slot_c);
+
+    for (int i = 0; i < flagset->count; i++) {
+        struct ArgpxFlag *conf = &flagset->ptr[i];
+        uint32_t hash = FlagTableHash_(conf->name, name_len_v[i], conf->group_idx);
+
+        // the same name in the same group stays behind the first one, lookup won't reach it
+        size_t slot_idx = hash & table->mask;
+        while (table->slot_v[slot_idx].conf != NULL)
+            slot_idx = (slot_idx + 1) & table->mask;
+
+        table->slot_v[slot_idx] = (struct FlagTableSlot_){
+            .conf = conf,
+            .hash = hash,
+            .name_len = (uint32_t)name_len_v[i],
+        };
+    }
+
+    return table;
+}
+
+/*
+    The same kind of table for .env_name, it's only for ArgpxParseEnv(). The group doesn't matter here.
+    A flag without .env_name is left out, the same name again stays behind the first one.
+
+    return negative: error(memory error)
+ */
+static int EnvTableMake_(struct ArgpxParser *parser)
+{
+    assert(parser != NULL);
+
+    const struct ArgpxFlagSet *flagset = &parser->conf;
+    int env_c = 0;
+    for (int i = 0; i < flagset->count; i++)
+        env_c += flagset->ptr[i].env_name != NULL;
+    if (env_c == 0)
+        return 0;
+
+    size_t slot_c = 1;
+    while (slot_c * ARGPX_FLAG_TABLE_LOADFACTOR < env_c or slot_c <= (size_t)env_c)
+        slot_c *= 2;
+
+    struct FlagTable_ *table = &parser->env_table;
+    table->slot_v = ArgpxMemAlloc(parser->allocator, sizeof(struct FlagTableSlot_) * slot_c);
+    if (table->slot_v == NULL)
+        return -1;
+    table->mask = slot_c - 1;
+    memset(table->slot_v, 0, sizeof(struct FlagTableSlot_) * slot_c);
+
+    for (int i = 0; i < flagset->count; i++) {
+        struct ArgpxFlag *conf = &flagset->ptr[i];
+        if (conf->env_name == NULL)
             continue;
-        }
-        unit->next = malloc(sizeof(struct FlagTableUnit_));
-        if (unit->next == NULL)
+        size_t len = strlen(conf->env_name);
+        uint32_t hash = ArgpxHashFnv1aB32(conf->env_name, len, ARGPX_HASH_FNV1A_32_INIT);
+
+        size_t slot_idx = hash & table->mask;
+        while (table->slot_v[slot_idx].conf != NULL)
+            slot_idx = (slot_idx + 1) & table->mask;
+        table->slot_v[slot_idx] = (struct FlagTableSlot_){.conf = conf, .hash = hash, .name_len = (uint32_t)len};
+        parser->env_len_mask |= (uint64_t)1 << (len < 63 ? len : 63);
+    }
+
+    return 0;
+}
+
+/*
+    return NULL: no flag has this .env_name
+ */
+static struct ArgpxFlag *EnvTableFind_(const struct FlagTable_ *table, const char *name, size_t name_len)
+{
+    assert(table != NULL);
+    assert(name != NULL);
+
+    uint32_t hash = ArgpxHashFnv1aB32(name, name_len, ARGPX_HASH_FNV1A_32_INIT);
+    for (size_t slot_idx = hash & table->mask;; slot_idx = (slot_idx + 1) & table->mask) {
+        const struct FlagTableSlot_ *slot = &table->slot_v[slot_idx];
+        if (slot->conf == NULL)
             return NULL;
+        if (slot->hash == hash and slot->name_len == (uint32_t)name_len
+            and memcmp(slot->conf->env_name, name, name_len) == 0)
+            return slot->conf;
+    }
+}
+
+struct FlagTrieRecord_ {
+    const char *name;
+    size_t name_len;
+    int conf_idx;
+};
+
+/*
+    For qsort(). Sort by name, and keep the flag append order for the same name.
+ */
+static int FlagTrieRecordCompare_(const void *a_in, const void *b_in)
+{
+    const struct FlagTrieRecord_ *a = a_in;
+    const struct FlagTrieRecord_ *b = b_in;
+
+    size_t min_len = a->name_len < b->name_len ? a->name_len : b->name_len;
+    int ret = memcmp(a->name, b->name, min_len);
+    if (ret != 0)
+        return ret;
+    if (a->name_len != b->name_len)
+        return a->name_len < b->name_len ? -1 : 1;
+
+    return a->conf_idx - b->conf_idx;
+}
+
+/*
+    Build the node for the sorted records rec_v[lo, hi), they are all share the first "depth" bytes.
+    The node and edge arrays must already have enough room.
+
+    return the new node index.
+ */
+static int FlagTrieBuildNode_(struct FlagTrie_ *trie, struct ArgpxFlag *conf_v, const struct FlagTrieRecord_ *rec_v,
+    int lo, int hi, size_t depth)
+{
+    int node_idx = trie->node_c;
+    trie->node_c += 1;
+    struct FlagTrieNode_ *node = &trie->node_v[node_idx];
+    *node = (struct FlagTrieNode_){.conf = NULL};
+
+    // names end here are sorted in front, the first one wins
+    // an empty name can't be matched, so the root never has a conf
+    if (lo < hi and rec_v[lo].name_len == depth) {
+        if (depth > 0)
+            node->conf = &conf_v[rec_v[lo].conf_idx];
+        while (lo < hi and rec_v[lo].name_len == depth)
+            lo++;
+    }
 
-        return unit->next;
+    node->edge_start = trie->edge_c;
+    for (int i = lo; i < hi; i++) {
+        if (i == lo or rec_v[i].name[depth] != rec_v[i - 1].name[depth])
+            node->edge_c += 1;
+    }
+    trie->edge_c += node->edge_c;
+
+    int edge_idx = node->edge_start;
+    for (int run_lo = lo; run_lo < hi; edge_idx++) {
+        unsigned char byte = rec_v[run_lo].name[depth];
+        int run_hi = run_lo + 1;
+        while (run_hi < hi and (unsigned char)rec_v[run_hi].name[depth] == byte)
+            run_hi++;
+
+        trie->edge_byte_v[edge_idx] = byte;
+        trie->edge_child_v[edge_idx] = FlagTrieBuildNode_(trie, conf_v, rec_v, run_lo, run_hi, depth + 1);
+        run_lo = run_hi;
     }
+
+    return node_idx;
 }
 
 /*
-    Initialize the incoming table. That should be on the stack.
+    Build the trie of all flags in a group.
 
-    return the "table" parameter self.
-    return NULL: error
+    return negative: error(memory error)
  */
-static struct FlagTable_ *FlagTableMake_(
-    struct ArgpxStyle *style, struct ArgpxFlagSet *flagset, struct FlagTable_ *table)
+static int FlagTrieMake_(const struct ArgpxAllocator *allocator, const struct ArgpxFlagSet *flagset,
+    const size_t *name_len_v, int group_idx, struct FlagTrie_ *trie)
 {
-    assert(style != NULL);
     assert(flagset != NULL);
-    assert(table != NULL);
+    assert(name_len_v != NULL || flagset->count == 0);
+    assert(trie != NULL);
 
-    table->count = flagset->count / ARGPX_FLAG_TABLE_LOADFACTOR;
-    table->array = malloc(sizeof(struct FlagTableUnit_) * table->count);
-    if (table == NULL) {
-        return NULL;
+    int rec_c = 0;
+    size_t byte_c = 0;
+    for (int i = 0; i < flagset->count; i++) {
+        if (flagset->ptr[i].group_idx != group_idx)
+            continue;
+        rec_c += 1;
+        byte_c += name_len_v[i];
     }
 
-    for (int i = 0; i < table->count; i++) {
-        table->array[i] = (struct FlagTableUnit_){.root_used = false};
+    struct FlagTrieRecord_ *rec_v = ArgpxMemAlloc(allocator, sizeof(struct FlagTrieRecord_) * (rec_c > 0 ? rec_c : 1));
+    if (rec_v == NULL)
+        return -1;
+    rec_c = 0;
+    for (int i = 0; i < flagset->count; i++) {
+        if (flagset->ptr[i].group_idx != group_idx)
+            continue;
+        rec_v[rec_c] = (struct FlagTrieRecord_){.name = flagset->ptr[i].name, .name_len = name_len_v[i], .conf_idx = i};
+        rec_c += 1;
     }
+    qsort(rec_v, rec_c, sizeof(struct FlagTrieRecord_), FlagTrieRecordCompare_);
 
-    // init finished
+    // every name byte makes at most one node and one edge, plus the root
+    size_t node_max = byte_c + 1;
+    trie->node_v = ArgpxMemAlloc(allocator, (sizeof(struct FlagTrieNode_) + sizeof(int) + 1) * node_max);
+    if (trie->node_v == NULL) {
+        ArgpxMemFree(allocator, rec_v);
+        return -1;
+    }
+    trie->edge_child_v = (int *)(trie->node_v + node_max);
+    trie->edge_byte_v = (unsigned char *)(trie->edge_child_v + node_max);
+    trie->node_c = 0;
+    trie->edge_c = 0;
 
-    for (int i = 0; i < flagset->count; i++) {
-        struct ArgpxFlag *conf = &flagset->ptr[i];
+    FlagTrieBuildNode_(trie, flagset->ptr, rec_v, 0, rec_c, 0);
 
-        uint32_t name_hash;
-        name_hash = ArgpxHashFnv1aB32(conf->name, strlen(conf->name), ARGPX_HASH_FNV1A_32_INIT);
-        name_hash = ArgpxHashFnv1aB32(&conf->group_idx, sizeof(conf->group_idx), name_hash);
-        struct FlagTableUnit_ *unit = table->array + name_hash % table->count;
+    ArgpxMemFree(allocator, rec_v);
+    return 0;
+}
 
-        if (unit->root_used == true) {
-            unit = FlagTableEnterUnit_(unit);
-            if (unit == NULL) {
-                free(table->array);
-                return NULL;
-            }
-        }
+static void FlagTrieFree_(const struct ArgpxAllocator *allocator, struct FlagTrie_ *trie)
+{
+    assert(trie != NULL);
+
+    if (trie->node_c > 0)
+        ArgpxMemFree(allocator, trie->node_v);
+}
+
+/*
+    The first 8 bytes of a name, byte k at bits [8k, 8k + 8), so it's the same on any byte order.
+    It stops at len or a \0, the rest is zero.
+ */
+static uint64_t FlagNameHead_(const char *name, size_t len)
+{
+    uint64_t head = 0;
+    for (size_t i = 0; i < len and i < 8 and name[i] != '\0'; i++)
+        head |= (uint64_t)(unsigned char)name[i] << (i * 8);
+    return head;
+}
+
+/*
+    The last 8 bytes of a name in the same way, or the head if it's shorter.
+ */
+static uint64_t FlagNameTail_(const char *name, size_t len)
+{
+    return len < 8 ? FlagNameHead_(name, len) : FlagNameHead_(name + len - 8, 8);
+}
+
+/*
+    Build the linear index of all groups.
+
+    return negative: error(memory error)
+ */
+static int FlagLinearMake_(const struct ArgpxAllocator *allocator, const struct ArgpxFlagSet *flagset,
+    const size_t *name_len_v, int group_c, struct FlagLinear_ *linear)
+{
+    assert(flagset != NULL);
+    assert(name_len_v != NULL || flagset->count == 0);
+    assert(linear != NULL);
+
+    int flag_c = flagset->count;
+    // the 8 byte arrays first, the others need less alignment
+    size_t size = (sizeof(uint64_t) * 2 + sizeof(uint32_t) + sizeof(int)) * flag_c + sizeof(int) * (group_c + 1);
+    linear->head_v = ArgpxMemAlloc(allocator, size);
+    if (linear->head_v == NULL)
+        return -1;
+    linear->tail_v = linear->head_v + flag_c;
+    linear->name_len_v = (uint32_t *)(linear->tail_v + flag_c);
+    linear->conf_idx_v = (int *)(linear->name_len_v + flag_c);
+    linear->group_start_v = linear->conf_idx_v + flag_c;
+
+    // a counting sort by the group, it keeps the append order in a group
+    // a flag of no group is left out, it can't be matched anyway
+    int *start_v = linear->group_start_v;
+    memset(start_v, 0, sizeof(int) * (group_c + 1));
+    for (int i = 0; i < flag_c; i++) {
+        int group_idx = flagset->ptr[i].group_idx;
+        if (group_idx >= 0 and group_idx < group_c)
+            start_v[group_idx + 1] += 1;
+    }
+    for (int g = 0; g < group_c; g++)
+        start_v[g + 1] += start_v[g];
 
-        *unit = (struct FlagTableUnit_){.root_used = true, .conf = conf, .next = NULL};
+    // start_v[g] is the fill cursor of group g, it ends at the start of g + 1
+    for (int i = 0; i < flag_c; i++) {
+        int group_idx = flagset->ptr[i].group_idx;
+        if (group_idx < 0 or group_idx >= group_c)
+            continue;
+        int pos = start_v[group_idx]++;
+        linear->conf_idx_v[pos] = i;
+        linear->head_v[pos] = FlagNameHead_(flagset->ptr[i].name, name_len_v[i]);
+        linear->tail_v[pos] = FlagNameTail_(flagset->ptr[i].name, name_len_v[i]);
+        linear->name_len_v[pos] = (uint32_t)name_len_v[i];
     }
+    for (int g = group_c; g > 0; g--)
+        start_v[g] = start_v[g - 1];
+    start_v[0] = 0;
 
-    return table;
+    return 0;
+}
+
+static void FlagLinearFree_(const struct ArgpxAllocator *allocator, struct FlagLinear_ *linear)
+{
+    assert(linear != NULL);
+
+    ArgpxMemFree(allocator, linear->head_v);
+}
+
+/*
+    Sort the flags of each ARGPX_ATTR_ABBREVIATION group by name, in the same ranges as the linear index.
+    The other groups are left in the append order, they're never searched.
+
+    return negative: error(memory error)
+ */
+static int FlagSortedMake_(struct ArgpxParser *parser)
+{
+    assert(parser != NULL);
+
+    const struct ArgpxStyle *style = &parser->style;
+    const int *start_v = parser->linear.group_start_v;
+    bool any = false;
+    for (int g = 0; g < style->group_c; g++) {
+        if ((style->group_v[g].attribute & ARGPX_ATTR_ABBREVIATION) != 0 and start_v[g] < start_v[g + 1])
+            any = true;
+    }
+    if (any == false)
+        return 0;
+
+    int flag_c = start_v[style->group_c];
+    parser->sorted_idx_v = ArgpxMemAlloc(parser->allocator, sizeof(int) * flag_c);
+    struct FlagTrieRecord_ *rec_v = ArgpxMemAlloc(parser->allocator, sizeof(struct FlagTrieRecord_) * flag_c);
+    if (parser->sorted_idx_v == NULL or rec_v == NULL) {
+        ArgpxMemFree(parser->allocator, rec_v);
+        return -1;
+    }
+    memcpy(parser->sorted_idx_v, parser->linear.conf_idx_v, sizeof(int) * flag_c);
+
+    for (int g = 0; g < style->group_c; g++) {
+        if ((style->group_v[g].attribute & ARGPX_ATTR_ABBREVIATION) == 0)
+            continue;
+        int *idx_v = &parser->sorted_idx_v[start_v[g]];
+        int rec_c = start_v[g + 1] - start_v[g];
+        for (int i = 0; i < rec_c; i++) {
+            const struct ArgpxFlag *conf = &parser->conf.ptr[idx_v[i]];
+            rec_v[i] = (struct FlagTrieRecord_){
+                .name = conf->name, .name_len = parser->name_len_v[idx_v[i]], .conf_idx = idx_v[i]};
+        }
+        qsort(rec_v, rec_c, sizeof(struct FlagTrieRecord_), FlagTrieRecordCompare_);
+        for (int i = 0; i < rec_c; i++)
+            idx_v[i] = rec_v[i].conf_idx;
+    }
+
+    ArgpxMemFree(parser->allocator, rec_v);
+    return 0;
 }
 
 /*
-    Call this function, if "unit->next" linked list is exist.
+    Walk the trie along name_start.
+    Like MatchConfLinear_(), set max_name_len to 0 to stop at the \0 only.
+    The names on the path are all prefixes of name_start, the first appended one wins, the same as the linear index.
 
-    Note: it won't free up the parameter "unit", that's managed by table.array.
-    Note: this function won't check .used element of root unit.
+    return NULL: no flag name is a prefix of name_start
  */
-static void FlagTableFreeRecursiveUnit_(struct FlagTableUnit_ *unit)
+static struct ArgpxFlag *FlagTrieMatch_(const struct FlagTrie_ *trie, const char *name_start, size_t max_name_len)
 {
-    assert(unit != NULL);
+    assert(trie != NULL);
+    assert(trie->node_c > 0);
+    assert(name_start != NULL);
+
+    // all in the same flag array, so the lower address is the earlier one
+    struct ArgpxFlag *first_conf = NULL;
+    const struct FlagTrieNode_ *node = &trie->node_v[0];
+    for (size_t depth = 0; max_name_len == 0 ? name_start[depth] != '\0' : depth < max_name_len; depth++) {
+        unsigned char byte = name_start[depth];
+
+        // binary search in the sorted edges
+        int lo = node->edge_start;
+        int hi = node->edge_start + node->edge_c;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (trie->edge_byte_v[mid] < byte)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if (lo >= node->edge_start + node->edge_c or trie->edge_byte_v[lo] != byte)
+            break;
+
+        node = &trie->node_v[trie->edge_child_v[lo]];
+        if (node->conf != NULL and (first_conf == NULL or node->conf < first_conf))
+            first_conf = node->conf;
+    }
 
-    unit = unit->next;
-    do {
-        struct FlagTableUnit_ *ahead_unit = unit->next;
-        free(unit);
-        unit = ahead_unit;
-    } while (unit != NULL);
+    return first_conf;
 }
 
-static void FlagTableFree_(struct FlagTable_ *table)
+/*
+    Get the next argument from the innermost response file, then the stream, the command line or the argv.
+    arg_idx only counts the arguments of the stream, the command line or the argv, the tokens of response files are
+    not in it.
+    If keep_current is true, the last argument must stay valid(a stream may overwrite it otherwise).
+
+    return NULL: no more arguments, or a response file is broken and status is set
+ */
+static char *NextArgument_(struct UnifiedData_ *data, bool keep_current)
 {
-    assert(table != NULL);
+    assert(data != NULL);
+
+    while (data->response_depth > 0) {
+        struct ArgpxResponse *rsp = &data->response_v[data->response_depth - 1];
+        char *token = ArgpxResponseNext(rsp);
+        if (token != NULL)
+            return token;
+        // it stays on the stack, so the rest of the parse gets nothing too
+        if (rsp->status != kArgpxStatusSuccess) {
+            data->res->status = rsp->status;
+            return NULL;
+        }
+        // the file stays mapped, some outputs may point into it
+        data->response_depth -= 1;
+    }
+
+    if (data->tokenizer != NULL) {
+        char *arg = ArgpxTokenizerNext(data->tokenizer);
+        if (arg != NULL)
+            data->arg_idx += 1;
+        return arg;
+    }
 
-    for (int i = 0; i < table->count; i++) {
-        struct FlagTableUnit_ *unit = &table->array[i];
-        if (unit->root_used == true and unit->next != NULL)
-            FlagTableFreeRecursiveUnit_(unit);
+    if (data->stream != NULL) {
+        char *arg = ArgpxStreamNext(data->stream, keep_current);
+        if (arg != NULL)
+            data->arg_idx += 1;
+        return arg;
     }
-    free(table->array);
+
+    if (data->arg_idx + 1 >= data->arg_c)
+        return NULL;
+    data->arg_idx += 1;
+    return data->arg_v[data->arg_idx];
 }
 
 /*
     Using the offset shift arguments, it will be safe.
     Return a pointer to the new argument.
 
-    return NULL: error
+    return NULL: error and set status
  */
 static char *ShiftArguments_(struct UnifiedData_ *data, const int offset)
 {
     assert(data != NULL);
     assert(offset > 0);
 
-    if (data->arg_idx + offset >= data->arg_c)
-        return NULL;
-    data->arg_idx += offset;
+    char *arg = NULL;
+    for (int i = 0; i < offset; i++) {
+        arg = NextArgument_(data, true);
+        if (arg == NULL) {
+            // a broken response file has set it already
+            if (data->res->status == kArgpxStatusSuccess)
+                data->res->status = kArgpxStatusParamInsufficient;
+            return NULL;
+        }
+        ARGPX_STATS_ADD(data->opt.stats, arg_c, 1);
+    }
 
-    return data->arg_v[data->arg_idx];
+    return arg;
+}
+
+/*
+    Map a response file, its tokens are the next arguments.
+
+    return negative: error and set status
+ */
+static int ResponseFilePush_(struct UnifiedData_ *data, const char *path)
+{
+    assert(data != NULL);
+    assert(path != NULL);
+
+    if (data->response_depth >= ARGPX_RESPONSE_DEPTH_MAX) {
+        data->res->status = kArgpxStatusResponseTooDeep;
+        return -1;
+    }
+
+    int status = ArgpxResponseOpen(&data->response_v[data->response_depth], path, &data->res->mapping);
+    if (status != kArgpxStatusSuccess) {
+        data->res->status = status;
+        return -1;
+    }
+    data->response_depth += 1;
+
+    return 0;
 }
 
 /*
@@ -374,10 +970,26 @@ static int AppendCommandParameter_(struct UnifiedData_ *data, char *str)
     assert(str != NULL);
     struct ArgpxResult *res = data->res;
 
-    res->param_v = ArrGrowOneSlot_(res->param_v, sizeof(char *), res->param_c, 3);
-    if (res->param_v == NULL) {
-        res->status = kArgpxStatusMemoryError;
-        return -1;
+    // the string of a stream will be overwritten, so the caller gets it right now
+    if (data->stream != NULL) {
+        if (data->fd_source->param_fn != NULL)
+            data->fd_source->param_fn(data->fd_source->param_ctx, str);
+        data->stream_param_c += 1;
+        if (data->opt.max_cmdparam != 0 and data->stream_param_c >= data->opt.max_cmdparam)
+            return -2;
+        return 0;
+    }
+
+    if (res->param_c >= res->param_cap) {
+        int new_cap = res->param_cap > 0 ? res->param_cap * 2 : 8;
+        char **new_v = MemRealloc_(
+            &data->mem, res->param_v, sizeof(char *) * res->param_cap, sizeof(char *) * new_cap);
+        if (new_v == NULL) {
+            res->status = kArgpxStatusMemoryError;
+            return -1;
+        }
+        res->param_v = new_v;
+        res->param_cap = new_cap;
     }
     res->param_c += 1;
 
@@ -391,6 +1003,8 @@ static int AppendCommandParameter_(struct UnifiedData_ *data, char *str)
 }
 
 /*
+    The whole string must be one of the words.
+
     return:
         < 0 == Error
         0 == false
@@ -414,12 +1028,12 @@ static int StringIsBool_(const char *string, const size_t length)
     };
 
     for (int i = 0; i < sizeof(true_list) / sizeof(char *); i++) {
-        if (strncmp(string, true_list[i], length) == 0)
+        if (strlen(true_list[i]) == length and memcmp(string, true_list[i], length) == 0)
             return true;
     }
 
     for (int i = 0; i < sizeof(false_list) / sizeof(char *); i++) {
-        if (strncmp(string, false_list[i], length) == 0)
+        if (strlen(false_list[i]) == length and memcmp(string, false_list[i], length) == 0)
             return false;
     }
 
@@ -427,54 +1041,174 @@ static int StringIsBool_(const char *string, const size_t length)
 }
 
 /*
-    Converting a string to a specific type.
-    And assign it to a pointer.
-
-    The "max_len" is similar to strncmp()'s "n"
-
-    return negative: error
+    return the value of a digit in any base up to 36, or -1.
  */
-static int StringToType_(const char *source_str, const size_t max_len, const enum ArgpxVarType type, void *ptr)
+static int DigitValue_(const char c)
 {
-    assert(source_str != NULL);
+    if (c >= '0' and c <= '9')
+        return c - '0';
+    if (c >= 'a' and c <= 'z')
+        return c - 'a' + 10;
+    if (c >= 'A' and c <= 'Z')
+        return c - 'A' + 10;
+    return -1;
+}
+
+/*
+    Like strtoimax(str, NULL, 0), but the string is bounded by len and the result is an int.
+    The "0x" and "0" prefixes select hex and octal. Leading space is not allowed.
+
+    return ArgpxStatus code.
+ */
+static int StringToInt_(const char *str, const size_t len, int *out)
+{
+    assert(str != NULL);
+    assert(out != NULL);
+
+    size_t i = 0;
+    bool negative = false;
+    if (i < len and (str[i] == '+' or str[i] == '-')) {
+        negative = str[i] == '-';
+        i++;
+    }
+
+    int base = 10;
+    if (i + 1 < len and str[i] == '0' and (str[i + 1] == 'x' or str[i + 1] == 'X')) {
+        base = 16;
+        i += 2;
+    } else if (i < len and str[i] == '0') {
+        base = 8;
+    }
+
+    uintmax_t limit = negative == true ? (uintmax_t)INT_MAX + 1 : (uintmax_t)INT_MAX;
+    uintmax_t value = 0;
+    bool overflow = false;
+    size_t digit_start = i;
+    for (; i < len; i++) {
+        int digit = DigitValue_(str[i]);
+        if (digit < 0 or digit >= base)
+            break;
+        if (value > (limit - digit) / base)
+            overflow = true;
+        else
+            value = value * base + digit;
+    }
+
+    if (i == digit_start)
+        return kArgpxStatusConvertMalformed;
+    if (i != len)
+        return kArgpxStatusConvertTrailing;
+    if (overflow == true)
+        return kArgpxStatusConvertOutOfRange;
+
+    *out = negative == true ? (int)-(intmax_t)value : (int)value;
+    return kArgpxStatusSuccess;
+}
+
+/*
+    A float literal shorter than this is copied, see StringToFloating_()
+ */
+#define ARGPX_CONVERT_BUFFER_SIZE 64
+
+/*
+    Convert to float or double with strtof()/strtod(), without any heap memory.
+    The span is copied to a stack buffer to get the \0. A longer one is converted in place, strtod() stops at the end
+    of the longest literal, so if that's the end of the span, it's the same literal as the span alone.
+
+    return ArgpxStatus code.
+ */
+static int StringToFloating_(const char *str, const size_t len, const enum ArgpxVarType type, void *ptr)
+{
+    assert(str != NULL);
     assert(ptr != NULL);
-    if (max_len == 0)
-        return -1;
+    assert(type == kArgpxVarFloat or type == kArgpxVarDouble);
+
+    // strtod() skips them, but StringToInt_() doesn't
+    if (len == 0 or isspace((unsigned char)str[0]))
+        return kArgpxStatusConvertMalformed;
+
+    char buf[ARGPX_CONVERT_BUFFER_SIZE];
+    const char *value_str;
+    if (len < sizeof(buf)) {
+        memcpy(buf, str, len);
+        buf[len] = '\0';
+        value_str = buf;
+    } else {
+        value_str = str;
+    }
+
+    // the output is only touched on success
+    char *end;
+    float value_float = 0;
+    double value_double = 0;
+    errno = 0;
+    if (type == kArgpxVarFloat)
+        value_float = strtof(value_str, &end);
+    else
+        value_double = strtod(value_str, &end);
+
+    if (end == value_str)
+        return kArgpxStatusConvertMalformed;
+    if (end < value_str + len)
+        return kArgpxStatusConvertTrailing;
+    // in place only, the literal goes on after the span(like "1e5" of "1" + "e5"), it's too long to tell them apart
+    if (end > value_str + len or errno == ERANGE)
+        return kArgpxStatusConvertOutOfRange;
+
+    if (type == kArgpxVarFloat)
+        *(float *)ptr = value_float;
+    else
+        *(double *)ptr = value_double;
+    return kArgpxStatusSuccess;
+}
+
+/*
+    Converting a string to a specific type.
+    And assign it to a pointer.
 
-    // prepare a separate string
-    size_t str_size = strlen(source_str);
-    // chose the smallest one
-    if (max_len < str_size)
-        str_size = max_len;
-    str_size += 1;
+    The "len" is the exact length of the value, source_str don't need a \0 there.
+    Only kArgpxVarString allocates memory from "mem", it's the output itself.
 
-    // allocate a new string
-    char *value_str = malloc(str_size);
-    memcpy(value_str, source_str, str_size);
-    value_str[str_size - 1] = '\0'; // actual_len is the last index of this string
+    return ArgpxStatus code.
+ */
+static int StringToType_(
+    const struct MemSource_ *mem, const char *source_str, const size_t len, const enum ArgpxVarType type, void *ptr)
+{
+    assert(mem != NULL);
+    assert(source_str != NULL);
+    assert(ptr != NULL);
+    if (len == 0)
+        return kArgpxStatusParamInsufficient;
 
     // remember to change the first level pointer, but not just change secondary one
-    // if can, the value_str needs to free up
     switch (type) {
-    case kArgpxVarString:
+    case kArgpxVarString: {
+        char *value_str = MemAlloc_(mem, len + 1);
+        if (value_str == NULL)
+            return kArgpxStatusMemoryError;
+        memcpy(value_str, source_str, len);
+        value_str[len] = '\0';
         *(char **)ptr = value_str;
-        return 0; // dont't free up
+        return kArgpxStatusSuccess;
+    }
+    case kArgpxVarStringView:
+        *(struct ArgpxStringView *)ptr = (struct ArgpxStringView){.ptr = source_str, .len = len};
+        return kArgpxStatusSuccess;
     case kArgpxVarInt:
-        *(int *)ptr = strtoimax(value_str, NULL, 0);
-        break;
-    case kArgpxVarBool:
-        *(bool *)ptr = StringIsBool_(value_str, strlen(value_str));
-        break;
+        return StringToInt_(source_str, len, ptr);
+    case kArgpxVarBool: {
+        int value = StringIsBool_(source_str, len);
+        if (value < 0)
+            return kArgpxStatusConvertMalformed;
+        *(bool *)ptr = value;
+        return kArgpxStatusSuccess;
+    }
     case kArgpxVarFloat:
-        *(float *)ptr = strtof(value_str, NULL);
-        break;
     case kArgpxVarDouble:
-        *(double *)ptr = strtod(value_str, NULL);
-        break;
+        return StringToFloating_(source_str, len, type, ptr);
     }
 
-    free(value_str);
-    return 0;
+    return kArgpxStatusFailure;
 }
 
 static size_t TypeToSize_(const enum ArgpxVarType type)
@@ -490,7 +1224,40 @@ static size_t TypeToSize_(const enum ArgpxVarType type)
         return sizeof(float);
     case kArgpxVarDouble:
         return sizeof(double);
+    case kArgpxVarStringView:
+        return sizeof(struct ArgpxStringView);
+    }
+
+    return 0; // make compiler happy
+}
+
+/*
+    Find the single parameter of a flag.
+    If *param_len is 0 then no limit.
+    If *param_start is NULL, shift to the next argument.
+
+    return negative: error and set status
+ */
+static int ParamSingleSpan_(struct UnifiedData_ *data, char **param_start, size_t *param_len)
+{
+    assert(data != NULL);
+    assert(param_start != NULL);
+    assert(param_len != NULL);
+
+    if (*param_start == NULL)
+        *param_start = ShiftArguments_(data, 1);
+    if (*param_start == NULL)
+        return -1;
+
+    if (*param_len == 0)
+        *param_len = strlen(*param_start);
+
+    if (*param_len == 0) {
+        data->res->status = kArgpxStatusParamInsufficient;
+        return -1;
     }
+
+    return 0;
 }
 
 /*
@@ -506,30 +1273,28 @@ static int ActionParamSingle_(
     assert(conf != NULL);
 
     struct ArgpxOutParamSingle *unit = &conf->action_load.param_single;
+    unit->allocator = data->mem.allocator;
     if (ondemand == true)
-        unit->var_ptr = malloc(TypeToSize_(unit->type));
+        unit->var_ptr = MemAlloc_(&data->mem, TypeToSize_(unit->type));
     if (unit->var_ptr == NULL) {
         data->res->status = kArgpxStatusMemoryError;
         return -1;
     }
 
-    if (param_start == NULL)
-        param_start = ShiftArguments_(data, 1);
-    if (param_start == NULL) {
-        data->res->status = kArgpxStatusParamInsufficient;
+    if (ParamSingleSpan_(data, &param_start, &param_len) < 0)
         return -1;
-    }
 
-    if (param_len == 0)
-        param_len = strlen(param_start);
-
-    if (param_len == 0) {
-        data->res->status = kArgpxStatusParamInsufficient;
-        return -1;
+    ARGPX_STATS_ADD(data->opt.stats, convert_c, 1);
+    int status;
+    if (data->ready != NULL) {
+        status = data->ready->status;
+        if (status == kArgpxStatusSuccess)
+            memcpy(unit->var_ptr, &data->ready->value, TypeToSize_(unit->type));
+    } else {
+        status = StringToType_(&data->mem, param_start, param_len, unit->type, unit->var_ptr);
     }
-
-    if (StringToType_(param_start, param_len, unit->type, unit->var_ptr) < 0) {
-        data->res->status = kArgpxStatusFailure;
+    if (status != kArgpxStatusSuccess) {
+        data->res->status = status;
         return -1;
     }
 
@@ -540,95 +1305,205 @@ void ArgpxOutParamSingleFree(struct ArgpxOutParamSingle *out)
 {
     assert(out != NULL);
 
-    free(out->var_ptr);
+    ArgpxMemFree(out->allocator, out->var_ptr);
 }
 
 /*
-    Append a new item into a ParamList action. It can only be attached to the tail.
-    The last_idx acts as both the counter(index + 1) and new item index.
+    Only keep the parameter, a later one of the same flag just replaces it.
 
-    If batch alloc enabled, allocate 3 slots of the list at a time.
+    return negative: error and set status
+ */
+static int ActionParamLazy_(struct UnifiedData_ *data, struct ArgpxFlag *conf, char *param_start, size_t param_len)
+{
+    assert(data != NULL);
+    assert(conf != NULL);
 
-    return negative: error(memory error)
+    if (ParamSingleSpan_(data, &param_start, &param_len) < 0)
+        return -1;
+
+    struct ArgpxOutParamLazy *lazy = &conf->action_load.param_lazy;
+    // a stream reuses its buffer, the raw string won't be there for ArgpxOutParamLazyGet(), so convert it now
+    if (data->stream != NULL)
+        ArgpxOutParamLazyFree(lazy);
+    lazy->raw = (struct ArgpxStringView){.ptr = param_start, .len = param_len};
+    lazy->converted = false;
+    lazy->allocator = data->mem.allocator;
+    lazy->arena = data->mem.arena;
+    if (data->stream != NULL) {
+        // the same as ArgpxOutParamLazyGet(), but the stats of the parse see the allocation
+        assert(lazy->var_ptr != NULL);
+        int status = StringToType_(&data->mem, param_start, param_len, lazy->type, lazy->var_ptr);
+        if (status != kArgpxStatusSuccess) {
+            data->res->status = status;
+            return -1;
+        }
+        lazy->converted = true;
+    }
+    return 0;
+}
+
+/*
+    Convert the parameter of a ParamLazy flag to its variable, only the first call does it.
+    The raw string must still be alive, see struct ArgpxOutParamLazy.
+    A kArgpxVarString comes from the arena of the parse(it must be still alive), or its allocator. Free it by
+    ArgpxOutParamLazyFree(), it's nothing for the arena.
+
+    return ArgpxStatus code, kArgpxStatusSuccess and nothing is written if the flag isn't given
  */
-static int ParamListAppend_(struct ArgpxOutParamList *out, const int last_idx, const char *str, const size_t str_len)
+int ArgpxOutParamLazyGet(struct ArgpxOutParamLazy *out)
 {
     assert(out != NULL);
-    assert(last_idx >= 0);
-    assert(str != NULL);
-    if (str_len == 0)
-        return -1;
 
-    out->out_count = last_idx + 1;
+    if (out->converted == true or out->raw.ptr == NULL)
+        return kArgpxStatusSuccess;
+    assert(out->var_ptr != NULL);
 
-    out->out_list = ArrGrowOneSlot_(out->out_list, sizeof(char *), out->out_count, 3);
-    if (out->out_list == NULL)
-        return -1;
+    const struct MemSource_ mem = {.arena = out->arena, .allocator = out->allocator, .stats = NULL};
+    int status = StringToType_(&mem, out->raw.ptr, out->raw.len, out->type, out->var_ptr);
+    if (status != kArgpxStatusSuccess)
+        return status;
 
-    char *new_str = malloc(sizeof(char) * str_len + 1);
-    if (new_str == NULL)
-        return -1;
+    out->converted = true;
+    return kArgpxStatusSuccess;
+}
+
+/*
+    Free the kArgpxVarString made by ArgpxOutParamLazyGet(), the next call converts it again.
+ */
+void ArgpxOutParamLazyFree(struct ArgpxOutParamLazy *out)
+{
+    assert(out != NULL);
 
-    memcpy(new_str, str, str_len);
-    new_str[str_len] = '\0';
+    if (out->converted == true and out->type == kArgpxVarString and out->arena == NULL)
+        ArgpxMemFree(out->allocator, *(char **)out->var_ptr);
+    out->converted = false;
+}
 
-    out->out_list[last_idx] = new_str;
+/*
+    Split a ParamList parameter by the group delimiter into out_v.
+    If out_v is NULL, just count the pieces. So the caller can count first, and then allocate the output at once.
+    The max is the same as struct ArgpxOutParamList.
 
-    return 0;
+    return the count of pieces.
+    return negative: error and set status
+ */
+static int ParamListSplit_(struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp, const char *param,
+    size_t param_len, int max, struct ArgpxStringView *out_v)
+{
+    assert(data != NULL);
+    assert(grp != NULL);
+    assert(param != NULL);
+
+    // the delimiters are found a chunk at a time, not once for each piece
+    const char *hit_v[ARGPX_SEARCH_CHUNK];
+    size_t hit_c = 0;
+    size_t hit_idx = 0;
+    bool hit_more = grp->delimiter_toggle;
+
+    int count = 0;
+    while (param_len > 0) {
+        if (max > 0 and count + 1 > max) {
+            data->res->status = kArgpxStatusParamExcess;
+            return -1;
+        }
+
+        if (hit_idx == hit_c and hit_more == true) {
+            hit_c = data->parser->search_fn(
+                param, param_len, grp->item.delimiter, grp->delimiter_len, hit_v, ARGPX_SEARCH_CHUNK);
+            hit_idx = 0;
+            hit_more = hit_c == ARGPX_SEARCH_CHUNK;
+        }
+        const char *delimiter_ptr = hit_idx < hit_c ? hit_v[hit_idx++] : NULL;
+
+        size_t piece_len = delimiter_ptr == NULL ? param_len : (size_t)(delimiter_ptr - param);
+        if (grp->delimiter_toggle == true)
+            ARGPX_STATS_ADD(data->opt.stats, scan_byte_c,
+                delimiter_ptr == NULL ? param_len : piece_len + grp->delimiter_len);
+        // delimiter shouldn't exist at the last parameter's tail, and the piece can't be empty
+        if (piece_len == 0 or (delimiter_ptr != NULL and piece_len + grp->delimiter_len >= param_len)) {
+            data->res->status = kArgpxStatusBizarreFormat;
+            return -1;
+        }
+
+        if (out_v != NULL)
+            out_v[count] = (struct ArgpxStringView){.ptr = param, .len = piece_len};
+        count += 1;
+
+        // the last piece has no delimiter, then no next loop
+        size_t used_len = delimiter_ptr == NULL ? piece_len : piece_len + grp->delimiter_len;
+        param_len -= used_len;
+        param += used_len;
+    }
+
+    return count;
 }
 
 /*
+    If param_start_ptr is NULL, shift to the next argument.
     If max_param_len == 0 then no limit.
 
+    The ParamList output copies every piece, the ParamListView one only points to them.
+    Either way, the list array is allocated once.
+
     return negative: error and set status
  */
-static int ActionParamList_(struct UnifiedData_ *data, struct UnifiedGroupCache_ *grp, struct ArgpxFlag *conf,
+static int ActionParamList_(struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp, struct ArgpxFlag *conf,
     char *param_start_ptr, size_t max_param_len)
 {
     assert(data != NULL);
     assert(grp != NULL);
     assert(conf != NULL);
-    assert(param_start_ptr != NULL);
-    struct ArgpxOutParamList *out = &conf->action_load.param_list;
 
     char *param_now = param_start_ptr != NULL ? param_start_ptr : ShiftArguments_(data, 1);
-    if (param_now == NULL) {
-        data->res->status = kArgpxStatusParamInsufficient;
+    if (param_now == NULL)
         return -1;
-    }
-    int remaining_len = max_param_len > 0 ? max_param_len : strlen(param_now);
+    size_t param_len = max_param_len > 0 ? max_param_len : strlen(param_now);
 
-    char *delimiter_ptr;
-    for (int param_idx = 0; remaining_len > 0; param_idx++) {
-        if (out->max > 0 and param_idx + 1 > out->max) {
-            data->res->status = kArgpxStatusParamExcess;
-            return -1;
-        }
+    bool view = conf->action_type == kArgpxActionParamListView;
+    int max = view == true ? conf->action_load.param_list_view.max : conf->action_load.param_list.max;
 
-        delimiter_ptr = strnstr_(param_now, grp->item.delimiter, remaining_len);
+    int count = ParamListSplit_(data, grp, param_now, param_len, max, NULL);
+    if (count < 0)
+        return -1;
 
-        int param_len;
-        if (delimiter_ptr == NULL) {
-            param_len = remaining_len;
-        } else {
-            param_len = delimiter_ptr - param_now;
-            // delimiter shouldn't exist at the last parameter's tail
-            if (param_len + grp->delimiter_len >= remaining_len) {
-                data->res->status = kArgpxStatusBizarreFormat;
-                return -1;
-            }
+    struct ArgpxStringView *view_v = NULL;
+    if (count > 0) {
+        view_v = MemAlloc_(&data->mem, sizeof(struct ArgpxStringView) * count);
+        if (view_v == NULL) {
+            data->res->status = kArgpxStatusMemoryError;
+            return -1;
         }
+        ParamListSplit_(data, grp, param_now, param_len, max, view_v);
+    }
+
+    if (view == true) {
+        struct ArgpxOutParamListView *out = &conf->action_load.param_list_view;
+        out->out_count = count;
+        out->out_list = view_v;
+        out->allocator = data->mem.allocator;
+        return 0;
+    }
 
-        if (ParamListAppend_(out, param_idx, param_now, param_len) < 0) {
+    // copy mode, the view array becomes the string pointer array in place
+    // a char * is smaller than a view, so item i is always read before the slot is overwritten
+    struct ArgpxOutParamList *out = &conf->action_load.param_list;
+    char **str_v = (char **)view_v;
+    out->out_count = 0;
+    out->out_list = str_v;
+    out->allocator = data->mem.allocator;
+    for (int i = 0; i < count; i++) {
+        struct ArgpxStringView piece = view_v[i];
+        char *new_str = MemAlloc_(&data->mem, piece.len + 1);
+        if (new_str == NULL) {
             data->res->status = kArgpxStatusMemoryError;
             return -1;
         }
+        memcpy(new_str, piece.ptr, piece.len);
+        new_str[piece.len] = '\0';
 
-        int used_len = param_len + grp->delimiter_len;
-        // each parameter will have a delimiter, expect the last one
-        // it will reduce remaining_len to a negative number, then no next loop
-        remaining_len -= used_len;
-        param_now += used_len;
+        str_v[i] = new_str;
+        // keep it available for ArgpxOutParamListFree()
+        out->out_count = i + 1;
     }
 
     return 0;
@@ -642,8 +1517,18 @@ void ArgpxOutParamListFree(struct ArgpxOutParamList *out)
     assert(out != NULL);
 
     for (int i = 0; i < out->out_count; i++)
-        free(out->out_list[i]);
-    free(out->out_list);
+        ArgpxMemFree(out->allocator, out->out_list[i]);
+    ArgpxMemFree(out->allocator, out->out_list);
+}
+
+/*
+    Clean up the struct ArgpxOutParamListView, the pieces are not owned by it.
+ */
+void ArgpxOutParamListViewFree(struct ArgpxOutParamListView *out)
+{
+    assert(out != NULL);
+
+    ArgpxMemFree(out->allocator, out->out_list);
 }
 
 /*
@@ -682,35 +1567,217 @@ static void ActionSetInt_(struct UnifiedData_ *data, struct ArgpxFlag *conf_ptr)
     *ptr->target_ptr = ptr->source;
 }
 
+/*
+    Make a copy of conf for the .bind_offset mode, its target pointers point into the record "base".
+    The lists are built in the copy, and moved to the record after the action by BindOffsetCommit_().
+ */
+static void BindOffsetResolve_(const struct ArgpxFlag *conf, char *base, struct ArgpxFlag *out_bound)
+{
+    assert(conf != NULL);
+    assert(base != NULL);
+    assert(out_bound != NULL);
+
+    *out_bound = *conf;
+    void *target = base + conf->out_offset;
+    switch (conf->action_type) {
+    case kArgpxActionParamSingle:
+    case kArgpxActionParamSingleOnDemand:
+        out_bound->action_load.param_single.var_ptr = target;
+        break;
+    case kArgpxActionSetMemory:
+        out_bound->action_load.set_memory.target_ptr = target;
+        break;
+    case kArgpxActionSetBool:
+        out_bound->action_load.set_bool.target_ptr = target;
+        break;
+    case kArgpxActionSetInt:
+        out_bound->action_load.set_int.target_ptr = target;
+        break;
+    case kArgpxActionParamList:
+        // nothing of the config goes to the record, except .max
+        out_bound->action_load.param_list.out_count = 0;
+        out_bound->action_load.param_list.out_list = NULL;
+        break;
+    case kArgpxActionParamListView:
+        out_bound->action_load.param_list_view.out_count = 0;
+        out_bound->action_load.param_list_view.out_list = NULL;
+        break;
+    case kArgpxActionParamLazy:
+        // the whole load goes to the record, and the value stays in it too
+        out_bound->action_load.param_lazy.var_ptr = &((struct ArgpxOutParamLazy *)target)->value;
+        break;
+    case kArgpxActionCallbackOnly:
+        break;
+    }
+}
+
+/*
+    return the action_load for the callback, it's in the record for the lists
+ */
+static void *BindOffsetCommit_(struct ArgpxFlag *bound, char *base)
+{
+    assert(bound != NULL);
+    assert(base != NULL);
+
+    void *target = base + bound->out_offset;
+    switch (bound->action_type) {
+    case kArgpxActionParamList:
+        memcpy(target, &bound->action_load.param_list, sizeof(struct ArgpxOutParamList));
+        return target;
+    case kArgpxActionParamListView:
+        memcpy(target, &bound->action_load.param_list_view, sizeof(struct ArgpxOutParamListView));
+        return target;
+    case kArgpxActionParamLazy:
+        memcpy(target, &bound->action_load.param_lazy, sizeof(struct ArgpxOutParamLazy));
+        return target;
+    default:
+        return &bound->action_load;
+    }
+}
+
+/*
+    Run the action of conf and then its callback.
+    In the .bind_offset mode, everything happens in a copy of conf, so the flag set is read only.
+
+    return negative: error and set status
+ */
+static int RunAction_(struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp, struct ArgpxFlag *conf,
+    char *param_start, size_t param_len)
+{
+    assert(data != NULL);
+    assert(grp != NULL);
+    assert(conf != NULL);
+
+    if (data->seen_v != NULL) {
+        size_t conf_idx = conf - data->parser->conf.ptr;
+        data->seen_v[conf_idx / 64] |= (uint64_t)1 << (conf_idx % 64);
+    }
+
+    struct ArgpxFlag bound;
+    char *base = data->opt.out_base;
+    if (conf->bind_offset == true) {
+        // a bound flag without the record is a bug of the caller
+        assert(base != NULL);
+        BindOffsetResolve_(conf, base, &bound);
+        conf = &bound;
+    }
+
+    int ret = 0;
+    switch (conf->action_type) {
+    case kArgpxActionParamSingle:
+        ret = ActionParamSingle_(data, conf, false, param_start, param_len);
+        break;
+    case kArgpxActionParamSingleOnDemand:
+        // the variable is already in the record
+        ret = ActionParamSingle_(data, conf, conf != &bound, param_start, param_len);
+        break;
+    case kArgpxActionParamList:
+    case kArgpxActionParamListView:
+        ret = ActionParamList_(data, grp, conf, param_start, param_len);
+        break;
+    case kArgpxActionParamLazy:
+        ret = ActionParamLazy_(data, conf, param_start, param_len);
+        break;
+    case kArgpxActionSetMemory:
+        ActionSetMemory_(data, conf);
+        break;
+    case kArgpxActionSetBool:
+        ActionSetBool_(data, conf);
+        break;
+    case kArgpxActionSetInt:
+        ActionSetInt_(data, conf);
+        break;
+    case kArgpxActionCallbackOnly:
+        break;
+    }
+
+    // even on error, a half done list is in the record for ArgpxOutParamListFree()
+    void *action_load = conf == &bound ? BindOffsetCommit_(&bound, base) : &conf->action_load;
+    if (ret < 0)
+        return -1;
+
+    if (conf->callback != NULL)
+        conf->callback(action_load, conf->callback_param);
+
+    return 0;
+}
+
 /*
     Detect the group where the argument is located.
-    A group index will be returned. Use GroupIndexToPointer_() convert it to a pointer.
+    Only the groups with the same first prefix byte will be compared, and the longer prefix wins. So "--" will be
+    preferred to "-" in any group order.
+
     return:
-      >= 0: valid index of data.groups[]
+      >= 0: valid index of parser.group_v[]
       < 0: it's a command parameter, not flag
  */
-static int MatchingGroup_(int group_c, struct ArgpxGroup *group_v, char *arg)
+static inline int MatchingGroup_(const struct ArgpxParser *parser, const char *arg, struct ArgpxParseStats *stats)
 {
-    assert(group_c > 0);
-    assert(group_v != NULL);
+    assert(parser != NULL);
     assert(arg != NULL);
 
-    struct ArgpxGroup grp;
-    int no_prefix_group_idx = -1;
-    for (int g_idx = 0; g_idx < group_c; g_idx++) {
-        grp = group_v[g_idx];
+    unsigned char first = arg[0];
+    for (int i = parser->dispatch_v[first]; i < parser->dispatch_v[first + 1]; i++) {
+        const struct UnifiedGroupCache_ *grp = &parser->group_v[parser->group_order_v[i]];
+        ARGPX_STATS_ADD(stats, group_try_c, 1);
+        // the first byte is already the same
+        if (strncmp(arg + 1, grp->item.prefix + 1, grp->prefix_len - 1) == 0)
+            return grp->idx;
+    }
+
+    return parser->no_prefix_group_idx;
+}
+
+/*
+    Make the group dispatch table of MatchingGroup_(). The group caches must be ready.
+
+    return negative: error(memory error)
+ */
+static int GroupDispatchMake_(struct ArgpxParser *parser)
+{
+    assert(parser != NULL);
 
-        if (grp.prefix[0] == '\0')
-            no_prefix_group_idx = g_idx;
+    int group_c = parser->style.group_c;
+    parser->no_prefix_group_idx = -1;
+    parser->group_order_v = ArgpxMemAlloc(parser->allocator, sizeof(int) * (group_c > 0 ? group_c : 1));
+    if (parser->group_order_v == NULL)
+        return -1;
 
-        if (strncmp(arg, grp.prefix, strlen(grp.prefix)) == 0)
-            return g_idx;
+    // counting sort by the first byte
+    for (int b = 0; b < UCHAR_MAX + 2; b++)
+        parser->dispatch_v[b] = 0;
+    for (int i = 0; i < group_c; i++) {
+        const struct UnifiedGroupCache_ *grp = &parser->group_v[i];
+        if (grp->prefix_len == 0)
+            parser->no_prefix_group_idx = i;
+        else
+            parser->dispatch_v[(unsigned char)grp->item.prefix[0] + 1] += 1;
     }
+    for (int b = 1; b < UCHAR_MAX + 2; b++)
+        parser->dispatch_v[b] += parser->dispatch_v[b - 1];
+
+    int fill_v[UCHAR_MAX + 1];
+    for (int b = 0; b < UCHAR_MAX + 1; b++)
+        fill_v[b] = parser->dispatch_v[b];
+    for (int i = 0; i < group_c; i++) {
+        const struct UnifiedGroupCache_ *grp = &parser->group_v[i];
+        if (grp->prefix_len == 0)
+            continue;
 
-    if (no_prefix_group_idx >= 0)
-        return no_prefix_group_idx;
+        // insertion sort in the bucket, longest prefix first and keep the append order
+        unsigned char first = grp->item.prefix[0];
+        int pos = fill_v[first];
+        fill_v[first] += 1;
+        while (pos > parser->dispatch_v[first]
+            and parser->group_v[parser->group_order_v[pos - 1]].prefix_len < grp->prefix_len)
+        {
+            parser->group_order_v[pos] = parser->group_order_v[pos - 1];
+            pos--;
+        }
+        parser->group_order_v[pos] = i;
+    }
 
-    return -1;
+    return 0;
 }
 
 /*
@@ -736,6 +1803,11 @@ static int GroupCacheInit_(struct UnifiedGroupCache_ *grp)
     if (grp->delimiter_toggle == true and grp->delimiter_len == 0)
         return -1;
 
+    // a response file is the whole rest of the argument, and an empty prefix would take every argument
+    if ((grp->item.attribute & ARGPX_ATTR_RESPONSE_FILE) != 0
+        and ((grp->item.attribute & ARGPX_ATTR_COMPOSABLE) != 0 or grp->prefix_len == 0))
+        return -1;
+
     return 0;
 }
 
@@ -756,12 +1828,25 @@ static bool ShouldFlagTypeHaveParam_(struct UnifiedData_ *data, const struct Arg
     case kArgpxActionParamSingle:
     case kArgpxActionParamSingleOnDemand:
     case kArgpxActionParamList:
+    case kArgpxActionParamListView:
+    case kArgpxActionParamLazy:
         return true;
     }
 
     return false; // make compiler happy... noreturn is baster then this
 }
 
+/*
+    Get the cached name length of a flag config. The config must be a member of the parser's flag set.
+ */
+static size_t FlagNameLen_(const struct ArgpxParser *parser, const struct ArgpxFlag *conf)
+{
+    assert(parser != NULL);
+    assert(conf != NULL);
+
+    return parser->name_len_v[conf - parser->conf.ptr];
+}
+
 /*
     Matching a name in all flag configs.
     It will find the conf with the highest match length in name_start.
@@ -776,63 +1861,84 @@ static bool ShouldFlagTypeHaveParam_(struct UnifiedData_ *data, const struct Arg
     Set max_name_len to == 0 to disable it.
 
     If "shortest" is true, then shortest matching flag name and ignore tail.
+    Only the flags of the group are visited, see struct FlagLinear_.
 
     return NULL: error and set status
  */
-static struct ArgpxFlag *MatchConfLinear_(
-    struct UnifiedData_ *data, struct UnifiedGroupCache_ *grp, char *name_start, size_t max_name_len, bool shortest)
+static struct ArgpxFlag *MatchConfLinear_(struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp,
+    char *name_start, size_t max_name_len, bool shortest)
 {
     assert(data != NULL);
     assert(grp != NULL);
     assert(name_start != NULL);
 
-    bool tail_limit = max_name_len == 0 ? false : true;
-    // we may need to find the longest match
-    struct ArgpxFlag *longest_conf = NULL;
-    int longest_len = 0;
-
-    for (int conf_idx = 0; conf_idx < data->conf.count; conf_idx++) {
-        struct ArgpxFlag *conf = &data->conf.ptr[conf_idx];
-        if (conf->group_idx != grp->idx)
-            continue;
+    // the bytes of a name shorter than 8 in its head
+    static const uint64_t head_mask_v[9] = {0, 0xff, 0xffff, 0xffffff, 0xffffffff, 0xffffffffff, 0xffffffffffff,
+        0xffffffffffffff, UINT64_MAX};
 
-        size_t conf_name_len = strlen(conf->name);
-        if (tail_limit == true and conf_name_len > max_name_len)
-            continue;
-
-        size_t match_len;
+    bool tail_limit = max_name_len == 0 ? false : true;
+    size_t match_len = 0;
+    if (shortest != true)
+        match_len = tail_limit == true ? max_name_len : strlen(name_start);
+    uint64_t head = FlagNameHead_(name_start, shortest == true ? 8 : match_len);
+    uint64_t tail = shortest == true ? 0 : FlagNameTail_(name_start, match_len);
+
+    const struct ArgpxParser *parser = data->parser;
+    const struct FlagLinear_ *linear = &parser->linear;
+    int start = linear->group_start_v[grp->idx];
+    int end = linear->group_start_v[grp->idx + 1];
+
+    // filter 16 of them at a time without a branch, then check the survivors one by one
+    // in the shortest mode, a name longer than the argument has a non-zero byte over the \0 of its head, so it fails
+    int found_pos = -1;
+    for (int base = start; base < end and found_pos < 0; base += 16) {
+        int chunk = end - base < 16 ? end - base : 16;
+        uint32_t pass = 0;
         if (shortest != true) {
-            match_len = tail_limit == true ? max_name_len : strlen(name_start);
-            if (match_len != conf_name_len)
-                continue;
+            for (int j = 0; j < chunk; j++) {
+                pass |= (uint32_t)((linear->name_len_v[base + j] == match_len) & (linear->head_v[base + j] == head)
+                            & (linear->tail_v[base + j] == tail))
+                    << j;
+            }
         } else {
-            match_len = conf_name_len;
-        }
-
-        // matching name
-        if (strncmp(name_start, conf->name, match_len) != 0)
-            continue;
-
-        // if matched, update max length record
-        if (longest_len < conf_name_len) {
-            longest_len = conf_name_len;
-            longest_conf = conf;
+            for (int j = 0; j < chunk; j++) {
+                uint32_t len = linear->name_len_v[base + j];
+                uint64_t mask = head_mask_v[len < 8 ? len : 8];
+                pass |= (uint32_t)(((head & mask) == linear->head_v[base + j])
+                            & (tail_limit == false or len <= max_name_len))
+                    << j;
+            }
         }
 
-        if (shortest == true)
+        for (int j = 0; (pass >> j) != 0; j++) {
+            if ((pass >> j & 1) == 0)
+                continue;
+            // the first 8 bytes are equal already, and the last 8 too if the length is known
+            size_t conf_name_len = linear->name_len_v[base + j];
+            size_t checked_len = shortest == true ? 8 : 16;
+            const char *conf_name = parser->conf.ptr[linear->conf_idx_v[base + j]].name;
+            if (conf_name_len > checked_len and strncmp(name_start + 8, conf_name + 8, conf_name_len - 8) != 0)
+                continue;
+            found_pos = base + j;
             break;
+        }
     }
+    // it stops at the matched one or goes through all
+    ARGPX_STATS_ADD(data->opt.stats, lookup_linear_c, 1);
+    ARGPX_STATS_ADD(data->opt.stats, linear_visit_c, found_pos >= 0 ? found_pos - start + 1 : end - start);
 
-    if (longest_conf == NULL)
+    if (found_pos < 0) {
         data->res->status = kArgpxStatusUnknownFlag;
-    return longest_conf;
+        return NULL;
+    }
+    return &parser->conf.ptr[linear->conf_idx_v[found_pos]];
 }
 
 /*
     return NULL: error and set status
  */
 static struct ArgpxFlag *MatchConfHash_(
-    struct UnifiedData_ *data, struct UnifiedGroupCache_ *grp, char *name, size_t name_len)
+    struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp, char *name, size_t name_len)
 {
     assert(data != NULL);
     assert(grp != NULL);
@@ -843,102 +1949,338 @@ static struct ArgpxFlag *MatchConfHash_(
         return NULL;
     }
 
-    uint32_t name_hash;
-    name_hash = ArgpxHashFnv1aB32(name, name_len, ARGPX_HASH_FNV1A_32_INIT);
-    name_hash = ArgpxHashFnv1aB32(&grp->idx, sizeof(grp->idx), name_hash);
-    struct FlagTableUnit_ *unit = data->conf_table.array + name_hash % data->conf_table.count;
+    const struct FlagTable_ *table = &data->parser->conf_table;
+    uint32_t hash = FlagTableHash_(name, name_len, grp->idx);
 
-    if (unit->root_used == false) {
-        data->res->status = kArgpxStatusUnknownFlag;
-        return NULL;
+    struct ArgpxFlag *found = NULL;
+    unsigned long probe_c = 0;
+    for (size_t slot_idx = hash & table->mask;; slot_idx = (slot_idx + 1) & table->mask) {
+        const struct FlagTableSlot_ *slot = &table->slot_v[slot_idx];
+        probe_c += 1;
+        if (slot->conf == NULL)
+            break;
+        if (slot->hash != hash or slot->name_len != (uint32_t)name_len)
+            continue;
+
+        struct ArgpxFlag *conf = slot->conf;
+        if (conf->group_idx == grp->idx and FlagNameLen_(data->parser, conf) == name_len
+            and memcmp(conf->name, name, name_len) == 0) {
+            found = conf;
+            break;
+        }
     }
+    ARGPX_STATS_ADD(data->opt.stats, lookup_hash_c, 1);
+    ARGPX_STATS_ADD(data->opt.stats, hash_probe_c, probe_c);
+    ARGPX_STATS_MAX(data->opt.stats, hash_probe_max, probe_c);
 
-    while (true) {
-        if (unit->conf->group_idx == grp->idx and strncmp(unit->conf->name, name, name_len) == 0)
-            return unit->conf;
+    if (found == NULL)
+        data->res->status = kArgpxStatusUnknownFlag;
+    return found;
+}
 
-        if (unit->next == NULL) {
-            data->res->status = kArgpxStatusUnknownFlag;
-            return NULL;
-        }
+/*
+    Lookup a struct ArgpxStaticIndex, it's always two hashes and one compare.
+    The candidate is still checked, an unknown name lands on the slot of some flag too.
+ */
+static struct ArgpxFlag *MatchConfStatic_(
+    struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp, char *name, size_t name_len)
+{
+    assert(data != NULL);
+    assert(grp != NULL);
+    assert(name != NULL);
 
-        unit = unit->next;
-    }
+    const struct ArgpxParser *parser = data->parser;
+    const struct ArgpxStaticIndex *index = parser->static_index;
+    ARGPX_STATS_ADD(data->opt.stats, lookup_static_c, 1);
+
+    uint32_t hash = ArgpxStaticKeyHash(name, name_len, grp->idx, index->seed);
+    uint32_t slot = ArgpxStaticSlot(hash, index->disp_v[hash % index->bucket_c], (uint32_t)index->flag_c);
+    int conf_idx = index->slot_v[slot];
+
+    struct ArgpxFlag *conf = &parser->conf.ptr[conf_idx];
+    if (conf->group_idx == grp->idx and parser->name_len_v[conf_idx] == name_len
+        and memcmp(conf->name, name, name_len) == 0)
+        return conf;
+
+    data->res->status = kArgpxStatusUnknownFlag;
+    return NULL;
 }
 
 /*
     A wrapper of MatchConf*() functions.
 
     If name_len is 0, then the shortest matching name is implied(the "shortest" of MatchConfLinear_() function).
-    Because hash mode can only be used when the length fixed, so even the HASH mode enabled, when length is unknown(like
-    ARGPX_ATTR_COMPOSABLE mode), linear algorithm still be use.
+    Hash mode can only be used when the length fixed, so when length is unknown(like ARGPX_ATTR_COMPOSABLE mode), the
+    group's trie will be used instead.
+    A static index works for the fixed length only, just like the hash table, and it's preferred.
  */
 static struct ArgpxFlag *MatchConf_(
-    struct UnifiedData_ *data, struct UnifiedGroupCache_ *grp, char *name_start, size_t name_len)
+    struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp, char *name_start, size_t name_len)
 {
     assert(data != NULL);
     assert(grp != NULL);
     assert(name_start != NULL);
 
-    if (data->opt.use_hash == false) {
+    if (data->parser->static_index != NULL and name_len > 0)
+        return MatchConfStatic_(data, grp, name_start, name_len);
+
+    if (data->parser->use_hash == false) {
         return MatchConfLinear_(data, grp, name_start, name_len, name_len == 0 ? true : false);
     }
 
     if (name_len == 0) {
-        return MatchConfLinear_(data, grp, name_start, 0, true);
+        const struct FlagTrie_ *trie = &data->parser->trie_v[grp->idx];
+        if (trie->node_c == 0)
+            return MatchConfLinear_(data, grp, name_start, 0, true);
+
+        ARGPX_STATS_ADD(data->opt.stats, lookup_trie_c, 1);
+        struct ArgpxFlag *conf = FlagTrieMatch_(trie, name_start, 0);
+        if (conf == NULL)
+            data->res->status = kArgpxStatusUnknownFlag;
+        return conf;
     } else {
         return MatchConfHash_(data, grp, name_start, name_len);
     }
 }
 
 /*
-    Return matched symbol item index of sym_v.
+    Compare the first prefix_len bytes of a flag name with the prefix, 0: it starts with the prefix.
+    It's the same order as FlagTrieRecordCompare_(), so the names with the prefix are a range of the sorted ones.
+ */
+static int FlagPrefixCompare_(const char *name, size_t name_len, const char *prefix, size_t prefix_len)
+{
+    int ret = memcmp(name, prefix, name_len < prefix_len ? name_len : prefix_len);
+    if (ret != 0)
+        return ret;
+    return name_len < prefix_len ? -1 : 0;
+}
+
+/*
+    The first one of sorted_idx_v[lo, hi) that FlagPrefixCompare_() puts over "above".
+    -1 is the start of the range of the prefix, 0 is the end.
+ */
+static int FlagSortedBound_(
+    const struct ArgpxParser *parser, int lo, int hi, const char *prefix, size_t prefix_len, int above)
+{
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        int conf_idx = parser->sorted_idx_v[mid];
+        if (FlagPrefixCompare_(parser->conf.ptr[conf_idx].name, parser->name_len_v[conf_idx], prefix, prefix_len)
+            > above)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+/*
+    The flag of the group starting with the name, after the exact lookup missed. Two binary searches of the sorted
+    index find the range of the prefix, it's O(name_len * log n).
+    The same name appended twice is still one flag, the first one.
+    An ambiguous one fills the candidates into the result, the shortest first.
+
+    return NULL: error and set status(kArgpxStatusUnknownFlag or kArgpxStatusAmbiguousFlag)
+ */
+static struct ArgpxFlag *MatchAbbreviation_(
+    struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp, const char *name, size_t name_len)
+{
+    assert(data != NULL);
+    assert(grp != NULL);
+    assert(name != NULL);
+
+    const struct ArgpxParser *parser = data->parser;
+    const int *start_v = parser->linear.group_start_v;
+    if (parser->sorted_idx_v == NULL or name_len == 0) {
+        data->res->status = kArgpxStatusUnknownFlag;
+        return NULL;
+    }
+
+    int first = FlagSortedBound_(parser, start_v[grp->idx], start_v[grp->idx + 1], name, name_len, -1);
+    int end = FlagSortedBound_(parser, first, start_v[grp->idx + 1], name, name_len, 0);
+    if (first == end) {
+        data->res->status = kArgpxStatusUnknownFlag;
+        return NULL;
+    }
+
+    int first_idx = parser->sorted_idx_v[first];
+    int last_idx = parser->sorted_idx_v[end - 1];
+    if (parser->name_len_v[first_idx] == parser->name_len_v[last_idx]
+        and memcmp(parser->conf.ptr[first_idx].name, parser->conf.ptr[last_idx].name, parser->name_len_v[first_idx])
+            == 0) {
+        // the miss of the exact lookup is not an error now
+        data->res->status = kArgpxStatusSuccess;
+        return &parser->conf.ptr[first_idx];
+    }
+
+    data->res->status = kArgpxStatusAmbiguousFlag;
+    if (data->no_suggest == true)
+        return NULL;
+    int found_c = 0;
+    for (int i = first; i < end; i++) {
+        int conf_idx = parser->sorted_idx_v[i];
+        int prev_idx = i > first ? parser->sorted_idx_v[i - 1] : -1;
+        // a name appended again is right after the first one
+        if (prev_idx >= 0 and parser->name_len_v[conf_idx] == parser->name_len_v[prev_idx]
+            and memcmp(parser->conf.ptr[conf_idx].name, parser->conf.ptr[prev_idx].name, parser->name_len_v[conf_idx])
+                == 0)
+            continue;
+        // the rest of the name is all inserted, that's the edit distance
+        found_c = ArgpxSuggestTake(data->res->suggest_v, found_c, ARGPX_SUGGEST_MAX, &parser->conf.ptr[conf_idx],
+            (int)(parser->name_len_v[conf_idx] - name_len));
+    }
+    data->res->suggest_c = found_c;
+    return NULL;
+}
+
+/*
+    Fill the suggestions of an unknown name into the result, if the parser has the index.
+    Running out of memory only loses them, the status is still the unknown flag.
+    A big tree takes its scratch from the allocator of the parse, not the parser's, a batch only makes the former
+    thread-safe.
+ */
+static void ResultSuggest_(
+    struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp, const char *name, size_t name_len)
+{
+    assert(data != NULL);
+    assert(grp != NULL);
+    assert(name != NULL);
+
+    const struct ArgpxParser *parser = data->parser;
+    if (parser->suggest_v == NULL or data->no_suggest == true)
+        return;
+
+    int found_c = ArgpxSuggestTreeQuery(data->mem.allocator, &parser->suggest_v[grp->idx], &parser->conf,
+        parser->name_len_v, name, name_len, ArgpxSuggestDistanceMax(name_len), data->res->suggest_v,
+        ARGPX_SUGGEST_MAX);
+    data->res->suggest_c = found_c > 0 ? found_c : 0;
+}
+
+/*
+    Most arguments are not a symbol, so reject them by the first byte and length before any string compare.
+    The length is only counted up to the longest symbol, it's O(1) for any long argument.
+
+    Return matched symbol item index of style.symbol_v.
     Return negative num is not match.
  */
-static int MatchSymbol_(const char *target, const int sym_c, const struct ArgpxSymbol *sym_v)
+static inline int MatchSymbol_(const struct ArgpxParser *parser, const char *target, struct ArgpxParseStats *stats)
 {
+    assert(parser != NULL);
     assert(target != NULL);
-    assert(sym_c > 0);
-    assert(sym_v != NULL);
 
-    for (int i = 0; i < sym_c; i++) {
-        if (strcmp(target, sym_v[i].str) == 0)
+    unsigned char first = target[0];
+    if ((parser->symbol_head_v[first / 32] >> (first % 32) & 1) == 0)
+        return -1;
+
+    size_t len = 0;
+    while (len <= parser->symbol_max_len and target[len] != '\0')
+        len++;
+    if (len > parser->symbol_max_len)
+        return -1;
+    if ((parser->symbol_len_mask >> (len < 63 ? len : 63) & 1) == 0)
+        return -1;
+
+    for (int i = 0; i < parser->style.symbol_c; i++) {
+        if (parser->symbol_len_v[i] != len)
+            continue;
+        ARGPX_STATS_ADD(stats, symbol_cmp_c, 1);
+        if (memcmp(target, parser->style.symbol_v[i].str, len) == 0)
             return i;
     }
 
     return -1;
 }
 
+/*
+    Make the quick reject data of MatchSymbol_().
+
+    return negative: error(memory error)
+ */
+static int SymbolSetMake_(struct ArgpxParser *parser)
+{
+    assert(parser != NULL);
+
+    const struct ArgpxStyle *style = &parser->style;
+    parser->symbol_len_v
+        = ArgpxMemAlloc(parser->allocator, sizeof(size_t) * (style->symbol_c > 0 ? style->symbol_c : 1));
+    if (parser->symbol_len_v == NULL)
+        return -1;
+
+    parser->symbol_max_len = 0;
+    parser->symbol_len_mask = 0;
+    for (int b = 0; b < (UCHAR_MAX + 1) / 32; b++)
+        parser->symbol_head_v[b] = 0;
+
+    for (int i = 0; i < style->symbol_c; i++) {
+        const char *str = style->symbol_v[i].str;
+        size_t len = strlen(str);
+        unsigned char first = str[0];
+
+        parser->symbol_len_v[i] = len;
+        if (len > parser->symbol_max_len)
+            parser->symbol_max_len = len;
+        parser->symbol_len_mask |= (uint64_t)1 << (len < 63 ? len : 63);
+        parser->symbol_head_v[first / 32] |= (uint32_t)1 << (first % 32);
+    }
+
+    return 0;
+}
+
 /*
     Unlike composable mode, independent mode need to know the exact length of the flag name.
     So it must determine in advance if the assignment symbol exist.
+    The parameter after the assigner goes to *out_param_base, NULL if there's no assigner.
 
     return negative: error and set status
  */
-static int ParseArgumentIndependent_(struct UnifiedData_ *data, struct UnifiedGroupCache_ *grp, char *arg)
+static int MatchIndependent_(struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp, char *arg,
+    struct ArgpxFlag **out_conf, char **out_param_base)
 {
     assert(data != NULL);
     assert(grp != NULL);
     assert(arg != NULL);
+    assert(out_conf != NULL);
+    assert(out_param_base != NULL);
 
     char *name_start = arg + grp->prefix_len;
 
-    char *assigner_ptr;
-    if (grp->assigner_toggle == true)
-        assigner_ptr = strstr(name_start, grp->item.assigner);
-    else
-        assigner_ptr = NULL;
+    // an assigner after the longest name can't end a known one, so the rest(maybe a long parameter) isn't searched
+    char *assigner_ptr = NULL;
+    if (grp->assigner_toggle == true) {
+        size_t search_max = data->parser->name_max_len + grp->assigner_len;
+        const char *nul = memchr(name_start, '\0', search_max);
+        size_t search_len = nul != NULL ? (size_t)(nul - name_start) : search_max;
+        assigner_ptr
+            = ArgpxSearchFirst(data->parser->search_fn, name_start, search_len, grp->item.assigner, grp->assigner_len);
+    }
 
     size_t name_len;
     if (assigner_ptr != NULL)
         name_len = assigner_ptr - name_start;
     else
         name_len = strlen(name_start);
+    if (grp->assigner_toggle == true)
+        ARGPX_STATS_ADD(data->opt.stats, scan_byte_c, assigner_ptr != NULL ? name_len + grp->assigner_len : name_len);
 
     struct ArgpxFlag *conf = MatchConf_(data, grp, name_start, name_len);
+    // not a whole name, but maybe the start of one
+    if (conf == NULL and data->res->status == kArgpxStatusUnknownFlag
+        and (grp->item.attribute & ARGPX_ATTR_ABBREVIATION) != 0)
+        conf = MatchAbbreviation_(data, grp, name_start, name_len);
     // some check
-    if (conf == NULL)
+    if (conf == NULL) {
+        if (data->res->status != kArgpxStatusUnknownFlag)
+            return -1;
+        // a typo longer than every name, its assigner wasn't searched for, so the parameter is not a part of it
+        if (grp->assigner_toggle == true and assigner_ptr == NULL) {
+            char *typo_end = ArgpxSearchFirst(
+                data->parser->search_fn, name_start, name_len, grp->item.assigner, grp->assigner_len);
+            if (typo_end != NULL)
+                name_len = typo_end - name_start;
+        }
+        ResultSuggest_(data, grp, name_start, name_len);
         return -1;
+    }
     if (assigner_ptr != NULL and ShouldFlagTypeHaveParam_(data, conf) == false) {
         data->res->status = kArgpxStatusParamNoNeeded;
         return -1;
@@ -954,45 +2296,34 @@ static int ParseArgumentIndependent_(struct UnifiedData_ *data, struct UnifiedGr
         }
     }
 
-    char *param_base = assigner_ptr != NULL ? assigner_ptr + grp->assigner_len : NULL;
-    // get flag parameters
-    switch (conf->action_type) {
-    case kArgpxActionParamSingle:
-        if (ActionParamSingle_(data, conf, false, param_base, 0) < 0)
-            return -1;
-        break;
-    case kArgpxActionParamSingleOnDemand:
-        if (ActionParamSingle_(data, conf, true, param_base, 0) < 0)
-            return -1;
-        break;
-    case kArgpxActionParamList:
-        if (ActionParamList_(data, grp, conf, param_base, 0) < 0)
-            return -1;
-        break;
-    case kArgpxActionSetMemory:
-        ActionSetMemory_(data, conf);
-        break;
-    case kArgpxActionSetBool:
-        ActionSetBool_(data, conf);
-        break;
-    case kArgpxActionSetInt:
-        ActionSetInt_(data, conf);
-        break;
-    case kArgpxActionCallbackOnly:
-        break;
-    }
+    *out_conf = conf;
+    *out_param_base = assigner_ptr != NULL ? assigner_ptr + grp->assigner_len : NULL;
+    return 0;
+}
 
-    if (conf->callback != NULL)
-        conf->callback(&conf->action_load, conf->callback_param);
+/*
+    return negative: error and set status
+ */
+static int ParseArgumentIndependent_(struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp, char *arg)
+{
+    assert(data != NULL);
+    assert(grp != NULL);
+    assert(arg != NULL);
 
-    return 0;
+    struct ArgpxFlag *conf;
+    char *param_base;
+    if (MatchIndependent_(data, grp, arg, &conf, &param_base) < 0)
+        return -1;
+
+    // get flag parameters
+    return RunAction_(data, grp, conf, param_base, 0);
 }
 
 #include <stdio.h>
 /*
     return negative: error and status is set
  */
-static int ParseArgumentComposable_(struct UnifiedData_ *data, struct UnifiedGroupCache_ *grp, char *arg)
+static int ParseArgumentComposable_(struct UnifiedData_ *data, const struct UnifiedGroupCache_ *grp, char *arg)
 {
     assert(data != NULL);
     assert(grp != NULL);
@@ -1006,14 +2337,19 @@ static int ParseArgumentComposable_(struct UnifiedData_ *data, struct UnifiedGro
         struct ArgpxFlag *conf = MatchConf_(data, grp, base_ptr, 0);
         if (conf == NULL)
             return -1;
-        size_t name_len = strlen(conf->name);
+        size_t name_len = FlagNameLen_(data->parser, conf);
         remaining_len -= name_len;
 
         // some windows style...
         // if group attribute not set, next_prefix will always be NULL
         char *next_prefix = NULL;
-        if ((grp->item.attribute & ARGPX_ATTR_COMPOSABLE_NEED_PREFIX) != 0)
-            next_prefix = strstr(base_ptr, grp->item.prefix);
+        if ((grp->item.attribute & ARGPX_ATTR_COMPOSABLE_NEED_PREFIX) != 0) {
+            next_prefix = ArgpxSearchFirst(
+                data->parser->search_fn, base_ptr, remaining_len + name_len, grp->item.prefix, grp->prefix_len);
+            // remaining_len is already without the name
+            ARGPX_STATS_ADD(data->opt.stats, scan_byte_c,
+                next_prefix != NULL ? (size_t)(next_prefix - base_ptr) + grp->prefix_len : remaining_len + name_len);
+        }
 
         // parameter stuff
         char *param_start = base_ptr + name_len;
@@ -1067,34 +2403,8 @@ static int ParseArgumentComposable_(struct UnifiedData_ *data, struct UnifiedGro
             return -1;
         }
 
-        switch (conf->action_type) {
-        case kArgpxActionParamSingle:
-            if (ActionParamSingle_(data, conf, false, param_start, param_len) < 0)
-                return -1;
-            break;
-        case kArgpxActionParamSingleOnDemand:
-            if (ActionParamSingle_(data, conf, true, param_start, param_len) < 0)
-                return -1;
-            break;
-        case kArgpxActionParamList:
-            if (ActionParamList_(data, grp, conf, param_start, param_len) < 0)
-                return -1;
-            break;
-        case kArgpxActionSetMemory:
-            ActionSetMemory_(data, conf);
-            break;
-        case kArgpxActionSetBool:
-            ActionSetBool_(data, conf);
-            break;
-        case kArgpxActionSetInt:
-            ActionSetInt_(data, conf);
-            break;
-        case kArgpxActionCallbackOnly:
-            break;
-        }
-
-        if (conf->callback != NULL)
-            conf->callback(&conf->action_load, conf->callback_param);
+        if (RunAction_(data, grp, conf, param_start, param_len) < 0)
+            return -1;
 
         // update base_ptr
         // don't forget the prefix length in the NEED_PREFIX mode
@@ -1112,109 +2422,998 @@ static int ParseArgumentComposable_(struct UnifiedData_ *data, struct UnifiedGro
 }
 
 /*
-    The caller needs to prepare the memory of struct ArgpxResult.
+    return negative: stop
+ */
+static inline int RunSymbol_(const struct ArgpxParser *parser, int symbol_idx, bool *stop_parsing)
+{
+    assert(parser != NULL);
+    assert(stop_parsing != NULL);
+
+    struct ArgpxSymbol *sym = &parser->style.symbol_v[symbol_idx];
+    switch (sym->type) {
+    case kArgpxSymbolStopParsing:
+        *stop_parsing = true;
+        return 0;
+    case kArgpxSymbolTerminateProcessing:
+        return -1;
+    case kArgpxSymbolCallback:
+        sym->callback(sym->callback_param);
+        return 0;
+    }
 
-    If the terminate param is NULL, that's same as {.method = kArgpxTerminateNone} of struct ArgpxTerminateMethod.
+    return 0;
+}
 
-    return the result.status enum(ArgpxStatus) code.
-    Only 0(kArgpxStatusSuccess) is success.
+/*
+    Parse an argument from NextArgument_(), all kinds of the input share it.
+    The "stop_parsing" is kept by the caller between the calls.
+    It's the body of the hot loop, so it and the matching functions in it are inline, a call costs 20% on short args.
+
+    return negative: stop, it's an error if the status is set
  */
-int ArgpxParse(struct ArgpxResult *in_result, int in_arg_c, char **in_arg_v, struct ArgpxStyle *in_style,
-    struct ArgpxFlagSet *in_flag, struct ArgpxParseOption *in_option)
+static inline int ParseOneArgument_(struct UnifiedData_ *data, char *arg, bool *stop_parsing)
 {
-    assert(in_result != NULL);
-    assert(in_arg_c >= 0);
-    assert(in_arg_v != NULL);
-    assert(in_style != NULL);
-    assert(in_flag != NULL);
-    assert(in_option != NULL);
+    assert(data != NULL);
+    assert(arg != NULL);
+    assert(stop_parsing != NULL);
 
-    struct UnifiedData_ data = {
-        .res = in_result,
-        .arg_c = in_arg_c,
-        .arg_v = in_arg_v,
-        .arg_idx = 0,
-        .style = *in_style,
-        .conf = *in_flag,
-        .opt = *in_option,
-    };
+    const struct ArgpxParser *parser = data->parser;
 
-    *data.res = (struct ArgpxResult){
-        .status = kArgpxStatusSuccess,
-        .current_argv_idx = 0,
-        .current_argv_ptr = NULL,
-        .param_c = 0,
-        .param_v = NULL,
-    };
+    // update index record
+    data->res->current_argv_idx = data->arg_idx;
+    data->res->current_argv_ptr = arg;
+    ARGPX_STATS_ADD(data->opt.stats, arg_c, 1);
 
-    if (data.arg_c == 0) {
-        return data.res->status;
+    if (*stop_parsing == true)
+        return AppendCommandParameter_(data, arg);
+
+    int symbol_idx = MatchSymbol_(parser, arg, data->opt.stats);
+    if (symbol_idx >= 0)
+        return RunSymbol_(parser, symbol_idx, stop_parsing);
+
+    int group_idx = MatchingGroup_(parser, arg, data->opt.stats);
+    if (group_idx < 0)
+        return AppendCommandParameter_(data, arg);
+    const struct UnifiedGroupCache_ *grp = &parser->group_v[group_idx];
+
+    if ((grp->item.attribute & ARGPX_ATTR_RESPONSE_FILE) != 0)
+        return ResponseFilePush_(data, arg + grp->prefix_len);
+    if ((grp->item.attribute & ARGPX_ATTR_COMPOSABLE) != 0)
+        return ParseArgumentComposable_(data, grp, arg);
+    else
+        return ParseArgumentIndependent_(data, grp, arg);
+}
+
+static void ParserDestroy_(struct ArgpxParser *parser)
+{
+    assert(parser != NULL);
+
+    const struct ArgpxAllocator *allocator = parser->allocator;
+    FlagTableFree_(allocator, &parser->conf_table);
+    FlagTableFree_(allocator, &parser->env_table);
+    if (parser->trie_v != NULL) {
+        for (int i = 0; i < parser->style.group_c; i++)
+            FlagTrieFree_(allocator, &parser->trie_v[i]);
+        ArgpxMemFree(allocator, parser->trie_v);
+    }
+    if (parser->suggest_v != NULL) {
+        for (int i = 0; i < parser->style.group_c; i++)
+            ArgpxSuggestTreeFree(allocator, &parser->suggest_v[i]);
+        ArgpxMemFree(allocator, parser->suggest_v);
     }
+    FlagLinearFree_(allocator, &parser->linear);
+    ArgpxMemFree(allocator, parser->sorted_idx_v);
+    ArgpxMemFree(allocator, parser->name_len_v);
+    ArgpxMemFree(allocator, parser->symbol_len_v);
+    ArgpxMemFree(allocator, parser->group_order_v);
+    ArgpxMemFree(allocator, parser->group_v);
+}
 
-    if (data.opt.use_hash == true) {
-        if (FlagTableMake_(&data.style, &data.conf, &data.conf_table) == NULL) {
-            data.res->status = kArgpxStatusMemoryError;
-            return data.res->status;
-        }
+/*
+    The body of ParserInit_(), any error will leave the rest part NULL.
+ */
+static int ParserBuild_(struct ArgpxParser *parser, bool use_suggest)
+{
+    assert(parser != NULL);
+
+    const struct ArgpxStyle *style = &parser->style;
+    const struct ArgpxFlagSet *flag = &parser->conf;
+
+    if (style->group_c > 0) {
+        parser->group_v = ArgpxMemAlloc(parser->allocator, sizeof(struct UnifiedGroupCache_) * style->group_c);
+        if (parser->group_v == NULL)
+            return kArgpxStatusMemoryError;
+    }
+    for (int i = 0; i < style->group_c; i++) {
+        struct UnifiedGroupCache_ *grp = &parser->group_v[i];
+        *grp = (struct UnifiedGroupCache_){.idx = i, .item = style->group_v[i]};
+        if (GroupCacheInit_(grp) < 0)
+            return kArgpxStatusConfigInvalid;
     }
 
-    bool stop_parsing = false;
-    for (; data.arg_idx < data.arg_c; data.arg_idx++) {
-        // update index record
-        data.res->current_argv_idx = data.arg_idx;
-        data.res->current_argv_ptr = data.arg_v[data.arg_idx];
+    if (GroupDispatchMake_(parser) < 0)
+        return kArgpxStatusMemoryError;
+    if (SymbolSetMake_(parser) < 0)
+        return kArgpxStatusMemoryError;
 
-        char *arg = data.arg_v[data.arg_idx];
+    if (flag->count > 0) {
+        parser->name_len_v = ArgpxMemAlloc(parser->allocator, sizeof(size_t) * flag->count);
+        if (parser->name_len_v == NULL)
+            return kArgpxStatusMemoryError;
+    }
+    for (int i = 0; i < flag->count; i++) {
+        parser->name_len_v[i] = strlen(flag->ptr[i].name);
+        // an empty name is the start of every argument, the shortest match would take them all
+        if (parser->name_len_v[i] == 0)
+            return kArgpxStatusConfigInvalid;
+        // the environment runs a flag with the cache of its group, a flag out of the groups is only never matched
+        int group_idx = flag->ptr[i].group_idx;
+        if (flag->ptr[i].env_name != NULL and (group_idx < 0 or group_idx >= style->group_c))
+            return kArgpxStatusConfigInvalid;
+        if (parser->name_max_len < parser->name_len_v[i])
+            parser->name_max_len = parser->name_len_v[i];
+    }
 
-        if (stop_parsing == true) {
-            if (AppendCommandParameter_(&data, arg) < 0)
-                goto out;
-            continue;
+    // every flag must come back from its own slot, or the spec isn't the one of this flag set
+    const struct ArgpxStaticIndex *index = parser->static_index;
+    if (index != NULL) {
+        if (index->flag_c != flag->count or index->flag_c <= 0 or index->bucket_c == 0)
+            return kArgpxStatusConfigInvalid;
+        for (int i = 0; i < flag->count; i++) {
+            const struct ArgpxFlag *conf = &flag->ptr[i];
+            uint32_t hash = ArgpxStaticKeyHash(conf->name, parser->name_len_v[i], conf->group_idx, index->seed);
+            uint32_t slot = ArgpxStaticSlot(hash, index->disp_v[hash % index->bucket_c], (uint32_t)index->flag_c);
+            if (index->slot_v[slot] != i)
+                return kArgpxStatusConfigInvalid;
         }
+    }
 
-        int symbol_idx = MatchSymbol_(arg, data.style.symbol_c, data.style.symbol_v);
-        if (symbol_idx >= 0) {
-            struct ArgpxSymbol *sym = &data.style.symbol_v[symbol_idx];
-            switch (sym->type) {
-            case kArgpxSymbolStopParsing:
-                stop_parsing = true;
-                continue;
-            case kArgpxSymbolTerminateProcessing:
-                goto out;
-            case kArgpxSymbolCallback:
-                sym->callback(sym->callback_param);
-                continue;
-            }
+    // the hash mode still needs it for a group without a trie
+    if (FlagLinearMake_(parser->allocator, flag, parser->name_len_v, style->group_c, &parser->linear) < 0)
+        return kArgpxStatusMemoryError;
+    if (FlagSortedMake_(parser) < 0)
+        return kArgpxStatusMemoryError;
+    if (EnvTableMake_(parser) < 0)
+        return kArgpxStatusMemoryError;
+
+    if (use_suggest == true and style->group_c > 0) {
+        parser->suggest_v = ArgpxMemAlloc(parser->allocator, sizeof(struct ArgpxSuggestTree) * style->group_c);
+        if (parser->suggest_v == NULL)
+            return kArgpxStatusMemoryError;
+        // all empty first, so ParserDestroy_() can free a half built one
+        for (int i = 0; i < style->group_c; i++)
+            parser->suggest_v[i] = (struct ArgpxSuggestTree){.node_c = 0, .conf_idx_v = NULL};
+        for (int i = 0; i < style->group_c; i++) {
+            if (ArgpxSuggestTreeMake(parser->allocator, flag, parser->name_len_v, i, &parser->suggest_v[i]) < 0)
+                return kArgpxStatusMemoryError;
         }
+    }
 
-        struct UnifiedGroupCache_ grp = {0};
-        grp.idx = MatchingGroup_(data.style.group_c, data.style.group_v, arg);
+    if (parser->use_hash == false)
+        return kArgpxStatusSuccess;
 
-        if (grp.idx < 0) {
-            if (AppendCommandParameter_(&data, arg) < 0)
-                goto out;
+    if (index == NULL and FlagTableMake_(parser->allocator, flag, parser->name_len_v, &parser->conf_table) == NULL)
+        return kArgpxStatusMemoryError;
+
+    size_t trie_size = sizeof(struct FlagTrie_) * (style->group_c > 0 ? style->group_c : 1);
+    parser->trie_v = ArgpxMemAlloc(parser->allocator, trie_size);
+    if (parser->trie_v == NULL)
+        return kArgpxStatusMemoryError;
+    // zero makes all the tries "not built"
+    memset(parser->trie_v, 0, trie_size);
+    for (int i = 0; i < style->group_c; i++) {
+        if ((style->group_v[i].attribute & ARGPX_ATTR_COMPOSABLE) == 0)
             continue;
-        }
-        grp.item = data.style.group_v[grp.idx];
+        if (FlagTrieMake_(parser->allocator, flag, parser->name_len_v, i, &parser->trie_v[i]) < 0)
+            return kArgpxStatusMemoryError;
+    }
 
-        if (GroupCacheInit_(&grp) < 0) {
-            data.res->status = kArgpxStatusConfigInvalid;
-            goto out;
-        }
+    return kArgpxStatusSuccess;
+}
 
-        int ret;
-        if ((grp.item.attribute & ARGPX_ATTR_COMPOSABLE) != 0)
-            ret = ParseArgumentComposable_(&data, &grp, arg);
-        else
-            ret = ParseArgumentIndependent_(&data, &grp, arg);
+/*
+    Fill a parser in place, so ArgpxParse() can keep it on the stack.
+    The style and flag set are not copied deeply, the parser borrows their arrays.
 
-        if (ret < 0)
-            goto out;
-    }
+    return ArgpxStatus code. Only 0(kArgpxStatusSuccess) is success, and the parser needs ParserDestroy_() only then.
+ */
+static int ParserInit_(
+    struct ArgpxParser *parser, struct ArgpxStyle *style, struct ArgpxFlagSet *flag, struct ArgpxParseOption *option)
+{
+    assert(parser != NULL);
+    assert(style != NULL);
+    assert(flag != NULL);
+    assert(option != NULL);
+
+    *parser = (struct ArgpxParser){
+        .style = *style,
+        .conf = *flag,
+        .use_hash = option->use_hash,
+        .allocator = option->allocator,
+        .group_v = NULL,
+        .group_order_v = NULL,
+        .symbol_len_v = NULL,
+        .name_len_v = NULL,
+        .name_max_len = 0,
+        .linear = {.head_v = NULL},
+        .sorted_idx_v = NULL,
+        .search_fn = ArgpxSearchResolve(),
+        .conf_table = {.mask = 0, .slot_v = NULL},
+        .trie_v = NULL,
+        .static_index = option->static_index,
+        .suggest_v = NULL,
+        .env_table = {.mask = 0, .slot_v = NULL},
+        .env_len_mask = 0,
+    };
+
+    int status = ParserBuild_(parser, option->use_suggest);
+    if (status != kArgpxStatusSuccess)
+        ParserDestroy_(parser);
+
+    return status;
+}
+
+/*
+    Build a reusable parser from style and flag set, all the per-config works are done here.
+    The option decides which lookup index will be built, like .use_hash.
+
+    The style and flag set are borrowed, keep them alive and unchanged until ArgpxParserFree().
+
+    return ArgpxStatus code, *out_parser is set only on kArgpxStatusSuccess.
+ */
+int ArgpxCompile(struct ArgpxParser **out_parser, struct ArgpxStyle *style, struct ArgpxFlagSet *flag,
+    struct ArgpxParseOption *option)
+{
+    assert(out_parser != NULL);
+    assert(style != NULL);
+    assert(flag != NULL);
+    assert(option != NULL);
+
+    *out_parser = NULL;
+
+    struct ArgpxParser *parser = ArgpxMemAlloc(option->allocator, sizeof(struct ArgpxParser));
+    if (parser == NULL)
+        return kArgpxStatusMemoryError;
 
-out:
-    if (data.opt.use_hash == true) {
-        FlagTableFree_(&data.conf_table);
+    int status = ParserInit_(parser, style, flag, option);
+    if (status != kArgpxStatusSuccess) {
+        ArgpxMemFree(option->allocator, parser);
+        return status;
     }
+
+    *out_parser = parser;
+    return kArgpxStatusSuccess;
+}
+
+void ArgpxParserFree(struct ArgpxParser *parser)
+{
+    if (parser == NULL)
+        return;
+
+    const struct ArgpxAllocator *allocator = parser->allocator;
+    ParserDestroy_(parser);
+    ArgpxMemFree(allocator, parser);
+}
+
+/*
+    Whether a parse writes into the flag set. The parameter actions keep their output(and its allocator) in the
+    action_load of the flag, unless it's bound by .bind_offset. A flag of no group is never matched.
+    ArgpxParseBatch() shares the flag set between the threads, so it can't take such a parser.
+ */
+bool ArgpxParserWritesFlagSet(const struct ArgpxParser *parser)
+{
+    assert(parser != NULL);
+
+    for (int i = 0; i < parser->conf.count; i++) {
+        const struct ArgpxFlag *conf = &parser->conf.ptr[i];
+        if (conf->bind_offset == true or conf->group_idx < 0 or conf->group_idx >= parser->style.group_c)
+            continue;
+        switch (conf->action_type) {
+        case kArgpxActionParamSingle:
+        case kArgpxActionParamSingleOnDemand:
+        case kArgpxActionParamList:
+        case kArgpxActionParamListView:
+        case kArgpxActionParamLazy:
+            return true;
+        default:
+            break;
+        }
+    }
+
+    return false;
+}
+
+/*
+    The k nearest flag names of a group to "name", the nearest first, and the earlier appended one of a tie.
+    A negative max_distance picks one by the length, about a typo for every 3 letters.
+    It's a BK-tree lookup, the parser needs .use_suggest at compile time, or nothing is found.
+
+    return the count in out_v, negative: memory error
+ */
+int ArgpxSuggest(const struct ArgpxParser *parser, int group_idx, const char *name, size_t name_len, int max_distance,
+    struct ArgpxSuggestion *out_v, int k)
+{
+    assert(parser != NULL);
+    assert(group_idx >= 0 and group_idx < parser->style.group_c);
+    assert(name != NULL);
+
+    if (parser->suggest_v == NULL)
+        return 0;
+    if (max_distance < 0)
+        max_distance = ArgpxSuggestDistanceMax(name_len);
+
+    return ArgpxSuggestTreeQuery(parser->allocator, &parser->suggest_v[group_idx], &parser->conf, parser->name_len_v,
+        name, name_len, max_distance, out_v, k);
+}
+
+/*
+    Prepare the result for a new parse.
+    Only with reuse_result and without an arena, the old param_v memory is kept.
+ */
+static void ResultInit_(struct ArgpxResult *res, const struct ArgpxParseOption *opt)
+{
+    assert(res != NULL);
+    assert(opt != NULL);
+
+    bool keep = opt->reuse_result == true and opt->arena == NULL and res->arena == NULL
+        and res->allocator == opt->allocator;
+    // the strings of the last parse are not kept anyway
+    if (opt->reuse_result == true)
+        ArgpxResponseUnmapAll(&res->mapping);
+    *res = (struct ArgpxResult){
+        .status = kArgpxStatusSuccess,
+        .current_argv_idx = 0,
+        .current_argv_ptr = NULL,
+        .param_c = 0,
+        .param_v = keep == true ? res->param_v : NULL,
+        .param_cap = keep == true ? res->param_cap : 0,
+        .arena = opt->arena,
+        .allocator = opt->allocator,
+        .mapping = NULL,
+        .suggest_c = 0,
+    };
+}
+
+/*
+    Parse with a parser made by ArgpxCompile(). The parser is read only here, so it can be reused many times.
+    The caller needs to prepare the memory of struct ArgpxResult.
+
+    Lookup related options(like .use_hash) are decided at compile time, the ones in in_option are ignored.
+
+    return the result.status enum(ArgpxStatus) code.
+    Only 0(kArgpxStatusSuccess) is success.
+ */
+int ArgpxParseCompiled(struct ArgpxResult *in_result, int in_arg_c, char **in_arg_v,
+    const struct ArgpxParser *in_parser, struct ArgpxParseOption *in_option)
+{
+    assert(in_result != NULL);
+    assert(in_arg_c >= 0);
+    assert(in_arg_v != NULL);
+    assert(in_parser != NULL);
+    assert(in_option != NULL);
+
+    struct UnifiedData_ data = {
+        .res = in_result,
+        .arg_c = in_arg_c,
+        .arg_v = in_arg_v,
+        // NextArgument_() moves it to the first one
+        .arg_idx = -1,
+        .parser = in_parser,
+        .opt = *in_option,
+        .mem = {.arena = in_option->arena, .allocator = in_option->allocator, .stats = in_option->stats},
+    };
+
+    ResultInit_(data.res, &data.opt);
+    if (data.opt.stats != NULL)
+        *data.opt.stats = (struct ArgpxParseStats){0};
+
+    bool stop_parsing = false;
+    for (char *arg; (arg = NextArgument_(&data, false)) != NULL;) {
+        if (ParseOneArgument_(&data, arg, &stop_parsing) < 0)
+            break;
+    }
+
     return data.res->status;
 }
+
+/*
+    Parse the NUL-delimited arguments of a fd, each one is parsed when it's read. See struct ArgpxFdSource.
+    It's the same as ArgpxParseCompiled(), except:
+    - the command parameters go to .param_fn of the source, param_v of the result is always empty
+    - the string views(kArgpxVarStringView, ParamListView) point into the buffer, use them in the flag callback
+    - current_argv_ptr points into the buffer too
+    - a ParamLazy is converted as soon as it's given, a bad one is an error even if a later one overrides it, and
+      its .raw points into the buffer too. A kArgpxVarString of the flag converted before is freed then
+
+    return the result.status enum(ArgpxStatus) code.
+    Only 0(kArgpxStatusSuccess) is success.
+ */
+int ArgpxParseFd(struct ArgpxResult *in_result, struct ArgpxFdSource *in_source, const struct ArgpxParser *in_parser,
+    struct ArgpxParseOption *in_option)
+{
+    assert(in_result != NULL);
+    assert(in_source != NULL);
+    assert(in_parser != NULL);
+    assert(in_option != NULL);
+
+    struct ArgpxStream stream;
+    ArgpxStreamInit(&stream, in_source->fd, in_source->buf, in_source->size);
+
+    struct UnifiedData_ data = {
+        .res = in_result,
+        .arg_c = 0,
+        .arg_v = NULL,
+        .arg_idx = -1,
+        .parser = in_parser,
+        .opt = *in_option,
+        .mem = {.arena = in_option->arena, .allocator = in_option->allocator, .stats = in_option->stats},
+        .stream = &stream,
+        .fd_source = in_source,
+        .stream_param_c = 0,
+        .response_depth = 0,
+    };
+
+    ResultInit_(data.res, &data.opt);
+    if (data.opt.stats != NULL)
+        *data.opt.stats = (struct ArgpxParseStats){0};
+
+    bool stop_parsing = false;
+    for (char *arg; (arg = NextArgument_(&data, false)) != NULL;) {
+        if (ParseOneArgument_(&data, arg, &stop_parsing) < 0)
+            break;
+    }
+
+    // a read error is the reason of whatever happened after it
+    if (stream.status != kArgpxStatusSuccess)
+        data.res->status = stream.status;
+
+    return data.res->status;
+}
+
+/*
+    Parse a command line string, it's split by ArgpxTokenizerNext() as the parse goes, nothing is copied.
+    The line is modified in place, and the command parameters and string views point into it.
+    current_argv_idx counts the tokens.
+
+    return the result.status enum(ArgpxStatus) code.
+    Only 0(kArgpxStatusSuccess) is success.
+ */
+int ArgpxParseCommandLine(struct ArgpxResult *in_result, char *in_line, const struct ArgpxParser *in_parser,
+    struct ArgpxParseOption *in_option)
+{
+    assert(in_result != NULL);
+    assert(in_line != NULL);
+    assert(in_parser != NULL);
+    assert(in_option != NULL);
+
+    struct ArgpxTokenizer tokenizer;
+    ArgpxTokenizerInit(&tokenizer, in_line);
+
+    struct UnifiedData_ data = {
+        .res = in_result,
+        .arg_c = 0,
+        .arg_v = NULL,
+        .arg_idx = -1,
+        .parser = in_parser,
+        .opt = *in_option,
+        .mem = {.arena = in_option->arena, .allocator = in_option->allocator, .stats = in_option->stats},
+        .tokenizer = &tokenizer,
+        .response_depth = 0,
+    };
+
+    ResultInit_(data.res, &data.opt);
+    if (data.opt.stats != NULL)
+        *data.opt.stats = (struct ArgpxParseStats){0};
+
+    bool stop_parsing = false;
+    for (char *arg; (arg = NextArgument_(&data, false)) != NULL;) {
+        if (ParseOneArgument_(&data, arg, &stop_parsing) < 0)
+            break;
+    }
+
+    // the rest of the line is never parsed
+    if (tokenizer.status != kArgpxStatusSuccess)
+        data.res->status = tokenizer.status;
+
+    return data.res->status;
+}
+
+/*
+    Walk the environment once, each KEY=VALUE is looked up in the env table of the parser. A flag already run by the
+    argv is skipped, and so is the same variable again.
+    An empty value is the same as unset. A flag without parameter runs if the value is true("1" or the ones of
+    kArgpxVarBool), not if false.
+
+    return negative: error and set status
+ */
+static int ParseEnvironment_(struct UnifiedData_ *data, char **env_v)
+{
+    assert(data != NULL);
+    assert(env_v != NULL);
+
+    const struct ArgpxParser *parser = data->parser;
+    for (int i = 0; env_v[i] != NULL; i++) {
+        char *entry = env_v[i];
+        char *assigner = strchr(entry, '=');
+        if (assigner == NULL)
+            continue;
+        // most of the variables are not bound, the length rejects them before the hash
+        size_t name_len = assigner - entry;
+        if ((parser->env_len_mask >> (name_len < 63 ? name_len : 63) & 1) == 0)
+            continue;
+        struct ArgpxFlag *conf = EnvTableFind_(&parser->env_table, entry, name_len);
+        if (conf == NULL)
+            continue;
+
+        size_t conf_idx = conf - parser->conf.ptr;
+        uint64_t bit = (uint64_t)1 << (conf_idx % 64);
+        if ((data->seen_v[conf_idx / 64] & bit) != 0)
+            continue;
+        data->seen_v[conf_idx / 64] |= bit;
+
+        char *value = assigner + 1;
+        if (value[0] == '\0')
+            continue;
+        data->res->current_argv_idx = data->arg_c + i;
+        data->res->current_argv_ptr = entry;
+        if (ShouldFlagTypeHaveParam_(data, conf) == false) {
+            // the usual 1 and 0 of a variable too
+            int on = strcmp(value, "1") == 0 ? 1 : strcmp(value, "0") == 0 ? 0 : StringIsBool_(value, strlen(value));
+            if (on < 0) {
+                data->res->status = kArgpxStatusConvertMalformed;
+                return -1;
+            }
+            if (on == 0)
+                continue;
+            value = NULL;
+        }
+        if (RunAction_(data, &parser->group_v[conf->group_idx], conf, value, 0) < 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+/*
+    Parse the argv, then the flags with .env_name from the environment, like "APP_LEVEL=3" for "--level=3".
+    in_env_v is NULL terminated, usually the "environ" of POSIX. It's walked once, each variable is one hash lookup.
+    A flag given in the argv is not run again by the environment, the argv wins. The actions and callbacks of the
+    environment run after all the argv ones, in the order of in_env_v. If the argv parse is stopped by a terminate
+    symbol or .max_cmdparam, the environment is not read at all.
+
+    An error of a variable leaves current_argv_ptr at the "KEY=VALUE", and current_argv_idx is in_arg_c plus its index
+    in in_env_v.
+
+    return the result.status enum(ArgpxStatus) code.
+    Only 0(kArgpxStatusSuccess) is success.
+ */
+int ArgpxParseEnv(struct ArgpxResult *in_result, int in_arg_c, char **in_arg_v, char **in_env_v,
+    const struct ArgpxParser *in_parser, struct ArgpxParseOption *in_option)
+{
+    assert(in_result != NULL);
+    assert(in_arg_c >= 0);
+    assert(in_arg_v != NULL);
+    assert(in_env_v != NULL);
+    assert(in_parser != NULL);
+    assert(in_option != NULL);
+
+    struct UnifiedData_ data = {
+        .res = in_result,
+        .arg_c = in_arg_c,
+        .arg_v = in_arg_v,
+        .arg_idx = -1,
+        .parser = in_parser,
+        .opt = *in_option,
+        .mem = {.arena = in_option->arena, .allocator = in_option->allocator, .stats = in_option->stats},
+    };
+
+    ResultInit_(data.res, &data.opt);
+    if (data.opt.stats != NULL)
+        *data.opt.stats = (struct ArgpxParseStats){0};
+
+    // the bits of a few hundred flags are on the stack
+    uint64_t seen_local_v[4];
+    size_t word_c = ((size_t)in_parser->conf.count + 63) / 64;
+    data.seen_v = word_c <= 4 ? seen_local_v : MemAlloc_(&data.mem, sizeof(uint64_t) * word_c);
+    if (data.seen_v == NULL) {
+        data.res->status = kArgpxStatusMemoryError;
+        return data.res->status;
+    }
+    memset(data.seen_v, 0, sizeof(uint64_t) * (word_c > 0 ? word_c : 1));
+
+    // a terminate symbol or .max_cmdparam ends the whole parse, not only the argv
+    bool argv_done = true;
+    bool stop_parsing = false;
+    for (char *arg; (arg = NextArgument_(&data, false)) != NULL;) {
+        if (ParseOneArgument_(&data, arg, &stop_parsing) < 0) {
+            argv_done = false;
+            break;
+        }
+    }
+    if (argv_done == true and data.res->status == kArgpxStatusSuccess and in_parser->env_table.slot_v != NULL)
+        ParseEnvironment_(&data, in_env_v);
+
+    if (data.seen_v != seen_local_v and data.mem.arena == NULL)
+        ArgpxMemFree(data.mem.allocator, data.seen_v);
+    return data.res->status;
+}
+
+/*
+    What an argument of ArgpxParseParallel() is when it's parsed on its own, found in the phase 1.
+ */
+enum ArgKind_ {
+    // a command parameter, unless the flag before takes it
+    kArgKindParam = 0,
+    kArgKindSymbol,
+    // a flag of an independent group
+    kArgKindFlag,
+    // left to ParseOneArgument_(): a composable group, a response file, or an error
+    kArgKindSequential,
+};
+
+struct ArgClass_ {
+    enum ArgKind_ kind;
+    // the symbol index or the group index
+    int idx;
+    struct ArgpxFlag *conf;
+    // the parameter after the assigner, NULL: the next argument if the flag takes one
+    char *param_start;
+    bool take_param;
+    // set by the phase 3
+    bool has_ready;
+    struct ParamReady_ ready;
+};
+
+/*
+    The shared state of the parallel phases. The workers only write their own items of cls_v.
+ */
+struct ParallelJob_ {
+    const struct ArgpxParser *parser;
+    int arg_c;
+    char **arg_v;
+    struct ArgClass_ *cls_v;
+    // the arguments with a parameter to convert, in the current segment
+    int *conv_v;
+    int conv_c;
+};
+
+/*
+    Nothing is run here, a worker can't touch the outputs or the result.
+ */
+static void ClassifyArgument_(struct UnifiedData_ *data, char *arg, struct ArgClass_ *cls)
+{
+    assert(data != NULL);
+    assert(arg != NULL);
+    assert(cls != NULL);
+
+    const struct ArgpxParser *parser = data->parser;
+    *cls = (struct ArgClass_){.kind = kArgKindSequential, .idx = -1, .has_ready = false};
+
+    int symbol_idx = MatchSymbol_(parser, arg, NULL);
+    if (symbol_idx >= 0) {
+        cls->kind = kArgKindSymbol;
+        cls->idx = symbol_idx;
+        return;
+    }
+
+    int group_idx = MatchingGroup_(parser, arg, NULL);
+    if (group_idx < 0) {
+        cls->kind = kArgKindParam;
+        return;
+    }
+    const struct UnifiedGroupCache_ *grp = &parser->group_v[group_idx];
+    if ((grp->item.attribute & (ARGPX_ATTR_RESPONSE_FILE | ARGPX_ATTR_COMPOSABLE)) != 0)
+        return;
+
+    // an error is made again by ParseOneArgument_(), with everything before it done
+    if (MatchIndependent_(data, grp, arg, &cls->conf, &cls->param_start) < 0)
+        return;
+    cls->kind = kArgKindFlag;
+    cls->idx = group_idx;
+    cls->take_param = ShouldFlagTypeHaveParam_(data, cls->conf);
+}
+
+/*
+    Phase 1: classify a chunk of the arguments.
+ */
+static void ParallelClassify_(void *job_in, int chunk_idx)
+{
+    struct ParallelJob_ *job = job_in;
+
+    // a miss writes the status, keep it away from the real result
+    struct ArgpxResult scratch;
+    struct UnifiedData_ data = {
+        .res = &scratch,
+        .parser = job->parser,
+        .opt = {.stats = NULL},
+        // the real parse will find the same miss
+        .no_suggest = true,
+    };
+
+    int end = chunk_idx * ARGPX_PARALLEL_CHUNK + ARGPX_PARALLEL_CHUNK;
+    if (end > job->arg_c)
+        end = job->arg_c;
+    for (int i = chunk_idx * ARGPX_PARALLEL_CHUNK; i < end; i++)
+        ClassifyArgument_(&data, job->arg_v[i], &job->cls_v[i]);
+}
+
+/*
+    The conversions don't allocate, so they can be done by any thread.
+ */
+static bool ParamCanConvertAhead_(const struct ArgpxFlag *conf)
+{
+    assert(conf != NULL);
+
+    if (conf->action_type != kArgpxActionParamSingle and conf->action_type != kArgpxActionParamSingleOnDemand)
+        return false;
+    switch (conf->action_load.param_single.type) {
+    case kArgpxVarInt:
+    case kArgpxVarBool:
+    case kArgpxVarFloat:
+    case kArgpxVarDouble:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*
+    Phase 2: follow the arguments from "start" like the real parse, but only on the classes.
+    The flags taking the next argument and the stop parsing symbol are the reason it's sequential.
+    The conversions of the segment go to conv_v.
+
+    return the end of the segment, it includes an argument left to ParseOneArgument_()
+ */
+static int ParallelStitch_(struct ParallelJob_ *job, int start, bool stop_parsing)
+{
+    assert(job != NULL);
+
+    job->conv_c = 0;
+    int i = start;
+    while (i < job->arg_c and stop_parsing == false) {
+        int flag_idx = i;
+        struct ArgClass_ *cls = &job->cls_v[i];
+        i += 1;
+        if (cls->kind == kArgKindSequential)
+            break;
+
+        if (cls->kind == kArgKindSymbol) {
+            enum ArgpxSymbolType type = job->parser->style.symbol_v[cls->idx].type;
+            if (type == kArgpxSymbolStopParsing)
+                stop_parsing = true;
+            else if (type == kArgpxSymbolTerminateProcessing)
+                break;
+        } else if (cls->kind == kArgKindFlag and cls->take_param == true) {
+            char *param = cls->param_start;
+            if (param == NULL) {
+                // taken by the flag, the real parse never sees its class
+                param = i < job->arg_c ? job->arg_v[i] : NULL;
+                i += 1;
+            }
+            if (param != NULL and ParamCanConvertAhead_(cls->conf) == true) {
+                job->conv_v[job->conv_c] = flag_idx;
+                job->conv_c += 1;
+            }
+        }
+    }
+
+    // the rest is only command parameters
+    if (stop_parsing == true)
+        return job->arg_c;
+    return i < job->arg_c ? i : job->arg_c;
+}
+
+/*
+    Phase 3: convert a chunk of conv_v.
+ */
+static void ParallelConvert_(void *job_in, int chunk_idx)
+{
+    struct ParallelJob_ *job = job_in;
+
+    const struct MemSource_ no_mem = {.arena = NULL, .allocator = NULL, .stats = NULL};
+    int end = chunk_idx * ARGPX_PARALLEL_CHUNK + ARGPX_PARALLEL_CHUNK;
+    if (end > job->conv_c)
+        end = job->conv_c;
+    for (int k = chunk_idx * ARGPX_PARALLEL_CHUNK; k < end; k++) {
+        int i = job->conv_v[k];
+        struct ArgClass_ *cls = &job->cls_v[i];
+        const char *param = cls->param_start != NULL ? cls->param_start : job->arg_v[i + 1];
+        // an empty one never gets here in the real parse
+        size_t len = strlen(param);
+        cls->ready.status = len > 0 ? StringToType_(&no_mem, param, len, cls->conf->action_load.param_single.type,
+                                          &cls->ready.value)
+                                    : kArgpxStatusParamInsufficient;
+        cls->has_ready = true;
+    }
+}
+
+/*
+    The same as ParseOneArgument_(), but the argument is classified already.
+
+    return negative: stop, it's an error if the status is set
+ */
+static int ParseClassified_(struct UnifiedData_ *data, char *arg, const struct ArgClass_ *cls, bool *stop_parsing)
+{
+    assert(data != NULL);
+    assert(arg != NULL);
+    assert(cls != NULL);
+    assert(stop_parsing != NULL);
+
+    data->res->current_argv_idx = data->arg_idx;
+    data->res->current_argv_ptr = arg;
+
+    if (*stop_parsing == true)
+        return AppendCommandParameter_(data, arg);
+
+    switch (cls->kind) {
+    case kArgKindParam:
+        return AppendCommandParameter_(data, arg);
+    case kArgKindSymbol:
+        return RunSymbol_(data->parser, cls->idx, stop_parsing);
+    case kArgKindFlag: {
+        data->ready = cls->has_ready == true ? &cls->ready : NULL;
+        int ret = RunAction_(data, &data->parser->group_v[cls->idx], cls->conf, cls->param_start, 0);
+        data->ready = NULL;
+        return ret;
+    }
+    case kArgKindSequential:
+        break;
+    }
+
+    return ParseOneArgument_(data, arg, stop_parsing);
+}
+
+/*
+    The same as ArgpxParseCompiled(), but the work on each argument is shared by the workers of the pool:
+    1. the arguments are classified in parallel: symbol, command parameter, or flag with the config found
+    2. then followed in order, to know which ones are taken by the flag before, or after a stop parsing symbol
+    3. the parameters of the flags are converted to the types in parallel(int, bool, float and double)
+    The actions, the callbacks and the command parameters still go one by one in the calling thread, so the result is
+    exactly the same as the sequential parse, an error included.
+    A composable group or a response file breaks the phase 2, it's parsed as usual and the phase 2 starts again after
+    it.
+
+    It only pays off for a long argv, a short one(or without a pool) is just ArgpxParseCompiled().
+    The option can't have stats. The pool runs one job at a time.
+
+    return the result.status enum(ArgpxStatus) code.
+    Only 0(kArgpxStatusSuccess) is success.
+ */
+int ArgpxParseParallel(struct ArgpxPool *pool, struct ArgpxResult *in_result, int in_arg_c, char **in_arg_v,
+    const struct ArgpxParser *in_parser, struct ArgpxParseOption *in_option)
+{
+    assert(in_result != NULL);
+    assert(in_arg_c >= 0);
+    assert(in_arg_v != NULL);
+    assert(in_parser != NULL);
+    assert(in_option != NULL);
+    // the phase 1 would count the arguments taken as a parameter too
+    assert(in_option->stats == NULL);
+
+    if (pool == NULL or in_arg_c < ARGPX_PARALLEL_CHUNK * 2)
+        return ArgpxParseCompiled(in_result, in_arg_c, in_arg_v, in_parser, in_option);
+
+    struct UnifiedData_ data = {
+        .res = in_result,
+        .arg_c = in_arg_c,
+        .arg_v = in_arg_v,
+        .arg_idx = -1,
+        .parser = in_parser,
+        .opt = *in_option,
+        .mem = {.arena = in_option->arena, .allocator = in_option->allocator, .stats = NULL},
+    };
+    ResultInit_(data.res, &data.opt);
+
+    struct ParallelJob_ job = {
+        .parser = in_parser,
+        .arg_c = in_arg_c,
+        .arg_v = in_arg_v,
+        .cls_v = ArgpxMemAlloc(in_option->allocator, sizeof(struct ArgClass_) * in_arg_c),
+        .conv_v = ArgpxMemAlloc(in_option->allocator, sizeof(int) * in_arg_c),
+        .conv_c = 0,
+    };
+    if (job.cls_v == NULL or job.conv_v == NULL) {
+        ArgpxMemFree(in_option->allocator, job.conv_v);
+        ArgpxMemFree(in_option->allocator, job.cls_v);
+        data.res->status = kArgpxStatusMemoryError;
+        return data.res->status;
+    }
+
+    int chunk_c = (in_arg_c + ARGPX_PARALLEL_CHUNK - 1) / ARGPX_PARALLEL_CHUNK;
+    ArgpxPoolRun(pool, chunk_c, ParallelClassify_, &job);
+
+    bool stop_parsing = false;
+    int segment_end = 0;
+    while (true) {
+        // a segment is over, and it's not in a response file
+        if (data.response_depth == 0 and data.arg_idx + 1 >= segment_end and data.arg_idx + 1 < in_arg_c) {
+            segment_end = ParallelStitch_(&job, data.arg_idx + 1, stop_parsing);
+            int conv_chunk_c = (job.conv_c + ARGPX_PARALLEL_CHUNK - 1) / ARGPX_PARALLEL_CHUNK;
+            // a few of them are not worth waking the workers
+            ArgpxPoolRun(conv_chunk_c > 1 ? pool : NULL, conv_chunk_c, ParallelConvert_, &job);
+        }
+
+        int last_idx = data.arg_idx;
+        char *arg = NextArgument_(&data, false);
+        if (arg == NULL)
+            break;
+
+        int ret;
+        if (data.arg_idx != last_idx)
+            ret = ParseClassified_(&data, arg, &job.cls_v[data.arg_idx], &stop_parsing);
+        else
+            ret = ParseOneArgument_(&data, arg, &stop_parsing);
+        if (ret < 0)
+            break;
+    }
+
+    ArgpxMemFree(in_option->allocator, job.conv_v);
+    ArgpxMemFree(in_option->allocator, job.cls_v);
+    return data.res->status;
+}
+
+/*
+    The parser of ArgpxParse() lives in an arena on its stack, frees are left to ArgpxArenaFree().
+ */
+static void *OneShotAlloc_(void *ctx, size_t size)
+{
+    return ArgpxArenaAlloc(ctx, size);
+}
+
+static void *OneShotRealloc_(void *ctx, void *ptr, size_t old_size, size_t new_size)
+{
+    return ArgpxArenaRealloc(ctx, ptr, old_size, new_size);
+}
+
+static void OneShotFree_(void *ctx, void *ptr)
+{
+    (void)ctx;
+    (void)ptr;
+}
+
+/*
+    The one-shot version of ArgpxCompile() + ArgpxParseCompiled().
+    If the same style and flag set will be parsed many times, compile them once instead.
+    The parser is built in a stack buffer, only a big config makes it take the heap.
+    Like ArgpxCompile(), every group and flag is checked first, so a bad one is kArgpxStatusConfigInvalid even if the
+    argv never reaches it.
+
+    return the result.status enum(ArgpxStatus) code.
+    Only 0(kArgpxStatusSuccess) is success.
+ */
+int ArgpxParse(struct ArgpxResult *in_result, int in_arg_c, char **in_arg_v, struct ArgpxStyle *in_style,
+    struct ArgpxFlagSet *in_flag, struct ArgpxParseOption *in_option)
+{
+    assert(in_result != NULL);
+    assert(in_arg_c >= 0);
+    assert(in_arg_v != NULL);
+    assert(in_style != NULL);
+    assert(in_flag != NULL);
+    assert(in_option != NULL);
+
+    char local_buf[ARGPX_ONESHOT_LOCAL_SIZE];
+    struct ArgpxArena arena;
+    ArgpxArenaInit(&arena, local_buf, sizeof(local_buf), true);
+    arena.allocator = in_option->allocator;
+    const struct ArgpxAllocator local_allocator = {
+        .alloc_fn = OneShotAlloc_,
+        .realloc_fn = OneShotRealloc_,
+        .free_fn = OneShotFree_,
+        .ctx = &arena,
+    };
+    // only the build takes the local allocator, the parse output still goes where the caller says
+    struct ArgpxParseOption build_option = *in_option;
+    build_option.allocator = &local_allocator;
+
+    struct ArgpxParser parser;
+    int status = ParserInit_(&parser, in_style, in_flag, &build_option);
+    if (status == kArgpxStatusSuccess) {
+        status = ArgpxParseCompiled(in_result, in_arg_c, in_arg_v, &parser, in_option);
+    } else {
+        ResultInit_(in_result, in_option);
+        in_result->status = status;
+    }
+
+    ArgpxArenaFree(&arena);
+    return status;
+}
@@ -0,0 +1,56 @@
+#include <assert.h>
+#include <iso646.h>
+#include <stdlib.h>
+
+#include "argpx_alloc.h"
+
+/*
+    The only place in the library calls malloc() and friends.
+    A NULL allocator means the C standard library.
+ */
+
+/*
+    return NULL: error
+ */
+void *ArgpxMemAlloc(const struct ArgpxAllocator *allocator, size_t size)
+{
+    if (allocator == NULL)
+        return malloc(size);
+
+    assert(allocator->alloc_fn != NULL);
+    return allocator->alloc_fn(allocator->ctx, size);
+}
+
+/*
+    A NULL ptr works like ArgpxMemAlloc().
+
+    return NULL: error, the old memory is untouched
+ */
+void *ArgpxMemRealloc(const struct ArgpxAllocator *allocator, void *ptr, size_t old_size, size_t new_size)
+{
+    if (allocator == NULL)
+        return realloc(ptr, new_size);
+
+    if (ptr == NULL)
+        return ArgpxMemAlloc(allocator, new_size);
+
+    assert(allocator->realloc_fn != NULL);
+    return allocator->realloc_fn(allocator->ctx, ptr, old_size, new_size);
+}
+
+/*
+    A NULL ptr is fine, like free().
+ */
+void ArgpxMemFree(const struct ArgpxAllocator *allocator, void *ptr)
+{
+    if (ptr == NULL)
+        return;
+
+    if (allocator == NULL) {
+        free(ptr);
+        return;
+    }
+
+    assert(allocator->free_fn != NULL);
+    allocator->free_fn(allocator->ctx, ptr);
+}
@@ -0,0 +1,12 @@
+#ifndef ARGPX_ALLOC_H_
+#define ARGPX_ALLOC_H_
+
+#include <stdlib.h>
+
+#include "argpx/argpx.h"
+
+void *ArgpxMemAlloc(const struct ArgpxAllocator *allocator, size_t size);
+void *ArgpxMemRealloc(const struct ArgpxAllocator *allocator, void *ptr, size_t old_size, size_t new_size);
+void ArgpxMemFree(const struct ArgpxAllocator *allocator, void *ptr);
+
+#endif
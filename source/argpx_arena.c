@@ -0,0 +1,185 @@
+#include <assert.h>
+#include <iso646.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argpx_alloc.h"
+#include "argpx_arena.h"
+
+// enough for any of the types the library puts in
+#define ARGPX_ARENA_ALIGN 16
+// the first library block when the arena starts empty
+#define ARGPX_ARENA_MIN_BLOCK 4096
+
+/*
+    The head of every block allocated by the library, the data follows it.
+ */
+struct ArenaBlock_ {
+    struct ArenaBlock_ *next;
+    size_t size;
+};
+
+static size_t AlignUp_(size_t size)
+{
+    return (size + ARGPX_ARENA_ALIGN - 1) & ~(size_t)(ARGPX_ARENA_ALIGN - 1);
+}
+
+// the data of a block starts here
+#define ARGPX_ARENA_BLOCK_HEAD AlignUp_(sizeof(struct ArenaBlock_))
+
+/*
+    The buf can be NULL, then the first block will be allocated on demand.
+    A non-growable arena only uses the given buf.
+ */
+void ArgpxArenaInit(struct ArgpxArena *arena, void *buf, size_t size, bool growable)
+{
+    assert(arena != NULL);
+    assert(buf != NULL or size == 0);
+
+    // the user buffer may not be aligned
+    uintptr_t pad = buf == NULL ? 0 : (ARGPX_ARENA_ALIGN - (uintptr_t)buf % ARGPX_ARENA_ALIGN) % ARGPX_ARENA_ALIGN;
+    if (pad > size)
+        pad = size;
+
+    *arena = (struct ArgpxArena){
+        .buf = buf == NULL ? NULL : (char *)buf + pad,
+        .size = size - pad,
+        .used = 0,
+        .growable = growable,
+        .chain = NULL,
+        .chain_size = 0,
+        .allocator = NULL,
+    };
+}
+
+/*
+    Switch to a new library block which has at least "need" bytes.
+
+    return negative: error
+ */
+static int ArenaGrow_(struct ArgpxArena *arena, size_t need)
+{
+    assert(arena != NULL);
+
+    size_t size = arena->size * 2;
+    if (size < ARGPX_ARENA_MIN_BLOCK)
+        size = ARGPX_ARENA_MIN_BLOCK;
+    if (size < need)
+        size = need;
+
+    struct ArenaBlock_ *block = ArgpxMemAlloc(arena->allocator, ARGPX_ARENA_BLOCK_HEAD + size);
+    if (block == NULL)
+        return -1;
+
+    *block = (struct ArenaBlock_){.next = arena->chain, .size = size};
+    arena->chain = block;
+    arena->chain_size += size;
+
+    arena->buf = (char *)block + ARGPX_ARENA_BLOCK_HEAD;
+    arena->size = size;
+    arena->used = 0;
+
+    return 0;
+}
+
+/*
+    return NULL: error
+ */
+void *ArgpxArenaAlloc(struct ArgpxArena *arena, size_t size)
+{
+    assert(arena != NULL);
+
+    size = AlignUp_(size);
+    if (arena->size - arena->used < size) {
+        if (arena->growable == false or ArenaGrow_(arena, size) < 0)
+            return NULL;
+    }
+
+    void *ptr = arena->buf + arena->used;
+    arena->used += size;
+
+    return ptr;
+}
+
+/*
+    If ptr is the last allocation, it will grow in place. Otherwise a new one is allocated and the content is copied.
+
+    return NULL: error, the old memory is still usable
+ */
+void *ArgpxArenaRealloc(struct ArgpxArena *arena, void *ptr, size_t old_size, size_t new_size)
+{
+    assert(arena != NULL);
+
+    if (ptr == NULL)
+        return ArgpxArenaAlloc(arena, new_size);
+
+    old_size = AlignUp_(old_size);
+    if ((char *)ptr + old_size == arena->buf + arena->used and AlignUp_(new_size) - old_size <= arena->size - arena->used)
+    {
+        arena->used += AlignUp_(new_size) - old_size;
+        return ptr;
+    }
+
+    void *new_ptr = ArgpxArenaAlloc(arena, new_size);
+    if (new_ptr == NULL)
+        return NULL;
+    memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+
+    return new_ptr;
+}
+
+static void ArenaFreeChain_(struct ArgpxArena *arena)
+{
+    assert(arena != NULL);
+
+    struct ArenaBlock_ *block = arena->chain;
+    while (block != NULL) {
+        struct ArenaBlock_ *next = block->next;
+        ArgpxMemFree(arena->allocator, block);
+        block = next;
+    }
+    arena->chain = NULL;
+    arena->chain_size = 0;
+}
+
+/*
+    Release everything allocated from the arena, but keep the capacity.
+    If the arena has grown, the blocks are merged into a single one, so the next round won't need to grow again.
+    After that, it's just a reset of the counter.
+ */
+void ArgpxArenaReset(struct ArgpxArena *arena)
+{
+    assert(arena != NULL);
+
+    struct ArenaBlock_ *block = arena->chain;
+    if (block == NULL or block->next == NULL) {
+        // zero or one block, it's the current one
+        arena->used = 0;
+        return;
+    }
+
+    size_t total = arena->chain_size;
+    ArenaFreeChain_(arena);
+
+    arena->size = 0;
+    if (ArenaGrow_(arena, total) < 0) {
+        // nothing to use now, it will try again on the next allocation
+        arena->buf = NULL;
+        arena->size = 0;
+    }
+    arena->used = 0;
+}
+
+/*
+    Free the library blocks. A user buffer is never touched.
+ */
+void ArgpxArenaFree(struct ArgpxArena *arena)
+{
+    assert(arena != NULL);
+
+    ArenaFreeChain_(arena);
+    arena->buf = NULL;
+    arena->size = 0;
+    arena->used = 0;
+}
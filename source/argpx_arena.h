@@ -0,0 +1,11 @@
+#ifndef ARGPX_ARENA_H_
+#define ARGPX_ARENA_H_
+
+#include <stdlib.h>
+
+#include "argpx/argpx.h"
+
+void *ArgpxArenaAlloc(struct ArgpxArena *arena, size_t size);
+void *ArgpxArenaRealloc(struct ArgpxArena *arena, void *ptr, size_t old_size, size_t new_size);
+
+#endif
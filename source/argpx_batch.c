@@ -0,0 +1,357 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <assert.h>
+#include <iso646.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "argpx/argpx.h"
+#include "argpx_alloc.h"
+#include "argpx_batch.h"
+
+// the most items a worker takes from its own range at once, fewer locks but coarser stealing
+#define ARGPX_BATCH_CHUNK 16
+
+/*
+    The items [next, end) still waiting for a worker.
+    The owner takes from "next", a thief cuts off the upper half by moving "end".
+ */
+struct BatchRange_ {
+    pthread_mutex_t lock;
+    int next;
+    int end;
+};
+
+// keep the ranges of different workers on different cache lines
+union BatchRangeSlot_ {
+    struct BatchRange_ range;
+    char pad[128];
+};
+
+struct BatchWorker_ {
+    struct ArgpxPool *pool;
+    int idx;
+};
+
+struct ArgpxPool {
+    const struct ArgpxAllocator *allocator;
+    int thread_c;
+    pthread_t *thread_v;
+    struct BatchWorker_ *worker_v;
+    union BatchRangeSlot_ *range_v;
+
+    // protects everything below
+    pthread_mutex_t lock;
+    // a new job or quit
+    pthread_cond_t job_cond;
+    // the last worker finished the job
+    pthread_cond_t done_cond;
+    unsigned long job_seq;
+    int busy_c;
+    bool quit;
+
+    // the current job, read only for the workers
+    ArgpxPoolJobFn job_fn;
+    void *job_ctx;
+};
+
+/*
+    Take up to ARGPX_BATCH_CHUNK items from the front, they are [*out_start, return value).
+
+    return negative: nothing left in this range
+ */
+static int RangeTake_(struct BatchRange_ *range, int *out_start)
+{
+    assert(range != NULL);
+    assert(out_start != NULL);
+
+    int end = -1;
+    pthread_mutex_lock(&range->lock);
+    int left = range->end - range->next;
+    if (left > 0) {
+        // leave the half to the thieves if it's not much
+        int take = left / 2 < ARGPX_BATCH_CHUNK ? (left + 1) / 2 : ARGPX_BATCH_CHUNK;
+        *out_start = range->next;
+        range->next += take;
+        end = range->next;
+    }
+    pthread_mutex_unlock(&range->lock);
+
+    return end;
+}
+
+/*
+    Move the upper half of some other worker's range to "thief".
+    Only the thief itself writes a new range to its own slot, so the owner never loses anything it has taken.
+
+    return negative: all the ranges are empty
+ */
+static int RangeSteal_(struct ArgpxPool *pool, int thief)
+{
+    assert(pool != NULL);
+
+    for (int i = 1; i < pool->thread_c; i++) {
+        struct BatchRange_ *victim = &pool->range_v[(thief + i) % pool->thread_c].range;
+
+        pthread_mutex_lock(&victim->lock);
+        int left = victim->end - victim->next;
+        if (left <= 0) {
+            pthread_mutex_unlock(&victim->lock);
+            continue;
+        }
+        int mid = victim->next + left / 2;
+        int end = victim->end;
+        victim->end = mid;
+        pthread_mutex_unlock(&victim->lock);
+
+        struct BatchRange_ *own = &pool->range_v[thief].range;
+        pthread_mutex_lock(&own->lock);
+        own->next = mid;
+        own->end = end;
+        pthread_mutex_unlock(&own->lock);
+        return 0;
+    }
+
+    return -1;
+}
+
+static void BatchRun_(struct ArgpxPool *pool, int worker_idx)
+{
+    assert(pool != NULL);
+
+    struct BatchRange_ *own = &pool->range_v[worker_idx].range;
+    while (true) {
+        int start;
+        int end = RangeTake_(own, &start);
+        if (end < 0) {
+            if (RangeSteal_(pool, worker_idx) < 0)
+                return;
+            continue;
+        }
+
+        for (int i = start; i < end; i++)
+            pool->job_fn(pool->job_ctx, i);
+    }
+}
+
+static void *BatchWorker_(void *worker_in)
+{
+    struct BatchWorker_ *worker = worker_in;
+    struct ArgpxPool *pool = worker->pool;
+
+    unsigned long seen_seq = 0;
+    while (true) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->quit == false and pool->job_seq == seen_seq)
+            pthread_cond_wait(&pool->job_cond, &pool->lock);
+        if (pool->quit == true) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen_seq = pool->job_seq;
+        pthread_mutex_unlock(&pool->lock);
+
+        BatchRun_(pool, worker->idx);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->busy_c -= 1;
+        if (pool->busy_c == 0)
+            pthread_cond_signal(&pool->done_cond);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+/*
+    Stop and join the first "started_c" threads, then release the pool.
+ */
+static void PoolDestroy_(struct ArgpxPool *pool, int started_c)
+{
+    assert(pool != NULL);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast(&pool->job_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < started_c; i++)
+        pthread_join(pool->thread_v[i], NULL);
+
+    for (int i = 0; i < pool->thread_c; i++)
+        pthread_mutex_destroy(&pool->range_v[i].range.lock);
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->job_cond);
+    pthread_mutex_destroy(&pool->lock);
+
+    const struct ArgpxAllocator *allocator = pool->allocator;
+    ArgpxMemFree(allocator, pool->range_v);
+    ArgpxMemFree(allocator, pool->worker_v);
+    ArgpxMemFree(allocator, pool->thread_v);
+    ArgpxMemFree(allocator, pool);
+}
+
+/*
+    Start thread_c worker threads, if thread_c <= 0, one for each online CPU.
+    The allocator is only for the pool itself.
+
+    return ArgpxStatus code, *out_pool is set only on kArgpxStatusSuccess.
+ */
+int ArgpxPoolCreate(struct ArgpxPool **out_pool, int thread_c, const struct ArgpxAllocator *allocator)
+{
+    assert(out_pool != NULL);
+
+    *out_pool = NULL;
+
+    if (thread_c <= 0) {
+        long cpu_c = sysconf(_SC_NPROCESSORS_ONLN);
+        thread_c = cpu_c > 0 ? (int)cpu_c : 1;
+    }
+
+    struct ArgpxPool *pool = ArgpxMemAlloc(allocator, sizeof(struct ArgpxPool));
+    if (pool == NULL)
+        return kArgpxStatusMemoryError;
+    *pool = (struct ArgpxPool){
+        .allocator = allocator,
+        .thread_c = thread_c,
+        .job_seq = 0,
+        .busy_c = 0,
+        .quit = false,
+    };
+
+    pool->thread_v = ArgpxMemAlloc(allocator, sizeof(pthread_t) * thread_c);
+    pool->worker_v = ArgpxMemAlloc(allocator, sizeof(struct BatchWorker_) * thread_c);
+    pool->range_v = ArgpxMemAlloc(allocator, sizeof(union BatchRangeSlot_) * thread_c);
+    if (pool->thread_v == NULL or pool->worker_v == NULL or pool->range_v == NULL) {
+        ArgpxMemFree(allocator, pool->range_v);
+        ArgpxMemFree(allocator, pool->worker_v);
+        ArgpxMemFree(allocator, pool->thread_v);
+        ArgpxMemFree(allocator, pool);
+        return kArgpxStatusMemoryError;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->job_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+    for (int i = 0; i < thread_c; i++) {
+        pthread_mutex_init(&pool->range_v[i].range.lock, NULL);
+        pool->range_v[i].range.next = 0;
+        pool->range_v[i].range.end = 0;
+    }
+
+    for (int i = 0; i < thread_c; i++) {
+        pool->worker_v[i] = (struct BatchWorker_){.pool = pool, .idx = i};
+        if (pthread_create(&pool->thread_v[i], NULL, BatchWorker_, &pool->worker_v[i]) != 0) {
+            PoolDestroy_(pool, i);
+            return kArgpxStatusMemoryError;
+        }
+    }
+
+    *out_pool = pool;
+    return kArgpxStatusSuccess;
+}
+
+void ArgpxPoolFree(struct ArgpxPool *pool)
+{
+    if (pool == NULL)
+        return;
+
+    PoolDestroy_(pool, pool->thread_c);
+}
+
+/*
+    Run fn on every index, the indexes are split evenly to the workers first, a worker that runs out steals half of
+    the other's rest. It returns when all of them are done.
+    If pool is NULL, all of them run in the calling thread.
+    One pool runs one job at a time.
+ */
+void ArgpxPoolRun(struct ArgpxPool *pool, int item_c, ArgpxPoolJobFn fn, void *ctx)
+{
+    assert(item_c >= 0);
+    assert(fn != NULL);
+
+    if (pool == NULL) {
+        for (int i = 0; i < item_c; i++)
+            fn(ctx, i);
+        return;
+    }
+    if (item_c == 0)
+        return;
+
+    for (int i = 0; i < pool->thread_c; i++) {
+        struct BatchRange_ *range = &pool->range_v[i].range;
+        pthread_mutex_lock(&range->lock);
+        range->next = (int)((long long)item_c * i / pool->thread_c);
+        range->end = (int)((long long)item_c * (i + 1) / pool->thread_c);
+        pthread_mutex_unlock(&range->lock);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->job_fn = fn;
+    pool->job_ctx = ctx;
+    pool->busy_c = pool->thread_c;
+    pool->job_seq += 1;
+    pthread_cond_broadcast(&pool->job_cond);
+    while (pool->busy_c > 0)
+        pthread_cond_wait(&pool->done_cond, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+struct BatchJob_ {
+    struct ArgpxBatchItem *item_v;
+    const struct ArgpxParser *parser;
+    const struct ArgpxParseOption *option;
+};
+
+/*
+    The option of each item only differs in .out_base.
+ */
+static void BatchParseItem_(void *job_in, int idx)
+{
+    struct BatchJob_ *job = job_in;
+    struct ArgpxBatchItem *item = &job->item_v[idx];
+
+    struct ArgpxParseOption item_opt = *job->option;
+    if (item->out_base != NULL)
+        item_opt.out_base = item->out_base;
+    ArgpxParseCompiled(&item->res, item->arg_c, item->arg_v, job->parser, &item_opt);
+}
+
+/*
+    Parse every item with the same parser, it's the same as ArgpxParseCompiled() on each of them.
+    The items go to the workers by ArgpxPoolRun(), if pool is NULL, all of them are parsed in the calling thread.
+
+    Every item has its own result, and the status of the items are not merged.
+    The flag set is shared, so the parameter actions must use .bind_offset with a record for each item(.out_base),
+    or it's kArgpxStatusConfigInvalid for all of the items. The others only write to their targets, see README.
+    The option can't have an arena or stats, and its allocator must be thread-safe.
+    One pool runs one batch at a time.
+
+    return ArgpxStatus code, kArgpxStatusSuccess means all of the items are successful.
+ */
+int ArgpxParseBatch(struct ArgpxPool *pool, struct ArgpxBatchItem *item_v, int item_c, const struct ArgpxParser *parser,
+    struct ArgpxParseOption *option)
+{
+    assert(item_v != NULL or item_c == 0);
+    assert(parser != NULL);
+    assert(option != NULL);
+    // an arena is not thread-safe, and the counters would be mixed
+    assert(option->arena == NULL);
+    assert(option->stats == NULL);
+
+    if (ArgpxParserWritesFlagSet(parser) == true) {
+        // still a result for ArgpxResultFree()
+        for (int i = 0; i < item_c; i++)
+            item_v[i].res = (struct ArgpxResult){.status = kArgpxStatusConfigInvalid, .allocator = option->allocator};
+        return kArgpxStatusConfigInvalid;
+    }
+
+    struct BatchJob_ job = {.item_v = item_v, .parser = parser, .option = option};
+    ArgpxPoolRun(pool, item_c, BatchParseItem_, &job);
+
+    for (int i = 0; i < item_c; i++) {
+        if (item_v[i].res.status != kArgpxStatusSuccess)
+            return item_v[i].res.status;
+    }
+    return kArgpxStatusSuccess;
+}
@@ -0,0 +1,14 @@
+#ifndef ARGPX_BATCH_H_
+#define ARGPX_BATCH_H_
+
+#include "argpx/argpx.h"
+
+/*
+    A job of the pool, it's called once for each index in [0, item_c), in any order and any thread.
+ */
+typedef void (*ArgpxPoolJobFn)(void *ctx, int idx);
+
+void ArgpxPoolRun(struct ArgpxPool *pool, int item_c, ArgpxPoolJobFn fn, void *ctx);
+bool ArgpxParserWritesFlagSet(const struct ArgpxParser *parser);
+
+#endif
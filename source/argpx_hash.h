@@ -8,6 +8,6 @@
 
 #define ARGPX_HASH_FNV1A_32_PRIME ((uint32_t)0x01000193)
 
-uint32_t ArgpxHashFnv1aB32(void *buf_in, size_t buf_size, uint32_t hash);
+uint32_t ArgpxHashFnv1aB32(const void *buf_in, size_t buf_size, uint32_t hash);
 
 #endif
@@ -0,0 +1,190 @@
+// for MAP_ANONYMOUS
+#define _DEFAULT_SOURCE
+
+#include <assert.h>
+#include <fcntl.h>
+#include <iso646.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "argpx_response.h"
+#include "argpx_token.h"
+
+/*
+    A response file is mapped privately(copy on write) and tokenized in place, a token is a pointer into the mapping.
+    Nothing is allocated: the mapping is one byte longer than the file, so the last token always has a place for its
+    NUL, and the node of the mapping list lives after that byte.
+
+    The quoting rules are the same as GCC's @file:
+    - whitespace separates the tokens, NUL counts as whitespace
+    - '...' and "..." keep the whitespace, the quotes are removed
+    - a backslash takes the next byte as it is, even in the quotes
+    - a quote left open at the end of the file is an error(kArgpxStatusUnclosedQuote)
+ */
+
+struct ResponseMapping_ {
+    struct ResponseMapping_ *next;
+    void *addr;
+    size_t len;
+};
+
+// 1: separator, 2: quote or escape, the tokenizer only slows down on them
+static const unsigned char response_class_v[UCHAR_MAX + 1] = {
+    ['\0'] = 1,
+    [' '] = 1,
+    ['\t'] = 1,
+    ['\n'] = 1,
+    ['\v'] = 1,
+    ['\f'] = 1,
+    ['\r'] = 1,
+    ['\''] = 2,
+    ['"'] = 2,
+    ['\\'] = 2,
+};
+
+/*
+    Map the file at "path", and link the mapping to the list for ArgpxResponseUnmapAll().
+
+    return ArgpxStatus code
+ */
+int ArgpxResponseOpen(struct ArgpxResponse *rsp, const char *path, void **mapping_list)
+{
+    assert(rsp != NULL);
+    assert(path != NULL);
+    assert(mapping_list != NULL);
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return kArgpxStatusIoError;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return kArgpxStatusIoError;
+    }
+    size_t file_len = (size_t)st.st_size;
+
+    // the NUL byte, then the node at an aligned offset
+    size_t node_offset = (file_len + 1 + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *);
+    size_t map_len = node_offset + sizeof(struct ResponseMapping_);
+
+    // reserve the whole range, then put the file over the front of it
+    char *addr = mmap(NULL, map_len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+        close(fd);
+        return kArgpxStatusMemoryError;
+    }
+    if (file_len > 0) {
+        // every page will be written, so fault them all in at once
+        int populate = 0;
+#ifdef MAP_POPULATE
+        populate = MAP_POPULATE;
+#endif
+        void *file_addr = mmap(addr, file_len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED | populate, fd, 0);
+        if (file_addr == MAP_FAILED) {
+            munmap(addr, map_len);
+            close(fd);
+            return kArgpxStatusIoError;
+        }
+        posix_madvise(addr, file_len, POSIX_MADV_SEQUENTIAL);
+    }
+    close(fd);
+
+    struct ResponseMapping_ *node = (struct ResponseMapping_ *)(addr + node_offset);
+    *node = (struct ResponseMapping_){.next = *mapping_list, .addr = addr, .len = map_len};
+    *mapping_list = node;
+
+    *rsp = (struct ArgpxResponse){.pos = addr, .end = addr + file_len, .status = kArgpxStatusSuccess};
+    return kArgpxStatusSuccess;
+}
+
+/*
+    Cut the next token in place, the quotes and escapes are removed by moving the rest of it forward.
+
+    return NULL: no more token, or an error and rsp->status is set
+ */
+char *ArgpxResponseNext(struct ArgpxResponse *rsp)
+{
+    assert(rsp != NULL);
+
+    if (rsp->status != kArgpxStatusSuccess)
+        return NULL;
+
+    char *read_ptr = rsp->pos;
+    char *end = rsp->end;
+    while (read_ptr < end and response_class_v[(unsigned char)*read_ptr] == 1)
+        read_ptr++;
+    if (read_ptr == end) {
+        rsp->pos = read_ptr;
+        return NULL;
+    }
+
+    char *token = read_ptr;
+    // the common token has nothing to remove, so nothing is moved
+    read_ptr += ArgpxTokenPlainLen(read_ptr, end - read_ptr);
+    while (read_ptr < end and response_class_v[(unsigned char)*read_ptr] == 0)
+        read_ptr++;
+
+    char *write_ptr = read_ptr;
+    bool single_quote = false;
+    bool double_quote = false;
+    bool escape = false;
+    for (; read_ptr < end; read_ptr++) {
+        char c = *read_ptr;
+        if (escape == true) {
+            escape = false;
+            *write_ptr++ = c;
+        } else if (c == '\\') {
+            escape = true;
+        } else if (single_quote == true) {
+            if (c == '\'')
+                single_quote = false;
+            else
+                *write_ptr++ = c;
+        } else if (double_quote == true) {
+            if (c == '"')
+                double_quote = false;
+            else
+                *write_ptr++ = c;
+        } else if (response_class_v[(unsigned char)c] == 1) {
+            break;
+        } else if (c == '\'') {
+            single_quote = true;
+        } else if (c == '"') {
+            double_quote = true;
+        } else {
+            *write_ptr++ = c;
+        }
+    }
+
+    if (single_quote == true or double_quote == true) {
+        rsp->pos = end;
+        rsp->status = kArgpxStatusUnclosedQuote;
+        return NULL;
+    }
+
+    // write_ptr <= read_ptr, and "end" itself is the spare byte
+    *write_ptr = '\0';
+    rsp->pos = read_ptr < end ? read_ptr + 1 : end;
+    return token;
+}
+
+/*
+    Unmap every file of the list, and empty it.
+ */
+void ArgpxResponseUnmapAll(void **mapping_list)
+{
+    assert(mapping_list != NULL);
+
+    struct ResponseMapping_ *node = *mapping_list;
+    while (node != NULL) {
+        // the node is in the mapping
+        struct ResponseMapping_ *next = node->next;
+        munmap(node->addr, node->len);
+        node = next;
+    }
+    *mapping_list = NULL;
+}
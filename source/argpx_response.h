@@ -0,0 +1,23 @@
+#ifndef ARGPX_RESPONSE_H_
+#define ARGPX_RESPONSE_H_
+
+#include <stdlib.h>
+
+#include "argpx/argpx.h"
+
+/*
+    The tokenizing state of a mapped response file, see argpx_response.c.
+ */
+struct ArgpxResponse {
+    // the next byte to read
+    char *pos;
+    char *end;
+    // not kArgpxStatusSuccess: the file is broken, no more token is given
+    enum ArgpxStatus status;
+};
+
+int ArgpxResponseOpen(struct ArgpxResponse *rsp, const char *path, void **mapping_list);
+char *ArgpxResponseNext(struct ArgpxResponse *rsp);
+void ArgpxResponseUnmapAll(void **mapping_list);
+
+#endif
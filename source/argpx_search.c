@@ -0,0 +1,258 @@
+#include <assert.h>
+#include <iso646.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "argpx_search.h"
+
+#ifdef ARGPX_SEARCH_X86
+#include <immintrin.h>
+#endif
+
+/*
+    The needles are the assigners and delimiters of the groups, almost always 1 to 3 bytes. The haystack may be a
+    long flag parameter, like a list of 64KB.
+
+    The vector kernels compare a block with the first byte of the needle, and the block needle_len - 1 bytes later with
+    the last byte, a candidate hits on both ends(the trick of "SIMD-friendly algorithms for substring searching").
+    Only the middle bytes of a candidate are compared one by one, it's nothing for the short needles.
+    A block is 64 bytes, its candidates are one 64 bit mask. The rest of the haystack(and a short one) is left to
+    16 byte blocks, then an 8 byte word and bytes. The scalar kernel only has the last two.
+
+    The kernel is picked by ArgpxSearchResolve() with the CPU of the runtime, the library isn't built for one.
+ */
+
+/*
+    The state of a search, shared by the block and byte loops.
+ */
+struct SearchState_ {
+    const char *haystack;
+    const char *needle;
+    size_t needle_len;
+    const char **hit_v;
+    size_t hit_cap;
+    size_t hit_c;
+    // a candidate before it overlaps the last hit
+    size_t next;
+};
+
+/*
+    Take a candidate at haystack[pos], the first and the last byte are already equal.
+
+    return true: hit_v is full
+ */
+static inline bool SearchTake_(struct SearchState_ *st, size_t pos)
+{
+    if (pos < st->next)
+        return false;
+    if (st->needle_len > 2 and memcmp(st->haystack + pos + 1, st->needle + 1, st->needle_len - 2) != 0)
+        return false;
+
+    st->hit_v[st->hit_c] = st->haystack + pos;
+    st->hit_c += 1;
+    st->next = pos + st->needle_len;
+    return st->hit_c == st->hit_cap;
+}
+
+/*
+    0x80 in every zero byte of word, and nothing else.
+ */
+static inline uint64_t SearchZeroBytes_(uint64_t word)
+{
+    const uint64_t low7 = UINT64_MAX / 255 * 0x7f;
+    return ~(((word & low7) + low7) | word | low7);
+}
+
+/*
+    Search the rest of the haystack from "start", 8 candidates at a time with a word, then byte by byte.
+ */
+static inline size_t SearchBytes_(struct SearchState_ *st, size_t start, size_t haystack_len)
+{
+    char first = st->needle[0];
+    char last = st->needle[st->needle_len - 1];
+    size_t last_off = st->needle_len - 1;
+    const uint64_t first_8 = UINT64_MAX / 255 * (unsigned char)first;
+    const uint64_t last_8 = UINT64_MAX / 255 * (unsigned char)last;
+
+    size_t i = start;
+    for (; haystack_len - i >= 8; i += 8) {
+        uint64_t word;
+        memcpy(&word, st->haystack + i, sizeof(word));
+        uint64_t zero = SearchZeroBytes_(word ^ first_8);
+        // the last word of a short haystack is filtered by the first byte only
+        if (haystack_len - i >= 8 + last_off) {
+            memcpy(&word, st->haystack + i + last_off, sizeof(word));
+            zero &= SearchZeroBytes_(word ^ last_8);
+        }
+        if (zero == 0)
+            continue;
+        // the byte order of the word doesn't matter this way
+        for (size_t j = i; j < i + 8 and j + last_off < haystack_len; j++) {
+            if (st->haystack[j] == first and st->haystack[j + last_off] == last and SearchTake_(st, j) == true)
+                return st->hit_c;
+        }
+    }
+    for (; i + last_off < haystack_len; i++) {
+        if (st->haystack[i] == first and st->haystack[i + last_off] == last and SearchTake_(st, i) == true)
+            break;
+    }
+    return st->hit_c;
+}
+
+/*
+    return false: nothing to search, hit_c is the result already
+ */
+static bool SearchStart_(struct SearchState_ *st, const char *haystack, size_t haystack_len, const char *needle,
+    size_t needle_len, const char **hit_v, size_t hit_cap)
+{
+    assert(haystack != NULL);
+    assert(needle != NULL);
+    assert(hit_v != NULL);
+
+    *st = (struct SearchState_){
+        .haystack = haystack,
+        .needle = needle,
+        .needle_len = needle_len,
+        .hit_v = hit_v,
+        .hit_cap = hit_cap,
+        .hit_c = 0,
+        .next = 0,
+    };
+    if (hit_cap == 0)
+        return false;
+    // the same as strstr(), an empty needle is at the start
+    if (needle_len == 0) {
+        hit_v[0] = haystack;
+        st->hit_c = 1;
+        return false;
+    }
+    return needle_len <= haystack_len;
+}
+
+size_t ArgpxSearchScalar(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len,
+    const char **hit_v, size_t hit_cap)
+{
+    struct SearchState_ st;
+    if (SearchStart_(&st, haystack, haystack_len, needle, needle_len, hit_v, hit_cap) == false)
+        return st.hit_c;
+    return SearchBytes_(&st, 0, haystack_len);
+}
+
+#ifdef ARGPX_SEARCH_X86
+
+/*
+    Take every candidate of a block at haystack[base], bit n of mask is the one at base + n.
+    Only the vector kernels make a mask, and they're all GNU C(see ARGPX_SEARCH_X86).
+
+    return true: hit_v is full
+ */
+static inline bool SearchTakeMask_(struct SearchState_ *st, size_t base, uint64_t mask)
+{
+    while (mask != 0) {
+        if (SearchTake_(st, base + (size_t)__builtin_ctzll(mask)) == true)
+            return true;
+        mask &= mask - 1;
+    }
+    return false;
+}
+
+__attribute__((target("sse2"))) static inline uint64_t SearchMaskSse2_(
+    const char *ptr, size_t last_off, __m128i first, __m128i last)
+{
+    __m128i block_first = _mm_loadu_si128((const __m128i *)ptr);
+    __m128i block_last = _mm_loadu_si128((const __m128i *)(ptr + last_off));
+    __m128i hit = _mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last));
+    return (uint32_t)_mm_movemask_epi8(hit);
+}
+
+__attribute__((target("sse2"))) size_t ArgpxSearchSse2(const char *haystack, size_t haystack_len, const char *needle,
+    size_t needle_len, const char **hit_v, size_t hit_cap)
+{
+    struct SearchState_ st;
+    if (SearchStart_(&st, haystack, haystack_len, needle, needle_len, hit_v, hit_cap) == false)
+        return st.hit_c;
+    // too short for a vector, don't even set one up
+    if (haystack_len < 16 + needle_len - 1)
+        return SearchBytes_(&st, 0, haystack_len);
+
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needle_len - 1]);
+    size_t last_off = needle_len - 1;
+    // the last candidate of a block needs last_off more bytes
+    size_t i = 0;
+    for (; haystack_len - i >= 64 + last_off; i += 64) {
+        uint64_t mask = SearchMaskSse2_(haystack + i, last_off, first, last)
+            | SearchMaskSse2_(haystack + i + 16, last_off, first, last) << 16
+            | SearchMaskSse2_(haystack + i + 32, last_off, first, last) << 32
+            | SearchMaskSse2_(haystack + i + 48, last_off, first, last) << 48;
+        if (mask != 0 and SearchTakeMask_(&st, i, mask) == true)
+            return st.hit_c;
+    }
+    for (; haystack_len - i >= 16 + last_off; i += 16) {
+        uint64_t mask = SearchMaskSse2_(haystack + i, last_off, first, last);
+        if (mask != 0 and SearchTakeMask_(&st, i, mask) == true)
+            return st.hit_c;
+    }
+
+    return SearchBytes_(&st, i, haystack_len);
+}
+
+__attribute__((target("avx2"))) static inline uint64_t SearchMaskAvx2_(
+    const char *ptr, size_t last_off, __m256i first, __m256i last)
+{
+    __m256i block_first = _mm256_loadu_si256((const __m256i *)ptr);
+    __m256i block_last = _mm256_loadu_si256((const __m256i *)(ptr + last_off));
+    __m256i hit = _mm256_and_si256(_mm256_cmpeq_epi8(block_first, first), _mm256_cmpeq_epi8(block_last, last));
+    return (uint32_t)_mm256_movemask_epi8(hit);
+}
+
+__attribute__((target("avx2"))) size_t ArgpxSearchAvx2(const char *haystack, size_t haystack_len, const char *needle,
+    size_t needle_len, const char **hit_v, size_t hit_cap)
+{
+    struct SearchState_ st;
+    if (SearchStart_(&st, haystack, haystack_len, needle, needle_len, hit_v, hit_cap) == false)
+        return st.hit_c;
+    // too short for a vector, don't even set one up
+    if (haystack_len < 16 + needle_len - 1)
+        return SearchBytes_(&st, 0, haystack_len);
+
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[needle_len - 1]);
+    size_t last_off = needle_len - 1;
+    size_t i = 0;
+    for (; haystack_len - i >= 64 + last_off; i += 64) {
+        uint64_t mask = SearchMaskAvx2_(haystack + i, last_off, first, last)
+            | SearchMaskAvx2_(haystack + i + 32, last_off, first, last) << 32;
+        if (mask != 0 and SearchTakeMask_(&st, i, mask) == true)
+            return st.hit_c;
+    }
+
+    // less than a block, the SSE2 one still takes 16 bytes
+    const __m128i first_16 = _mm256_castsi256_si128(first);
+    const __m128i last_16 = _mm256_castsi256_si128(last);
+    for (; haystack_len - i >= 16 + last_off; i += 16) {
+        uint64_t mask = SearchMaskSse2_(haystack + i, last_off, first_16, last_16);
+        if (mask != 0 and SearchTakeMask_(&st, i, mask) == true)
+            return st.hit_c;
+    }
+
+    return SearchBytes_(&st, i, haystack_len);
+}
+
+#endif
+
+/*
+    The best kernel of this CPU.
+ */
+ArgpxSearchFn ArgpxSearchResolve(void)
+{
+#ifdef ARGPX_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return ArgpxSearchAvx2;
+    if (__builtin_cpu_supports("sse2"))
+        return ArgpxSearchSse2;
+#endif
+    return ArgpxSearchScalar;
+}
@@ -0,0 +1,43 @@
+#ifndef ARGPX_SEARCH_H_
+#define ARGPX_SEARCH_H_
+
+#include <stdlib.h>
+
+// the hits a caller usually takes at a time, see ArgpxSearchFn
+#define ARGPX_SEARCH_CHUNK 64
+
+/*
+    Find the needles in haystack[0, haystack_len) from left to right, they don't overlap(the next one starts after the
+    last hit). At most hit_cap of them go to hit_v.
+
+    return the count of hits, less than hit_cap: there's no more
+ */
+typedef size_t (*ArgpxSearchFn)(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len,
+    const char **hit_v, size_t hit_cap);
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARGPX_SEARCH_X86 1
+#endif
+
+size_t ArgpxSearchScalar(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len,
+    const char **hit_v, size_t hit_cap);
+#ifdef ARGPX_SEARCH_X86
+size_t ArgpxSearchSse2(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len,
+    const char **hit_v, size_t hit_cap);
+size_t ArgpxSearchAvx2(const char *haystack, size_t haystack_len, const char *needle, size_t needle_len,
+    const char **hit_v, size_t hit_cap);
+#endif
+
+ArgpxSearchFn ArgpxSearchResolve(void);
+
+/*
+    The first needle, NULL: not found.
+ */
+static inline char *ArgpxSearchFirst(
+    ArgpxSearchFn fn, const char *haystack, size_t haystack_len, const char *needle, size_t needle_len)
+{
+    const char *hit;
+    return fn(haystack, haystack_len, needle, needle_len, &hit, 1) == 1 ? (char *)hit : NULL;
+}
+
+#endif
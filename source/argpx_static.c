@@ -0,0 +1,41 @@
+#include <assert.h>
+
+#include "argpx_hash.h"
+#include "argpx_static.h"
+
+/*
+    The hash functions of struct ArgpxStaticIndex, shared by the library and tools/argpx_gen.c.
+    Don't change them without regenerating all the indexes.
+ */
+
+/*
+    The group index is mixed as a value, so the result doesn't depend on the byte order of the build machine.
+ */
+uint32_t ArgpxStaticKeyHash(const char *name, size_t name_len, int group_idx, uint32_t seed)
+{
+    assert(name != NULL);
+
+    uint32_t hash = ArgpxHashFnv1aB32(name, name_len, ARGPX_HASH_FNV1A_32_INIT ^ seed);
+    hash ^= (uint32_t)group_idx;
+    hash *= ARGPX_HASH_FNV1A_32_PRIME;
+
+    return hash;
+}
+
+/*
+    The bucket of a key is key_hash % bucket_c, and its displacement picks the slot.
+    The murmur3 finalizer makes every displacement a different spread of the keys.
+ */
+uint32_t ArgpxStaticSlot(uint32_t key_hash, uint32_t disp, uint32_t slot_c)
+{
+    assert(slot_c > 0);
+
+    uint32_t h = key_hash ^ (disp * 0x9e3779b9u);
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+
+    return h % slot_c;
+}
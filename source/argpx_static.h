@@ -0,0 +1,10 @@
+#ifndef ARGPX_STATIC_H_
+#define ARGPX_STATIC_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+uint32_t ArgpxStaticKeyHash(const char *name, size_t name_len, int group_idx, uint32_t seed);
+uint32_t ArgpxStaticSlot(uint32_t key_hash, uint32_t disp, uint32_t slot_c);
+
+#endif
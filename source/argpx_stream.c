@@ -0,0 +1,120 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <assert.h>
+#include <errno.h>
+#include <iso646.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "argpx_stream.h"
+
+/*
+    The buffer is used like a ring, but every argument stays contiguous in it(so it's a NUL terminated string):
+    when an argument doesn't fit before the end, the read part of it is moved to the front, and the reading goes on
+    there. The bytes in [live, ...) are never moved or overwritten, it's the current argument if the caller keeps it.
+
+    So a flag and the argument after it are both available. The worst case is the flag(L bytes) in the middle, and the
+    next argument(N bytes) fits neither after it nor before it, that needs L + 2N > size. So anything up to a third of
+    the size is safe.
+ */
+
+void ArgpxStreamInit(struct ArgpxStream *stream, int fd, char *buf, size_t size)
+{
+    assert(stream != NULL);
+    assert(buf != NULL);
+    assert(size > 0);
+
+    *stream = (struct ArgpxStream){
+        .fd = fd,
+        .buf = buf,
+        .size = size,
+        .live = 0,
+        .cur = 0,
+        .next = 0,
+        .fill = 0,
+        .eof = false,
+        .status = kArgpxStatusSuccess,
+    };
+}
+
+/*
+    The writable end, the live argument if the data is wrapped to the front.
+ */
+static size_t StreamLimit_(const struct ArgpxStream *stream)
+{
+    return stream->live > stream->next ? stream->live : stream->size;
+}
+
+/*
+    Move the unfinished argument [next, fill) to the front of the buffer.
+
+    return negative: no room, the argument is too long and status is set
+ */
+static int StreamMakeRoom_(struct ArgpxStream *stream)
+{
+    assert(stream != NULL);
+
+    size_t part_len = stream->fill - stream->next;
+    // nothing before it is in use, or the part fits before the live one
+    bool movable = stream->live == stream->next ? stream->next > 0 : stream->live < stream->next and part_len < stream->live;
+    if (movable == false) {
+        stream->status = kArgpxStatusArgumentTooLong;
+        return -1;
+    }
+
+    memmove(stream->buf, stream->buf + stream->next, part_len);
+    if (stream->live == stream->next)
+        stream->live = 0;
+    stream->next = 0;
+    stream->fill = part_len;
+
+    return 0;
+}
+
+/*
+    Get the next argument. If keep_current is true, the last returned one stays valid, otherwise it may be overwritten.
+    The last argument doesn't need a NUL at the end of the input.
+
+    return NULL: the end of the input, or an error if status is not kArgpxStatusSuccess
+ */
+char *ArgpxStreamNext(struct ArgpxStream *stream, bool keep_current)
+{
+    assert(stream != NULL);
+
+    if (stream->status != kArgpxStatusSuccess)
+        return NULL;
+
+    stream->live = keep_current == true ? stream->cur : stream->next;
+
+    while (true) {
+        char *nul = memchr(stream->buf + stream->next, '\0', stream->fill - stream->next);
+        if (nul != NULL) {
+            stream->cur = stream->next;
+            stream->next = nul - stream->buf + 1;
+            return stream->buf + stream->cur;
+        }
+        if (stream->eof == true and stream->next == stream->fill)
+            return NULL;
+
+        if (stream->fill == StreamLimit_(stream) and StreamMakeRoom_(stream) < 0)
+            return NULL;
+
+        // terminate the last one
+        if (stream->eof == true) {
+            stream->buf[stream->fill] = '\0';
+            stream->fill += 1;
+            continue;
+        }
+
+        ssize_t got = read(stream->fd, stream->buf + stream->fill, StreamLimit_(stream) - stream->fill);
+        if (got < 0) {
+            if (errno == EINTR)
+                continue;
+            stream->status = kArgpxStatusIoError;
+            return NULL;
+        }
+        if (got == 0)
+            stream->eof = true;
+        stream->fill += got;
+    }
+}
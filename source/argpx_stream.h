@@ -0,0 +1,32 @@
+#ifndef ARGPX_STREAM_H_
+#define ARGPX_STREAM_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "argpx/argpx.h"
+
+/*
+    NUL-delimited arguments read from a fd into a fixed buffer, see argpx_stream.c.
+ */
+struct ArgpxStream {
+    int fd;
+    char *buf;
+    size_t size;
+    // the first byte still in use
+    size_t live;
+    // the start of the last returned argument
+    size_t cur;
+    // the first byte not returned yet
+    size_t next;
+    // the end of the data read
+    size_t fill;
+    bool eof;
+    // anything else stops the stream
+    enum ArgpxStatus status;
+};
+
+void ArgpxStreamInit(struct ArgpxStream *stream, int fd, char *buf, size_t size);
+char *ArgpxStreamNext(struct ArgpxStream *stream, bool keep_current);
+
+#endif
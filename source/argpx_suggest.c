@@ -0,0 +1,251 @@
+#include <assert.h>
+#include <iso646.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argpx_alloc.h"
+#include "argpx_suggest.h"
+
+/*
+    The "did you mean" of an unknown flag. A BK-tree only works with a metric, so it's the plain Levenshtein
+    distance(a swap of two letters is 2), not the Damerau one.
+
+    A query with radius r computes the distance d to a node, and only goes down the child edges in [d - r, d + r], by
+    the triangle inequality nothing else can be within r. With a few hundred flags it visits a small part of them,
+    and the distance of a node stops early once it's too far to matter.
+ */
+
+// the query stack and the distance row fit in it for most flag sets
+#define SUGGEST_LOCAL_INT 256
+
+/*
+    The Levenshtein distance of a and b, but anything over "bound" is bound + 1.
+    It stops once a whole row is over the bound, the distance is never less than the smallest of a row.
+    row_v has b_len + 1 items.
+ */
+static int SuggestDistance_(const char *a, size_t a_len, const char *b, size_t b_len, int bound, int *row_v)
+{
+    size_t len_diff = a_len > b_len ? a_len - b_len : b_len - a_len;
+    if (len_diff > (size_t)bound)
+        return bound + 1;
+
+    for (size_t j = 0; j <= b_len; j++)
+        row_v[j] = (int)j;
+    for (size_t i = 1; i <= a_len; i++) {
+        // row_v[j - 1] of the last row
+        int diag = row_v[0];
+        row_v[0] = (int)i;
+        int row_min = row_v[0];
+        for (size_t j = 1; j <= b_len; j++) {
+            int replace = diag + (a[i - 1] != b[j - 1]);
+            int remove = row_v[j] + 1;
+            int insert = row_v[j - 1] + 1;
+            diag = row_v[j];
+
+            int best = replace < remove ? replace : remove;
+            row_v[j] = best < insert ? best : insert;
+            if (row_v[j] < row_min)
+                row_min = row_v[j];
+        }
+        if (row_min > bound)
+            return bound + 1;
+    }
+
+    return row_v[b_len] <= bound ? row_v[b_len] : bound + 1;
+}
+
+static void SuggestTreeInsert_(struct ArgpxSuggestTree *tree, const struct ArgpxFlagSet *set,
+    const size_t *name_len_v, int conf_idx, int *row_v)
+{
+    int new_idx = tree->node_c;
+    tree->conf_idx_v[new_idx] = conf_idx;
+    tree->dist_v[new_idx] = 0;
+    tree->reach_v[new_idx] = 0;
+    tree->child_v[new_idx] = -1;
+    tree->sibling_v[new_idx] = -1;
+    if (new_idx == 0) {
+        tree->node_c = 1;
+        return;
+    }
+
+    const char *name = set->ptr[conf_idx].name;
+    size_t name_len = name_len_v[conf_idx];
+    int node = 0;
+    while (true) {
+        int node_conf = tree->conf_idx_v[node];
+        // no bound, the edge needs the exact one
+        int dist
+            = SuggestDistance_(name, name_len, set->ptr[node_conf].name, name_len_v[node_conf], INT_MAX - 1, row_v);
+        // the same name twice in a group, it's suggested once
+        if (dist == 0)
+            return;
+
+        int child = tree->child_v[node];
+        while (child >= 0 and tree->dist_v[child] != dist)
+            child = tree->sibling_v[child];
+        if (child >= 0) {
+            node = child;
+            continue;
+        }
+
+        tree->dist_v[new_idx] = dist;
+        tree->sibling_v[new_idx] = tree->child_v[node];
+        tree->child_v[node] = new_idx;
+        if (tree->reach_v[node] < dist)
+            tree->reach_v[node] = dist;
+        tree->node_c += 1;
+        return;
+    }
+}
+
+/*
+    Build the tree of the flags of group_idx, in the order of the flag set.
+    A group without flags has an empty tree(node_c 0), it needs no free but ArgpxSuggestTreeFree() is fine too.
+
+    return negative: memory error, nothing is left to free
+ */
+int ArgpxSuggestTreeMake(const struct ArgpxAllocator *allocator, const struct ArgpxFlagSet *set,
+    const size_t *name_len_v, int group_idx, struct ArgpxSuggestTree *out_tree)
+{
+    assert(set != NULL);
+    assert(out_tree != NULL);
+
+    *out_tree = (struct ArgpxSuggestTree){.node_c = 0, .conf_idx_v = NULL};
+
+    int cap = 0;
+    size_t name_max_len = 0;
+    for (int i = 0; i < set->count; i++) {
+        if (set->ptr[i].group_idx != group_idx)
+            continue;
+        cap += 1;
+        if (name_max_len < name_len_v[i])
+            name_max_len = name_len_v[i];
+    }
+    if (cap == 0)
+        return 0;
+
+    // all the arrays are one block
+    int *block = ArgpxMemAlloc(allocator, sizeof(int) * cap * 5);
+    int *row_v = ArgpxMemAlloc(allocator, sizeof(int) * (name_max_len + 1));
+    if (block == NULL or row_v == NULL) {
+        ArgpxMemFree(allocator, block);
+        ArgpxMemFree(allocator, row_v);
+        return -1;
+    }
+
+    struct ArgpxSuggestTree *tree = out_tree;
+    tree->conf_idx_v = block;
+    tree->dist_v = block + cap;
+    tree->reach_v = block + cap * 2;
+    tree->child_v = block + cap * 3;
+    tree->sibling_v = block + cap * 4;
+    tree->name_max_len = name_max_len;
+    for (int i = 0; i < set->count; i++) {
+        if (set->ptr[i].group_idx == group_idx)
+            SuggestTreeInsert_(tree, set, name_len_v, i, row_v);
+    }
+
+    ArgpxMemFree(allocator, row_v);
+    return 0;
+}
+
+void ArgpxSuggestTreeFree(const struct ArgpxAllocator *allocator, struct ArgpxSuggestTree *tree)
+{
+    assert(tree != NULL);
+
+    ArgpxMemFree(allocator, tree->conf_idx_v);
+    *tree = (struct ArgpxSuggestTree){.node_c = 0, .conf_idx_v = NULL};
+}
+
+/*
+    Put a found one into out_v, sorted by the distance and then the order of the flag set. Only the first k are kept.
+
+    return the new count
+ */
+int ArgpxSuggestTake(struct ArgpxSuggestion *out_v, int found_c, int k, const struct ArgpxFlag *conf, int dist)
+{
+    int pos = found_c;
+    while (pos > 0
+        and (out_v[pos - 1].distance > dist or (out_v[pos - 1].distance == dist and out_v[pos - 1].conf > conf)))
+        pos -= 1;
+    if (pos >= k)
+        return found_c;
+
+    int last = found_c < k ? found_c : k - 1;
+    memmove(&out_v[pos + 1], &out_v[pos], sizeof(struct ArgpxSuggestion) * (last - pos));
+    out_v[pos] = (struct ArgpxSuggestion){.conf = conf, .distance = dist};
+    return found_c < k ? found_c + 1 : k;
+}
+
+/*
+    The k nearest names of the tree within max_distance, the nearest first.
+    Once out_v is full, the radius shrinks to the farthest one in it.
+
+    return the count in out_v, negative: memory error
+ */
+int ArgpxSuggestTreeQuery(const struct ArgpxAllocator *allocator, const struct ArgpxSuggestTree *tree,
+    const struct ArgpxFlagSet *set, const size_t *name_len_v, const char *name, size_t name_len, int max_distance,
+    struct ArgpxSuggestion *out_v, int k)
+{
+    assert(tree != NULL);
+    assert(set != NULL);
+    assert(name != NULL);
+    assert(k <= 0 or out_v != NULL);
+
+    if (tree->node_c == 0 or k <= 0 or max_distance < 0)
+        return 0;
+
+    // every node is pushed once at most
+    int local_v[SUGGEST_LOCAL_INT];
+    size_t need = (size_t)tree->node_c + tree->name_max_len + 1;
+    int *buf = need <= SUGGEST_LOCAL_INT ? local_v : ArgpxMemAlloc(allocator, sizeof(int) * need);
+    if (buf == NULL)
+        return -1;
+    int *stack_v = buf;
+    int *row_v = buf + tree->node_c;
+
+    int stack_c = 0;
+    stack_v[stack_c++] = 0;
+    int found_c = 0;
+    int radius = max_distance;
+    while (stack_c > 0) {
+        int node = stack_v[--stack_c];
+        int conf_idx = tree->conf_idx_v[node];
+        // past reach + radius no child is visited, so the exact distance isn't needed
+        int dist = SuggestDistance_(
+            name, name_len, set->ptr[conf_idx].name, name_len_v[conf_idx], radius + tree->reach_v[node], row_v);
+        if (dist <= radius) {
+            found_c = ArgpxSuggestTake(out_v, found_c, k, &set->ptr[conf_idx], dist);
+            // a tie can still replace a later flag
+            if (found_c == k)
+                radius = out_v[k - 1].distance;
+        }
+
+        for (int child = tree->child_v[node]; child >= 0; child = tree->sibling_v[child]) {
+            if (abs(tree->dist_v[child] - dist) <= radius)
+                stack_v[stack_c++] = child;
+        }
+    }
+
+    if (buf != local_v)
+        ArgpxMemFree(allocator, buf);
+    return found_c;
+}
+
+/*
+    The default radius of a name, about one typo for every 3 letters. It's always less than the length, or any
+    short name would be "close" to every other short one.
+ */
+int ArgpxSuggestDistanceMax(size_t name_len)
+{
+    if (name_len == 0)
+        return -1;
+
+    size_t max = 1 + name_len / 3;
+    if (max > 4)
+        max = 4;
+    if (max >= name_len)
+        max = name_len - 1;
+    return (int)max;
+}
@@ -0,0 +1,35 @@
+#ifndef ARGPX_SUGGEST_H_
+#define ARGPX_SUGGEST_H_
+
+#include <stdlib.h>
+
+#include "argpx/argpx.h"
+
+/*
+    A BK-tree of the flag names of one group, for the "did you mean" of an unknown flag.
+    Node 0 is the root. Everything under the child edge d of a node is exactly d(the edit distance) away from it.
+ */
+struct ArgpxSuggestTree {
+    int node_c;
+    // the index of conf.ptr of each node
+    int *conf_idx_v;
+    // the distance to the parent
+    int *dist_v;
+    // the largest dist_v of the children
+    int *reach_v;
+    // the first child and the next sibling, negative: none
+    int *child_v;
+    int *sibling_v;
+    size_t name_max_len;
+};
+
+int ArgpxSuggestTreeMake(const struct ArgpxAllocator *allocator, const struct ArgpxFlagSet *set,
+    const size_t *name_len_v, int group_idx, struct ArgpxSuggestTree *out_tree);
+void ArgpxSuggestTreeFree(const struct ArgpxAllocator *allocator, struct ArgpxSuggestTree *tree);
+int ArgpxSuggestTreeQuery(const struct ArgpxAllocator *allocator, const struct ArgpxSuggestTree *tree,
+    const struct ArgpxFlagSet *set, const size_t *name_len_v, const char *name, size_t name_len, int max_distance,
+    struct ArgpxSuggestion *out_v, int k);
+int ArgpxSuggestDistanceMax(size_t name_len);
+int ArgpxSuggestTake(struct ArgpxSuggestion *out_v, int found_c, int k, const struct ArgpxFlag *conf, int dist);
+
+#endif
@@ -0,0 +1,256 @@
+#include <assert.h>
+#include <iso646.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "argpx/argpx.h"
+#include "argpx_token.h"
+
+#ifdef ARGPX_TOKEN_X86
+#include <immintrin.h>
+#endif
+
+/*
+    The tokenizers(this one and the response files) only slow down on a few bytes: whitespace, quotes and the backslash.
+    The rest of a token is found 32, 16 or 8 bytes at a time, whichever the CPU of the runtime has. Like the search
+    kernels(argpx_search.c), the vector ones are built with the target attribute, not with the flags of the library.
+ */
+
+// the bytes below 0x21 and the quotes and the backslash, the same set as the vector filters
+static const bool token_special_v[UCHAR_MAX + 1] = {
+    [0x00] = true, [0x01] = true, [0x02] = true, [0x03] = true, [0x04] = true, [0x05] = true, [0x06] = true,
+    [0x07] = true, [0x08] = true, [0x09] = true, [0x0a] = true, [0x0b] = true, [0x0c] = true, [0x0d] = true,
+    [0x0e] = true, [0x0f] = true, [0x10] = true, [0x11] = true, [0x12] = true, [0x13] = true, [0x14] = true,
+    [0x15] = true, [0x16] = true, [0x17] = true, [0x18] = true, [0x19] = true, [0x1a] = true, [0x1b] = true,
+    [0x1c] = true, [0x1d] = true, [0x1e] = true, [0x1f] = true, [0x20] = true, ['\''] = true, ['"'] = true,
+    ['\\'] = true,
+};
+
+/*
+    Some byte of the 8 might be special, it's a bitwise filter like the "has zero byte" trick.
+    It may pass a few more bytes(the borrow goes across bytes), the table decides them.
+ */
+static bool WordMaybeSpecial_(uint64_t word)
+{
+    const uint64_t ones = UINT64_MAX / 255;
+    const uint64_t highs = ones * 0x80;
+    uint64_t below = (word - ones * 0x21) & ~word;
+    uint64_t dquote = (word ^ ones * '"') - ones;
+    uint64_t squote = (word ^ ones * '\'') - ones;
+    uint64_t escape = (word ^ ones * '\\') - ones;
+    return ((below | (dquote & ~(word ^ ones * '"')) | (squote & ~(word ^ ones * '\''))
+                | (escape & ~(word ^ ones * '\\')))
+               & highs)
+        != 0;
+}
+
+/*
+    The word and byte loops, the vector ones end with it.
+ */
+static size_t PlainLenScalar_(const char *str, size_t len)
+{
+    size_t i = 0;
+    for (; len - i >= 8; i += 8) {
+        uint64_t word;
+        memcpy(&word, str + i, sizeof(word));
+        if (WordMaybeSpecial_(word) == true)
+            break;
+    }
+
+    while (i < len and token_special_v[(unsigned char)str[i]] == false)
+        i++;
+    return i;
+}
+
+#ifdef ARGPX_TOKEN_X86
+
+// a vector hit is exact, the word filter is not and leaves it to the byte loop
+
+__attribute__((target("sse2"))) static size_t PlainLenSse2_(const char *str, size_t len)
+{
+    const __m128i space_16 = _mm_set1_epi8(0x20);
+    const __m128i squote_16 = _mm_set1_epi8('\'');
+    const __m128i dquote_16 = _mm_set1_epi8('"');
+    const __m128i escape_16 = _mm_set1_epi8('\\');
+    size_t i = 0;
+    for (; len - i >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(str + i));
+        // unsigned v <= 0x20
+        __m128i hit = _mm_cmpeq_epi8(_mm_min_epu8(v, space_16), v);
+        hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, squote_16));
+        hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, dquote_16));
+        hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, escape_16));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(hit);
+        if (mask != 0)
+            return i + (size_t)__builtin_ctz(mask);
+    }
+
+    return i + PlainLenScalar_(str + i, len - i);
+}
+
+__attribute__((target("avx2"))) static size_t PlainLenAvx2_(const char *str, size_t len)
+{
+    const __m256i space_32 = _mm256_set1_epi8(0x20);
+    const __m256i squote_32 = _mm256_set1_epi8('\'');
+    const __m256i dquote_32 = _mm256_set1_epi8('"');
+    const __m256i escape_32 = _mm256_set1_epi8('\\');
+    size_t i = 0;
+    for (; len - i >= 32; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(str + i));
+        __m256i hit = _mm256_cmpeq_epi8(_mm256_min_epu8(v, space_32), v);
+        hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, squote_32));
+        hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, dquote_32));
+        hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, escape_32));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(hit);
+        if (mask != 0)
+            return i + (size_t)__builtin_ctz(mask);
+    }
+
+    // less than 32 bytes, the SSE2 one still takes 16
+    return i + PlainLenSse2_(str + i, len - i);
+}
+
+#endif
+
+/*
+    The length of the leading part of str without special bytes.
+    The CPU is asked every time, it's only a load of what libgcc found at the startup.
+ */
+size_t ArgpxTokenPlainLen(const char *str, size_t len)
+{
+    assert(str != NULL);
+
+#ifdef ARGPX_TOKEN_X86
+    if (__builtin_cpu_supports("avx2"))
+        return PlainLenAvx2_(str, len);
+    if (__builtin_cpu_supports("sse2"))
+        return PlainLenSse2_(str, len);
+#endif
+    return PlainLenScalar_(str, len);
+}
+
+void ArgpxTokenizerInit(struct ArgpxTokenizer *tok, char *line)
+{
+    assert(tok != NULL);
+    assert(line != NULL);
+
+    *tok = (struct ArgpxTokenizer){
+        .pos = line,
+        .end = line + strlen(line),
+        .status = kArgpxStatusSuccess,
+    };
+}
+
+static bool TokenIsSeparator_(char c)
+{
+    return c == ' ' or c == '\t' or c == '\n' or c == '\v' or c == '\f' or c == '\r';
+}
+
+/*
+    Copy the plain bytes from the read position to the write position, return the read position after them.
+ */
+static char *TokenCopyPlain_(char **write_ptr, char *read_ptr, const char *end)
+{
+    size_t plain_len = ArgpxTokenPlainLen(read_ptr, end - read_ptr);
+    if (*write_ptr != read_ptr)
+        memmove(*write_ptr, read_ptr, plain_len);
+    *write_ptr += plain_len;
+    return read_ptr + plain_len;
+}
+
+/*
+    Cut the next token of the line in place, the quotes and escapes are removed by moving the rest of it forward.
+    The rules are a subset of POSIX sh:
+    - whitespace separates the tokens
+    - '...' keeps everything, a backslash too
+    - "..." keeps everything, except that a backslash escapes $ ` " \ and the newline
+    - a backslash out of the quotes takes the next byte as it is
+    - a backslash and a newline are removed, out of the quotes or in "..."
+    Nothing is expanded, "$HOME" and "*" stay as they are.
+
+    return NULL: no more token, or kArgpxStatusUnclosedQuote in status
+ */
+char *ArgpxTokenizerNext(struct ArgpxTokenizer *tok)
+{
+    assert(tok != NULL);
+
+    if (tok->status != kArgpxStatusSuccess)
+        return NULL;
+
+    char *read_ptr = tok->pos;
+    char *end = tok->end;
+    while (read_ptr < end and TokenIsSeparator_(*read_ptr) == true)
+        read_ptr++;
+    if (read_ptr == end) {
+        tok->pos = read_ptr;
+        return NULL;
+    }
+
+    char *token = read_ptr;
+    char *write_ptr = read_ptr;
+    while (true) {
+        read_ptr = TokenCopyPlain_(&write_ptr, read_ptr, end);
+        if (read_ptr == end)
+            break;
+
+        char c = *read_ptr;
+        if (TokenIsSeparator_(c) == true) {
+            read_ptr++;
+            break;
+        } else if (c == '\\') {
+            if (end - read_ptr == 1) {
+                // nothing to escape, it's just a backslash
+                *write_ptr++ = c;
+                read_ptr++;
+            } else {
+                if (read_ptr[1] != '\n')
+                    *write_ptr++ = read_ptr[1];
+                read_ptr += 2;
+            }
+        } else if (c == '\'') {
+            char *close = memchr(read_ptr + 1, '\'', end - read_ptr - 1);
+            if (close == NULL) {
+                tok->status = kArgpxStatusUnclosedQuote;
+                return NULL;
+            }
+            size_t quoted_len = close - read_ptr - 1;
+            memmove(write_ptr, read_ptr + 1, quoted_len);
+            write_ptr += quoted_len;
+            read_ptr = close + 1;
+        } else if (c == '"') {
+            read_ptr++;
+            while (true) {
+                read_ptr = TokenCopyPlain_(&write_ptr, read_ptr, end);
+                if (read_ptr == end) {
+                    tok->status = kArgpxStatusUnclosedQuote;
+                    return NULL;
+                }
+                c = *read_ptr;
+                if (c == '"') {
+                    read_ptr++;
+                    break;
+                }
+                if (c == '\\' and end - read_ptr > 1 and strchr("$`\"\\\n", read_ptr[1]) != NULL) {
+                    if (read_ptr[1] != '\n')
+                        *write_ptr++ = read_ptr[1];
+                    read_ptr += 2;
+                } else {
+                    // whitespace, a single quote or a lone backslash
+                    *write_ptr++ = c;
+                    read_ptr++;
+                }
+            }
+        } else {
+            // the other control bytes are just bytes
+            *write_ptr++ = c;
+            read_ptr++;
+        }
+    }
+
+    // write_ptr < read_ptr if a separator is consumed, otherwise "end" is the NUL of the line
+    *write_ptr = '\0';
+    tok->pos = read_ptr;
+    return token;
+}
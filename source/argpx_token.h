@@ -0,0 +1,13 @@
+#ifndef ARGPX_TOKEN_H_
+#define ARGPX_TOKEN_H_
+
+#include <stdlib.h>
+
+// the vector kernels are GNU C, see argpx_token.c
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARGPX_TOKEN_X86 1
+#endif
+
+size_t ArgpxTokenPlainLen(const char *str, size_t len);
+
+#endif
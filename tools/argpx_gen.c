@@ -0,0 +1,295 @@
+/*
+    Generate a struct ArgpxStaticIndex from a flag spec, it's a CHD(compress, hash and displace) minimal perfect hash.
+
+    usage: argpx_gen [-n symbol_name] <spec> <output.c>
+
+    The spec has one flag a line, "<group_idx> <name>", in the same order as the ArgpxFlagAppend() calls.
+    Empty lines and the lines start with '#' are skipped.
+    Without -n, the symbol name is made from the spec file name, like "cli.flags" -> "cli_flags_index".
+ */
+
+#include <ctype.h>
+#include <iso646.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argpx_static.h"
+
+// average keys in a bucket
+#define GEN_BUCKET_LOAD 4
+// tries of a bucket, then a new seed is tried
+#define GEN_DISP_MAX (1u << 20)
+#define GEN_SEED_MAX 64
+
+struct GenKey_ {
+    int group_idx;
+    char *name;
+    size_t name_len;
+    uint32_t hash;
+};
+
+struct GenBucket_ {
+    uint32_t idx;
+    // the keys of this bucket
+    int key_c;
+    int *key_idx_v;
+};
+
+static void Die_(const char *msg, const char *detail)
+{
+    fprintf(stderr, "argpx_gen: %s%s\n", msg, detail != NULL ? detail : "");
+    exit(EXIT_FAILURE);
+}
+
+static void *Alloc_(size_t size)
+{
+    void *ptr = malloc(size > 0 ? size : 1);
+    if (ptr == NULL)
+        Die_("out of memory", NULL);
+    return ptr;
+}
+
+static int KeyCompare_(const void *a_in, const void *b_in)
+{
+    const struct GenKey_ *a = *(struct GenKey_ *const *)a_in;
+    const struct GenKey_ *b = *(struct GenKey_ *const *)b_in;
+    if (a->group_idx != b->group_idx)
+        return a->group_idx < b->group_idx ? -1 : 1;
+    return strcmp(a->name, b->name);
+}
+
+/*
+    return the count of keys
+ */
+static int ReadSpec_(const char *path, struct GenKey_ **out_key_v)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+        Die_("can't open the spec: ", path);
+
+    int key_c = 0;
+    int key_cap = 64;
+    struct GenKey_ *key_v = Alloc_(sizeof(struct GenKey_) * key_cap);
+
+    char line[1024];
+    int line_no = 0;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        line_no += 1;
+        char *start = line;
+        while (isspace((unsigned char)*start))
+            start++;
+        if (*start == '\0' or *start == '#')
+            continue;
+
+        int group_idx;
+        char name[sizeof(line)];
+        if (sscanf(start, "%d %1023s", &group_idx, name) != 2 or group_idx < 0) {
+            fprintf(stderr, "argpx_gen: %s:%d: expect \"<group_idx> <name>\"\n", path, line_no);
+            exit(EXIT_FAILURE);
+        }
+
+        if (key_c == key_cap) {
+            key_cap *= 2;
+            key_v = realloc(key_v, sizeof(struct GenKey_) * key_cap);
+            if (key_v == NULL)
+                Die_("out of memory", NULL);
+        }
+        size_t name_len = strlen(name);
+        key_v[key_c] = (struct GenKey_){.group_idx = group_idx, .name = Alloc_(name_len + 1), .name_len = name_len};
+        memcpy(key_v[key_c].name, name, name_len + 1);
+        key_c += 1;
+    }
+    fclose(file);
+
+    // same as the flag table, the same name in the same group can't be found twice
+    struct GenKey_ **sorted_v = Alloc_(sizeof(struct GenKey_ *) * key_c);
+    for (int i = 0; i < key_c; i++)
+        sorted_v[i] = &key_v[i];
+    qsort(sorted_v, key_c, sizeof(struct GenKey_ *), KeyCompare_);
+    for (int i = 1; i < key_c; i++) {
+        if (KeyCompare_(&sorted_v[i - 1], &sorted_v[i]) == 0)
+            Die_("duplicate flag in the same group: ", sorted_v[i]->name);
+    }
+    free(sorted_v);
+
+    *out_key_v = key_v;
+    return key_c;
+}
+
+static int BucketCompare_(const void *a_in, const void *b_in)
+{
+    const struct GenBucket_ *a = a_in;
+    const struct GenBucket_ *b = b_in;
+    // the big buckets first, they are the hard ones
+    if (a->key_c != b->key_c)
+        return b->key_c - a->key_c;
+    return a->idx < b->idx ? -1 : (a->idx > b->idx ? 1 : 0);
+}
+
+/*
+    Place all the keys with this seed.
+
+    return negative: some bucket has no displacement works, try another seed
+ */
+static int Build_(struct GenKey_ *key_v, int key_c, uint32_t seed, uint32_t bucket_c, uint32_t *disp_v, int32_t *slot_v)
+{
+    for (int i = 0; i < key_c; i++)
+        key_v[i].hash = ArgpxStaticKeyHash(key_v[i].name, key_v[i].name_len, key_v[i].group_idx, seed);
+
+    struct GenBucket_ *bucket_v = Alloc_(sizeof(struct GenBucket_) * bucket_c);
+    int *key_idx_pool = Alloc_(sizeof(int) * key_c);
+    for (uint32_t b = 0; b < bucket_c; b++)
+        bucket_v[b] = (struct GenBucket_){.idx = b, .key_c = 0};
+    for (int i = 0; i < key_c; i++)
+        bucket_v[key_v[i].hash % bucket_c].key_c += 1;
+    // counting sort the keys into the buckets
+    int offset = 0;
+    for (uint32_t b = 0; b < bucket_c; b++) {
+        bucket_v[b].key_idx_v = key_idx_pool + offset;
+        offset += bucket_v[b].key_c;
+        bucket_v[b].key_c = 0;
+    }
+    for (int i = 0; i < key_c; i++) {
+        struct GenBucket_ *bucket = &bucket_v[key_v[i].hash % bucket_c];
+        bucket->key_idx_v[bucket->key_c] = i;
+        bucket->key_c += 1;
+    }
+    qsort(bucket_v, bucket_c, sizeof(struct GenBucket_), BucketCompare_);
+
+    for (int i = 0; i < key_c; i++)
+        slot_v[i] = -1;
+    for (uint32_t b = 0; b < bucket_c; b++)
+        disp_v[b] = 0;
+
+    int ret = 0;
+    uint32_t *try_v = Alloc_(sizeof(uint32_t) * key_c);
+    for (uint32_t b = 0; b < bucket_c and bucket_v[b].key_c > 0; b++) {
+        struct GenBucket_ *bucket = &bucket_v[b];
+
+        bool placed = false;
+        for (uint32_t disp = 0; disp < GEN_DISP_MAX and placed == false; disp++) {
+            placed = true;
+            for (int k = 0; k < bucket->key_c and placed == true; k++) {
+                try_v[k] = ArgpxStaticSlot(key_v[bucket->key_idx_v[k]].hash, disp, (uint32_t)key_c);
+                if (slot_v[try_v[k]] >= 0)
+                    placed = false;
+                // the keys of the same bucket can't take the same slot too
+                for (int prev = 0; prev < k and placed == true; prev++) {
+                    if (try_v[prev] == try_v[k])
+                        placed = false;
+                }
+            }
+            if (placed == true) {
+                disp_v[bucket->idx] = disp;
+                for (int k = 0; k < bucket->key_c; k++)
+                    slot_v[try_v[k]] = bucket->key_idx_v[k];
+            }
+        }
+        if (placed == false) {
+            ret = -1;
+            break;
+        }
+    }
+
+    free(try_v);
+    free(key_idx_pool);
+    free(bucket_v);
+    return ret;
+}
+
+static void WriteOutput_(const char *path, const char *spec_path, const char *symbol, struct GenKey_ *key_v,
+    int key_c, uint32_t seed, uint32_t bucket_c, const uint32_t *disp_v, const int32_t *slot_v)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+        Die_("can't open the output: ", path);
+
+    fprintf(file, "// generated by argpx_gen from %s, don't edit\n", spec_path);
+    fprintf(file, "//\n// the flags, in the order of ArgpxFlagAppend():\n");
+    for (int i = 0; i < key_c; i++)
+        fprintf(file, "//   %d: group %d, \"%s\"\n", i, key_v[i].group_idx, key_v[i].name);
+    fprintf(file, "//\n// extern const struct ArgpxStaticIndex %s;\n\n", symbol);
+    fprintf(file, "#include \"argpx/argpx.h\"\n\n");
+
+    fprintf(file, "static const uint32_t %s_disp_v_[%u] = {", symbol, bucket_c);
+    for (uint32_t b = 0; b < bucket_c; b++)
+        fprintf(file, "%s%s%u", b > 0 ? "," : "", b % 12 == 0 ? "\n    " : " ", disp_v[b]);
+    fprintf(file, "\n};\n\n");
+
+    fprintf(file, "static const int32_t %s_slot_v_[%d] = {", symbol, key_c);
+    for (int i = 0; i < key_c; i++)
+        fprintf(file, "%s%s%d", i > 0 ? "," : "", i % 12 == 0 ? "\n    " : " ", slot_v[i]);
+    fprintf(file, "\n};\n\n");
+
+    fprintf(file, "const struct ArgpxStaticIndex %s = {\n", symbol);
+    fprintf(file, "    .seed = %uu,\n", seed);
+    fprintf(file, "    .bucket_c = %u,\n", bucket_c);
+    fprintf(file, "    .disp_v = %s_disp_v_,\n", symbol);
+    fprintf(file, "    .flag_c = %d,\n", key_c);
+    fprintf(file, "    .slot_v = %s_slot_v_,\n", symbol);
+    fprintf(file, "};\n");
+
+    if (fclose(file) != 0)
+        Die_("can't write the output: ", path);
+}
+
+/*
+    "dir/cli.flags" -> "cli_flags_index"
+ */
+static char *SymbolFromPath_(const char *path)
+{
+    const char *base = strrchr(path, '/');
+    base = base != NULL ? base + 1 : path;
+
+    size_t len = strlen(base);
+    char *symbol = Alloc_(len + sizeof("_index") + 1);
+    size_t out = 0;
+    if (isdigit((unsigned char)base[0]))
+        symbol[out++] = '_';
+    for (size_t i = 0; i < len; i++)
+        symbol[out++] = isalnum((unsigned char)base[i]) ? base[i] : '_';
+    memcpy(symbol + out, "_index", sizeof("_index"));
+
+    return symbol;
+}
+
+int main(int argc, char **argv)
+{
+    char *symbol = NULL;
+    int arg_idx = 1;
+    if (arg_idx + 1 < argc and strcmp(argv[arg_idx], "-n") == 0) {
+        symbol = argv[arg_idx + 1];
+        arg_idx += 2;
+    }
+    if (argc - arg_idx != 2) {
+        fprintf(stderr, "usage: argpx_gen [-n symbol_name] <spec> <output.c>\n");
+        return EXIT_FAILURE;
+    }
+    const char *spec_path = argv[arg_idx];
+    const char *out_path = argv[arg_idx + 1];
+    if (symbol == NULL)
+        symbol = SymbolFromPath_(spec_path);
+
+    struct GenKey_ *key_v;
+    int key_c = ReadSpec_(spec_path, &key_v);
+    if (key_c == 0)
+        Die_("no flag in the spec: ", spec_path);
+
+    uint32_t bucket_c = (uint32_t)key_c / GEN_BUCKET_LOAD + 1;
+    uint32_t *disp_v = Alloc_(sizeof(uint32_t) * bucket_c);
+    int32_t *slot_v = Alloc_(sizeof(int32_t) * key_c);
+
+    uint32_t seed = 0;
+    while (Build_(key_v, key_c, seed, bucket_c, disp_v, slot_v) < 0) {
+        seed += 1;
+        if (seed == GEN_SEED_MAX)
+            Die_("can't find a perfect hash for the spec: ", spec_path);
+    }
+
+    WriteOutput_(out_path, spec_path, symbol, key_v, key_c, seed, bucket_c, disp_v, slot_v);
+
+    return EXIT_SUCCESS;
+}